@@ -175,13 +175,9 @@ int SGAxisODFWidget::getOrientationData(StatsData* statsData, unsigned int phase
     e2s[i] = e2s[i] * M_PI / 180.0;
     e3s[i] = e3s[i] * M_PI / 180.0;
   }
-  size_t numEntries = e1s.size();
 
-  QVector<float> aodf;
-  aodf.resize(OrthoRhombicOps::k_OdfSize);
-  Texture::CalculateOrthoRhombicODFData(e1s.data(), e2s.data(), e3s.data(),
-                                        weights.data(), sigmas.data(), true,
-                                        aodf.data(), numEntries);
+  // The axis ODF always uses the OrthoRhombic symmetry
+  QVector<float> aodf = m_TextureCache.getODF(Ebsd::CrystalStructure::OrthoRhombic, e1s, e2s, e3s, weights, sigmas);
   if (aodf.size() > 0)
   {
     FloatArrayType::Pointer aodfData = FloatArrayType::FromPointer(aodf.data(), aodf.size(), DREAM3D::StringConstants::AxisOrientation);
@@ -444,7 +440,6 @@ void SGAxisODFWidget::on_m_CalculateODFBtn_clicked()
     e2s[i] = e2s[i] * M_PI / 180.0;
     e3s[i] = e3s[i] * M_PI / 180.0;
   }
-  size_t numEntries = e1s.size();
 
   int imageSize = 226;
   int lamberSize = 22;
@@ -453,11 +448,16 @@ void SGAxisODFWidget::on_m_CalculateODFBtn_clicked()
   QVector<size_t> dims(1, 3);
   FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(npoints, dims, "Eulers");
 
-  odf.resize(OrthoRhombicOps::k_OdfSize);
-
-  Texture::CalculateOrthoRhombicODFData(e1s.data(), e2s.data(), e3s.data(),
-                                        weights.data(), sigmas.data(), true,
-                                        odf.data(), numEntries);
+  // The ODF and the pole figures are only recalculated when the texture changed
+  odf = m_TextureCache.getODF(Ebsd::CrystalStructure::OrthoRhombic, e1s, e2s, e3s, weights, sigmas);
+  QVector<float> settings;
+  settings << imageSize << lamberSize << npoints;
+  QImage image;
+  if (m_TextureCache.getPoleFigure(settings, image) == true)
+  {
+    m_PoleFigureLabel->setPixmap(QPixmap::fromImage(image));
+    return;
+  }
 
   err = StatsGen::GenAxisODFPlotData(odf.data(), eulers->getPointer(0), npoints);
 
@@ -475,7 +475,8 @@ void SGAxisODFWidget::on_m_CalculateODFBtn_clicked()
     return;
   }
 
-  QImage image = PoleFigureImageUtilities::Create3ImagePoleFigure(figures[0].get(), figures[1].get(), figures[2].get(), config);
+  image = PoleFigureImageUtilities::Create3ImagePoleFigure(figures[0].get(), figures[1].get(), figures[2].get(), config);
+  m_TextureCache.setPoleFigure(settings, image);
   m_PoleFigureLabel->setPixmap(QPixmap::fromImage(image));
 
 }
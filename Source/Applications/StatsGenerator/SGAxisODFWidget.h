@@ -62,6 +62,8 @@
 
 #include "QtSupport/PoleFigureImageUtilities.h"
 
+#include "StatsGenerator/TexturePreviewCache.h"
+
 class SGODFTableModel;
 class StatsGenMDFWidget;
 
@@ -123,6 +125,7 @@ class SGAxisODFWidget : public QWidget, private Ui::SGAxisODFWidget
     QwtPlotCurve*           m_CircleGrid;
     QwtPlotCurve*           m_RotCross0;
     QwtPlotCurve*           m_RotCross1;
+    TexturePreviewCache     m_TextureCache;
 
     QString m_OpenDialogLastDirectory; // Must be last in the list
     SGAxisODFWidget(const SGAxisODFWidget&); // Copy Constructor Not Implemented
@@ -164,10 +164,8 @@ void StatsGenMDFWidget::updateMDFPlot(QVector<float>& odf)
   QVector<float> y;
   if ( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructure )
   {
-    // Allocate a new vector to hold the mdf data
-    QVector<float> mdf(CubicOps::k_MdfSize);
     // Calculate the MDF Data using the ODF data and the rows from the MDF Table model
-    Texture::CalculateMDFData<float, CubicOps>(angles.data(), axes.data(), weights.data(), odf.data(), mdf.data(), angles.size());
+    QVector<float> mdf = m_TextureCache.getMDF(m_CrystalStructure, odf, angles, axes, weights);
     // Now generate the actual XY point data that gets plotted.
     size_t npoints = 13;
     x.resize(npoints);
@@ -180,10 +178,8 @@ void StatsGenMDFWidget::updateMDFPlot(QVector<float>& odf)
   }
   else if ( Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructure )
   {
-    // Allocate a new vector to hold the mdf data
-    QVector<float> mdf(HexagonalOps::k_MdfSize);
     // Calculate the MDF Data using the ODF data and the rows from the MDF Table model
-    Texture::CalculateMDFData<float, HexagonalOps>(angles.data(), axes.data(), weights.data(), odf.data(), mdf.data(), angles.size());
+    QVector<float> mdf = m_TextureCache.getMDF(m_CrystalStructure, odf, angles, axes, weights);
     // Now generate the actual XY point data that gets plotted.
     size_t npoints = 20;
     x.resize(npoints);
@@ -242,22 +238,10 @@ QVector<float> StatsGenMDFWidget::generateODFData()
     e2s[i] = e2s[i] * M_PI / 180.0;
     e3s[i] = e3s[i] * M_PI / 180.0;
   }
-  size_t numEntries = e1s.size();
 
-  if ( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructure)
+  if ( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructure || Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructure)
   {
-
-    odf.resize(CubicOps::k_OdfSize);
-    Texture::CalculateCubicODFData(e1s.data(), e2s.data(), e3s.data(),
-                                   weights.data(), sigmas.data(), true,
-                                   odf.data(), numEntries);
-  }
-  else if ( Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructure)
-  {
-    odf.resize(HexagonalOps::k_OdfSize);
-    Texture::CalculateHexODFData(e1s.data(), e2s.data(), e3s.data(),
-                                 weights.data(), sigmas.data(), true,
-                                 odf.data(), numEntries);
+    odf = m_TextureCache.getODF(m_CrystalStructure, e1s, e2s, e3s, weights, sigmas);
   }
   return odf;
 }
@@ -396,17 +380,9 @@ int StatsGenMDFWidget::getMisorientationData(StatsData* statsData, unsigned int
 
   //unsigned long long int nElements = 0;
 
-  if ( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructure)
-  {
-    mdf.resize(CubicOps::k_MdfSize);
-    Texture::CalculateMDFData<float, CubicOps>(angles.data(), axes.data(), weights.data(), odf.data(), mdf.data(), angles.size());
-    //nElements = 18 * 18 * 18;
-  }
-  else if ( Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructure)
+  if ( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructure || Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructure)
   {
-    mdf.resize(HexagonalOps::k_MdfSize);
-    Texture::CalculateMDFData<float, HexagonalOps>(angles.data(), axes.data(), weights.data(), odf.data(), mdf.data(), angles.size());
-    //nElements = 36 * 36 * 12;
+    mdf = m_TextureCache.getMDF(m_CrystalStructure, odf, angles, axes, weights);
   }
   if (mdf.size() > 0)
   {
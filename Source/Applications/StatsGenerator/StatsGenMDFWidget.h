@@ -49,6 +49,7 @@
 #include "DREAM3DLib/StatsData/PrecipitateStatsData.h"
 #include "DREAM3DLib/StatsData/TransformationStatsData.h"
 #include "StatsGenerator/TableModels/SGODFTableModel.h"
+#include "StatsGenerator/TexturePreviewCache.h"
 
 
 class SGMDFTableModel;
@@ -96,6 +97,7 @@ class StatsGenMDFWidget : public QWidget, private Ui::StatsGenMDFWidget
   private:
     SGMDFTableModel* m_MDFTableModel;
     QwtPlotCurve*    m_PlotCurve;
+    TexturePreviewCache m_TextureCache;
 
     QString m_OpenDialogLastDirectory; // Must be last in the list
     StatsGenMDFWidget(const StatsGenMDFWidget&); // Copy Constructor Not Implemented
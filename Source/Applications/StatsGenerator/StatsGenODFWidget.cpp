@@ -197,21 +197,10 @@ int StatsGenODFWidget::getOrientationData(StatsData* statsData, unsigned int pha
     e2s[i] = e2s[i] * M_PI / 180.0;
     e3s[i] = e3s[i] * M_PI / 180.0;
   }
-  size_t numEntries = e1s.size();
 
-  if ( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructure)
+  if ( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructure || Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructure)
   {
-    odf.resize(CubicOps::k_OdfSize);
-    Texture::CalculateCubicODFData(e1s.data(), e2s.data(), e3s.data(),
-                                   weights.data(), sigmas.data(), true,
-                                   odf.data(), numEntries);
-  }
-  else if ( Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructure)
-  {
-    odf.resize(HexagonalOps::k_OdfSize);
-    Texture::CalculateHexODFData(e1s.data(), e2s.data(), e3s.data(),
-                                 weights.data(), sigmas.data(), true,
-                                 odf.data(), numEntries);
+    odf = m_TextureCache.getODF(m_CrystalStructure, e1s, e2s, e3s, weights, sigmas);
   }
   if (odf.size() > 0)
   {
@@ -521,7 +510,6 @@ void StatsGenODFWidget::on_m_CalculateODFBtn_clicked()
     e2s[i] = e2s[i] * M_PI / 180.0;
     e3s[i] = e3s[i] * M_PI / 180.0;
   }
-  size_t numEntries = e1s.size();
 
   int imageSize = pfImageSize->value();
   int lamberSize = pfLambertSize->value();
@@ -532,14 +520,17 @@ void StatsGenODFWidget::on_m_CalculateODFBtn_clicked()
   PoleFigureConfiguration_t config;
   QVector<UInt8ArrayType::Pointer> figures;
 
-  if ( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructure)
+  // The ODF and the pole figures are only recalculated when the texture or the image settings changed
+  odf = m_TextureCache.getODF(m_CrystalStructure, e1s, e2s, e3s, weights, sigmas);
+  QVector<float> settings;
+  settings << imageSize << lamberSize << npoints << imageLayout->currentIndex();
+  QImage image;
+  if (m_TextureCache.getPoleFigure(settings, image) == true)
+  {
+    // The pole figure of this ODF was already drawn with these settings
+  }
+  else if ( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructure)
   {
-    // We now need to resize all the arrays here to make sure they are all allocated
-    odf.resize(CubicOps::k_OdfSize);
-    Texture::CalculateCubicODFData(e1s.data(), e2s.data(), e3s.data(),
-                                   weights.data(), sigmas.data(), true,
-                                   odf.data(), numEntries);
-
     err = StatsGen::GenCubicODFPlotData(odf.data(), eulers->getPointer(0), npoints);
 
     CubicOps ops;
@@ -552,12 +543,6 @@ void StatsGenODFWidget::on_m_CalculateODFBtn_clicked()
   }
   else if ( Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructure)
   {
-    // We now need to resize all the arrays here to make sure they are all allocated
-    odf.resize(HexagonalOps::k_OdfSize);
-    Texture::CalculateHexODFData(e1s.data(), e2s.data(), e3s.data(),
-                                 weights.data(), sigmas.data(), true,
-                                 odf.data(), numEntries);
-
     err = StatsGen::GenHexODFPlotData(odf.data(), eulers->getPointer(0), npoints);
 
     HexagonalOps ops;
@@ -570,12 +555,6 @@ void StatsGenODFWidget::on_m_CalculateODFBtn_clicked()
   }
   else if ( Ebsd::CrystalStructure::OrthoRhombic == m_CrystalStructure)
   {
-    //    // We now need to resize all the arrays here to make sure they are all allocated
-    odf.resize(OrthoRhombicOps::k_OdfSize);
-    Texture::CalculateOrthoRhombicODFData(e1s.data(), e2s.data(), e3s.data(),
-                                          weights.data(), sigmas.data(), true,
-                                          odf.data(), numEntries);
-
     err = StatsGen::GenOrthoRhombicODFPlotData(odf.data(), eulers->getPointer(0), npoints);
 
     OrthoRhombicOps ops;
@@ -593,7 +572,11 @@ void StatsGenODFWidget::on_m_CalculateODFBtn_clicked()
     return;
   }
 
-  QImage image = PoleFigureImageUtilities::Create3ImagePoleFigure(figures[0].get(), figures[1].get(), figures[2].get(), config, imageLayout->currentIndex());
+  if (image.isNull() == true)
+  {
+    image = PoleFigureImageUtilities::Create3ImagePoleFigure(figures[0].get(), figures[1].get(), figures[2].get(), config, imageLayout->currentIndex());
+    m_TextureCache.setPoleFigure(settings, image);
+  }
   m_PoleFigureLabel->setPixmap(QPixmap::fromImage(image));
 
   // Enable the MDF tab
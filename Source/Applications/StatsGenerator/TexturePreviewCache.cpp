@@ -0,0 +1,192 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "TexturePreviewCache.h"
+
+#include "EbsdLib/EbsdConstants.h"
+
+#include "DREAM3DLib/Common/Texture.hpp"
+#include "OrientationLib/OrientationOps/CubicOps.h"
+#include "OrientationLib/OrientationOps/HexagonalOps.h"
+#include "OrientationLib/OrientationOps/OrthoRhombicOps.h"
+
+namespace Detail
+{
+  /**
+   * @brief Appends the size and the values of an input vector to a cache key. The sizes keep keys of
+   * different input vectors from running into each other.
+   */
+  void appendToKey(QVector<float>& key, const QVector<float>& values)
+  {
+    key.push_back(static_cast<float>(values.size()));
+    key += values;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TexturePreviewCache::TexturePreviewCache()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TexturePreviewCache::~TexturePreviewCache()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<float> TexturePreviewCache::getODF(unsigned int crystalStructure, const QVector<float>& e1s, const QVector<float>& e2s,
+                                           const QVector<float>& e3s, const QVector<float>& weights, const QVector<float>& sigmas)
+{
+  QVector<float> key(1, static_cast<float>(crystalStructure));
+  Detail::appendToKey(key, e1s);
+  Detail::appendToKey(key, e2s);
+  Detail::appendToKey(key, e3s);
+  Detail::appendToKey(key, weights);
+  Detail::appendToKey(key, sigmas);
+  if (key == m_ODFKey)
+  {
+    return m_ODF;
+  }
+
+  // The Texture functions take non const pointers
+  QVector<float> euler1 = e1s;
+  QVector<float> euler2 = e2s;
+  QVector<float> euler3 = e3s;
+  QVector<float> w = weights;
+  QVector<float> s = sigmas;
+  size_t numEntries = e1s.size();
+  QVector<float> odf;
+  if ( Ebsd::CrystalStructure::Cubic_High == crystalStructure)
+  {
+    odf.resize(CubicOps::k_OdfSize);
+    Texture::CalculateCubicODFData(euler1.data(), euler2.data(), euler3.data(), w.data(), s.data(), true, odf.data(), numEntries);
+  }
+  else if ( Ebsd::CrystalStructure::Hexagonal_High == crystalStructure)
+  {
+    odf.resize(HexagonalOps::k_OdfSize);
+    Texture::CalculateHexODFData(euler1.data(), euler2.data(), euler3.data(), w.data(), s.data(), true, odf.data(), numEntries);
+  }
+  else if ( Ebsd::CrystalStructure::OrthoRhombic == crystalStructure)
+  {
+    odf.resize(OrthoRhombicOps::k_OdfSize);
+    Texture::CalculateOrthoRhombicODFData(euler1.data(), euler2.data(), euler3.data(), w.data(), s.data(), true, odf.data(), numEntries);
+  }
+
+  m_ODFKey = key;
+  m_ODF = odf;
+  // Anything that was derived from the previous ODF is stale now
+  m_PoleFigureKey.clear();
+  m_PoleFigure = QImage();
+  return m_ODF;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<float> TexturePreviewCache::getMDF(unsigned int crystalStructure, const QVector<float>& odf, const QVector<float>& angles,
+                                           const QVector<float>& axes, const QVector<float>& weights)
+{
+  QVector<float> key(1, static_cast<float>(crystalStructure));
+  Detail::appendToKey(key, odf);
+  Detail::appendToKey(key, angles);
+  Detail::appendToKey(key, axes);
+  Detail::appendToKey(key, weights);
+  if (key == m_MDFKey)
+  {
+    return m_MDF;
+  }
+
+  QVector<float> o = odf;
+  QVector<float> a = angles;
+  QVector<float> n = axes;
+  QVector<float> w = weights;
+  QVector<float> mdf;
+  if ( Ebsd::CrystalStructure::Cubic_High == crystalStructure)
+  {
+    mdf.resize(CubicOps::k_MdfSize);
+    Texture::CalculateMDFData<float, CubicOps>(a.data(), n.data(), w.data(), o.data(), mdf.data(), a.size());
+  }
+  else if ( Ebsd::CrystalStructure::Hexagonal_High == crystalStructure)
+  {
+    mdf.resize(HexagonalOps::k_MdfSize);
+    Texture::CalculateMDFData<float, HexagonalOps>(a.data(), n.data(), w.data(), o.data(), mdf.data(), a.size());
+  }
+
+  m_MDFKey = key;
+  m_MDF = mdf;
+  return m_MDF;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TexturePreviewCache::getPoleFigure(const QVector<float>& settings, QImage& image)
+{
+  if (m_PoleFigure.isNull() == true || settings != m_PoleFigureKey)
+  {
+    return false;
+  }
+  image = m_PoleFigure;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TexturePreviewCache::setPoleFigure(const QVector<float>& settings, const QImage& image)
+{
+  m_PoleFigureKey = settings;
+  m_PoleFigure = image;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TexturePreviewCache::clear()
+{
+  m_ODFKey.clear();
+  m_ODF.clear();
+  m_MDFKey.clear();
+  m_MDF.clear();
+  m_PoleFigureKey.clear();
+  m_PoleFigure = QImage();
+}
@@ -0,0 +1,117 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _TEXTUREPREVIEWCACHE_H_
+#define _TEXTUREPREVIEWCACHE_H_
+
+#include <QtCore/QVector>
+#include <QtGui/QImage>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+
+/**
+ * @class TexturePreviewCache TexturePreviewCache.h StatsGenerator/TexturePreviewCache.h
+ * @brief This class remembers the last ODF, MDF and pole figure image that a StatsGenerator widget calculated
+ * together with the inputs they were calculated from. Redrawing a widget whose texture inputs did not change
+ * then reuses the previous result instead of recalculating it, which also keeps the randomly filled part of
+ * the ODF the same between the preview and the data that gets saved.
+ */
+class TexturePreviewCache
+{
+  public:
+    TexturePreviewCache();
+    virtual ~TexturePreviewCache();
+
+    /**
+     * @brief Returns the ODF of the weighted orientations. Only the Cubic, Hexagonal and OrthoRhombic crystal
+     * structures are supported, the ODF is empty for all others.
+     * @param crystalStructure The crystal structure
+     * @param e1s The first euler angles in radians
+     * @param e2s The second euler angles in radians
+     * @param e3s The third euler angles in radians
+     * @param weights The weights
+     * @param sigmas The sigmas
+     * @return The ODF
+     */
+    QVector<float> getODF(unsigned int crystalStructure, const QVector<float>& e1s, const QVector<float>& e2s,
+                          const QVector<float>& e3s, const QVector<float>& weights, const QVector<float>& sigmas);
+
+    /**
+     * @brief Returns the MDF for an ODF and the weighted misorientations. Only the Cubic and Hexagonal crystal
+     * structures are supported, the MDF is empty for all others.
+     * @param crystalStructure The crystal structure
+     * @param odf The ODF
+     * @param angles The misorientation angles
+     * @param axes The misorientation axes
+     * @param weights The weights
+     * @return The MDF
+     */
+    QVector<float> getMDF(unsigned int crystalStructure, const QVector<float>& odf, const QVector<float>& angles,
+                          const QVector<float>& axes, const QVector<float>& weights);
+
+    /**
+     * @brief Looks up the pole figure image that was stored for the given settings of the last calculated ODF
+     * @param settings The image settings (size, number of sample points, ...)
+     * @param image [output] The stored image
+     * @return true if an image for the settings and the current ODF is stored
+     */
+    bool getPoleFigure(const QVector<float>& settings, QImage& image);
+
+    /**
+     * @brief Stores the pole figure image for the given settings of the last calculated ODF
+     * @param settings The image settings (size, number of sample points, ...)
+     * @param image The image
+     */
+    void setPoleFigure(const QVector<float>& settings, const QImage& image);
+
+    /**
+     * @brief Forgets everything that was stored
+     */
+    void clear();
+
+  private:
+    QVector<float>  m_ODFKey;
+    QVector<float>  m_ODF;
+    QVector<float>  m_MDFKey;
+    QVector<float>  m_MDF;
+    QVector<float>  m_PoleFigureKey;
+    QImage          m_PoleFigure;
+
+    TexturePreviewCache(const TexturePreviewCache&); // Copy Constructor Not Implemented
+    void operator=(const TexturePreviewCache&); // Operator '=' Not Implemented
+};
+
+#endif /* _TEXTUREPREVIEWCACHE_H_ */
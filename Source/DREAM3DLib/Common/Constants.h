@@ -191,10 +191,12 @@ namespace DREAM3D
     const DREAM3D_STRING DislocationTensors("DislocationTensors");
     const DREAM3D_STRING EulerAngles("EulerAngles");
     const DREAM3D_STRING EulerColor("EulerColor");
+    const DREAM3D_STRING FaceMisorientations("FaceMisorientations");
     const DREAM3D_STRING FarFeatureQuats("FarFeatureQuats");
     const DREAM3D_STRING FarFeatureZoneIds("FarFeatureZoneIds");
     const DREAM3D_STRING FitQuality("FitQuality");
     const DREAM3D_STRING FlatImageData("FlatImageData");
+    const DREAM3D_STRING FZQuats("FZQuats");
     const DREAM3D_STRING GBEuclideanDistances("GBEuclideanDistances");
     const DREAM3D_STRING GlobAlpha("GlobAlpha");
     const DREAM3D_STRING GoodVoxels("GoodVoxels");
@@ -396,6 +398,7 @@ namespace DREAM3D
     const DREAM3D_STRING ComponentDimensions("ComponentDimensions");
     const DREAM3D_STRING AxisDimensions("Tuple Axis Dimensions");
     const DREAM3D_STRING DataArrayVersion("DataArrayVersion");
+    const DREAM3D_STRING QuantizedEncoding("QuantizedEncoding");
   }
 
   namespace StringConstants
@@ -502,6 +502,14 @@
   DataArray<type>::WeakPointer m_##name##Ptr;\
   type* m_##name;
 
+//used in place of 'DEFINE_REQUIRED_DATAARRAY_VARIABLE' when the filter only reads the array. The raw pointer is
+//fetched with getConstPointer() so an array that shares its memory with a copy is not duplicated
+#define DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(type, name)\
+  DREAM3D_INSTANCE_STRING_PROPERTY(name##ArrayName);\
+  private:\
+  DataArray<type>::WeakPointer m_##name##Ptr;\
+  const type* m_##name;
+
 #define DEFINE_REQUIRED_VARIABLE(type, name)\
   DREAM3D_INSTANCE_STRING_PROPERTY(name##ArrayName);\
   private:\
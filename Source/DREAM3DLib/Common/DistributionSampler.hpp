@@ -0,0 +1,101 @@
+/* ============================================================================
+ * Copyright (c) 2014, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2014, Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _DISTRIBUTIONSAMPLER_H_
+#define _DISTRIBUTIONSAMPLER_H_
+
+#include <vector>
+#include <algorithm>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+
+/**
+ * @class DistributionSampler DistributionSampler.hpp DREAM3DLib/Common/DistributionSampler.hpp
+ * @brief This class picks bins of a discrete distribution (an ODF, MDF or any other binned density) from
+ * uniform random numbers. The cumulative density is built once and each pick is a binary search, instead
+ * of summing the densities of all the bins before the picked one for every sample.
+ *
+ * A random number r picks bin j when (sum of the densities of bins 0..j-1) <= r < (sum of bins 0..j), which
+ * is exactly the bin the linear scan used by StatsGen, Texture and MatchCrystallography picks. The sums are
+ * accumulated in the template type in the same order as the scan so the same bins are chosen. If r is not
+ * below the total density (the densities sum to less than 1) bin 0 is returned, again like the scan.
+ */
+template<typename T>
+class DistributionSampler
+{
+  public:
+    DistributionSampler() {}
+
+    DistributionSampler(const T* densities, size_t numBins)
+    {
+      initialize(densities, numBins);
+    }
+
+    virtual ~DistributionSampler() {}
+
+    /**
+     * @brief Builds the cumulative density for the given bins. The densities must not be negative.
+     * @param densities The density of each bin
+     * @param numBins The number of bins
+     */
+    void initialize(const T* densities, size_t numBins)
+    {
+      m_Cumulative.resize(numBins);
+      T totaldensity = 0;
+      for (size_t j = 0; j < numBins; j++)
+      {
+        totaldensity = totaldensity + densities[j];
+        m_Cumulative[j] = totaldensity;
+      }
+    }
+
+    /**
+     * @brief Returns the bin picked by a random number on the [0,1) interval
+     */
+    int pick(T random) const
+    {
+      typename std::vector<T>::const_iterator iter = std::upper_bound(m_Cumulative.begin(), m_Cumulative.end(), random);
+      if (iter == m_Cumulative.end()) { return 0; }
+      return static_cast<int>(iter - m_Cumulative.begin());
+    }
+
+    size_t getNumberOfBins() const { return m_Cumulative.size(); }
+
+  private:
+    std::vector<T> m_Cumulative;
+};
+
+#endif /* _DISTRIBUTIONSAMPLER_H_ */
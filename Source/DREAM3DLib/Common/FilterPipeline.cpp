@@ -38,6 +38,7 @@
 FilterPipeline::FilterPipeline() :
   QObject(),
   m_ErrorCondition(0),
+  m_PerformanceMonitor(PerformanceMonitor::New()),
   m_Cancel(false)
 {
 
@@ -320,8 +321,13 @@ void FilterPipeline::execute()
             m_MessageReceivers.at(i), SLOT(processPipelineMessage(const PipelineMessage&)) );
   }
 
+  // Let filters report named phases of their work while they execute
+  m_PerformanceMonitor->clear();
+  PerformanceMonitor::SetActiveMonitor(m_PerformanceMonitor.get());
+
   PipelineMessage progValue("", "", 0, PipelineMessage::ProgressValue, -1);
-  for (FilterContainerType::iterator filter = m_Pipeline.begin(); filter != m_Pipeline.end(); ++filter)
+  int filterIndex = 0;
+  for (FilterContainerType::iterator filter = m_Pipeline.begin(); filter != m_Pipeline.end(); ++filter, ++filterIndex)
   {
     progress = progress + 1.0f;
     progValue.setType(PipelineMessage::ProgressValue);
@@ -339,13 +345,25 @@ void FilterPipeline::execute()
     connectFilterNotifications( (*filter).get() );
     (*filter)->setDataContainerArray(dca);
     setCurrentFilter(*filter);
+    int firstRecord = m_PerformanceMonitor->getRecords().size();
+    m_PerformanceMonitor->setCurrentFilterIndex(filterIndex);
+    PerformanceMonitor::Snapshot start = PerformanceMonitor::TakeSnapshot();
     (*filter)->execute();
+    PerformanceMonitor::Record record = PerformanceMonitor::Difference(start, PerformanceMonitor::TakeSnapshot());
+    record.FilterIndex = filterIndex;
+    record.FilterClassName = (*filter)->getNameOfClass();
+    record.FilterHumanLabel = (*filter)->getHumanLabel();
+    m_PerformanceMonitor->addRecord(record);
+    notifyPerformanceRecords(firstRecord, ss);
     disconnectFilterNotifications( (*filter).get() );
     (*filter)->setDataContainerArray(DataContainerArray::NullPointer());
+    // The next filter fetches its own pointers in dataCheck() so copies made from here on may share memory
+    dca->invalidateWritePointers();
     err = (*filter)->getErrorCondition();
     if(err < 0)
     {
       setErrorCondition(err);
+      PerformanceMonitor::SetActiveMonitor(NULL);
 
       progValue.setType(PipelineMessage::Error);
       progValue.setProgressValue(100);
@@ -361,10 +379,26 @@ void FilterPipeline::execute()
     ss = QObject::tr("%1 Filter Complete").arg((*filter)->getNameOfClass());
   }
 
+  PerformanceMonitor::SetActiveMonitor(NULL);
+
   PipelineMessage completMessage("", "Pipeline Complete", 0, PipelineMessage::StatusMessage, -1);
   emit pipelineGeneratedMessage(completMessage);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::notifyPerformanceRecords(int firstRecord, const QString& prefix)
+{
+  QVector<PerformanceMonitor::Record> records = m_PerformanceMonitor->getRecords();
+  for (int i = firstRecord; i < records.size(); ++i)
+  {
+    PipelineMessage pm(records[i].FilterClassName, records[i].FilterHumanLabel, records[i].toString(), 0, PipelineMessage::PerformanceData, -1);
+    pm.setPrefix(prefix);
+    emit pipelineGeneratedMessage(pm);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -41,6 +41,7 @@
 #include "DREAM3DLib/Common/DREAM3DSetGetMacros.h"
 #include "DREAM3DLib/Common/Observer.h"
 #include "DREAM3DLib/Common/AbstractFilter.h"
+#include "DREAM3DLib/Common/PerformanceMonitor.h"
 
 /**
  * @class FilterPipeline FilterPipeline.h DREAM3DLib/Common/FilterPipeline.h
@@ -67,6 +68,12 @@ class DREAM3DLib_EXPORT FilterPipeline : public QObject
     DREAM3D_INSTANCE_PROPERTY(int, ErrorCondition)
     DREAM3D_INSTANCE_PROPERTY(AbstractFilter::Pointer, CurrentFilter)
 
+    /**
+     * @brief Holds the time and memory used by each filter during the last call to execute(). A record for
+     * each filter (and each PerformanceMonitor::ScopedPhase inside it) is also sent out as a PerformanceData message.
+     */
+    DREAM3D_INSTANCE_PROPERTY(PerformanceMonitor::Pointer, PerformanceMonitor)
+
     /**
      * @brief Cancel the operation
      */
@@ -139,6 +146,11 @@ class DREAM3DLib_EXPORT FilterPipeline : public QObject
 
     void updatePrevNextFilters();
 
+    /**
+     * @brief Sends a PerformanceData message for each performance record from firstRecord on
+     */
+    void notifyPerformanceRecords(int firstRecord, const QString& prefix);
+
   signals:
     void pipelineGeneratedMessage(const PipelineMessage& message);
 
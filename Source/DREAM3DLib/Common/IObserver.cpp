@@ -78,6 +78,10 @@ void IObserver::processPipelineMessage(const PipelineMessage& pm)
   {
     ss << msg.getProgressValue() << msg.generateStatusString();
   }
+  else if(msg.getType() == PipelineMessage::PerformanceData)
+  {
+    ss << msg.generateStatusString();
+  }
   std::cout << msg.getFilterHumanLabel().toStdString() << ": " << str.toStdString() << std::endl;
 }
 
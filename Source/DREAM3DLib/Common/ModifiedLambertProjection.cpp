@@ -36,14 +36,178 @@
 
 #include "ModifiedLambertProjection.h"
 
+#include <vector>
+#include <algorithm>
+
 #include <QtCore/QSet>
 
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "DREAM3DLib/Math/DREAM3DMath.h"
 #include "DREAM3DLib/Math/MatrixMath.h"
 
 #define WRITE_LAMBERT_SQUARE_COORD_VTK 0
 
+/**
+ * @brief The LambertBinningImpl class adds a range of XYZ coordinates to a pair of north and south squares. Every
+ * body owns its own pair of squares and the squares are summed in join() so no two threads ever write the same bin.
+ */
+class LambertBinningImpl
+{
+  public:
+    LambertBinningImpl(const ModifiedLambertProjection* projection, const float* coords) :
+      m_Projection(projection),
+      m_Coords(coords)
+    {
+      size_t count = static_cast<size_t>(projection->getDimension() * projection->getDimension());
+      m_North.resize(count, 0.0);
+      m_South.resize(count, 0.0);
+    }
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    LambertBinningImpl(LambertBinningImpl& other, tbb::split) :
+      m_Projection(other.m_Projection),
+      m_Coords(other.m_Coords)
+    {
+      m_North.resize(other.m_North.size(), 0.0);
+      m_South.resize(other.m_South.size(), 0.0);
+    }
+#endif
+    virtual ~LambertBinningImpl() {}
+
+    void bin(size_t start, size_t end)
+    {
+      float sqCoord[2];
+      int index[4];
+      double weight[4];
+      for (size_t i = start; i < end; i++)
+      {
+        sqCoord[0] = 0.0;
+        sqCoord[1] = 0.0;
+        //get coordinates in square projection of crystal normal parallel to boundary normal
+        bool nhCheck = m_Projection->getSquareCoord(m_Coords + i * 3, sqCoord);
+        m_Projection->getInterpolationBins(sqCoord, index, weight);
+        double* square = (nhCheck == true) ? &(m_North.front()) : &(m_South.front());
+        for (int k = 0; k < 4; k++)
+        {
+          square[index[k]] += weight[k];
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      bin(r.begin(), r.end());
+    }
+
+    void join(const LambertBinningImpl& rhs)
+    {
+      size_t count = m_North.size();
+      for (size_t i = 0; i < count; i++)
+      {
+        m_North[i] += rhs.m_North[i];
+        m_South[i] += rhs.m_South[i];
+      }
+    }
+#endif
+
+    const std::vector<double>& getNorth() const { return m_North; }
+    const std::vector<double>& getSouth() const { return m_South; }
+
+  private:
+    const ModifiedLambertProjection* m_Projection;
+    const float* m_Coords;
+    std::vector<double> m_North;
+    std::vector<double> m_South;
+};
+
+/**
+ * @brief The StereographicProjectionImpl class resamples the north and south squares onto a range of rows of a
+ * stereographic projection image. Each pixel only reads the squares and writes its own value.
+ */
+class StereographicProjectionImpl
+{
+  public:
+    StereographicProjectionImpl(const ModifiedLambertProjection* projection, int dim, double* intensity) :
+      m_Projection(projection),
+      m_Dim(dim),
+      m_Intensity(intensity)
+    {}
+    virtual ~StereographicProjectionImpl() {}
+
+    void project(size_t start, size_t end) const
+    {
+      int xpoints = m_Dim;
+      int ypoints = m_Dim;
+
+      int xpointshalf = xpoints / 2;
+      int ypointshalf = ypoints / 2;
+
+      float xres = 2.0 / (float)(xpoints);
+      float yres = 2.0 / (float)(ypoints);
+      float xtmp, ytmp;
+      float sqCoord[2];
+      float xyz[3];
+      bool nhCheck = false;
+
+      for (int64_t y = start; y < static_cast<int64_t>(end); y++)
+      {
+        for (int64_t x = 0; x < xpoints; x++)
+        {
+          //get (x,y) for stereographic projection pixel
+          xtmp = float(x - xpointshalf) * xres + (xres * 0.5);
+          ytmp = float(y - ypointshalf) * yres + (yres * 0.5);
+          int index = y * xpoints + x;
+          if((xtmp * xtmp + ytmp * ytmp) <= 1.0)
+          {
+            //project xy from stereo projection to the unit spehere
+            xyz[2] = -((xtmp * xtmp + ytmp * ytmp) - 1) / ((xtmp * xtmp + ytmp * ytmp) + 1);
+            xyz[0] = xtmp * (1 + xyz[2]);
+            xyz[1] = ytmp * (1 + xyz[2]);
+
+            // Average the point and its antipode, one of which is in each hemisphere
+            double value = 0.0;
+            for( int64_t m = 0; m < 2; m++)
+            {
+              if(m == 1)
+              {
+                MatrixMath::Multiply3x1withConstant(xyz, -1.0);
+              }
+              nhCheck = m_Projection->getSquareCoord(xyz, sqCoord);
+              if (nhCheck == true)
+              {
+                value += m_Projection->getInterpolatedValue(ModifiedLambertProjection::NorthSquare, sqCoord);
+              }
+              else
+              {
+                value += m_Projection->getInterpolatedValue(ModifiedLambertProjection::SouthSquare, sqCoord);
+              }
+            }
+            m_Intensity[index] = value * 0.5;
+          }
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      project(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const ModifiedLambertProjection* m_Projection;
+    int m_Dim;
+    double* m_Intensity;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -72,9 +236,6 @@ ModifiedLambertProjection::Pointer ModifiedLambertProjection::CreateProjectionFr
 {
 
   size_t npoints = coords->getNumberOfTuples();
-  bool nhCheck = false;
-  float sqCoord[2];
-  //int sqIndex = 0;
   ModifiedLambertProjection::Pointer squareProj = ModifiedLambertProjection::New();
   squareProj->initializeSquares(dimension, sphereRadius);
 
@@ -85,6 +246,7 @@ ModifiedLambertProjection::Pointer ModifiedLambertProjection::CreateProjectionFr
   filename.append("ModifiedLambert_Square_Coords_").append(coords->getName()).append(".vtk");
   FILE* f = NULL;
   f = fopen(filename.toLatin1().data(), "wb");
+  float sqCoord[2];
   if(NULL == f)
   {
     ss.str("");
@@ -99,36 +261,32 @@ ModifiedLambertProjection::Pointer ModifiedLambertProjection::CreateProjectionFr
   fprintf(f, "\n");
 
   fprintf(f, "DATASET UNSTRUCTURED_GRID\nPOINTS %lu float\n", coords->getNumberOfTuples() );
-#endif
-
   for(size_t i = 0; i < npoints; ++i)
   {
     sqCoord[0] = 0.0;
     sqCoord[1] = 0.0;
-    //get coordinates in square projection of crystal normal parallel to boundary normal
-    nhCheck = squareProj->getSquareCoord(coords->getPointer(i * 3), sqCoord);
-#if WRITE_LAMBERT_SQUARE_COORD_VTK
+    squareProj->getSquareCoord(coords->getPointer(i * 3), sqCoord);
     fprintf(f, "%f %f 0\n", sqCoord[0], sqCoord[1]);
+  }
+  fclose(f);
 #endif
 
-    // Based on the XY coordinate, get the pointer index that the value corresponds to in the proper square
-//    sqIndex = squareProj->getSquareIndex(sqCoord);
-    if (nhCheck == true)
-    {
-      //north increment by 1
-//      squareProj->addValue(ModifiedLambertProjection::NorthSquare, sqIndex, 1.0);
-      squareProj->addInterpolatedValues(ModifiedLambertProjection::NorthSquare, sqCoord, 1.0);
-    }
-    else
-    {
-      // south increment by 1
-//      squareProj->addValue(ModifiedLambertProjection::SouthSquare, sqIndex, 1.0);
-      squareProj->addInterpolatedValues(ModifiedLambertProjection::SouthSquare, sqCoord, 1.0);
-    }
+  // Each point adds a value of 1 to the square of its hemisphere
+  LambertBinningImpl binner(squareProj.get(), coords->getConstPointer(0));
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
+  {
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, npoints), binner, tbb::auto_partitioner());
   }
-#if WRITE_LAMBERT_SQUARE_COORD_VTK
-  fclose(f);
+  else
 #endif
+  {
+    binner.bin(0, npoints);
+  }
+  std::copy(binner.getNorth().begin(), binner.getNorth().end(), squareProj->getNorthSquare()->getPointer(0));
+  std::copy(binner.getSouth().begin(), binner.getSouth().end(), squareProj->getSouthSquare()->getPointer(0));
 
   return squareProj;
 }
@@ -183,7 +341,7 @@ int ModifiedLambertProjection::readHDF5Data(hid_t groupId)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ModifiedLambertProjection::addInterpolatedValues(Square square, float* sqCoord, double value)
+void ModifiedLambertProjection::getInterpolationBins(const float* sqCoord, int index[4], double weight[4]) const
 {
   int abin1 = 0, bbin1 = 0;
   int abin2 = 0, bbin2 = 0;
@@ -194,6 +352,15 @@ void ModifiedLambertProjection::addInterpolatedValues(Square square, float* sqCo
   float modY = (sqCoord[1] + m_HalfDimensionTimesStepSize ) / m_StepSize;
   int abin = (int) modX;
   int bbin = (int) modY;
+  // A coordinate that rounds onto the far edge of the square belongs to the last bin
+  if(abin > m_Dimension - 1)
+  {
+    abin = m_Dimension - 1;
+  }
+  if(bbin > m_Dimension - 1)
+  {
+    bbin = m_Dimension - 1;
+  }
   modX -= abin;
   modY -= bbin;
   modX -= 0.5;
@@ -245,31 +412,28 @@ void ModifiedLambertProjection::addInterpolatedValues(Square square, float* sqCo
   modX = fabs(modX);
   modY = fabs(modY);
 
-  int index1 = bbin1 * m_Dimension + abin1;
-  int index2 = bbin2 * m_Dimension + abin2;
-  int index3 = bbin3 * m_Dimension + abin3;
-  int index4 = bbin4 * m_Dimension + abin4;
-  if (square == NorthSquare)
-  {
-    double v1 = m_NorthSquare->getValue(index1) + value * (1.0 - modX) * (1.0 - modY);
-    double v2 = m_NorthSquare->getValue(index2) + value * (modX) * (1.0 - modY);
-    double v3 = m_NorthSquare->getValue(index3) + value * (1.0 - modX) * (modY);
-    double v4 = m_NorthSquare->getValue(index4) + value * (modX) * (modY);
-    m_NorthSquare->setValue(index1, v1);
-    m_NorthSquare->setValue(index2, v2);
-    m_NorthSquare->setValue(index3, v3);
-    m_NorthSquare->setValue(index4, v4);
-  }
-  else
+  index[0] = bbin1 * m_Dimension + abin1;
+  index[1] = bbin2 * m_Dimension + abin2;
+  index[2] = bbin3 * m_Dimension + abin3;
+  index[3] = bbin4 * m_Dimension + abin4;
+  weight[0] = (1.0 - modX) * (1.0 - modY);
+  weight[1] = (modX) * (1.0 - modY);
+  weight[2] = (1.0 - modX) * (modY);
+  weight[3] = (modX) * (modY);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ModifiedLambertProjection::addInterpolatedValues(Square square, float* sqCoord, double value)
+{
+  int index[4];
+  double weight[4];
+  getInterpolationBins(sqCoord, index, weight);
+  double* values = (square == NorthSquare) ? m_NorthSquare->getPointer(0) : m_SouthSquare->getPointer(0);
+  for (int k = 0; k < 4; k++)
   {
-    double v1 = m_SouthSquare->getValue(index1) + value * (1.0 - modX) * (1.0 - modY);
-    double v2 = m_SouthSquare->getValue(index2) + value * (modX) * (1.0 - modY);
-    double v3 = m_SouthSquare->getValue(index3) + value * (1.0 - modX) * (modY);
-    double v4 = m_SouthSquare->getValue(index4) + value * (modX) * (modY);
-    m_SouthSquare->setValue(index1, v1);
-    m_SouthSquare->setValue(index2, v2);
-    m_SouthSquare->setValue(index3, v3);
-    m_SouthSquare->setValue(index4, v4);
+    values[index[k]] += value * weight[k];
   }
 }
 
@@ -323,92 +487,19 @@ double ModifiedLambertProjection::getValue(Square square, int index)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double ModifiedLambertProjection::getInterpolatedValue(Square square, float* sqCoord)
+double ModifiedLambertProjection::getInterpolatedValue(Square square, const float* sqCoord) const
 {
-// float sqCoord[2] = { sqCoord0[0] - 0.5*m_StepSize, sqCoord0[1] - 0.5*m_StepSize};
-  int abin1, bbin1;
-  int abin2, bbin2;
-  int abin3, bbin3;
-  int abin4, bbin4;
-  int abinSign, bbinSign;
-  float modX = (sqCoord[0] + m_HalfDimensionTimesStepSize ) / m_StepSize;
-  float modY = (sqCoord[1] + m_HalfDimensionTimesStepSize ) / m_StepSize;
-  int abin = (int) modX;
-  int bbin = (int) modY;
-  modX -= abin;
-  modY -= bbin;
-  modX -= 0.5;
-  modY -= 0.5;
-  if(modX == 0.0)
-  {
-    abinSign = 1;
-  }
-  else
-  {
-    abinSign = modX / fabs(modX);
-  }
-  if(modY == 0.0)
-  {
-    bbinSign = 1;
-  }
-  else
-  {
-    bbinSign = modY / fabs(modY);
-  }
-  abin1 = abin;
-  bbin1 = bbin;
-  abin2 = abin + abinSign;
-  bbin2 = bbin;
-  if(abin2 < 0 || abin2 > m_Dimension - 1)
-  {
-    abin2 = abin2 - (abinSign * m_Dimension), bbin2 = m_Dimension - bbin2 - 1;
-  }
-  abin3 = abin;
-  bbin3 = bbin + bbinSign;
-  if(bbin3 < 0 || bbin3 > m_Dimension - 1)
-  {
-    abin3 = m_Dimension - abin3 - 1, bbin3 = bbin3 - (bbinSign * m_Dimension);
-  }
-  abin4 = abin + abinSign;
-  bbin4 = bbin + bbinSign;
-  if((abin4 < 0 || abin4 > m_Dimension - 1) && (bbin4 >= 0 && bbin4 <= m_Dimension - 1))
-  {
-    abin4 = abin4 - (abinSign * m_Dimension), bbin4 = m_Dimension - bbin4 - 1;
-  }
-  else if((abin4 >= 0 && abin4 <= m_Dimension - 1) && (bbin4 < 0 || bbin4 > m_Dimension - 1))
-  {
-    abin4 = m_Dimension - abin4 - 1, bbin4 = bbin4 - (bbinSign * m_Dimension);
-  }
-  else if((abin4 < 0 || abin4 > m_Dimension - 1) && (bbin4 < 0 || bbin4 > m_Dimension - 1))
-  {
-    abin4 = abin4 - (abinSign * m_Dimension), bbin4 = bbin4 - (bbinSign * m_Dimension);
-  }
-  modX = fabs(modX);
-  modY = fabs(modY);
-  if (square == NorthSquare)
-  {
-    float intensity1 = m_NorthSquare->getValue((abin1) + (bbin1 * m_Dimension));
-    float intensity2 = m_NorthSquare->getValue((abin2) + (bbin2 * m_Dimension));
-    float intensity3 = m_NorthSquare->getValue((abin3) + (bbin3 * m_Dimension));
-    float intensity4 = m_NorthSquare->getValue((abin4) + (bbin4 * m_Dimension));
-    float interpolatedIntensity = ((intensity1 * (1 - modX) * (1 - modY)) + (intensity2 * (modX) * (1 - modY)) + (intensity3 * (1 - modX) * (modY)) + (intensity4 * (modX) * (modY)));
-    return interpolatedIntensity;
-  }
-  else
-  {
-    float intensity1 = m_SouthSquare->getValue((abin1) + (bbin1 * m_Dimension));
-    float intensity2 = m_SouthSquare->getValue((abin2) + (bbin2 * m_Dimension));
-    float intensity3 = m_SouthSquare->getValue((abin3) + (bbin3 * m_Dimension));
-    float intensity4 = m_SouthSquare->getValue((abin4) + (bbin4 * m_Dimension));
-    float interpolatedIntensity = ((intensity1 * (1 - modX) * (1 - modY)) + (intensity2 * (modX) * (1 - modY)) + (intensity3 * (1 - modX) * (modY)) + (intensity4 * (modX) * (modY)));
-    return interpolatedIntensity;
-  }
+  int index[4];
+  double weight[4];
+  getInterpolationBins(sqCoord, index, weight);
+  const double* values = (square == NorthSquare) ? m_NorthSquare->getConstPointer(0) : m_SouthSquare->getConstPointer(0);
+  return (values[index[0]] * weight[0]) + (values[index[1]] * weight[1]) + (values[index[2]] * weight[2]) + (values[index[3]] * weight[3]);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-bool ModifiedLambertProjection::getSquareCoord(float* xyz, float* sqCoord)
+bool ModifiedLambertProjection::getSquareCoord(const float* xyz, float* sqCoord) const
 {
   bool nhCheck = false;
   float adjust = 1.0;
@@ -531,63 +622,19 @@ void ModifiedLambertProjection::normalizeSquaresToMRD()
 // -----------------------------------------------------------------------------
 void ModifiedLambertProjection::createStereographicProjection(int dim, DoubleArrayType* stereoIntensity)
 {
-  int xpoints = dim;
-  int ypoints = dim;
-
-  int xpointshalf = xpoints / 2;
-  int ypointshalf = ypoints / 2;
-
-  float xres = 2.0 / (float)(xpoints);
-  float yres = 2.0 / (float)(ypoints);
-  float xtmp, ytmp;
-  float sqCoord[2];
-  float xyz[3];
-  bool nhCheck = false;
-
   stereoIntensity->initializeWithZeros();
-  double* intensity = stereoIntensity->getPointer(0);
-// int sqIndex = 0;
-
-  for (int64_t y = 0; y < ypoints; y++)
+  StereographicProjectionImpl projector(this, dim, stereoIntensity->getPointer(0));
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
   {
-    for (int64_t x = 0; x < xpoints; x++)
-    {
-      //get (x,y) for stereographic projection pixel
-      xtmp = float(x - xpointshalf) * xres + (xres * 0.5);
-      ytmp = float(y - ypointshalf) * yres + (yres * 0.5);
-      int index = y * xpoints + x;
-      if((xtmp * xtmp + ytmp * ytmp) <= 1.0)
-      {
-        //project xy from stereo projection to the unit spehere
-        xyz[2] = -((xtmp * xtmp + ytmp * ytmp) - 1) / ((xtmp * xtmp + ytmp * ytmp) + 1);
-        xyz[0] = xtmp * (1 + xyz[2]);
-        xyz[1] = ytmp * (1 + xyz[2]);
-
-
-        for( int64_t m = 0; m < 2; m++)
-        {
-          if(m == 1)
-          {
-            MatrixMath::Multiply3x1withConstant(xyz, -1.0);
-          }
-          nhCheck = getSquareCoord(xyz, sqCoord);
-          //sqIndex = getSquareIndex(sqCoord);
-          if (nhCheck == true)
-          {
-            //get Value from North square
-            intensity[index] += getInterpolatedValue(ModifiedLambertProjection::NorthSquare, sqCoord);
-            //intensity[index] += getValue(ModifiedLambertProjection::NorthSquare, sqIndex);
-          }
-          else
-          {
-            //get Value from South square
-            intensity[index] += getInterpolatedValue(ModifiedLambertProjection::SouthSquare, sqCoord);
-            //intensity[index] += getValue(ModifiedLambertProjection::SouthSquare, sqIndex);
-          }
-        }
-        intensity[index]  = intensity[index] * 0.5;
-      }
-    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, dim), projector, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    projector.project(0, dim);
   }
 }
 
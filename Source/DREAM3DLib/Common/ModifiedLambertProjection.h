@@ -105,6 +105,15 @@ class DREAM3DLib_EXPORT ModifiedLambertProjection
      */
     void addInterpolatedValues(Square square, float* sqCoord, double value);
 
+    /**
+     * @brief getInterpolationBins Computes the 4 bins that share a square coordinate, wrapping across the edges of
+     * the square, and the bilinear weight of each bin.
+     * @param sqCoord The XY coordinate in the Modified Lambert Square
+     * @param index [output] The index of each of the 4 bins
+     * @param weight [output] The weight of each of the 4 bins
+     */
+    void getInterpolationBins(const float* sqCoord, int index[4], double weight[4]) const;
+
     /**
      * @brief addValue
      * @param square
@@ -135,7 +144,7 @@ class DREAM3DLib_EXPORT ModifiedLambertProjection
      * @param sqCoord
      * @return
      */
-    double getInterpolatedValue(Square square, float* sqCoord);
+    double getInterpolatedValue(Square square, const float* sqCoord) const;
 
     /**
      * @brief getSquareCoord
@@ -143,7 +152,7 @@ class DREAM3DLib_EXPORT ModifiedLambertProjection
      * @param sqCoord [output] The XY coordinate in the Modified Lambert Square
      * @return If the point was in the north or south squares
      */
-    bool getSquareCoord(float* xyz, float* sqCoord);
+    bool getSquareCoord(const float* xyz, float* sqCoord) const;
 
     /**
      * @brief getSquareIndex
@@ -0,0 +1,377 @@
+/* ============================================================================
+ * Copyright (c) 2011, Michael A. Jackson (BlueQuartz Software)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Jackson nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PerformanceMonitor.h"
+
+#include <stdio.h>
+
+#if defined (_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#if defined (_MSC_VER)
+#pragma comment(lib, "psapi.lib")
+#endif
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#if defined (__APPLE__)
+#include <mach/mach.h>
+#endif
+#endif
+
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QObject>
+
+#include "DREAM3DLib/Common/AbstractFilter.h"
+
+namespace Detail
+{
+  static QMutex AllocatedBytesMutex;
+  static qint64 AllocatedBytes = 0;
+  static PerformanceMonitor* ActiveMonitor = NULL;
+
+  static QString csvField(const QString& value)
+  {
+    if (value.contains(',') == false && value.contains('"') == false && value.contains('\n') == false)
+    {
+      return value;
+    }
+    QString escaped = value;
+    escaped.replace("\"", "\"\"");
+    return QString("\"%1\"").arg(escaped);
+  }
+
+  static QString jsonString(const QString& value)
+  {
+    QString escaped;
+    for (int i = 0; i < value.size(); ++i)
+    {
+      QChar c = value.at(i);
+      if (c == '"') { escaped.append("\\\""); }
+      else if (c == '\\') { escaped.append("\\\\"); }
+      else if (c == '\n') { escaped.append("\\n"); }
+      else if (c == '\t') { escaped.append("\\t"); }
+      else if (c.unicode() < 0x20) { escaped.append(QString("\\u%1").arg(c.unicode(), 4, 16, QChar('0'))); }
+      else { escaped.append(c); }
+    }
+    return QString("\"%1\"").arg(escaped);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PerformanceMonitor::Record::toString() const
+{
+  QString label = (Phase.isEmpty() == true) ? QString("Total") : Phase;
+  return QObject::tr("%1: Wall %2 s, CPU %3 s, Allocated %4 MB, Resident %5%6 MB, Peak %7 MB")
+         .arg(label)
+         .arg(WallMillis / 1000.0, 0, 'f', 3)
+         .arg(CpuSeconds, 0, 'f', 3)
+         .arg(BytesAllocated / 1048576.0, 0, 'f', 1)
+         .arg(ResidentDelta >= 0 ? "+" : "")
+         .arg(ResidentDelta / 1048576.0, 0, 'f', 1)
+         .arg(PeakResident / 1048576.0, 0, 'f', 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PerformanceMonitor::ScopedPhase::ScopedPhase(AbstractFilter* filter, const QString& phase) :
+  m_Filter(filter),
+  m_Phase(phase),
+  m_Active(NULL != PerformanceMonitor::GetActiveMonitor())
+{
+  if (m_Active)
+  {
+    m_Start = PerformanceMonitor::TakeSnapshot();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PerformanceMonitor::ScopedPhase::~ScopedPhase()
+{
+  PerformanceMonitor* monitor = PerformanceMonitor::GetActiveMonitor();
+  if (m_Active == false || NULL == monitor)
+  {
+    return;
+  }
+  Record record = PerformanceMonitor::Difference(m_Start, PerformanceMonitor::TakeSnapshot());
+  record.FilterIndex = monitor->getCurrentFilterIndex();
+  if (NULL != m_Filter)
+  {
+    record.FilterClassName = m_Filter->getNameOfClass();
+    record.FilterHumanLabel = m_Filter->getHumanLabel();
+  }
+  record.Phase = m_Phase;
+  monitor->addRecord(record);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PerformanceMonitor::PerformanceMonitor() :
+  m_CurrentFilterIndex(-1)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PerformanceMonitor::~PerformanceMonitor()
+{
+  if (Detail::ActiveMonitor == this)
+  {
+    Detail::ActiveMonitor = NULL;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PerformanceMonitor::Snapshot PerformanceMonitor::TakeSnapshot()
+{
+  Snapshot snapshot;
+  snapshot.WallMillis = QDateTime::currentMSecsSinceEpoch();
+  snapshot.CpuSeconds = GetProcessCpuSeconds();
+  snapshot.BytesAllocated = GetAllocatedBytes();
+  snapshot.ResidentBytes = GetResidentSetSize();
+  return snapshot;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PerformanceMonitor::Record PerformanceMonitor::Difference(const Snapshot& start, const Snapshot& end)
+{
+  Record record;
+  record.FilterIndex = -1;
+  record.WallMillis = end.WallMillis - start.WallMillis;
+  record.CpuSeconds = end.CpuSeconds - start.CpuSeconds;
+  record.BytesAllocated = end.BytesAllocated - start.BytesAllocated;
+  record.ResidentDelta = end.ResidentBytes - start.ResidentBytes;
+  record.PeakResident = GetPeakResidentSetSize();
+  return record;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PerformanceMonitor::AddAllocatedBytes(size_t bytes)
+{
+  QMutexLocker locker(&Detail::AllocatedBytesMutex);
+  Detail::AllocatedBytes += static_cast<qint64>(bytes);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PerformanceMonitor::GetAllocatedBytes()
+{
+  QMutexLocker locker(&Detail::AllocatedBytesMutex);
+  return Detail::AllocatedBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PerformanceMonitor::GetResidentSetSize()
+{
+#if defined (_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0) { return 0; }
+  return static_cast<qint64>(counters.WorkingSetSize);
+#elif defined (__APPLE__)
+  mach_task_basic_info_data_t info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) { return 0; }
+  return static_cast<qint64>(info.resident_size);
+#else
+  FILE* f = fopen("/proc/self/statm", "r");
+  if (NULL == f) { return 0; }
+  long long size = 0;
+  long long resident = 0;
+  int n = fscanf(f, "%lld %lld", &size, &resident);
+  fclose(f);
+  if (n != 2) { return 0; }
+  return static_cast<qint64>(resident) * static_cast<qint64>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PerformanceMonitor::GetPeakResidentSetSize()
+{
+#if defined (_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0) { return 0; }
+  return static_cast<qint64>(counters.PeakWorkingSetSize);
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) { return 0; }
+#if defined (__APPLE__)
+  return static_cast<qint64>(usage.ru_maxrss); // Bytes on OS X
+#else
+  return static_cast<qint64>(usage.ru_maxrss) * 1024; // Kilobytes on Linux
+#endif
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double PerformanceMonitor::GetProcessCpuSeconds()
+{
+#if defined (_WIN32)
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if (GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime) == 0) { return 0.0; }
+  ULARGE_INTEGER kernel, user;
+  kernel.LowPart = kernelTime.dwLowDateTime;
+  kernel.HighPart = kernelTime.dwHighDateTime;
+  user.LowPart = userTime.dwLowDateTime;
+  user.HighPart = userTime.dwHighDateTime;
+  return static_cast<double>(kernel.QuadPart + user.QuadPart) * 1.0e-7; // 100 nanosecond ticks
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) { return 0.0; }
+  return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+         + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1.0e-6;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PerformanceMonitor* PerformanceMonitor::GetActiveMonitor()
+{
+  return Detail::ActiveMonitor;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PerformanceMonitor::SetActiveMonitor(PerformanceMonitor* monitor)
+{
+  Detail::ActiveMonitor = monitor;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PerformanceMonitor::addRecord(const Record& record)
+{
+  m_Records.push_back(record);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<PerformanceMonitor::Record> PerformanceMonitor::getRecords()
+{
+  return m_Records;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PerformanceMonitor::clear()
+{
+  m_Records.clear();
+  m_CurrentFilterIndex = -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PerformanceMonitor::writeCsv(QTextStream& out)
+{
+  out << "FilterIndex,FilterClassName,FilterHumanLabel,Phase,WallSeconds,CpuSeconds,BytesAllocated,ResidentDeltaBytes,PeakResidentBytes\n";
+  for (int i = 0; i < m_Records.size(); ++i)
+  {
+    const Record& r = m_Records[i];
+    out << r.FilterIndex << "," << Detail::csvField(r.FilterClassName) << "," << Detail::csvField(r.FilterHumanLabel) << ","
+        << Detail::csvField(r.Phase) << "," << QString::number(r.WallMillis / 1000.0, 'f', 3) << ","
+        << QString::number(r.CpuSeconds, 'f', 3) << "," << r.BytesAllocated << "," << r.ResidentDelta << "," << r.PeakResident << "\n";
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PerformanceMonitor::writeJson(QTextStream& out)
+{
+  out << "[\n";
+  for (int i = 0; i < m_Records.size(); ++i)
+  {
+    const Record& r = m_Records[i];
+    out << "  {"
+        << "\"FilterIndex\": " << r.FilterIndex << ", "
+        << "\"FilterClassName\": " << Detail::jsonString(r.FilterClassName) << ", "
+        << "\"FilterHumanLabel\": " << Detail::jsonString(r.FilterHumanLabel) << ", "
+        << "\"Phase\": " << Detail::jsonString(r.Phase) << ", "
+        << "\"WallSeconds\": " << QString::number(r.WallMillis / 1000.0, 'f', 3) << ", "
+        << "\"CpuSeconds\": " << QString::number(r.CpuSeconds, 'f', 3) << ", "
+        << "\"BytesAllocated\": " << r.BytesAllocated << ", "
+        << "\"ResidentDeltaBytes\": " << r.ResidentDelta << ", "
+        << "\"PeakResidentBytes\": " << r.PeakResident
+        << "}" << ((i + 1 < m_Records.size()) ? ",\n" : "\n");
+  }
+  out << "]\n";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PerformanceMonitor::writeFile(const QString& filePath)
+{
+  QFile file(filePath);
+  if (file.open(QIODevice::WriteOnly | QIODevice::Text) == false)
+  {
+    return -1;
+  }
+  QTextStream out(&file);
+  if (filePath.endsWith(".json", Qt::CaseInsensitive) == true)
+  {
+    writeJson(out);
+  }
+  else
+  {
+    writeCsv(out);
+  }
+  file.close();
+  return 0;
+}
@@ -0,0 +1,189 @@
+/* ============================================================================
+ * Copyright (c) 2011, Michael A. Jackson (BlueQuartz Software)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Jackson nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _PerformanceMonitor_H_
+#define _PerformanceMonitor_H_
+
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+#include <QtCore/QVector>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/DREAM3DSetGetMacros.h"
+
+class AbstractFilter;
+
+/**
+ * @class PerformanceMonitor PerformanceMonitor.h DREAM3DLib/Common/PerformanceMonitor.h
+ * @brief Collects how long each filter of a pipeline ran and how much memory it used. The FilterPipeline takes a
+ * Snapshot before and after each filter and stores the difference as a Record; long filters can add Records for
+ * named phases of their own work with a ScopedPhase. The Records can be written out as CSV or JSON.
+ *
+ * The byte counter is the running total of the memory requested by DataArray::allocate() and
+ * DataArray::resizeAndExtend() across the whole process. Resident set sizes come from the operating system and
+ * are 0 where they can not be determined.
+ */
+class DREAM3DLib_EXPORT PerformanceMonitor
+{
+  public:
+    DREAM3D_SHARED_POINTERS(PerformanceMonitor)
+    DREAM3D_TYPE_MACRO(PerformanceMonitor)
+    DREAM3D_STATIC_NEW_MACRO(PerformanceMonitor)
+
+    virtual ~PerformanceMonitor();
+
+    /**
+     * @brief The process wide counters at one moment
+     */
+    struct Snapshot
+    {
+      qint64 WallMillis;
+      double CpuSeconds;
+      qint64 BytesAllocated;
+      qint64 ResidentBytes;
+    };
+
+    /**
+     * @brief What happened between two Snapshots. An empty Phase means the Record covers a whole filter.
+     */
+    struct Record
+    {
+      int FilterIndex;
+      QString FilterClassName;
+      QString FilterHumanLabel;
+      QString Phase;
+      qint64 WallMillis;
+      double CpuSeconds;
+      qint64 BytesAllocated;
+      qint64 ResidentDelta;
+      qint64 PeakResident;
+
+      /**
+       * @brief Returns a one line human readable summary
+       */
+      QString toString() const;
+    };
+
+    /**
+     * @brief Times a named phase inside a filter for as long as the object lives and adds the Record to the active
+     * PerformanceMonitor when it goes out of scope. Does nothing if no pipeline is recording. Only use it on the
+     * thread that runs the filter.
+     */
+    class DREAM3DLib_EXPORT ScopedPhase
+    {
+      public:
+        ScopedPhase(AbstractFilter* filter, const QString& phase);
+        virtual ~ScopedPhase();
+
+      private:
+        AbstractFilter* m_Filter;
+        QString m_Phase;
+        Snapshot m_Start;
+        bool m_Active;
+
+        ScopedPhase(const ScopedPhase&); // Copy Constructor Not Implemented
+        void operator=(const ScopedPhase&); // Operator '=' Not Implemented
+    };
+
+    /**
+     * @brief Reads all the process wide counters
+     */
+    static Snapshot TakeSnapshot();
+
+    /**
+     * @brief Fills in the measured fields of a Record from two Snapshots
+     */
+    static Record Difference(const Snapshot& start, const Snapshot& end);
+
+    /**
+     * @brief Adds to the running total of bytes allocated by DataArrays. Safe to call from any thread.
+     */
+    static void AddAllocatedBytes(size_t bytes);
+
+    /**
+     * @brief Returns the running total of bytes allocated by DataArrays
+     */
+    static qint64 GetAllocatedBytes();
+
+    /**
+     * @brief Returns the current resident set size of the process in bytes
+     */
+    static qint64 GetResidentSetSize();
+
+    /**
+     * @brief Returns the largest resident set size the process has had in bytes
+     */
+    static qint64 GetPeakResidentSetSize();
+
+    /**
+     * @brief Returns the user plus system CPU time used by all the threads of the process
+     */
+    static double GetProcessCpuSeconds();
+
+    /**
+     * @brief The monitor that ScopedPhase objects report to. The FilterPipeline sets this while it executes.
+     */
+    static PerformanceMonitor* GetActiveMonitor();
+    static void SetActiveMonitor(PerformanceMonitor* monitor);
+
+    DREAM3D_INSTANCE_PROPERTY(int, CurrentFilterIndex)
+
+    void addRecord(const Record& record);
+    QVector<Record> getRecords();
+    void clear();
+
+    /**
+     * @brief Writes the Records as CSV with a header line
+     */
+    void writeCsv(QTextStream& out);
+
+    /**
+     * @brief Writes the Records as a JSON array of objects
+     */
+    void writeJson(QTextStream& out);
+
+    /**
+     * @brief Writes the Records to a file, as JSON if the file name ends in ".json" and as CSV otherwise
+     * @param filePath The file to write
+     * @return 0 on success, -1 if the file could not be opened
+     */
+    int writeFile(const QString& filePath);
+
+  protected:
+    PerformanceMonitor();
+
+  private:
+    QVector<Record> m_Records;
+
+    PerformanceMonitor(const PerformanceMonitor&); // Copy Constructor Not Implemented
+    void operator=(const PerformanceMonitor&); // Operator '=' Not Implemented
+};
+
+#endif /* _PerformanceMonitor_H_ */
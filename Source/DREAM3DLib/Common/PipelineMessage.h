@@ -54,6 +54,7 @@ class PipelineMessage
                       StatusMessage,
                       ProgressValue,
                       StatusMessageAndProgressValue,
+                      PerformanceData,
                       UnknownMessageType
                      };
 
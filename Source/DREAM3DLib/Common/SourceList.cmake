@@ -31,6 +31,7 @@ set(DREAM3DLib_Common_HDRS
   ${DREAM3DLib_SOURCE_DIR}/Common/CrystalStructure.h
   ${DREAM3DLib_SOURCE_DIR}/Common/DREAM3DDLLExport.h
   ${DREAM3DLib_SOURCE_DIR}/Common/DREAM3DSetGetMacros.h
+  ${DREAM3DLib_SOURCE_DIR}/Common/DistributionSampler.hpp
   ${DREAM3DLib_SOURCE_DIR}/Common/FilterFactory.hpp
   ${DREAM3DLib_SOURCE_DIR}/Common/FilterManager.h
   ${DREAM3DLib_SOURCE_DIR}/Common/IDataArrayFilter.h
@@ -38,6 +39,7 @@ set(DREAM3DLib_Common_HDRS
   ${DREAM3DLib_SOURCE_DIR}/Common/IObserver.h
   ${DREAM3DLib_SOURCE_DIR}/Common/ModifiedLambertProjection.h
   ${DREAM3DLib_SOURCE_DIR}/Common/ModifiedLambertProjectionArray.h
+  ${DREAM3DLib_SOURCE_DIR}/Common/PerformanceMonitor.h
   ${DREAM3DLib_SOURCE_DIR}/Common/PhaseType.h
   ${DREAM3DLib_SOURCE_DIR}/Common/PipelineMessage.h
   ${DREAM3DLib_SOURCE_DIR}/Common/ScopedFileMonitor.hpp
@@ -63,6 +65,7 @@ set(DREAM3DLib_Common_SRCS
   ${DREAM3DLib_SOURCE_DIR}/Common/ModifiedLambertProjectionArray.cpp
   ${DREAM3DLib_SOURCE_DIR}/Common/Observable.cpp
   ${DREAM3DLib_SOURCE_DIR}/Common/Observer.cpp
+  ${DREAM3DLib_SOURCE_DIR}/Common/PerformanceMonitor.cpp
   ${DREAM3DLib_SOURCE_DIR}/Common/PhaseType.cpp
   ${DREAM3DLib_SOURCE_DIR}/Common/ShapeType.cpp
   ${DREAM3DLib_SOURCE_DIR}/Common/TexturePreset.cpp
@@ -48,6 +48,7 @@
 #include "DREAM3DLib/Utilities/DREAM3DRandom.h"
 #include "OrientationLib/OrientationOps/OrientationOps.h"
 #include "DREAM3DLib/Common/Texture.hpp"
+#include "DREAM3DLib/Common/DistributionSampler.hpp"
 
 
 /**
@@ -228,24 +229,15 @@ class StatsGen
       int err = 0;
       int choose;
       T ea1, ea2, ea3;
-      T totaldensity;
-      T random, density;
+      T random;
 
       CubicOps ops;
-      T td1;
+      DistributionSampler<T> sampler(odf, CubicOps::k_OdfSize);
       //float* odfPtr = &(odf.front());
       for (size_t i = 0; i < npoints; i++)
       {
         random = rg.genrand_res53();
-        choose = 0;
-        totaldensity = 0;
-        for (int j = 0; j < CubicOps::k_OdfSize; j++)
-        {
-          density = odf[j];
-          td1 = totaldensity;
-          totaldensity = totaldensity + density;
-          if (random < totaldensity && random >= td1) { choose = static_cast<int> (j); break; }
-        }
+        choose = sampler.pick(random);
         ops.determineEulerAngles(choose, ea1, ea2, ea3);
         eulers[3 * i + 0] = ea1;
         eulers[3 * i + 1] = ea2;
@@ -272,23 +264,13 @@ class StatsGen
       int err = 0;
       int choose;
       float ea1, ea2, ea3;
-      float totaldensity;
-      float random, density;
+      float random;
       HexagonalOps ops;
-
-      float td1;
+      DistributionSampler<T> sampler(odf, HexagonalOps::k_OdfSize);
       for (int i = 0; i < npoints; i++)
       {
         random = rg.genrand_res53();
-        choose = 0;
-        totaldensity = 0;
-        for (int j = 0; j < HexagonalOps::k_OdfSize; j++)
-        {
-          density = odf[j];
-          td1 = totaldensity;
-          totaldensity = totaldensity + density;
-          if (random < totaldensity && random >= td1) { choose = static_cast<int> (j); break; }
-        }
+        choose = sampler.pick(random);
         ops.determineEulerAngles(choose, ea1, ea2, ea3);
         eulers[3 * i + 0] = ea1;
         eulers[3 * i + 1] = ea2;
@@ -315,27 +297,13 @@ class StatsGen
       int err = 0;
       int choose;
       float ea1, ea2, ea3;
-      float totaldensity;
-      float random, density;
+      float random;
       OrthoRhombicOps ops;
-
-      float td1;
+      DistributionSampler<T> sampler(odf, OrthoRhombicOps::k_OdfSize);
       for (int i = 0; i < npoints; i++)
       {
         random = rg.genrand_res53();
-        choose = 0;
-        totaldensity = 0;
-        for (int j = 0; j < OrthoRhombicOps::k_OdfSize; j++)
-        {
-          density = odf[j];
-          td1 = totaldensity;
-          totaldensity = totaldensity + density;
-          if (random < totaldensity && random >= td1)
-          {
-            choose = static_cast<int> (j);
-            break;
-          }
-        }
+        choose = sampler.pick(random);
         ops.determineEulerAngles(choose, ea1, ea2, ea3);
         eulers[3 * i + 0] = ea1;
         eulers[3 * i + 1] = ea2;
@@ -371,27 +339,13 @@ class StatsGen
       int err = 0;
       int choose;
       float ea1, ea2, ea3;
-      float totaldensity;
-      float random, density;
+      float random;
       OrthoRhombicOps ops;
-
-      float td1;
+      DistributionSampler<T> sampler(odf, OrthoRhombicOps::k_OdfSize);
       for (int i = 0; i < npoints; i++)
       {
         random = rg.genrand_res53();
-        choose = 0;
-        totaldensity = 0;
-        for (int j = 0; j < OrthoRhombicOps::k_OdfSize; j++)
-        {
-          density = odf[j];
-          td1 = totaldensity;
-          totaldensity = totaldensity + density;
-          if (random < totaldensity && random >= td1)
-          {
-            choose = static_cast<int> (j);
-            break;
-          }
-        }
+        choose = sampler.pick(random);
         ops.determineEulerAngles(choose, ea1, ea2, ea3);
         eulers[3 * i + 0] = ea1;
         eulers[3 * i + 1] = ea2;
@@ -416,8 +370,6 @@ class StatsGen
       float radtodeg = 180.0f / float(M_PI);
       DREAM3D_RANDOMNG_NEW()
       int err = 0;
-      float density;
-      float totaldensity;
       int choose = 0;
       float random;
       float w;
@@ -425,29 +377,17 @@ class StatsGen
       float r1, r2, r3;
 
       CubicOps ops;
+      DistributionSampler<T> sampler(mdf, CubicOps::k_MdfSize);
 
       for (int i = 0; i < npoints; i++)
       {
         yval[i] = 0;
       }
 
-      float td1;
       for (int i = 0; i < size; i++)
       {
         random = rg.genrand_res53();
-        choose = 0;
-        totaldensity = 0;
-        for (int j = 0; j < CubicOps::k_MdfSize; j++)
-        {
-          density = mdf[j];
-          td1 = totaldensity;
-          totaldensity = totaldensity + density;
-          if (random < totaldensity && random >= td1)
-          {
-            choose = static_cast<int> (j);
-            break;
-          }
-        }
+        choose = sampler.pick(random);
         ops.determineRodriguesVector(choose, r1, r2, r3);
         OrientationMath::RodtoAxisAngle(r1, r2, r3, w, n1, n2, n3);
         w = w * radtodeg;
@@ -478,32 +418,22 @@ class StatsGen
       DREAM3D_RANDOMNG_NEW()
       int err = 0;
       int choose = 0;
-      float density;
-      float totaldensity;
       float random;
       float w;
       float n1, n2, n3;
       float r1, r2, r3;
       HexagonalOps ops;
+      DistributionSampler<T> sampler(mdf, HexagonalOps::k_MdfSize);
 
       for (int i = 0; i < npoints; i++)
       {
         yval[i] = 0;
       }
       //    float ra1, ra2, ra3, rb1, rb2, rb3, rc1, rc2, rc3;
-      float td1;
       for (int i = 0; i < size; i++)
       {
         random = rg.genrand_res53();
-        choose = 0;
-        totaldensity = 0;
-        for (size_t j = 0; j < HexagonalOps::k_MdfSize; j++)
-        {
-          density = mdf[j];
-          td1 = totaldensity;
-          totaldensity = totaldensity + density;
-          if (random < totaldensity && random >= td1) { choose = static_cast<int> (j); break; }
-        }
+        choose = sampler.pick(random);
         ops.determineRodriguesVector(choose, r1, r2, r3);
         OrientationMath::RodtoAxisAngle(r1, r2, r3, w, n1, n2, n3);
         w = w * radtodeg;
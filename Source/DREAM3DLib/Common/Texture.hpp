@@ -38,6 +38,7 @@
 #define _TEXTURE_H_
 
 #include <vector>
+#include <algorithm>
 #include <QtCore/QString>
 #include <fstream>
 
@@ -53,6 +54,163 @@
 #include "OrientationLib/OrientationOps/HexagonalOps.h"
 #include "OrientationLib/OrientationOps/OrthoRhombicOps.h"
 #include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "DREAM3DLib/Common/DistributionSampler.hpp"
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+/**
+ * @brief The TextureBinsImpl class finds the ODF bin of each weighted orientation. The OrientationOpsType is
+ * the concrete symmetry class so the fundamental zone reduction and the binning are not virtual calls. The
+ * entries are split over threads rather than SIMD lanes: the fundamental zone search branches per symmetry
+ * operator and the homochoric mapping in getOdfBin() needs atan/sin/pow, which do not vectorise here.
+ */
+template<typename T, class OrientationOpsType>
+class TextureBinsImpl
+{
+  public:
+    TextureBinsImpl(T* e1s, T* e2s, T* e3s, int32_t* bins) :
+      m_E1s(e1s),
+      m_E2s(e2s),
+      m_E3s(e3s),
+      m_Bins(bins)
+    {}
+    virtual ~TextureBinsImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      OrientationOpsType ops;
+      float r1 = 0.0f, r2 = 0.0f, r3 = 0.0f;
+      for (size_t i = start; i < end; i++)
+      {
+        OrientationMath::EulertoRod(m_E1s[i], m_E2s[i], m_E3s[i], r1, r2, r3);
+        ops.OrientationOpsType::getODFFZRod(r1, r2, r3);
+        m_Bins[i] = ops.OrientationOpsType::getOdfBin(r1, r2, r3);
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+  private:
+    T* m_E1s;
+    T* m_E2s;
+    T* m_E3s;
+    int32_t* m_Bins;
+};
+
+/**
+ * @brief The TextureSmoothingImpl class smears the weight of each binned orientation over the ODF bins within
+ * sigma bins of it. Every body accumulates into its own ODF and the ODFs are summed in join() so no two
+ * threads ever write the same bin.
+ */
+template<typename T>
+class TextureSmoothingImpl
+{
+  public:
+    TextureSmoothingImpl(const int32_t* bins, const T* weights, const T* sigmas, const int dims[3]) :
+      m_Bins(bins),
+      m_Weights(weights),
+      m_Sigmas(sigmas),
+      m_TotalAddWeight(0.0)
+    {
+      m_Dims[0] = dims[0];
+      m_Dims[1] = dims[1];
+      m_Dims[2] = dims[2];
+      m_ODF.resize(dims[0] * dims[1] * dims[2], 0);
+    }
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    TextureSmoothingImpl(TextureSmoothingImpl& other, tbb::split) :
+      m_Bins(other.m_Bins),
+      m_Weights(other.m_Weights),
+      m_Sigmas(other.m_Sigmas),
+      m_TotalAddWeight(0.0)
+    {
+      m_Dims[0] = other.m_Dims[0];
+      m_Dims[1] = other.m_Dims[1];
+      m_Dims[2] = other.m_Dims[2];
+      m_ODF.resize(other.m_ODF.size(), 0);
+    }
+#endif
+    virtual ~TextureSmoothingImpl() {}
+
+    void smooth(size_t start, size_t end)
+    {
+      for (size_t i = start; i < end; i++)
+      {
+        int bin = m_Bins[i];
+        int bin1 = bin % m_Dims[0];
+        int bin2 = (bin / m_Dims[0]) % m_Dims[1];
+        int bin3 = bin / (m_Dims[0] * m_Dims[1]);
+        if (m_Sigmas[i] < 0) { continue; }
+        int sigma = static_cast<int>(m_Sigmas[i]);
+        if (sigma == 0)
+        {
+          m_ODF[bin] += m_Weights[i];
+          m_TotalAddWeight += m_Weights[i];
+          continue;
+        }
+        // Only visit the bins of the sphere of radius sigma that are inside of the ODF
+        int sigmaSqrd = sigma * sigma;
+        int jMin = std::max(-sigma, -bin1), jMax = std::min(sigma, m_Dims[0] - 1 - bin1);
+        int kMin = std::max(-sigma, -bin2), kMax = std::min(sigma, m_Dims[1] - 1 - bin2);
+        int lMin = std::max(-sigma, -bin3), lMax = std::min(sigma, m_Dims[2] - 1 - bin3);
+        for (int l = lMin; l <= lMax; l++)
+        {
+          for (int k = kMin; k <= kMax; k++)
+          {
+            int klSqrd = k * k + l * l;
+            if (klSqrd > sigmaSqrd) { continue; }
+            T* row = &(m_ODF[((bin3 + l) * m_Dims[1] + (bin2 + k)) * m_Dims[0] + bin1]);
+            for (int j = jMin; j <= jMax; j++)
+            {
+              int distSqrd = j * j + klSqrd;
+              if (distSqrd > sigmaSqrd) { continue; }
+              T addweight = m_Weights[i] * (1.0f - static_cast<float>(distSqrd) / static_cast<float>(sigmaSqrd));
+              row[j] += addweight;
+              m_TotalAddWeight += addweight;
+            }
+          }
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      smooth(r.begin(), r.end());
+    }
+
+    void join(const TextureSmoothingImpl& rhs)
+    {
+      size_t count = m_ODF.size();
+      for (size_t i = 0; i < count; i++)
+      {
+        m_ODF[i] += rhs.m_ODF[i];
+      }
+      m_TotalAddWeight += rhs.m_TotalAddWeight;
+    }
+#endif
+
+    const std::vector<T>& getODF() const { return m_ODF; }
+    double getTotalAddWeight() const { return m_TotalAddWeight; }
+
+  private:
+    const int32_t* m_Bins;
+    const T* m_Weights;
+    const T* m_Sigmas;
+    int m_Dims[3];
+    std::vector<T> m_ODF;
+    double m_TotalAddWeight;
+};
 
 /**
  * @class Texture Texture.h AIM/Common/Texture.h
@@ -90,113 +248,7 @@ class Texture
                                       T* weights, T* sigmas,
                                       bool normalize, T* odf, size_t numEntries)
     {
-      DREAM3D_RANDOMNG_NEW()
-      CubicOps ops;
-      Int32ArrayType::Pointer textureBins = Int32ArrayType::CreateArray(numEntries, "TextureBins");
-      int32_t* TextureBins = textureBins->getPointer(0);
-
-      float addweight = 0;
-      float totaladdweight = 0;
-      float totalweight = float(3 * CubicOps::k_OdfSize);
-      int bin, addbin;
-      int bin1, bin2, bin3;
-      int addbin1, addbin2, addbin3;
-      float dist, fraction;
-      float r1, r2, r3;
-
-      for (size_t i = 0; i < numEntries; i++)
-      {
-        OrientationMath::EulertoRod(e1s[i], e2s[i], e3s[i], r1, r2, r3);
-        ops.getODFFZRod(r1, r2, r3);
-        bin = ops.getOdfBin(r1, r2, r3);
-        TextureBins[i] = static_cast<int>(bin);
-      }
-
-      for (int i = 0; i < CubicOps::k_OdfSize; i++)
-      {
-        odf[i] = 0;
-      }
-      for (size_t i = 0; i < numEntries; i++)
-      {
-        bin = TextureBins[i];
-        bin1 = bin % 18;
-        bin2 = (bin / 18) % 18;
-        bin3 = bin / (18 * 18);
-        for (int j = -sigmas[i]; j <= sigmas[i]; j++)
-        {
-          int jsqrd = j * j;
-          for (int k = -sigmas[i]; k <= sigmas[i]; k++)
-          {
-            int ksqrd = k * k;
-            for (int l = -sigmas[i]; l <= sigmas[i]; l++)
-            {
-              int lsqrd = l * l;
-              addbin1 = bin1 + int(j);
-              addbin2 = bin2 + int(k);
-              addbin3 = bin3 + int(l);
-              //if(addbin1 < 0) addbin1 = addbin1 + 18;
-              //if(addbin1 >= 18) addbin1 = addbin1 - 18;
-              //if(addbin2 < 0) addbin2 = addbin2 + 18;
-              //if(addbin2 >= 18) addbin2 = addbin2 - 18;
-              //if(addbin3 < 0) addbin3 = addbin3 + 18;
-              //if(addbin3 >= 18) addbin3 = addbin3 - 18;
-              int good = 1;
-              if(addbin1 < 0) { good = 0; }
-              if(addbin1 >= 18) { good = 0; }
-              if(addbin2 < 0) { good = 0; }
-              if(addbin2 >= 18) { good = 0; }
-              if(addbin3 < 0) { good = 0; }
-              if(addbin3 >= 18) { good = 0; }
-              addbin = (addbin3 * 18 * 18) + (addbin2 * 18) + (addbin1);
-              dist = powf((jsqrd + ksqrd + lsqrd), 0.5);
-              fraction = 1.0 - (double(dist / int(sigmas[i])) * double(dist / int(sigmas[i])));
-              if(dist <= int(sigmas[i]) && good == 1)
-              {
-                addweight = (weights[i] * fraction);
-                if(sigmas[i] == 0.0) { addweight = weights[i]; }
-                odf[addbin] = odf[addbin] + addweight;
-                totaladdweight = totaladdweight + addweight;
-              }
-            }
-          }
-        }
-      }
-      if(totaladdweight > totalweight)
-      {
-        float scale = (totaladdweight / totalweight);
-        for (int i = 0; i < CubicOps::k_OdfSize; i++)
-        {
-          odf[i] = odf[i] / scale;
-        }
-      }
-      float remainingweight = totalweight;
-      for (int i = 0; i < CubicOps::k_OdfSize; i++)
-      {
-        remainingweight = remainingweight - odf[i];
-      }
-      float random1, random2, random3;
-      float ea1, ea2, ea3;
-      for (size_t i = 0; i < static_cast<size_t>(remainingweight); i++)
-      {
-        random1 = rg.genrand_res53();
-        random2 = rg.genrand_res53();
-        random3 = rg.genrand_res53();
-        ea1 = 2.0 * DREAM3D::Constants::k_Pi * random1;
-        ea2 = acos(2.0 * (random2 - 0.5));
-        ea3 = 2.0 * DREAM3D::Constants::k_Pi * random3;
-        OrientationMath::EulertoRod(ea1, ea2, ea3, r1, r2, r3);
-        ops.getODFFZRod(r1, r2, r3);
-        bin = ops.getOdfBin(r1, r2, r3);
-        odf[bin]++;
-      }
-      if(normalize == true)
-      {
-        // Normalize the odf
-        for (int i = 0; i < CubicOps::k_OdfSize; i++)
-        {
-          odf[i] = odf[i] / totalweight;
-        }
-      }
+      CalculateODFData<T, CubicOps>(e1s, e2s, e3s, weights, sigmas, normalize, odf, numEntries, 18, 18, 18);
     }
 
     /**
@@ -218,112 +270,7 @@ class Texture
     template<typename T>
     static void CalculateHexODFData(T* e1s, T* e2s, T* e3s, T* weights, T* sigmas, bool normalize, T* odf, size_t numEntries)
     {
-      DREAM3D_RANDOMNG_NEW()
-      Int32ArrayType::Pointer textureBins = Int32ArrayType::CreateArray(numEntries, "TextureBins");
-      int32_t* TextureBins = textureBins->getPointer(0);
-      float addweight = 0;
-      float totaladdweight = 0;
-      float totalweight = 3 * HexagonalOps::k_OdfSize;
-      int bin, addbin;
-      int bin1, bin2, bin3;
-      int addbin1, addbin2, addbin3;
-      float dist, fraction;
-      //    float rmag, angle;
-      float r1 = 0, r2 = 0, r3 = 0;
-      HexagonalOps ops;
-      for (size_t i = 0; i < numEntries; i++)
-      {
-        OrientationMath::EulertoRod(e1s[i], e2s[i], e3s[i], r1, r2, r3);
-        ops.getODFFZRod(r1, r2, r3);
-        bin = ops.getOdfBin(r1, r2, r3);
-        TextureBins[i] = static_cast<int>(bin);
-      }
-
-      for (int i = 0; i < HexagonalOps::k_OdfSize; i++)
-      {
-        odf[i] = 0;
-      }
-      for (size_t i = 0; i < numEntries; i++)
-      {
-        bin = TextureBins[i];
-        bin1 = bin % 36;
-        bin2 = (bin / 36) % 36;
-        bin3 = bin / (36 * 36);
-        for (int j = -sigmas[i]; j <= sigmas[i]; j++)
-        {
-          int jsqrd = j * j;
-          for (int k = -sigmas[i]; k <= sigmas[i]; k++)
-          {
-            int ksqrd = k * k;
-            for (int l = -sigmas[i]; l <= sigmas[i]; l++)
-            {
-              int lsqrd = l * l;
-              addbin1 = bin1 + int(j);
-              addbin2 = bin2 + int(k);
-              addbin3 = bin3 + int(l);
-              //if(addbin1 < 0) addbin1 = addbin1 + 36;
-              //if(addbin1 >= 36) addbin1 = addbin1 - 36;
-              //if(addbin2 < 0) addbin2 = addbin2 + 36;
-              //if(addbin2 >= 36) addbin2 = addbin2 - 36;
-              //if(addbin3 < 0) addbin3 = addbin3 + 12;
-              //if(addbin3 >= 12) addbin3 = addbin3 - 12;
-              int good = 1;
-              if(addbin1 < 0) { good = 0; }
-              if(addbin1 >= 36) { good = 0; }
-              if(addbin2 < 0) { good = 0; }
-              if(addbin2 >= 36) { good = 0; }
-              if(addbin3 < 0) { good = 0; }
-              if(addbin3 >= 12) { good = 0; }
-              addbin = (addbin3 * 36 * 36) + (addbin2 * 36) + (addbin1);
-              dist = powf((jsqrd + ksqrd + lsqrd), 0.5);
-              fraction = 1.0 - (double(dist / int(sigmas[i])) * double(dist / int(sigmas[i])));
-              if(dist <= int(sigmas[i]) && good == 1)
-              {
-                addweight = (weights[i] * fraction);
-                if(sigmas[i] == 0.0) { addweight = weights[i]; }
-                odf[addbin] = odf[addbin] + addweight;
-                totaladdweight = totaladdweight + addweight;
-              }
-            }
-          }
-        }
-      }
-      if(totaladdweight > totalweight)
-      {
-        float scale = (totaladdweight / totalweight);
-        for (int i = 0; i < HexagonalOps::k_OdfSize; i++)
-        {
-          odf[i] = odf[i] / scale;
-        }
-      }
-      float remainingweight = totalweight;
-      for (int i = 0; i < HexagonalOps::k_OdfSize; i++)
-      {
-        remainingweight = remainingweight - odf[i];
-      }
-      float random1, random2, random3;
-      float ea1, ea2, ea3;
-      for (size_t i = 0; i < static_cast<size_t>(remainingweight); i++)
-      {
-        random1 = rg.genrand_res53();
-        random2 = rg.genrand_res53();
-        random3 = rg.genrand_res53();
-        ea1 = 2.0 * DREAM3D::Constants::k_Pi * random1;
-        ea2 = acos(2.0 * (random2 - 0.5));
-        ea3 = 2.0 * DREAM3D::Constants::k_Pi * random3;
-        OrientationMath::EulertoRod(ea1, ea2, ea3, r1, r2, r3);
-        ops.getODFFZRod(r1, r2, r3);
-        bin = ops.getOdfBin(r1, r2, r3);
-        odf[bin]++;
-      }
-      if(normalize == true)
-      {
-        // Normalize the odf
-        for (int i = 0; i < HexagonalOps::k_OdfSize; i++)
-        {
-          odf[i] = odf[i] / totalweight;
-        }
-      }
+      CalculateODFData<T, HexagonalOps>(e1s, e2s, e3s, weights, sigmas, normalize, odf, numEntries, 36, 36, 12);
     }
 
     /**
@@ -345,112 +292,7 @@ class Texture
     template<typename T>
     static void CalculateOrthoRhombicODFData(T* e1s, T* e2s, T* e3s, T* weights, T* sigmas, bool normalize, T* odf, size_t numEntries)
     {
-      DREAM3D_RANDOMNG_NEW()
-      Int32ArrayType::Pointer textureBins = Int32ArrayType::CreateArray(numEntries, "TextureBins");
-      int32_t* TextureBins = textureBins->getPointer(0);
-      float addweight = 0;
-      float totaladdweight = 0;
-      float totalweight = 3 * OrthoRhombicOps::k_OdfSize;
-      int bin, addbin;
-      int bin1, bin2, bin3;
-      int addbin1, addbin2, addbin3;
-      float dist, fraction;
-      float r1 = 0, r2 = 0, r3 = 0;
-      OrthoRhombicOps ops;
-      for (size_t i = 0; i < numEntries; i++)
-      {
-        OrientationMath::EulertoRod(e1s[i], e2s[i], e3s[i], r1, r2, r3);
-        ops.getODFFZRod(r1, r2, r3);
-        bin = ops.getOdfBin(r1, r2, r3);
-        TextureBins[i] = static_cast<int>(bin);
-      }
-
-      for (int i = 0; i < OrthoRhombicOps::k_OdfSize; i++)
-      {
-        odf[i] = 0;
-      }
-      for (size_t i = 0; i < numEntries; i++)
-      {
-        bin = TextureBins[i];
-        bin1 = bin % 36;
-        bin2 = (bin / 36) % 36;
-        bin3 = bin / (36 * 36);
-        for (int j = -sigmas[i]; j <= sigmas[i]; j++)
-        {
-          int jsqrd = j * j;
-          for (int k = -sigmas[i]; k <= sigmas[i]; k++)
-          {
-            int ksqrd = k * k;
-            for (int l = -sigmas[i]; l <= sigmas[i]; l++)
-            {
-              int lsqrd = l * l;
-              addbin1 = bin1 + int(j);
-              addbin2 = bin2 + int(k);
-              addbin3 = bin3 + int(l);
-              //if (addbin1 < 0) addbin1 = addbin1 + 36;
-              //if (addbin1 >= 36) addbin1 = addbin1 - 36;
-              //if (addbin2 < 0) addbin2 = addbin2 + 36;
-              //if (addbin2 >= 36) addbin2 = addbin2 - 36;
-              //if (addbin3 < 0) addbin3 = addbin3 + 36;
-              //if (addbin3 >= 36) addbin3 = addbin3 - 36;
-              int good = 1;
-              if (addbin1 < 0) { good = 0; }
-              if (addbin1 >= 36) { good = 0; }
-              if (addbin2 < 0) { good = 0; }
-              if (addbin2 >= 36) { good = 0; }
-              if (addbin3 < 0) { good = 0; }
-              if (addbin3 >= 36) { good = 0; }
-              addbin = (addbin3 * 36 * 36) + (addbin2 * 36) + (addbin1);
-              dist = sqrtf(jsqrd + ksqrd + lsqrd);
-              fraction = 1.0 - (float(dist / int(sigmas[i])) * float(dist / int(sigmas[i])));
-              if (dist <= int(sigmas[i]) && good == 1)
-              {
-                addweight = (weights[i] * fraction);
-                if(sigmas[i] == 0.0) { addweight = weights[i]; }
-                odf[addbin] = odf[addbin] + addweight;
-                totaladdweight = totaladdweight + addweight;
-              }
-            }
-          }
-        }
-      }
-      if(totaladdweight > totalweight)
-      {
-        float scale = (totaladdweight / totalweight);
-        for (int i = 0; i < OrthoRhombicOps::k_OdfSize; i++)
-        {
-          odf[i] = odf[i] / scale;
-        }
-      }
-      float remainingweight = totalweight;
-      for (int i = 0; i < OrthoRhombicOps::k_OdfSize; i++)
-      {
-        remainingweight = remainingweight - odf[i];
-      }
-      float random1, random2, random3;
-      float ea1, ea2, ea3;
-      for (size_t i = 0; i < static_cast<size_t>(remainingweight); i++)
-      {
-        random1 = rg.genrand_res53();
-        random2 = rg.genrand_res53();
-        random3 = rg.genrand_res53();
-        ea1 = 2.0 * DREAM3D::Constants::k_Pi * random1;
-        ea2 = acos(2.0 * (random2 - 0.5));
-        ea3 = 2.0 * DREAM3D::Constants::k_Pi * random3;
-        OrientationMath::EulertoRod(ea1, ea2, ea3, r1, r2, r3);
-        ops.getODFFZRod(r1, r2, r3);
-        bin = ops.getOdfBin(r1, r2, r3);
-        odf[bin]++;
-      }
-      if (normalize == true)
-      {
-        // Normalize the odf
-        for (int i = 0; i < OrthoRhombicOps::k_OdfSize; i++)
-        {
-          odf[i] = odf[i] / totalweight;
-        }
-      }
-
+      CalculateODFData<T, OrthoRhombicOps>(e1s, e2s, e3s, weights, sigmas, normalize, odf, numEntries, 36, 36, 36);
     }
 
     /**
@@ -481,10 +323,10 @@ class Texture
       float ea21, ea22, ea23;
       QuatF q1;
       QuatF q2;
-      float totaldensity;
       float r1, r2, r3;
       float n1, n2, n3;
-      float random1, random2, density;
+      float random1, random2;
+      DistributionSampler<T> sampler(odf, odfsize);
 
       for (int i = 0; i < mdfsize; i++)
       {
@@ -505,18 +347,8 @@ class Texture
       {
         random1 = rg.genrand_res53();
         random2 = rg.genrand_res53();
-        choose1 = 0;
-        choose2 = 0;
-
-        totaldensity = 0;
-        for (int j = 0; j < odfsize; j++)
-        {
-          density = odf[j];
-          float d = totaldensity;
-          totaldensity = totaldensity + density;
-          if(random1 >= d && random1 < totaldensity) { choose1 = static_cast<int>(j); }
-          if(random2 >= d && random2 < totaldensity) { choose2 = static_cast<int>(j); }
-        }
+        choose1 = sampler.pick(random1);
+        choose2 = sampler.pick(random2);
         orientationOps.determineEulerAngles(choose1, ea11, ea12, ea13);
         OrientationMath::EulertoQuat(ea11, ea12, ea13, q1);
         orientationOps.determineEulerAngles(choose2, ea21, ea22, ea23);
@@ -541,6 +373,95 @@ class Texture
   protected:
     Texture() {}
 
+    /**
+    * @brief Calculates the ODF of a set of weighted orientations for the crystal symmetry of the OrientationOpsType
+    * class. The orientations are binned and each weight is smeared over the bins within sigma of its bin in
+    * parallel, each task accumulating into its own ODF which are summed at the end. The rest of the total
+    * weight is then spread over randomly chosen orientations.
+    * @param e1s The first euler angles
+    * @param e2s The second euler angles
+    * @param e3s The third euler angles
+    * @param weights Array of weights values.
+    * @param sigmas Array of sigma values.
+    * @param normalize Should the ODF data be normalized by the totalWeight value before returning.
+    * @param odf (OUT) The ODF data that is generated from this function. It must hold dim1 * dim2 * dim3 values.
+    * @param numEntries The number of entries of Angle/Weight/Sigmas
+    * @param dim1 The number of ODF bins along the first axis
+    * @param dim2 The number of ODF bins along the second axis
+    * @param dim3 The number of ODF bins along the third axis
+    */
+    template<typename T, class OrientationOpsType>
+    static void CalculateODFData(T* e1s, T* e2s, T* e3s, T* weights, T* sigmas, bool normalize, T* odf, size_t numEntries,
+                                 int dim1, int dim2, int dim3)
+    {
+      DREAM3D_RANDOMNG_NEW()
+      OrientationOpsType ops;
+      const int odfSize = dim1 * dim2 * dim3;
+      Int32ArrayType::Pointer textureBins = Int32ArrayType::CreateArray(numEntries, "TextureBins");
+      int32_t* TextureBins = textureBins->getPointer(0);
+      float totalweight = float(3 * odfSize);
+      int bin;
+      float r1 = 0, r2 = 0, r3 = 0;
+
+      int dims[3] = { dim1, dim2, dim3 };
+      TextureBinsImpl<T, OrientationOpsType> binner(e1s, e2s, e3s, TextureBins);
+      TextureSmoothingImpl<T> smoother(TextureBins, weights, sigmas, dims);
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+      tbb::task_scheduler_init init;
+      bool doParallel = true;
+      if (doParallel == true)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numEntries), binner, tbb::auto_partitioner());
+        tbb::parallel_reduce(tbb::blocked_range<size_t>(0, numEntries), smoother, tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        binner.convert(0, numEntries);
+        smoother.smooth(0, numEntries);
+      }
+
+      const std::vector<T>& smoothed = smoother.getODF();
+      float totaladdweight = static_cast<float>(smoother.getTotalAddWeight());
+      float scale = 1.0f;
+      if(totaladdweight > totalweight)
+      {
+        scale = (totaladdweight / totalweight);
+      }
+      for (int i = 0; i < odfSize; i++)
+      {
+        odf[i] = smoothed[i] / scale;
+      }
+      float remainingweight = totalweight;
+      for (int i = 0; i < odfSize; i++)
+      {
+        remainingweight = remainingweight - odf[i];
+      }
+      float random1, random2, random3;
+      float ea1, ea2, ea3;
+      for (size_t i = 0; i < static_cast<size_t>(remainingweight); i++)
+      {
+        random1 = rg.genrand_res53();
+        random2 = rg.genrand_res53();
+        random3 = rg.genrand_res53();
+        ea1 = 2.0 * DREAM3D::Constants::k_Pi * random1;
+        ea2 = acos(2.0 * (random2 - 0.5));
+        ea3 = 2.0 * DREAM3D::Constants::k_Pi * random3;
+        OrientationMath::EulertoRod(ea1, ea2, ea3, r1, r2, r3);
+        ops.OrientationOpsType::getODFFZRod(r1, r2, r3);
+        bin = ops.OrientationOpsType::getOdfBin(r1, r2, r3);
+        odf[bin]++;
+      }
+      if(normalize == true)
+      {
+        // Normalize the odf
+        for (int i = 0; i < odfSize; i++)
+        {
+          odf[i] = odf[i] / totalweight;
+        }
+      }
+    }
+
   private:
     Texture(const Texture&); // Copy Constructor Not Implemented
     void operator=(const Texture&); // Operator '=' Not Implemented
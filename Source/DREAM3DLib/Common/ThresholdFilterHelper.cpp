@@ -41,7 +41,20 @@
 ThresholdFilterHelper::ThresholdFilterHelper(DREAM3D::Comparison::Enumeration compType, double compValue, BoolArrayType* output) :
   comparisonOperator(compType),
   comparisonValue(compValue),
-  m_Output(output)
+  m_Output(output),
+  m_BitOutput(NULL)
+{
+
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdFilterHelper::ThresholdFilterHelper(DREAM3D::Comparison::Enumeration compType, double compValue, BitArray* output) :
+  comparisonOperator(compType),
+  comparisonValue(compValue),
+  m_Output(NULL),
+  m_BitOutput(output)
 {
 
 }
@@ -77,9 +90,20 @@ int ThresholdFilterHelper::execute(IDataArray* input, IDataArray* output)
   {
     return -1;
   }
-  m_Output->initializeWithZeros();
+  if (NULL != m_BitOutput) { m_BitOutput->initializeWithZeros(); }
+  else { m_Output->initializeWithZeros(); }
   QString dType = input->getTypeAsString();
 
+  // Compact float arrays are compared through their decoded values
+  QuantizedFloatArray* compactInput = dynamic_cast<QuantizedFloatArray*>(input);
+  if (NULL != compactInput)
+  {
+    if (comparisonOperator == DREAM3D::Comparison::Operator_LessThan) { filterQuantizedData(compactInput, std::less<float>()); }
+    else if (comparisonOperator == DREAM3D::Comparison::Operator_GreaterThan) { filterQuantizedData(compactInput, std::greater<float>()); }
+    else if (comparisonOperator == DREAM3D::Comparison::Operator_Equal) { filterQuantizedData(compactInput, std::equal_to<float>()); }
+    return 1;
+  }
+
   FILTER_DATA_HELPER(dType, comparisonOperator, float);
   FILTER_DATA_HELPER(dType, comparisonOperator, double);
 
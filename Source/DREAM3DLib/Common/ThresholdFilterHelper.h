@@ -37,12 +37,16 @@
 #define _ThresholdFilterHelperHelper_H_
 
 
+#include <functional>
+
 #include "DREAM3DLib/DREAM3DLib.h"
 #include "DREAM3DLib/Common/IDataArrayFilter.h"
 #include "DREAM3DLib/FilterParameters/FilterParameter.h"
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/DataArrays/IDataArray.h"
 #include "DREAM3DLib/DataArrays/DataArray.hpp"
+#include "DREAM3DLib/DataArrays/BitArray.hpp"
+#include "DREAM3DLib/DataArrays/QuantizedFloatArray.hpp"
 
 /**
  * @brief The ThresholdFilterHelper class
@@ -54,6 +58,13 @@ class DREAM3DLib_EXPORT ThresholdFilterHelper : public IDataArrayFilter
                           double compValue,
                           BoolArrayType* output);
 
+    /**
+     * @brief Writes the result of the comparison packed into a BitArray instead of a DataArray<bool>
+     */
+    ThresholdFilterHelper(DREAM3D::Comparison::Enumeration compType,
+                          double compValue,
+                          BitArray* output);
+
     virtual ~ThresholdFilterHelper();
 
     /**
@@ -65,6 +76,11 @@ class DREAM3DLib_EXPORT ThresholdFilterHelper : public IDataArrayFilter
       size_t m_NumValues = m_Input->getNumberOfTuples();
       T v = static_cast<T>(comparisonValue);
       T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
+      if (NULL != m_BitOutput)
+      {
+        packComparison<T>(data, m_NumValues, v, std::less<T>());
+        return;
+      }
       for (size_t i = 0; i < m_NumValues; ++i)
       {
         bool b = (data[i] < v);
@@ -81,6 +97,11 @@ class DREAM3DLib_EXPORT ThresholdFilterHelper : public IDataArrayFilter
       size_t m_NumValues = m_Input->getNumberOfTuples();
       T v = static_cast<T>(comparisonValue);
       T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
+      if (NULL != m_BitOutput)
+      {
+        packComparison<T>(data, m_NumValues, v, std::greater<T>());
+        return;
+      }
       for (size_t i = 0; i < m_NumValues; ++i)
       {
         bool b = (data[i] > v);
@@ -97,6 +118,11 @@ class DREAM3DLib_EXPORT ThresholdFilterHelper : public IDataArrayFilter
       size_t m_NumValues = m_Input->getNumberOfTuples();
       T v = static_cast<T>(comparisonValue);
       T* data = IDataArray::SafeReinterpretCast<IDataArray*, DataArray<T>*, T*>(m_Input);
+      if (NULL != m_BitOutput)
+      {
+        packComparison<T>(data, m_NumValues, v, std::equal_to<T>());
+        return;
+      }
       for (size_t i = 0; i < m_NumValues; ++i)
       {
         bool b = (data[i] == v);
@@ -113,10 +139,69 @@ class DREAM3DLib_EXPORT ThresholdFilterHelper : public IDataArrayFilter
     */
     int execute(IDataArray* input, IDataArray* output);
 
+  protected:
+    /**
+     * @brief Compares the values of a QuantizedFloatArray, decoding 64 of them at a time, so that thresholding a
+     * compact array does not expand it into a DataArray<float>
+     */
+    template<typename Compare>
+    void filterQuantizedData(QuantizedFloatArray* input, Compare comp)
+    {
+      size_t numValues = input->getNumberOfTuples();
+      float v = static_cast<float>(comparisonValue);
+      float block[64];
+      for (size_t start = 0; start < numValues; start += 64)
+      {
+        size_t count = (start + 64 < numValues) ? 64 : numValues - start;
+        for (size_t i = 0; i < count; ++i)
+        {
+          block[i] = input->getValue(start + i);
+        }
+        if (NULL != m_BitOutput)
+        {
+          BitArray::WordType bits = 0;
+          for (size_t i = 0; i < count; ++i)
+          {
+            bits |= static_cast<BitArray::WordType>(comp(block[i], v)) << i;
+          }
+          m_BitOutput->getWordPointer(0)[start / 64] = bits;
+        }
+        else
+        {
+          for (size_t i = 0; i < count; ++i)
+          {
+            m_Output->setValue(start + i, comp(block[i], v));
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Compares 64 values at a time and stores each group of results as one word of the BitArray output
+     */
+    template<typename T, typename Compare>
+    void packComparison(const T* data, size_t numValues, T v, Compare comp)
+    {
+      BitArray::WordType* words = m_BitOutput->getWordPointer(0);
+      size_t numWords = m_BitOutput->getNumberOfWords();
+      for (size_t w = 0; w < numWords; ++w)
+      {
+        size_t start = w * 64;
+        size_t end = (start + 64 < numValues) ? start + 64 : numValues;
+        BitArray::WordType bits = 0;
+        for (size_t i = start; i < end; ++i)
+        {
+          bits |= static_cast<BitArray::WordType>(comp(data[i], v)) << (i - start);
+        }
+        words[w] = bits;
+      }
+    }
+
   private:
     DREAM3D::Comparison::Enumeration comparisonOperator;
     double comparisonValue;
     BoolArrayType* m_Output;
+    BitArray* m_BitOutput;
 
 
     ThresholdFilterHelper(const ThresholdFilterHelper&); // Copy Constructor Not Implemented
@@ -134,7 +134,7 @@ void LinkFeatureMapToCellArray::dataCheck()
   m_SelectedCellDataPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getSelectedCellArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_SelectedCellDataPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
   {
-    m_SelectedCellData = m_SelectedCellDataPtr.lock()->getPointer(0);    /* Now assign the raw pointer to data from the DataArray<T> object */
+    m_SelectedCellData = m_SelectedCellDataPtr.lock()->getConstPointer(0);    /* Now assign the raw pointer to data from the DataArray<T> object */
   }
 
   tempPath.update(getSelectedCellArrayPath().getDataContainerName(), getCellFeatureAttributeMatrixName(), getActiveArrayName() );
@@ -138,7 +138,7 @@ class DREAM3DLib_EXPORT LinkFeatureMapToCellArray : public AbstractFilter
     void updateFeatureInstancePointers();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, SelectedCellData)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, SelectedCellData)
     DEFINE_CREATED_DATAARRAY_VARIABLE(bool, Active)
 
     LinkFeatureMapToCellArray(const LinkFeatureMapToCellArray&); // Copy Constructor Not Implemented
@@ -0,0 +1,589 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _BitArray_H_
+#define _BitArray_H_
+
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include <vector>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/DREAM3DSetGetMacros.h"
+#include "DREAM3DLib/DataArrays/IDataArray.h"
+#include "DREAM3DLib/DataArrays/DataArray.hpp"
+#include "DREAM3DLib/HDF5/H5DataArrayReader.h"
+
+/**
+ * @class BitArray BitArray.hpp DREAM3DLib/DataArrays/BitArray.hpp
+ * @brief Stores boolean values packed 64 to a 64 bit word so that a packed mask takes 1/8th of the memory of a
+ * DataArray<bool> and logical operations between masks work on 64 values at a time. Value i lives in bit
+ * (i % 64) of word (i / 64); the unused bits of the last word are always zero.
+ *
+ * The masks kept in the attribute matrices (GoodVoxels, SurfaceFeatures, BoundaryCells, Active, ...) are still
+ * stored as DataArray<bool>, one byte per value, because every filter that reads them and the resampling filters
+ * that copy their Tuples expect that type. BitArray is only used for the temporary masks inside MultiThresholdObjects,
+ * ErodeDilateMask, ClearDataMask and IdentifySample, so the memory of a stored mask does not shrink.
+ *
+ * The array is written to and read from HDF5 files with exactly the layout of a DataArray<bool>, so a file
+ * written from a BitArray reads back as a DataArray<bool> and vice versa. Because the values are not byte
+ * addressable getVoidPointer() always returns NULL, the same as NeighborList. Code that memcpy's Tuples
+ * through getVoidPointer()/getTypeSize() (the resampling filters for example) must use a DataArray<bool>;
+ * use getWordPointer() to work on the packed words directly.
+ */
+class BitArray : public IDataArray
+{
+  public:
+    DREAM3D_SHARED_POINTERS(BitArray )
+    DREAM3D_TYPE_MACRO_SUPER(BitArray, IDataArray)
+    DREAM3D_CLASS_VERSION(2)
+
+    typedef uint64_t WordType;
+
+    /**
+     * @brief Static constructor
+     * @param numTuples The number of Tuples in the array
+     * @param name The name of the array
+     * @param allocate Allocate (and zero) the words
+     * @return
+     */
+    static Pointer CreateArray(size_t numTuples, const QString& name, bool allocate = true)
+    {
+      QVector<size_t> cDims(1, 1);
+      return CreateArray(numTuples, cDims, name, allocate);
+    }
+
+    /**
+     * @brief Static constructor
+     * @param numTuples The number of Tuples in the array
+     * @param cDims The dimensions of the values at each Tuple
+     * @param name The name of the array
+     * @param allocate Allocate (and zero) the words
+     * @return
+     */
+    static Pointer CreateArray(size_t numTuples, QVector<size_t> cDims, const QString& name, bool allocate = true)
+    {
+      if (name.isEmpty() == true || cDims.size() == 0)
+      {
+        return NullPointer();
+      }
+      BitArray* d = new BitArray(numTuples, cDims, name, allocate);
+      Pointer ptr(d);
+      return ptr;
+    }
+
+    /**
+     * @brief Creates a BitArray holding the same values as a DataArray<bool>
+     * @param src The array to pack
+     * @return
+     */
+    static Pointer FromBoolArray(BoolArrayType* src)
+    {
+      if (NULL == src)
+      {
+        return NullPointer();
+      }
+      Pointer p = CreateArray(src->getNumberOfTuples(), src->getComponentDimensions(), src->getName(), src->isAllocated());
+      if (NULL != p.get() && src->isAllocated() == true)
+      {
+        p->packFrom(src->getConstPointer(0));
+      }
+      return p;
+    }
+
+    virtual IDataArray::Pointer createNewArray(size_t numElements, int rank, size_t* dims, const QString& name, bool allocate = true)
+    {
+      QVector<size_t> cDims(rank, 0);
+      for (int i = 0; i < rank; ++i) { cDims[i] = dims[i]; }
+      IDataArray::Pointer p = BitArray::CreateArray(numElements, cDims, name, allocate);
+      return p;
+    }
+
+    virtual IDataArray::Pointer createNewArray(size_t numElements, std::vector<size_t> dims, const QString& name, bool allocate = true)
+    {
+      IDataArray::Pointer p = BitArray::CreateArray(numElements, QVector<size_t>::fromStdVector(dims), name, allocate);
+      return p;
+    }
+
+    virtual IDataArray::Pointer createNewArray(size_t numElements, QVector<size_t> dims, const QString& name, bool allocate = true)
+    {
+      IDataArray::Pointer p = BitArray::CreateArray(numElements, dims, name, allocate);
+      return p;
+    }
+
+    virtual ~BitArray() {}
+
+    virtual bool isAllocated() { return m_IsAllocated; }
+
+    void getXdmfTypeAndSize(QString& xdmfTypeName, int& precision)
+    {
+      // This is what a DataArray<bool> reports, which is what ends up in the file
+      xdmfTypeName = "uchar";
+      precision = 1;
+    }
+
+    virtual QString getTypeAsString() { return "BitArray"; }
+
+    QString getFullNameOfClass() { return "BitArray"; }
+
+    void setName(const QString& name) { m_Name = name; }
+
+    QString getName() { return m_Name; }
+
+    /**
+     * @brief The words are always owned by this class
+     */
+    virtual void takeOwnership() {}
+
+    /**
+     * @brief The words are always owned by this class
+     */
+    virtual void releaseOwnership() {}
+
+    /**
+     * @brief The values are packed into bits and can not be addressed through a void pointer. A pointer to
+     * the word holding value i would let callers overwrite 63 of its neighbors, so NULL is returned instead.
+     * @param i The index of the value
+     * @return NULL
+     */
+    virtual void* getVoidPointer(size_t i) { return NULL; }
+
+    virtual size_t getNumberOfTuples() { return m_NumTuples; }
+
+    virtual size_t getSize() { return m_Size; }
+
+    virtual int getNumberOfComponents() { return static_cast<int>(m_NumComponents); }
+
+    virtual QVector<size_t> getComponentDimensions() { return m_CompDims; }
+
+    /**
+     * @brief Returns the size of the words the values are packed into
+     */
+    virtual size_t getTypeSize() { return sizeof(WordType); }
+
+    /**
+     * @brief Returns the number of words the values are packed into
+     */
+    size_t getNumberOfWords() { return m_Words.size(); }
+
+    /**
+     * @brief Returns a pointer to the w'th word. No bounds checking is performed.
+     * @param w The index of the word
+     */
+    WordType* getWordPointer(size_t w) { return &(m_Words[w]); }
+
+    /**
+     * @brief getValue
+     * @param i The index of the value
+     */
+    inline bool getValue(size_t i)
+    {
+      return ((m_Words[i >> 6] >> (i & 63)) & 1) != 0;
+    }
+
+    /**
+     * @brief setValue
+     * @param i The index of the value
+     * @param value The new value
+     */
+    inline void setValue(size_t i, bool value)
+    {
+      WordType bit = static_cast<WordType>(1) << (i & 63);
+      if (value) { m_Words[i >> 6] |= bit; }
+      else { m_Words[i >> 6] &= ~bit; }
+    }
+
+    /**
+     * @brief Packs getSize() values from a bool array into this array
+     * @param src The values to pack
+     */
+    void packFrom(const bool* src)
+    {
+      size_t numWords = m_Words.size();
+      for (size_t w = 0; w < numWords; ++w)
+      {
+        size_t start = w * 64;
+        size_t end = (start + 64 < m_Size) ? start + 64 : m_Size;
+        WordType bits = 0;
+        for (size_t i = start; i < end; ++i)
+        {
+          bits |= static_cast<WordType>(src[i]) << (i - start);
+        }
+        m_Words[w] = bits;
+      }
+    }
+
+    /**
+     * @brief Unpacks getSize() values from this array into a bool array
+     * @param dest The array to unpack into
+     */
+    void unpackTo(bool* dest)
+    {
+      size_t numWords = m_Words.size();
+      for (size_t w = 0; w < numWords; ++w)
+      {
+        size_t start = w * 64;
+        size_t end = (start + 64 < m_Size) ? start + 64 : m_Size;
+        WordType bits = m_Words[w];
+        for (size_t i = start; i < end; ++i)
+        {
+          dest[i] = ((bits >> (i - start)) & 1) != 0;
+        }
+      }
+    }
+
+    /**
+     * @brief Sets every value to the same value
+     * @param value
+     */
+    void fill(bool value)
+    {
+      std::fill(m_Words.begin(), m_Words.end(), value ? ~static_cast<WordType>(0) : static_cast<WordType>(0));
+      clearPadding();
+    }
+
+    /**
+     * @brief this = this AND other. Both arrays must be the same size.
+     */
+    void andWith(BitArray* other)
+    {
+      const WordType* src = other->getWordPointer(0);
+      size_t numWords = m_Words.size();
+      for (size_t w = 0; w < numWords; ++w) { m_Words[w] &= src[w]; }
+    }
+
+    /**
+     * @brief this = this OR other. Both arrays must be the same size.
+     */
+    void orWith(BitArray* other)
+    {
+      const WordType* src = other->getWordPointer(0);
+      size_t numWords = m_Words.size();
+      for (size_t w = 0; w < numWords; ++w) { m_Words[w] |= src[w]; }
+    }
+
+    /**
+     * @brief this = NOT this
+     */
+    void invert()
+    {
+      size_t numWords = m_Words.size();
+      for (size_t w = 0; w < numWords; ++w) { m_Words[w] = ~m_Words[w]; }
+      clearPadding();
+    }
+
+    /**
+     * @brief Sets value i of this array to value (i + offset) of src, or to false where (i + offset) is off either
+     * end of src. Both arrays must be the same size. This shifts a whole volume by a neighbor offset 64 values at a time.
+     * @param src The array to read from. Must not be this array.
+     * @param offset The offset to read at
+     */
+    void assignShifted(BitArray* src, int64_t offset)
+    {
+      const WordType* words = src->getWordPointer(0);
+      int64_t numWords = static_cast<int64_t>(m_Words.size());
+      // Split the offset into whole words and a bit shift, rounding towards negative infinity
+      int64_t wordOffset = (offset >= 0) ? (offset >> 6) : -((-offset + 63) >> 6);
+      int bitOffset = static_cast<int>(offset - wordOffset * 64);
+      for (int64_t w = 0; w < numWords; ++w)
+      {
+        int64_t lo = w + wordOffset;
+        WordType loWord = (lo >= 0 && lo < numWords) ? words[lo] : 0;
+        WordType value = loWord >> bitOffset;
+        if (bitOffset != 0)
+        {
+          int64_t hi = lo + 1;
+          WordType hiWord = (hi >= 0 && hi < numWords) ? words[hi] : 0;
+          value |= hiWord << (64 - bitOffset);
+        }
+        m_Words[w] = value;
+      }
+      clearPadding();
+    }
+
+    /**
+     * @brief Returns the number of values that are true
+     */
+    size_t countTrue()
+    {
+      size_t count = 0;
+      size_t numWords = m_Words.size();
+      for (size_t w = 0; w < numWords; ++w)
+      {
+        // Classic SWAR population count
+        WordType v = m_Words[w];
+        v = v - ((v >> 1) & 0x5555555555555555ULL);
+        v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+        v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        count += static_cast<size_t>((v * 0x0101010101010101ULL) >> 56);
+      }
+      return count;
+    }
+
+    /**
+     * @brief Creates a DataArray<bool> holding the same values as this array
+     */
+    BoolArrayType::Pointer toBoolArray()
+    {
+      BoolArrayType::Pointer p = BoolArrayType::CreateArray(m_NumTuples, m_CompDims, m_Name, m_IsAllocated);
+      if (m_IsAllocated == true && m_Size > 0)
+      {
+        unpackTo(p->getPointer(0));
+      }
+      return p;
+    }
+
+    /**
+     * @brief Removes Tuples from the array. See DataArray::eraseTuples for the error codes.
+     * @param idxs The indices to remove, sorted and strictly increasing
+     * @return error code.
+     */
+    virtual int eraseTuples(QVector<size_t>& idxs)
+    {
+      if(idxs.size() == 0) { return 0; }
+      if (static_cast<size_t>(idxs.size()) >= m_NumTuples)
+      {
+        resize(0);
+        return 0;
+      }
+      for(QVector<size_t>::size_type i = 1; i < idxs.size(); ++i)
+      {
+        if (idxs[i] <= idxs[i - 1]) { return -1; }
+      }
+      if (idxs.back() >= m_NumTuples) { return -100; }
+      size_t newNumTuples = m_NumTuples - idxs.size();
+      std::vector<WordType> newWords((newNumTuples * m_NumComponents + 63) / 64, 0);
+      size_t dest = 0;
+      QVector<size_t>::size_type next = 0;
+      for (size_t t = 0; t < m_NumTuples; ++t)
+      {
+        if (next < idxs.size() && idxs[next] == t) { ++next; continue; }
+        for (size_t c = 0; c < m_NumComponents; ++c, ++dest)
+        {
+          if (getValue(t * m_NumComponents + c)) { newWords[dest >> 6] |= static_cast<WordType>(1) << (dest & 63); }
+        }
+      }
+      m_Words.swap(newWords);
+      m_NumTuples = newNumTuples;
+      m_Size = m_NumTuples * m_NumComponents;
+      return 0;
+    }
+
+    virtual int copyTuple(size_t currentPos, size_t newPos)
+    {
+      if (currentPos >= m_NumTuples || newPos >= m_NumTuples) { return -1; }
+      for (size_t c = 0; c < m_NumComponents; ++c)
+      {
+        setValue(newPos * m_NumComponents + c, getValue(currentPos * m_NumComponents + c));
+      }
+      return 0;
+    }
+
+    virtual IDataArray::Pointer reorderCopy(QVector<size_t> newOrderMap)
+    {
+      if(static_cast<size_t>(newOrderMap.size()) != m_NumTuples)
+      {
+        return IDataArray::NullPointer();
+      }
+      BitArray::Pointer daCopy = BitArray::CreateArray(m_NumTuples, m_CompDims, m_Name, m_IsAllocated);
+      if (m_IsAllocated == true)
+      {
+        for (size_t t = 0; t < m_NumTuples; ++t)
+        {
+          for (size_t c = 0; c < m_NumComponents; ++c)
+          {
+            daCopy->setValue(newOrderMap[t] * m_NumComponents + c, getValue(t * m_NumComponents + c));
+          }
+        }
+      }
+      return daCopy;
+    }
+
+    virtual void initializeTuple(size_t pos, double value)
+    {
+      if (pos >= m_NumTuples) { return; }
+      for (size_t c = 0; c < m_NumComponents; ++c)
+      {
+        setValue(pos * m_NumComponents + c, value != 0.0);
+      }
+    }
+
+    virtual void initializeWithZeros()
+    {
+      fill(false);
+    }
+
+    virtual IDataArray::Pointer deepCopy(bool forceNoAllocate = false)
+    {
+      BitArray::Pointer daCopy = BitArray::CreateArray(m_NumTuples, m_CompDims, m_Name, m_IsAllocated);
+      if (m_IsAllocated == true && forceNoAllocate == false)
+      {
+        daCopy->m_Words = m_Words;
+      }
+      return daCopy;
+    }
+
+    virtual int32_t resizeTotalElements(size_t size)
+    {
+      m_Words.resize((size + 63) / 64, 0);
+      m_Size = size;
+      m_NumTuples = (m_NumComponents > 0) ? size / m_NumComponents : 0;
+      m_IsAllocated = true;
+      clearPadding();
+      return 1;
+    }
+
+    virtual int32_t resize(size_t numTuples)
+    {
+      int32_t check = resizeTotalElements(numTuples * m_NumComponents);
+      m_NumTuples = numTuples;
+      return check;
+    }
+
+    virtual void printTuple(QTextStream& out, size_t i, char delimiter = ',')
+    {
+      for(size_t j = 0; j < m_NumComponents; ++j)
+      {
+        if (j != 0) { out << delimiter; }
+        out << getValue(i * m_NumComponents + j);
+      }
+    }
+
+    virtual void printComponent(QTextStream& out, size_t i, int j)
+    {
+      out << getValue(i * m_NumComponents + j);
+    }
+
+    /**
+     * @brief Writes the values unpacked, exactly as a DataArray<bool> would write them
+     */
+    virtual int writeH5Data(hid_t parentId, QVector<size_t> tDims)
+    {
+      if (m_IsAllocated == false) { return -85648; }
+      BoolArrayType::Pointer p = toBoolArray();
+      return p->writeH5Data(parentId, tDims);
+    }
+
+    virtual int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName,
+                                   const QString& groupPath, const QString& label)
+    {
+      if (m_IsAllocated == false) { return -85648; }
+      QString dimStr;
+      if (m_NumComponents == 1)
+      {
+        out << "    <Attribute Name=\"" << getName() << label  << "\" AttributeType=\"Scalar\" ";
+        dimStr = QString("%1 %2 %3 ").arg(volDims[2]).arg(volDims[1]).arg(volDims[0]);
+      }
+      else
+      {
+        out << "    <Attribute Name=\"" << getName() << label  << "\" AttributeType=\"Vector\" ";
+        dimStr = QString("%1 %2 %3 %4 ").arg(volDims[2]).arg(volDims[1]).arg(volDims[0]).arg(m_NumComponents);
+      }
+      out << "Center=\"Cell\">\n" ;
+      out << "      <DataItem Format=\"HDF\" Dimensions=\"" << dimStr <<  "\" ";
+      out << "NumberType=\"uchar\" Precision=\"1\" >\n" ;
+      out << "        " << hdfFileName << groupPath << "/" << getName() << "\n";
+      out << "      </DataItem>" << "\n";
+      out << "    </Attribute>" << "\n";
+      return 1;
+    }
+
+    /**
+     * @brief Reads a DataArray<bool> from the file and packs it
+     */
+    virtual int readH5Data(hid_t parentId)
+    {
+      resize(0);
+      IDataArray::Pointer p = H5DataArrayReader::ReadIDataArray(parentId, getName());
+      BoolArrayType::Pointer boolArray = boost::dynamic_pointer_cast<BoolArrayType>(p);
+      if (NULL == boolArray.get())
+      {
+        return -1;
+      }
+      m_CompDims = boolArray->getComponentDimensions();
+      m_NumComponents = boolArray->getNumberOfComponents();
+      resize(boolArray->getNumberOfTuples());
+      packFrom(boolArray->getConstPointer(0));
+      return 0;
+    }
+
+  protected:
+    BitArray(size_t numTuples, QVector<size_t> compDims, const QString& name, bool allocate) :
+      m_Name(name),
+      m_NumTuples(numTuples),
+      m_CompDims(compDims),
+      m_IsAllocated(false)
+    {
+      m_NumComponents = m_CompDims[0];
+      for (int i = 1; i < m_CompDims.size(); i++)
+      {
+        m_NumComponents = m_NumComponents * m_CompDims[i];
+      }
+      m_Size = m_NumTuples * m_NumComponents;
+      if (allocate == true)
+      {
+        m_Words.resize((m_Size + 63) / 64, 0);
+        m_IsAllocated = true;
+      }
+    }
+
+    /**
+     * @brief Keeps the bits past the last value of the last word zero
+     */
+    void clearPadding()
+    {
+      size_t used = m_Size & 63;
+      if (used != 0 && m_Words.size() > 0)
+      {
+        m_Words.back() &= (static_cast<WordType>(1) << used) - 1;
+      }
+    }
+
+  private:
+    std::vector<WordType> m_Words;
+    QString m_Name;
+    size_t m_NumTuples;
+    QVector<size_t> m_CompDims;
+    size_t m_NumComponents;
+    size_t m_Size;
+    bool m_IsAllocated;
+
+    BitArray(const BitArray&); //Not Implemented
+    void operator=(const BitArray&); //Not Implemented
+};
+
+#endif /* _BitArray_H_ */
@@ -37,13 +37,16 @@
 
 // STL Includes
 #include <vector>
+#include <algorithm>
 #include <sstream>
 #include <fstream>
+#include <new>
 
 
 #include "DREAM3DLib/DREAM3DLib.h"
 #include "DREAM3DLib/Common/DREAM3DSetGetMacros.h"
 #include "DREAM3DLib/Common/IDataArrayFilter.h"
+#include "DREAM3DLib/Common/PerformanceMonitor.h"
 #include "DREAM3DLib/DataArrays/IDataArray.h"
 #include "DREAM3DLib/HDF5/H5DataArrayWriter.hpp"
 #include "DREAM3DLib/HDF5/H5DataArrayReader.h"
@@ -475,6 +478,7 @@ class DataArray : public IDataArray
      */
     virtual void takeOwnership()
     {
+      if (detachBuffer() == false) { return; }
       m_OwnsData = true;
     }
 
@@ -485,6 +489,7 @@ class DataArray : public IDataArray
      */
     virtual void releaseOwnership()
     {
+      if (detachBuffer() == false) { return; }
       m_OwnsData = false;
     }
 
@@ -499,6 +504,7 @@ class DataArray : public IDataArray
         _deallocate();
       }
       m_Array = NULL;
+      m_SharedBuffer.reset();
       m_OwnsData = true;
       m_IsAllocated = false;
       if (m_Size == 0)
@@ -521,6 +527,7 @@ class DataArray : public IDataArray
       }
       m_Size = newSize;
       m_IsAllocated = true;
+      PerformanceMonitor::AddAllocatedBytes(newSize * sizeof(T));
 
       return 1;
     }
@@ -536,6 +543,7 @@ class DataArray : public IDataArray
         _deallocate();
       }
       m_Array = NULL;
+      m_SharedBuffer.reset();
       m_Size = 0;
       m_OwnsData = true;
       m_MaxId = 0;
@@ -552,6 +560,7 @@ class DataArray : public IDataArray
     virtual void initializeWithZeros()
     {
       if(!m_IsAllocated) { return; }
+      if (detachBuffer() == false) { return; }
       size_t typeSize = sizeof(T);
       ::memset(m_Array, 0, m_Size * typeSize);
     }
@@ -562,6 +571,7 @@ class DataArray : public IDataArray
     virtual void initializeWithValue(T initValue, size_t offset = 0)
     {
       if(!m_IsAllocated) { return; }
+      if (detachBuffer() == false) { return; }
       for (size_t i = offset; i < m_Size; i++)
       {
         m_Array[i] = initValue;
@@ -570,10 +580,11 @@ class DataArray : public IDataArray
 
     /**
      * @brief Removes Tuples from the m_Array. If the size of the vector is Zero nothing is done. If the size of the
-     * vector is greater than or Equal to the number of Tuples then the m_Array is Resized to Zero. If there are
-     * indices that are larger than the size of the original (before erasing operations) then an error code (-100) is
-     * returned from the program.
-     * @param idxs The indices to remove
+     * vector is greater than or Equal to the number of Tuples then the m_Array is Resized to Zero. Otherwise the
+     * indices must be sorted and strictly increasing; if they are not, -1 is returned and the array is unchanged. If
+     * there are indices that are larger than the size of the original (before erasing operations) then an error
+     * code (-100) is returned from the program.
+     * @param idxs The indices to remove, sorted and strictly increasing
      * @return error code.
      */
     virtual int eraseTuples(QVector<size_t>& idxs)
@@ -593,80 +604,35 @@ class DataArray : public IDataArray
         return 0;
       }
 
-      // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
-      // off the end of the array and return an error code.
-      for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
+      // The runs of kept Tuples are found by walking the indices in order, so unsorted or repeated indices are
+      // rejected before anything is touched
+      for(QVector<size_t>::size_type i = 1; i < idxs.size(); ++i)
       {
-        if (idxs[i] * m_NumComponents > m_MaxId) { return -100; }
+        if (idxs[i] <= idxs[i - 1]) { return -1; }
       }
 
+      // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
+      // off the end of the array and return an error code. The indices are sorted so only the last one needs checking.
+      if (idxs.back() * m_NumComponents > m_MaxId) { return -100; }
+
       // Calculate the new size of the array to copy into
-      size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents ;
+      size_t numTuples = getNumberOfTuples();
+      size_t newSize = (numTuples - idxs.size()) * m_NumComponents ;
 
-      // Create a new m_Array to copy into
+      // Create a new m_Array and copy the runs of kept Tuples between the erased ones straight into it
       T* newArray = (T*)malloc(newSize * sizeof(T));
-      // Splat AB across the array so we know if we are copying the values or not
-      ::memset(newArray, 0xAB, newSize * sizeof(T));
-
-      // Keep the current Destination Pointer
       T* currentDest = newArray;
-      size_t j = 0;
-      int k = 0;
-      // Find the first chunk to copy by walking the idxs array until we get an
-      // index that is NOT a continuous increment from the start
-      for (k = 0; k < idxs.size(); ++k)
-      {
-        if(j == idxs[k])
-        {
-          ++j;
-        }
-        else
-        {
-          break;
-        }
-      }
-
-      if(k == idxs.size()) // Only front elements are being dropped
-      {
-        T* currentSrc = m_Array + (j * m_NumComponents);
-        ::memcpy(currentDest, currentSrc, (getNumberOfTuples() - idxs.size()) * m_NumComponents * sizeof(T));
-        _deallocate(); // We are done copying - delete the current m_Array
-        m_Size = newSize;
-        m_Array = newArray;
-        m_OwnsData = true;
-        m_MaxId = newSize - 1;
-        return 0;
-      }
-
-      QVector<size_t> srcIdx(idxs.size() + 1);
-      QVector<size_t> destIdx(idxs.size() + 1);
-      QVector<size_t> copyElements(idxs.size() + 1);
-      srcIdx[0] = 0;
-      destIdx[0] = 0;
-      copyElements[0] = (idxs[0] - 0) * m_NumComponents;
-
-      for (int i = 1; i < srcIdx.size(); ++i)
+      size_t runStart = 0;
+      for (QVector<size_t>::size_type i = 0; i <= idxs.size(); ++i)
       {
-        srcIdx[i] = (idxs[i - 1] + 1) * m_NumComponents;
-
-        if(i < srcIdx.size() - 1)
-        {
-          copyElements[i] = (idxs[i] - idxs[i - 1] - 1) * m_NumComponents;
-        }
-        else
+        size_t runEnd = (i < idxs.size()) ? idxs[i] : numTuples;
+        if(runEnd > runStart)
         {
-          copyElements[i] = (getNumberOfTuples() - idxs[i - 1] - 1) * m_NumComponents;
+          size_t elements = (runEnd - runStart) * m_NumComponents;
+          ::memcpy(currentDest, m_Array + (runStart * m_NumComponents), elements * sizeof(T));
+          currentDest += elements;
         }
-        destIdx[i] = copyElements[i - 1] + destIdx[i - 1];
-      }
-
-      // Copy the data
-      for (int i = 0; i < srcIdx.size(); ++i)
-      {
-        currentDest = newArray + destIdx[i];
-        T* currentSrc = m_Array + srcIdx[i];
-        size_t bytes = copyElements[i] * sizeof(T);
-        ::memcpy(currentDest, currentSrc, bytes);
+        runStart = runEnd + 1;
       }
 
       // We are done copying - delete the current m_Array
@@ -679,6 +645,7 @@ class DataArray : public IDataArray
       m_OwnsData = true;
 
       m_MaxId = newSize - 1;
+      m_NumTuples = numTuples - idxs.size();
 
       return err;
     }
@@ -695,6 +662,7 @@ class DataArray : public IDataArray
       if (currentPos >= max
           || newPos >= max )
       {return -1;}
+      if (detachBuffer() == false) { return -1; }
       T* src = m_Array + (currentPos * m_NumComponents);
       T* dest = m_Array + (newPos * m_NumComponents);
       size_t bytes = sizeof(T) * m_NumComponents;
@@ -702,6 +670,141 @@ class DataArray : public IDataArray
       return 0;
     }
 
+    /**
+     * @brief Copies a contiguous range of Tuples to another position in the array. The ranges may overlap.
+     * @param srcTupleIdx The index of the first source Tuple
+     * @param destTupleIdx The index of the first destination Tuple
+     * @param numTuples The number of Tuples to copy
+     * @return 0 on success, -1 if either range is off the end of the array
+     */
+    virtual int copyTuples(size_t srcTupleIdx, size_t destTupleIdx, size_t numTuples)
+    {
+      size_t max =  ((m_MaxId + 1) / m_NumComponents);
+      if (srcTupleIdx + numTuples > max
+          || destTupleIdx + numTuples > max )
+      {return -1;}
+      if (detachBuffer() == false) { return -1; }
+      T* src = m_Array + (srcTupleIdx * m_NumComponents);
+      T* dest = m_Array + (destTupleIdx * m_NumComponents);
+      ::memmove(dest, src, sizeof(T) * m_NumComponents * numTuples);
+      return 0;
+    }
+
+    /**
+     * @brief Copies Tuple srcIdxs[i] to Tuple destIdxs[i] for each i, in order, exactly like a loop of copyTuple calls.
+     * @param srcIdxs The indices of the source Tuples
+     * @param destIdxs The indices of the destination Tuples
+     * @return 0 on success, -1 if the lists differ in size or a pair is off the end of the array (that pair is skipped)
+     */
+    virtual int copyTuples(const QVector<size_t>& srcIdxs, const QVector<size_t>& destIdxs)
+    {
+      if (srcIdxs.size() != destIdxs.size()) { return -1; }
+      if (detachBuffer() == false) { return -1; }
+      int err = 0;
+      size_t max =  ((m_MaxId + 1) / m_NumComponents);
+      size_t count = static_cast<size_t>(srcIdxs.size());
+      const size_t* srcIdx = srcIdxs.constData();
+      const size_t* destIdx = destIdxs.constData();
+      size_t numComps = m_NumComponents;
+      for (size_t i = 0; i < count; i++)
+      {
+        if (srcIdx[i] >= max || destIdx[i] >= max) { err = -1; continue; }
+        T* src = m_Array + (srcIdx[i] * numComps);
+        T* dest = m_Array + (destIdx[i] * numComps);
+        for (size_t j = 0; j < numComps; j++)
+        {
+          dest[j] = src[j];
+        }
+      }
+      return err;
+    }
+
+    /**
+     * @brief Splats the same value across all components of a contiguous range of Tuples
+     * @param startTupleIdx The index of the first Tuple
+     * @param numTuples The number of Tuples
+     * @param value The value to splat
+     * @return 0 on success, -1 if the range is off the end of the array
+     */
+    virtual int fillTuples(size_t startTupleIdx, size_t numTuples, double value)
+    {
+      if(!m_IsAllocated) { return 0; }
+      if (startTupleIdx + numTuples > m_NumTuples) { return -1; }
+      if (detachBuffer() == false) { return -1; }
+      std::fill(m_Array + (startTupleIdx * m_NumComponents), m_Array + ((startTupleIdx + numTuples) * m_NumComponents), static_cast<T>(value));
+      return 0;
+    }
+
+    /**
+     * @brief Splats the same value across all components of each listed Tuple
+     * @param idxs The indices of the Tuples
+     * @param value The value to splat
+     * @return 0 on success, -1 if an index is off the end of the array (that index is skipped)
+     */
+    virtual int fillTuples(const QVector<size_t>& idxs, double value)
+    {
+      if(!m_IsAllocated) { return 0; }
+      if (detachBuffer() == false) { return -1; }
+      int err = 0;
+      T c = static_cast<T>(value);
+      size_t count = static_cast<size_t>(idxs.size());
+      const size_t* idx = idxs.constData();
+      size_t numComps = m_NumComponents;
+      for (size_t i = 0; i < count; i++)
+      {
+        if (idx[i] >= m_NumTuples) { err = -1; continue; }
+        T* dest = m_Array + (idx[i] * numComps);
+        for (size_t j = 0; j < numComps; j++)
+        {
+          dest[j] = c;
+        }
+      }
+      return err;
+    }
+
+    /**
+     * @brief Gathers the listed Tuples into a contiguous buffer: Tuple srcIdxs[i] is copied to position i of dest,
+     * which must hold srcIdxs.size() * getNumberOfComponents() values.
+     * @param srcIdxs The indices of the Tuples to gather
+     * @param dest The buffer to gather into
+     * @return 0 on success, -1 if an index is off the end of the array (that Tuple is skipped)
+     */
+    int gatherTuples(const QVector<size_t>& srcIdxs, T* dest)
+    {
+      int err = 0;
+      size_t count = static_cast<size_t>(srcIdxs.size());
+      const size_t* srcIdx = srcIdxs.constData();
+      size_t bytes = sizeof(T) * m_NumComponents;
+      for (size_t i = 0; i < count; i++)
+      {
+        if (srcIdx[i] >= m_NumTuples) { err = -1; continue; }
+        ::memcpy(dest + (i * m_NumComponents), m_Array + (srcIdx[i] * m_NumComponents), bytes);
+      }
+      return err;
+    }
+
+    /**
+     * @brief Scatters a contiguous buffer into the listed Tuples: position i of src is copied to Tuple destIdxs[i].
+     * This is the inverse of gatherTuples.
+     * @param src The buffer holding destIdxs.size() * getNumberOfComponents() values
+     * @param destIdxs The indices of the Tuples to scatter to
+     * @return 0 on success, -1 if an index is off the end of the array (that Tuple is skipped)
+     */
+    int scatterTuples(const T* src, const QVector<size_t>& destIdxs)
+    {
+      if (detachBuffer() == false) { return -1; }
+      int err = 0;
+      size_t count = static_cast<size_t>(destIdxs.size());
+      const size_t* destIdx = destIdxs.constData();
+      size_t bytes = sizeof(T) * m_NumComponents;
+      for (size_t i = 0; i < count; i++)
+      {
+        if (destIdx[i] >= m_NumTuples) { err = -1; continue; }
+        ::memcpy(m_Array + (destIdx[i] * m_NumComponents), src + (i * m_NumComponents), bytes);
+      }
+      return err;
+    }
+
     virtual IDataArray::Pointer reorderCopy(QVector<size_t> newOrderMap)
     {
       if(newOrderMap.size() != static_cast<QVector<size_t>::size_type>(getNumberOfTuples()))
@@ -715,7 +818,7 @@ class DataArray : public IDataArray
         size_t chunkSize = getNumberOfComponents() * sizeof(T);
         for(size_t i = 0; i < getNumberOfTuples(); i++)
         {
-          T* src = getPointer(i * getNumberOfComponents());
+          T* src = m_Array + (i * getNumberOfComponents());
           void* dest = daCopy->getVoidPointer(newOrderMap[i] * getNumberOfComponents());
           ::memcpy(dest, src, chunkSize);
         }
@@ -783,7 +886,8 @@ class DataArray : public IDataArray
     virtual void* getVoidPointer(size_t i)
     {
       if (i >= m_Size) { return NULL;}
-
+      if (detachBuffer() == false) { return NULL; }
+      m_WritePointerIssued = true;
       return (void*)(&(m_Array[i]));
     }
 
@@ -800,9 +904,44 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { BOOST_ASSERT(i < m_Size);}
 #endif
+      if (detachBuffer() == false) { return NULL; }
+      m_WritePointerIssued = true;
       return (T*)(&(m_Array[i]));
     }
 
+    /**
+     * @brief Returns a read only pointer to a specific index into the array. Unlike getPointer() this does
+     * not give this array its own copy of a buffer that is still shared with a copy of it made by deepCopy().
+     * @param i The index to return the pointer to.
+     * @return The pointer to the index
+     */
+    const T* getConstPointer(size_t i)
+    {
+#ifndef NDEBUG
+      if (m_Size > 0) { BOOST_ASSERT(i < m_Size);}
+#endif
+      return (const T*)(&(m_Array[i]));
+    }
+
+    /**
+     * @brief Returns true if the internal buffer is still shared with a copy of this array made by deepCopy(). The
+     * first mutable access through either array gives it its own copy of the buffer.
+     */
+    bool isSharedBuffer()
+    {
+      return (NULL != m_SharedBuffer.get() && m_SharedBuffer.use_count() > 1);
+    }
+
+    /**
+     * @brief Tells the array that none of the pointers or references handed out by getPointer(), getVoidPointer(),
+     * getTuplePointer() or operator[] are used any more, so deepCopy() may share the buffer again. FilterPipeline
+     * calls this on every array after each filter because filters fetch their pointers again in dataCheck().
+     */
+    virtual void invalidateWritePointers()
+    {
+      m_WritePointerIssued = false;
+    }
+
     /**
      * @brief Returns the value for a given index
      * @param i The index to return the value at
@@ -827,6 +966,7 @@ class DataArray : public IDataArray
       if (m_Size > 0)
       { BOOST_ASSERT(i < m_Size);}
 #endif
+      if (detachBuffer() == false) { return; }
       m_Array[i] = value;
     }
 
@@ -851,6 +991,7 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { BOOST_ASSERT(i * m_NumComponents + j < m_Size);}
 #endif
+      if (detachBuffer() == false) { return; }
       m_Array[i * m_NumComponents + j] = c;
     }
 
@@ -865,6 +1006,7 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { BOOST_ASSERT(i * m_NumComponents < m_Size);}
 #endif
+      if (detachBuffer() == false) { return; }
       T c = static_cast<T>(p);
       for (size_t j = 0; j < m_NumComponents; ++j)
       {
@@ -881,6 +1023,8 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { BOOST_ASSERT(tupleIndex * m_NumComponents < m_Size);}
 #endif
+      if (detachBuffer() == false) { return NULL; }
+      m_WritePointerIssued = true;
       return m_Array + (tupleIndex * m_NumComponents);
     }
 
@@ -1004,16 +1148,40 @@ class DataArray : public IDataArray
     }
 
     /**
-     * @brief deepCopy
+     * @brief deepCopy Copies this array. When this array owns its memory the copy shares the internal buffer
+     * and neither array duplicates it until one of them is first accessed mutably (getPointer(), getVoidPointer(),
+     * setValue(), ...). getValue(), getComponent(), getConstPointer() and writing the array to a file leave the
+     * buffer shared. If a writable pointer into this array may still be in use (see invalidateWritePointers()) the
+     * memory is duplicated right away, so writes through that pointer never reach the copy.
      * @param forceNoAllocate
      * @return
      */
     virtual IDataArray::Pointer deepCopy(bool forceNoAllocate = false)
     {
+      if(m_IsAllocated == true && forceNoAllocate == false && m_Size > 0 && m_WritePointerIssued == false
+          && (m_OwnsData == true || NULL != m_SharedBuffer.get()))
+      {
+        if(NULL == m_SharedBuffer.get())
+        {
+          // Hand the memory over to a reference counted buffer that both arrays now point at
+          m_SharedBuffer = SharedBufferPointer(new SharedBuffer(m_Array));
+          m_OwnsData = false;
+        }
+        DataArray* d = new DataArray(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+        Pointer daCopy(d);
+        daCopy->m_Array = m_Array;
+        daCopy->m_SharedBuffer = m_SharedBuffer;
+        daCopy->m_Size = m_Size;
+        daCopy->m_MaxId = m_MaxId;
+        daCopy->m_IsAllocated = true;
+        daCopy->m_InitValue = m_InitValue;
+        return daCopy;
+      }
+
       IDataArray::Pointer daCopy = createNewArray(getNumberOfTuples(), getComponentDimensions(), getName(), m_IsAllocated);
       if(m_IsAllocated == true && forceNoAllocate == false)
       {
-        T* src = getPointer(0);
+        T* src = m_Array;
         void* dest = daCopy->getVoidPointer(0);
         size_t totalBytes = (getNumberOfTuples() * getNumberOfComponents() * sizeof(T));
         ::memcpy(dest, src, totalBytes);
@@ -1129,6 +1297,7 @@ class DataArray : public IDataArray
      */
     virtual void byteSwapElements()
     {
+      if (detachBuffer() == false) { return; }
       char* ptr = (char*)(m_Array);
       char t[8];
       size_t size = getTypeSize();
@@ -1162,6 +1331,8 @@ class DataArray : public IDataArray
     inline T& operator[](size_t i)
     {
       BOOST_ASSERT(i < m_Size);
+      if (detachBuffer() == false) { throw std::bad_alloc(); }
+      m_WritePointerIssued = true;
       return m_Array[i];
     }
 
@@ -1176,6 +1347,7 @@ class DataArray : public IDataArray
     DataArray(size_t numTuples, QVector<size_t> compDims, const QString& name, bool ownsData = true) :
       m_Array(NULL),
       m_OwnsData(ownsData),
+      m_WritePointerIssued(false),
       m_IsAllocated(false),
       m_Name(name),
       m_NumTuples(numTuples)
@@ -1200,6 +1372,14 @@ class DataArray : public IDataArray
      */
     void _deallocate()
     {
+      // A buffer shared with a copy is freed by the last array that lets go of it
+      if(NULL != m_SharedBuffer.get())
+      {
+        m_SharedBuffer.reset();
+        m_Array = NULL;
+        m_IsAllocated = false;
+        return;
+      }
       // We are going to splat 0xABABAB across the first value of the array as a debugging aid
       unsigned char* cptr = reinterpret_cast<unsigned char*>(m_Array);
       if(NULL != cptr)
@@ -1334,8 +1514,10 @@ class DataArray : public IDataArray
       }
 
       // Allocation was successful.  Save it.
+      PerformanceMonitor::AddAllocatedBytes(newSize * sizeof(T));
       m_Size = newSize;
       m_Array = newArray;
+      m_SharedBuffer.reset();
 
       // Initialize the new tuples if newSize is larger than old size
       if(newSize > oldSize)
@@ -1352,14 +1534,63 @@ class DataArray : public IDataArray
     }
 
 
+    /**
+     * @brief Gives this array its own copy of the internal buffer if it is still shared with a copy made by
+     * deepCopy(). If this is the last array using the buffer it simply takes ownership of it back.
+     * @return false if the copy could not be allocated. The array then still points at the shared buffer and the
+     * caller must not write to it; the mutable accessors return NULL or -1 (operator[] throws std::bad_alloc).
+     */
+    inline bool detachBuffer()
+    {
+      if (NULL == m_SharedBuffer.get()) { return true; }
+      if (m_SharedBuffer.use_count() == 1)
+      {
+        m_Array = m_SharedBuffer->release();
+      }
+      else
+      {
+        T* newArray = (T*)malloc(m_Size * sizeof(T));
+        if (!newArray)
+        {
+          qCritical() << "DataArray '" << m_Name << "': Unable to allocate " << m_Size << " elements of size " << sizeof(T)
+                      << " bytes to stop sharing its buffer with a copy. The array was not modified.";
+          return false;
+        }
+        ::memcpy(newArray, m_Array, m_Size * sizeof(T));
+        m_Array = newArray;
+        PerformanceMonitor::AddAllocatedBytes(m_Size * sizeof(T));
+      }
+      m_SharedBuffer.reset();
+      m_OwnsData = true;
+      return true;
+    }
+
   private:
 
+    /**
+     * @brief Reference counted holder for a buffer shared between an array and its copies
+     */
+    class SharedBuffer
+    {
+      public:
+        explicit SharedBuffer(T* ptr) : m_Ptr(ptr) {}
+        ~SharedBuffer() { if (NULL != m_Ptr) { free(m_Ptr); } }
+        T* release() { T* ptr = m_Ptr; m_Ptr = NULL; return ptr; }
+      private:
+        T* m_Ptr;
+        SharedBuffer(const SharedBuffer&); //Not Implemented
+        void operator=(const SharedBuffer&); //Not Implemented
+    };
+    typedef boost::shared_ptr<SharedBuffer> SharedBufferPointer;
+
     //  unsigned long long int MUD_FLAP_0;
     T* m_Array;
+    SharedBufferPointer m_SharedBuffer;
     //  unsigned long long int MUD_FLAP_1;
     size_t m_Size;
     //  unsigned long long int MUD_FLAP_4;
     bool m_OwnsData;
+    bool m_WritePointerIssued;
     //  unsigned long long int MUD_FLAP_2;
     size_t m_MaxId;
 
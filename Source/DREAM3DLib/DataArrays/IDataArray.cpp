@@ -18,3 +18,76 @@ IDataArray::IDataArray()
 IDataArray::~IDataArray()
 {}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::copyTuples(size_t srcTupleIdx, size_t destTupleIdx, size_t numTuples)
+{
+  size_t max = getNumberOfTuples();
+  if(srcTupleIdx + numTuples > max || destTupleIdx + numTuples > max) { return -1; }
+  // Walk the ranges in the direction that reads every source Tuple before it gets overwritten
+  if(destTupleIdx <= srcTupleIdx)
+  {
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      copyTuple(srcTupleIdx + i, destTupleIdx + i);
+    }
+  }
+  else
+  {
+    for(size_t i = numTuples; i > 0; i--)
+    {
+      copyTuple(srcTupleIdx + i - 1, destTupleIdx + i - 1);
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::copyTuples(const QVector<size_t>& srcIdxs, const QVector<size_t>& destIdxs)
+{
+  if(srcIdxs.size() != destIdxs.size()) { return -1; }
+  int err = 0;
+  for(qint32 i = 0; i < srcIdxs.size(); i++)
+  {
+    if(copyTuple(srcIdxs[i], destIdxs[i]) < 0) { err = -1; }
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::fillTuples(size_t startTupleIdx, size_t numTuples, double value)
+{
+  if(startTupleIdx + numTuples > getNumberOfTuples()) { return -1; }
+  for(size_t i = startTupleIdx; i < startTupleIdx + numTuples; i++)
+  {
+    initializeTuple(i, value);
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::fillTuples(const QVector<size_t>& idxs, double value)
+{
+  int err = 0;
+  size_t max = getNumberOfTuples();
+  for(qint32 i = 0; i < idxs.size(); i++)
+  {
+    if(idxs[i] >= max) { err = -1; continue; }
+    initializeTuple(idxs[i], value);
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataArray::invalidateWritePointers()
+{
+}
@@ -148,6 +148,42 @@ class DREAM3DLib_EXPORT IDataArray
      */
     virtual int copyTuple(size_t currentPos, size_t newPos) = 0;
 
+    /**
+     * @brief Copies a contiguous range of Tuples to another position in the array. The source and destination
+     * ranges may overlap. The default implementation calls copyTuple for each Tuple.
+     * @param srcTupleIdx The index of the first source Tuple
+     * @param destTupleIdx The index of the first destination Tuple
+     * @param numTuples The number of Tuples to copy
+     * @return 0 on success, -1 if either range is off the end of the array
+     */
+    virtual int copyTuples(size_t srcTupleIdx, size_t destTupleIdx, size_t numTuples);
+
+    /**
+     * @brief Copies Tuple srcIdxs[i] to Tuple destIdxs[i] for each i, in order. The result is the same as calling
+     * copyTuple for each pair, so a Tuple written by an earlier pair is read with its new value by a later one.
+     * @param srcIdxs The indices of the source Tuples
+     * @param destIdxs The indices of the destination Tuples
+     * @return 0 on success, -1 if the lists differ in size or a pair is off the end of the array (that pair is skipped)
+     */
+    virtual int copyTuples(const QVector<size_t>& srcIdxs, const QVector<size_t>& destIdxs);
+
+    /**
+     * @brief Splats the same value across all components of a contiguous range of Tuples
+     * @param startTupleIdx The index of the first Tuple
+     * @param numTuples The number of Tuples
+     * @param value The value to splat
+     * @return 0 on success, -1 if the range is off the end of the array
+     */
+    virtual int fillTuples(size_t startTupleIdx, size_t numTuples, double value);
+
+    /**
+     * @brief Splats the same value across all components of each listed Tuple
+     * @param idxs The indices of the Tuples
+     * @param value The value to splat
+     * @return 0 on success, -1 if an index is off the end of the array (that index is skipped)
+     */
+    virtual int fillTuples(const QVector<size_t>& idxs, double value);
+
 
     /**
      * @brief Creates a copy with the given reordering.
@@ -189,6 +225,12 @@ class DREAM3DLib_EXPORT IDataArray
 
     virtual IDataArray::Pointer deepCopy(bool forceNoAllocate = false) = 0;
 
+    /**
+     * @brief Tells the array that no pointer fetched from it for writing is used any more, so deepCopy() may
+     * share its memory with the copy. The default implementation does nothing.
+     */
+    virtual void invalidateWritePointers();
+
     /**
      *
      * @param parentId
@@ -0,0 +1,649 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#ifndef _QuantizedFloatArray_H_
+#define _QuantizedFloatArray_H_
+
+#include <string.h>
+
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include <vector>
+
+#include "H5Support/QH5Lite.h"
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/Constants.h"
+#include "DREAM3DLib/Common/DREAM3DSetGetMacros.h"
+#include "DREAM3DLib/DataArrays/IDataArray.h"
+#include "DREAM3DLib/DataArrays/DataArray.hpp"
+#include "DREAM3DLib/HDF5/H5DataArrayReader.h"
+
+/**
+ * @class QuantizedFloatArray QuantizedFloatArray.hpp DREAM3DLib/DataArrays/QuantizedFloatArray.hpp
+ * @brief Stores float values in 16 bits each, which halves the memory of a DataArray<float>. Two encodings are
+ * available: IEEE 754 half precision floats (11 significant bits, range +-65504) which suit Euler angles and scalar
+ * values such as confidence index or image quality, and a 16 bit fixed point encoding of the range [-1, 1] (a step
+ * of 1/32767) which suits the components of unit quaternions. Values are converted on the fly by the typed accessors.
+ *
+ * The array is written to HDF5 files as a DataArray<float> plus a "QuantizedEncoding" attribute, so older versions
+ * read it as a normal float array while this version reads it back in its compact form. Filters that ask the
+ * AttributeMatrix for a DataArray<float> or a generic IDataArray get the array expanded in place, and it stays
+ * expanded; see AttributeMatrix::getPrereqArray. ThresholdFilterHelper and FindCellQuats read the compact values
+ * directly so the usual threshold and orientation steps of an EBSD pipeline keep the saving.
+ */
+class QuantizedFloatArray : public IDataArray
+{
+  public:
+    DREAM3D_SHARED_POINTERS(QuantizedFloatArray )
+    DREAM3D_TYPE_MACRO_SUPER(QuantizedFloatArray, IDataArray)
+    DREAM3D_CLASS_VERSION(2)
+
+    typedef uint16_t StorageType;
+
+    enum Encoding
+    {
+      HalfFloat = 0,   //!< IEEE 754 binary16
+      UnitFixed16 = 1  //!< Signed 16 bit fixed point over [-1, 1]
+    };
+
+    /**
+     * @brief Static constructor
+     * @param numTuples The number of Tuples in the array
+     * @param name The name of the array
+     * @param encoding How the values are stored
+     * @param allocate Allocate (and zero) the values
+     * @return
+     */
+    static Pointer CreateArray(size_t numTuples, const QString& name, Encoding encoding, bool allocate = true)
+    {
+      QVector<size_t> cDims(1, 1);
+      return CreateArray(numTuples, cDims, name, encoding, allocate);
+    }
+
+    /**
+     * @brief Static constructor
+     * @param numTuples The number of Tuples in the array
+     * @param cDims The dimensions of the values at each Tuple
+     * @param name The name of the array
+     * @param encoding How the values are stored
+     * @param allocate Allocate (and zero) the values
+     * @return
+     */
+    static Pointer CreateArray(size_t numTuples, QVector<size_t> cDims, const QString& name, Encoding encoding, bool allocate = true)
+    {
+      if (name.isEmpty() == true || cDims.size() == 0)
+      {
+        return NullPointer();
+      }
+      QuantizedFloatArray* d = new QuantizedFloatArray(numTuples, cDims, name, encoding, allocate);
+      Pointer ptr(d);
+      return ptr;
+    }
+
+    /**
+     * @brief Creates a QuantizedFloatArray holding the values of a DataArray<float>, rounded to the encoding
+     * @param src The array to convert
+     * @param encoding How the values are stored
+     * @return
+     */
+    static Pointer FromFloatArray(FloatArrayType* src, Encoding encoding)
+    {
+      if (NULL == src)
+      {
+        return NullPointer();
+      }
+      Pointer p = CreateArray(src->getNumberOfTuples(), src->getComponentDimensions(), src->getName(), encoding, src->isAllocated());
+      if (NULL != p.get() && src->isAllocated() == true)
+      {
+        p->packFrom(src->getConstPointer(0));
+      }
+      return p;
+    }
+
+    /**
+     * @brief Returns the name an encoding is known by in files
+     */
+    static QString EncodingName(Encoding encoding)
+    {
+      return (encoding == UnitFixed16) ? QString("UnitFixed16") : QString("HalfFloat");
+    }
+
+    /**
+     * @brief Returns the encoding for a name returned by EncodingName
+     * @param name The name of the encoding
+     * @param ok Set to false if the name is not known
+     */
+    static Encoding EncodingFromName(const QString& name, bool& ok)
+    {
+      ok = true;
+      if (name.compare("HalfFloat") == 0) { return HalfFloat; }
+      if (name.compare("UnitFixed16") == 0) { return UnitFixed16; }
+      ok = false;
+      return HalfFloat;
+    }
+
+    /**
+     * @brief Converts a float to the nearest IEEE half, rounding ties to even. Values too large become infinity.
+     */
+    static StorageType FloatToHalf(float value)
+    {
+      uint32_t x = 0;
+      ::memcpy(&x, &value, sizeof(float));
+      uint32_t sign = (x >> 16) & 0x8000;
+      uint32_t absx = x & 0x7FFFFFFF;
+      if (absx >= 0x7F800000) // Infinity or NaN, keep NaNs quiet
+      {
+        return static_cast<StorageType>(sign | 0x7C00 | ((absx > 0x7F800000) ? 0x200 : 0));
+      }
+      if (absx >= 0x477FF000) // Rounds to 65520 or more
+      {
+        return static_cast<StorageType>(sign | 0x7C00);
+      }
+      if (absx < 0x38800000) // Below the smallest normal half
+      {
+        if (absx < 0x33000000) { return static_cast<StorageType>(sign); }
+        uint32_t mant = (absx & 0x007FFFFF) | 0x00800000;
+        uint32_t shift = 126 - (absx >> 23);
+        uint32_t h = mant >> shift;
+        uint32_t rem = mant & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (rem > halfway || (rem == halfway && (h & 1) != 0)) { ++h; }
+        return static_cast<StorageType>(sign | h);
+      }
+      // Rebias the exponent from 127 to 15 and drop 13 bits of mantissa. A carry out of the mantissa correctly
+      // bumps the exponent.
+      uint32_t h = (absx - 0x38000000) >> 13;
+      uint32_t rem = absx & 0x1FFF;
+      if (rem > 0x1000 || (rem == 0x1000 && (h & 1) != 0)) { ++h; }
+      return static_cast<StorageType>(sign | h);
+    }
+
+    /**
+     * @brief Converts an IEEE half to a float. This is exact.
+     */
+    static float HalfToFloat(StorageType h)
+    {
+      uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+      uint32_t exponent = (h >> 10) & 0x1F;
+      uint32_t mant = h & 0x3FF;
+      uint32_t x = 0;
+      if (exponent == 0)
+      {
+        // Zero or subnormal: mant * 2^-24
+        float value = static_cast<float>(mant) * (1.0f / 16777216.0f);
+        return (sign != 0) ? -value : value;
+      }
+      else if (exponent == 31)
+      {
+        x = sign | 0x7F800000 | (mant << 13);
+      }
+      else
+      {
+        x = sign | ((exponent + 112) << 23) | (mant << 13);
+      }
+      float value = 0.0f;
+      ::memcpy(&value, &x, sizeof(float));
+      return value;
+    }
+
+    /**
+     * @brief Converts a float to the nearest step of the [-1, 1] fixed point encoding. Values outside are clamped.
+     */
+    static StorageType FloatToUnitFixed(float value)
+    {
+      if (!(value > -1.0f)) { value = -1.0f; } // Also maps NaN to -1
+      if (value > 1.0f) { value = 1.0f; }
+      float scaled = value * 32767.0f;
+      int32_t q = static_cast<int32_t>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+      return static_cast<StorageType>(static_cast<int16_t>(q));
+    }
+
+    /**
+     * @brief Converts a [-1, 1] fixed point value to a float
+     */
+    static float UnitFixedToFloat(StorageType q)
+    {
+      return static_cast<float>(static_cast<int16_t>(q)) / 32767.0f;
+    }
+
+    virtual IDataArray::Pointer createNewArray(size_t numElements, int rank, size_t* dims, const QString& name, bool allocate = true)
+    {
+      QVector<size_t> cDims(rank, 0);
+      for (int i = 0; i < rank; ++i) { cDims[i] = dims[i]; }
+      IDataArray::Pointer p = QuantizedFloatArray::CreateArray(numElements, cDims, name, m_Encoding, allocate);
+      return p;
+    }
+
+    virtual IDataArray::Pointer createNewArray(size_t numElements, std::vector<size_t> dims, const QString& name, bool allocate = true)
+    {
+      IDataArray::Pointer p = QuantizedFloatArray::CreateArray(numElements, QVector<size_t>::fromStdVector(dims), name, m_Encoding, allocate);
+      return p;
+    }
+
+    virtual IDataArray::Pointer createNewArray(size_t numElements, QVector<size_t> dims, const QString& name, bool allocate = true)
+    {
+      IDataArray::Pointer p = QuantizedFloatArray::CreateArray(numElements, dims, name, m_Encoding, allocate);
+      return p;
+    }
+
+    virtual ~QuantizedFloatArray() {}
+
+    virtual bool isAllocated() { return m_IsAllocated; }
+
+    void getXdmfTypeAndSize(QString& xdmfTypeName, int& precision)
+    {
+      // The values are written expanded to 32 bit floats
+      xdmfTypeName = "Float";
+      precision = 4;
+    }
+
+    virtual QString getTypeAsString() { return "QuantizedFloatArray"; }
+
+    QString getFullNameOfClass() { return "QuantizedFloatArray"; }
+
+    void setName(const QString& name) { m_Name = name; }
+
+    QString getName() { return m_Name; }
+
+    /**
+     * @brief Returns how the values are stored
+     */
+    Encoding getEncoding() { return m_Encoding; }
+
+    /**
+     * @brief The values are always owned by this class
+     */
+    virtual void takeOwnership() {}
+
+    /**
+     * @brief The values are always owned by this class
+     */
+    virtual void releaseOwnership() {}
+
+    /**
+     * @brief Returns a pointer to the encoded value i
+     * @param i The index of the value
+     * @return
+     */
+    virtual void* getVoidPointer(size_t i)
+    {
+      if (i >= m_Size) { return NULL; }
+      return static_cast<void*>(&(m_Values[i]));
+    }
+
+    /**
+     * @brief Returns a pointer to the encoded value i. No bounds checking is performed.
+     * @param i The index of the value
+     */
+    StorageType* getRawPointer(size_t i) { return &(m_Values[i]); }
+
+    virtual size_t getNumberOfTuples() { return m_NumTuples; }
+
+    virtual size_t getSize() { return m_Size; }
+
+    virtual int getNumberOfComponents() { return static_cast<int>(m_NumComponents); }
+
+    virtual QVector<size_t> getComponentDimensions() { return m_CompDims; }
+
+    /**
+     * @brief Returns the size of an encoded value
+     */
+    virtual size_t getTypeSize() { return sizeof(StorageType); }
+
+    /**
+     * @brief Encodes a float using the encoding of this array
+     */
+    inline StorageType encode(float value)
+    {
+      return (m_Encoding == UnitFixed16) ? FloatToUnitFixed(value) : FloatToHalf(value);
+    }
+
+    /**
+     * @brief Decodes a value stored using the encoding of this array
+     */
+    inline float decode(StorageType value)
+    {
+      return (m_Encoding == UnitFixed16) ? UnitFixedToFloat(value) : HalfToFloat(value);
+    }
+
+    /**
+     * @brief getValue
+     * @param i The index of the value
+     */
+    inline float getValue(size_t i)
+    {
+      return decode(m_Values[i]);
+    }
+
+    /**
+     * @brief setValue
+     * @param i The index of the value
+     * @param value The new value, rounded to the encoding
+     */
+    inline void setValue(size_t i, float value)
+    {
+      m_Values[i] = encode(value);
+    }
+
+    /**
+     * @brief Decodes all the components of a Tuple
+     * @param tupleIdx The index of the Tuple
+     * @param dest Receives getNumberOfComponents() values
+     */
+    void getTuple(size_t tupleIdx, float* dest)
+    {
+      const StorageType* src = &(m_Values[tupleIdx * m_NumComponents]);
+      for (size_t c = 0; c < m_NumComponents; ++c) { dest[c] = decode(src[c]); }
+    }
+
+    /**
+     * @brief Encodes all the components of a Tuple
+     * @param tupleIdx The index of the Tuple
+     * @param src Holds getNumberOfComponents() values
+     */
+    void setTuple(size_t tupleIdx, const float* src)
+    {
+      StorageType* dest = &(m_Values[tupleIdx * m_NumComponents]);
+      for (size_t c = 0; c < m_NumComponents; ++c) { dest[c] = encode(src[c]); }
+    }
+
+    /**
+     * @brief Encodes getSize() values from a float array into this array
+     * @param src The values to encode
+     */
+    void packFrom(const float* src)
+    {
+      if (m_Encoding == UnitFixed16)
+      {
+        for (size_t i = 0; i < m_Size; ++i) { m_Values[i] = FloatToUnitFixed(src[i]); }
+      }
+      else
+      {
+        for (size_t i = 0; i < m_Size; ++i) { m_Values[i] = FloatToHalf(src[i]); }
+      }
+    }
+
+    /**
+     * @brief Decodes getSize() values from this array into a float array
+     * @param dest The array to decode into
+     */
+    void unpackTo(float* dest)
+    {
+      if (m_Encoding == UnitFixed16)
+      {
+        for (size_t i = 0; i < m_Size; ++i) { dest[i] = UnitFixedToFloat(m_Values[i]); }
+      }
+      else
+      {
+        for (size_t i = 0; i < m_Size; ++i) { dest[i] = HalfToFloat(m_Values[i]); }
+      }
+    }
+
+    /**
+     * @brief Creates a DataArray<float> holding the decoded values of this array
+     */
+    FloatArrayType::Pointer toFloatArray()
+    {
+      FloatArrayType::Pointer p = FloatArrayType::CreateArray(m_NumTuples, m_CompDims, m_Name, m_IsAllocated);
+      if (m_IsAllocated == true && m_Size > 0)
+      {
+        unpackTo(p->getPointer(0));
+      }
+      return p;
+    }
+
+    /**
+     * @brief Removes Tuples from the array. See DataArray::eraseTuples for the error codes.
+     * @param idxs The indices to remove, sorted and strictly increasing
+     * @return error code.
+     */
+    virtual int eraseTuples(QVector<size_t>& idxs)
+    {
+      if(idxs.size() == 0) { return 0; }
+      if (static_cast<size_t>(idxs.size()) >= m_NumTuples)
+      {
+        resize(0);
+        return 0;
+      }
+      for(QVector<size_t>::size_type i = 1; i < idxs.size(); ++i)
+      {
+        if (idxs[i] <= idxs[i - 1]) { return -1; }
+      }
+      if (idxs.back() >= m_NumTuples) { return -100; }
+      // Slide each run of kept Tuples down over the erased ones
+      size_t dest = idxs[0];
+      for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
+      {
+        size_t runStart = idxs[i] + 1;
+        size_t runEnd = (i + 1 < idxs.size()) ? idxs[i + 1] : m_NumTuples;
+        if (runEnd > runStart)
+        {
+          ::memmove(&(m_Values[dest * m_NumComponents]), &(m_Values[runStart * m_NumComponents]),
+                    (runEnd - runStart) * m_NumComponents * sizeof(StorageType));
+          dest += runEnd - runStart;
+        }
+      }
+      m_NumTuples = m_NumTuples - idxs.size();
+      m_Size = m_NumTuples * m_NumComponents;
+      m_Values.resize(m_Size);
+      return 0;
+    }
+
+    virtual int copyTuple(size_t currentPos, size_t newPos)
+    {
+      if (currentPos >= m_NumTuples || newPos >= m_NumTuples) { return -1; }
+      for (size_t c = 0; c < m_NumComponents; ++c)
+      {
+        m_Values[newPos * m_NumComponents + c] = m_Values[currentPos * m_NumComponents + c];
+      }
+      return 0;
+    }
+
+    virtual IDataArray::Pointer reorderCopy(QVector<size_t> newOrderMap)
+    {
+      if(static_cast<size_t>(newOrderMap.size()) != m_NumTuples)
+      {
+        return IDataArray::NullPointer();
+      }
+      QuantizedFloatArray::Pointer daCopy = QuantizedFloatArray::CreateArray(m_NumTuples, m_CompDims, m_Name, m_Encoding, m_IsAllocated);
+      if (m_IsAllocated == true)
+      {
+        for (size_t t = 0; t < m_NumTuples; ++t)
+        {
+          ::memcpy(daCopy->getRawPointer(newOrderMap[t] * m_NumComponents), &(m_Values[t * m_NumComponents]),
+                   m_NumComponents * sizeof(StorageType));
+        }
+      }
+      return daCopy;
+    }
+
+    virtual void initializeTuple(size_t pos, double value)
+    {
+      if (pos >= m_NumTuples) { return; }
+      StorageType v = encode(static_cast<float>(value));
+      for (size_t c = 0; c < m_NumComponents; ++c)
+      {
+        m_Values[pos * m_NumComponents + c] = v;
+      }
+    }
+
+    virtual void initializeWithZeros()
+    {
+      // Both encodings store 0.0 as all bits clear
+      std::fill(m_Values.begin(), m_Values.end(), static_cast<StorageType>(0));
+    }
+
+    virtual IDataArray::Pointer deepCopy(bool forceNoAllocate = false)
+    {
+      QuantizedFloatArray::Pointer daCopy = QuantizedFloatArray::CreateArray(m_NumTuples, m_CompDims, m_Name, m_Encoding, m_IsAllocated);
+      if (m_IsAllocated == true && forceNoAllocate == false)
+      {
+        daCopy->m_Values = m_Values;
+      }
+      return daCopy;
+    }
+
+    virtual int32_t resizeTotalElements(size_t size)
+    {
+      m_Values.resize(size, 0);
+      m_Size = size;
+      m_NumTuples = (m_NumComponents > 0) ? size / m_NumComponents : 0;
+      m_IsAllocated = true;
+      return 1;
+    }
+
+    virtual int32_t resize(size_t numTuples)
+    {
+      int32_t check = resizeTotalElements(numTuples * m_NumComponents);
+      m_NumTuples = numTuples;
+      return check;
+    }
+
+    virtual void printTuple(QTextStream& out, size_t i, char delimiter = ',')
+    {
+      for(size_t j = 0; j < m_NumComponents; ++j)
+      {
+        if (j != 0) { out << delimiter; }
+        out << getValue(i * m_NumComponents + j);
+      }
+    }
+
+    virtual void printComponent(QTextStream& out, size_t i, int j)
+    {
+      out << getValue(i * m_NumComponents + j);
+    }
+
+    /**
+     * @brief Writes the values decoded, exactly as a DataArray<float> would write them, and records the encoding
+     */
+    virtual int writeH5Data(hid_t parentId, QVector<size_t> tDims)
+    {
+      if (m_IsAllocated == false) { return -85648; }
+      FloatArrayType::Pointer p = toFloatArray();
+      int err = p->writeH5Data(parentId, tDims);
+      if (err < 0) { return err; }
+      err = QH5Lite::writeStringAttribute(parentId, getName(), DREAM3D::HDF5::QuantizedEncoding, EncodingName(m_Encoding));
+      if (err < 0) { return -612; }
+      return err;
+    }
+
+    virtual int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName,
+                                   const QString& groupPath, const QString& label)
+    {
+      if (m_IsAllocated == false) { return -85648; }
+      QString dimStr;
+      if (m_NumComponents == 1)
+      {
+        out << "    <Attribute Name=\"" << getName() << label  << "\" AttributeType=\"Scalar\" ";
+        dimStr = QString("%1 %2 %3 ").arg(volDims[2]).arg(volDims[1]).arg(volDims[0]);
+      }
+      else
+      {
+        out << "    <Attribute Name=\"" << getName() << label  << "\" AttributeType=\"Vector\" ";
+        dimStr = QString("%1 %2 %3 %4 ").arg(volDims[2]).arg(volDims[1]).arg(volDims[0]).arg(m_NumComponents);
+      }
+      out << "Center=\"Cell\">\n" ;
+      out << "      <DataItem Format=\"HDF\" Dimensions=\"" << dimStr <<  "\" ";
+      out << "NumberType=\"Float\" Precision=\"4\" >\n" ;
+      out << "        " << hdfFileName << groupPath << "/" << getName() << "\n";
+      out << "      </DataItem>" << "\n";
+      out << "    </Attribute>" << "\n";
+      return 1;
+    }
+
+    /**
+     * @brief Reads a float array from the file and encodes it using the encoding of this array
+     */
+    virtual int readH5Data(hid_t parentId)
+    {
+      resize(0);
+      IDataArray::Pointer p = H5DataArrayReader::ReadIDataArray(parentId, getName());
+      FloatArrayType::Pointer floatArray = boost::dynamic_pointer_cast<FloatArrayType>(p);
+      QuantizedFloatArray::Pointer compactArray = boost::dynamic_pointer_cast<QuantizedFloatArray>(p);
+      if (NULL != compactArray.get())
+      {
+        floatArray = compactArray->toFloatArray();
+      }
+      if (NULL == floatArray.get())
+      {
+        return -1;
+      }
+      m_CompDims = floatArray->getComponentDimensions();
+      m_NumComponents = floatArray->getNumberOfComponents();
+      resize(floatArray->getNumberOfTuples());
+      packFrom(floatArray->getConstPointer(0));
+      return 0;
+    }
+
+  protected:
+    QuantizedFloatArray(size_t numTuples, QVector<size_t> compDims, const QString& name, Encoding encoding, bool allocate) :
+      m_Name(name),
+      m_NumTuples(numTuples),
+      m_CompDims(compDims),
+      m_Encoding(encoding),
+      m_IsAllocated(false)
+    {
+      m_NumComponents = m_CompDims[0];
+      for (int i = 1; i < m_CompDims.size(); i++)
+      {
+        m_NumComponents = m_NumComponents * m_CompDims[i];
+      }
+      m_Size = m_NumTuples * m_NumComponents;
+      if (allocate == true)
+      {
+        m_Values.resize(m_Size, 0);
+        m_IsAllocated = true;
+      }
+    }
+
+  private:
+    std::vector<StorageType> m_Values;
+    QString m_Name;
+    size_t m_NumTuples;
+    QVector<size_t> m_CompDims;
+    size_t m_NumComponents;
+    size_t m_Size;
+    Encoding m_Encoding;
+    bool m_IsAllocated;
+
+    QuantizedFloatArray(const QuantizedFloatArray&); //Not Implemented
+    void operator=(const QuantizedFloatArray&); //Not Implemented
+};
+
+#endif /* _QuantizedFloatArray_H_ */
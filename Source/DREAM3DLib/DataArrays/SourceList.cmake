@@ -10,10 +10,12 @@
 #--////////////////////////////////////////////////////////////////////////////
 
 set(DREAM3DLib_DataArrays_HDRS
+  ${DREAM3DLib_SOURCE_DIR}/DataArrays/BitArray.hpp
   ${DREAM3DLib_SOURCE_DIR}/DataArrays/DataArray.hpp
   ${DREAM3DLib_SOURCE_DIR}/DataArrays/IDataArray.h
   ${DREAM3DLib_SOURCE_DIR}/DataArrays/ManagedArrayOfArrays.hpp
   ${DREAM3DLib_SOURCE_DIR}/DataArrays/NeighborList.hpp
+  ${DREAM3DLib_SOURCE_DIR}/DataArrays/QuantizedFloatArray.hpp
   ${DREAM3DLib_SOURCE_DIR}/DataArrays/StatsDataArray.h
   ${DREAM3DLib_SOURCE_DIR}/DataArrays/StringDataArray.hpp
   ${DREAM3DLib_SOURCE_DIR}/DataArrays/StructArray.hpp
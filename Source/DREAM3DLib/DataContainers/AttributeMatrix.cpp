@@ -41,6 +41,14 @@
 // C++ Includes
 #include <iostream>
 #include <fstream>
+#include <vector>
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 //HDF5 Includes
 #include "H5Support/QH5Utilities.h"
@@ -58,6 +66,121 @@
 #include "DREAM3DLib/HDF5/H5DataArrayReader.h"
 #include "DREAM3DLib/DataArrays/StatsDataArray.h"
 
+/**
+ * @brief The CopyTuplesImpl class applies one list of Tuple copies, or fills when no source list is given, to a
+ * range of Attribute Arrays.
+ */
+class CopyTuplesImpl
+{
+  public:
+    CopyTuplesImpl(std::vector<IDataArray::Pointer>& arrays, const QVector<size_t>* srcIdxs, const QVector<size_t>& destIdxs, double value, std::vector<int>& errors) :
+      m_Arrays(arrays),
+      m_SrcIdxs(srcIdxs),
+      m_DestIdxs(destIdxs),
+      m_Value(value),
+      m_Errors(errors)
+    {}
+    virtual ~CopyTuplesImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      for (size_t i = start; i < end; i++)
+      {
+        if(NULL != m_SrcIdxs)
+        {
+          m_Errors[i] = m_Arrays[i]->copyTuples(*m_SrcIdxs, m_DestIdxs);
+        }
+        else
+        {
+          m_Errors[i] = m_Arrays[i]->fillTuples(m_DestIdxs, m_Value);
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    std::vector<IDataArray::Pointer>& m_Arrays;
+    const QVector<size_t>* m_SrcIdxs;
+    const QVector<size_t>& m_DestIdxs;
+    double m_Value;
+    std::vector<int>& m_Errors;
+};
+
+/**
+ * @brief The EraseTuplesImpl class erases the same sorted list of Tuples from a range of Attribute Arrays.
+ */
+class EraseTuplesImpl
+{
+  public:
+    EraseTuplesImpl(std::vector<IDataArray::Pointer>& arrays, QVector<size_t>& removeList) :
+      m_Arrays(arrays),
+      m_RemoveList(removeList)
+    {}
+    virtual ~EraseTuplesImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      for (size_t i = start; i < end; i++)
+      {
+        m_Arrays[i]->eraseTuples(m_RemoveList);
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    std::vector<IDataArray::Pointer>& m_Arrays;
+    QVector<size_t>& m_RemoveList;
+};
+
+/**
+ * @brief The RenumberIdsImpl class maps a range of Ids through a table of new Ids. Ids outside the table are left alone.
+ */
+class RenumberIdsImpl
+{
+  public:
+    RenumberIdsImpl(int32_t* ids, const int32_t* newIds, int32_t numNewIds) :
+      m_Ids(ids),
+      m_NewIds(newIds),
+      m_NumNewIds(numNewIds)
+    {}
+    virtual ~RenumberIdsImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      for (size_t i = start; i < end; i++)
+      {
+        if(m_Ids[i] >= 0 && m_Ids[i] < m_NumNewIds)
+        {
+          m_Ids[i] = m_NewIds[m_Ids[i]];
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    int32_t* m_Ids;
+    const int32_t* m_NewIds;
+    int32_t m_NumNewIds;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -158,6 +281,73 @@ bool AttributeMatrix::validateAttributeArraySizes()
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AttributeMatrix::copyTuples(const QVector<size_t>& srcIdxs, const QVector<size_t>& destIdxs)
+{
+  if(srcIdxs.size() != destIdxs.size()) { return -1; }
+  std::vector<IDataArray::Pointer> arrays;
+  for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
+  {
+    arrays.push_back(iter.value());
+  }
+  std::vector<int> errors(arrays.size(), 0);
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, arrays.size()), CopyTuplesImpl(arrays, &srcIdxs, destIdxs, 0.0, errors), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    CopyTuplesImpl serial(arrays, &srcIdxs, destIdxs, 0.0, errors);
+    serial.convert(0, arrays.size());
+  }
+
+  for(size_t i = 0; i < errors.size(); i++)
+  {
+    if(errors[i] < 0) { return errors[i]; }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AttributeMatrix::fillTuples(const QVector<size_t>& idxs, double value)
+{
+  std::vector<IDataArray::Pointer> arrays;
+  for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
+  {
+    arrays.push_back(iter.value());
+  }
+  std::vector<int> errors(arrays.size(), 0);
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, arrays.size()), CopyTuplesImpl(arrays, NULL, idxs, value, errors), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    CopyTuplesImpl serial(arrays, NULL, idxs, value, errors);
+    serial.convert(0, arrays.size());
+  }
+
+  for(size_t i = 0; i < errors.size(); i++)
+  {
+    if(errors[i] < 0) { return errors[i]; }
+  }
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -286,8 +476,9 @@ bool AttributeMatrix::removeInactiveObjects(QVector<bool> activeObjects, Int32Ar
   size_t totalTuples = getNumTuples();
   if( static_cast<size_t>(activeObjects.size()) == totalTuples && acceptableMatrix == true)
   {
-    size_t goodcount = 1;
-    QVector<size_t> NewNames(totalTuples, 0);
+    // One pass gives both the new name of every kept object and the sorted list of removed ones
+    int32_t goodcount = 1;
+    std::vector<int32_t> NewNames(totalTuples, 0);
     QVector<size_t> RemoveList;
 
     for(qint32 i = 1; i < activeObjects.size(); i++)
@@ -306,6 +497,7 @@ bool AttributeMatrix::removeInactiveObjects(QVector<bool> activeObjects, Int32Ar
 
     if(RemoveList.size() > 0)
     {
+      std::vector<IDataArray::Pointer> arrays;
       QList<QString> headers = getAttributeArrayNames();
       for (QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
       {
@@ -317,21 +509,41 @@ bool AttributeMatrix::removeInactiveObjects(QVector<bool> activeObjects, Int32Ar
         }
         else
         {
-          p->eraseTuples(RemoveList);
+          arrays.push_back(p);
         }
       }
+
+      size_t totalPoints = Ids->getNumberOfTuples();
+      int32_t* id = Ids->getPointer(0);
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+      tbb::task_scheduler_init init;
+      bool doParallel = true;
+      if (doParallel == true)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, arrays.size()), EraseTuplesImpl(arrays, RemoveList), tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        EraseTuplesImpl serial(arrays, RemoveList);
+        serial.convert(0, arrays.size());
+      }
+      // The arrays are already compacted, so this only records the new dimensions
       QVector<size_t> tDims(1, (totalTuples - RemoveList.size()));
       setTupleDimensions(tDims);
 
       // Loop over all the points and correct all the feature names
-      size_t totalPoints = Ids->getNumberOfTuples();
-      int32_t* id = Ids->getPointer(0);
-      for (size_t i = 0; i < totalPoints; i++)
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+      if (doParallel == true)
       {
-        if(id[i] >= 0 && id[i] < NewNames.size())
-        {
-          id[i] = static_cast<int32_t>( NewNames[id[i]] );
-        }
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints), RenumberIdsImpl(id, &(NewNames.front()), static_cast<int32_t>(NewNames.size())), tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        RenumberIdsImpl serial(id, &(NewNames.front()), static_cast<int32_t>(NewNames.size()));
+        serial.convert(0, totalPoints);
       }
     }
   }
@@ -47,6 +47,9 @@
 #include <sstream>
 #include <list>
 
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
 //-- EBSD Lib Includes
 #include "EbsdLib/EbsdConstants.h"
 
@@ -62,6 +65,7 @@
 #include "DREAM3DLib/Common/Observable.h"
 #include "DREAM3DLib/DataContainers/DataContainerProxy.h"
 #include "DREAM3DLib/DataArrays/DataArray.hpp"
+#include "DREAM3DLib/DataArrays/QuantizedFloatArray.hpp"
 
 enum RenameErrorCodes
 {
@@ -225,6 +229,24 @@ class DREAM3DLib_EXPORT AttributeMatrix : public Observable
      */
     virtual bool validateAttributeArraySizes();
 
+    /**
+     * @brief Copies Tuple srcIdxs[i] to Tuple destIdxs[i], in order, in every Attribute Array of the matrix. This is
+     * the bulk form of calling copyTuple on each array for each pair. The arrays are processed in parallel.
+     * @param srcIdxs The indices of the source Tuples
+     * @param destIdxs The indices of the destination Tuples
+     * @return 0 on success, otherwise the error of the first array that failed
+     */
+    int copyTuples(const QVector<size_t>& srcIdxs, const QVector<size_t>& destIdxs);
+
+    /**
+     * @brief Splats the same value across each listed Tuple in every Attribute Array of the matrix. This is the
+     * bulk form of calling initializeTuple on each array for each index. The arrays are processed in parallel.
+     * @param idxs The indices of the Tuples
+     * @param value The value to splat
+     * @return 0 on success, otherwise the error of the first array that failed
+     */
+    int fillTuples(const QVector<size_t>& idxs, double value);
+
     /**
      * @brief getPrereqArray
      * @param filter An instance of an AbstractFilter that is calling this function. Can be NULL in which case
@@ -265,6 +287,7 @@ class DREAM3DLib_EXPORT AttributeMatrix : public Observable
         }
         return attributeArray;
       }
+      expandQuantizedArray<ArrayType>(attributeArrayName);
       int NumComp = cDims[0];
       for(int i = 1; i < cDims.size(); i++)
       {
@@ -325,6 +348,7 @@ class DREAM3DLib_EXPORT AttributeMatrix : public Observable
       }
       else
       {
+        expandQuantizedArray<ArrayType>(attributeArrayName);
         IDataArray::Pointer ptr = getAttributeArray(attributeArrayName);
         return boost::dynamic_pointer_cast<ArrayType>(ptr);
       }
@@ -542,6 +566,30 @@ class DREAM3DLib_EXPORT AttributeMatrix : public Observable
   protected:
     AttributeMatrix(QVector<size_t> tDims, const QString& name, unsigned int attrType);
 
+    /**
+     * @brief If the named array is stored as a QuantizedFloatArray and the caller asks for any other ArrayType that
+     * the decoded values fit (a DataArray<float>, or a plain IDataArray that is then dispatched on its type name),
+     * replaces it with the decoded array so that filters working on raw float pointers see the values. The array
+     * stays expanded afterwards, so filters that can read the compact values directly should ask for a
+     * QuantizedFloatArray (or use getAttributeArray) to keep the memory saving.
+     * @param attributeArrayName The name of the Attribute Array
+     */
+    template<class ArrayType>
+    void expandQuantizedArray(const QString& attributeArrayName)
+    {
+      // Only decode when the caller could use the DataArray<float>, so no float copy is built and thrown away
+      if(boost::is_same<ArrayType, QuantizedFloatArray>::value || !boost::is_convertible<FloatArrayType*, ArrayType*>::value)
+      {
+        return;
+      }
+      QuantizedFloatArray::Pointer compactArray = boost::dynamic_pointer_cast<QuantizedFloatArray>(getAttributeArray(attributeArrayName));
+      if(NULL == compactArray.get())
+      {
+        return;
+      }
+      addAttributeArray(attributeArrayName, compactArray->toFloatArray());
+    }
+
     /**
      * @brief writeXdmfAttributeData
      * @param array
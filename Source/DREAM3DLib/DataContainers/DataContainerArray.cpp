@@ -249,6 +249,26 @@ void DataContainerArray::duplicateDataContainer(const QString& name, const QStri
   addDataContainer(new_f);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataContainerArray::invalidateWritePointers()
+{
+  for(QList<DataContainer::Pointer>::iterator it = m_Array.begin(); it != m_Array.end(); ++it)
+  {
+    DataContainer::AttributeMatrixMap_t& attrMats = (*it)->getAttributeMatrices();
+    for(DataContainer::AttributeMatrixMap_t::iterator am = attrMats.begin(); am != attrMats.end(); ++am)
+    {
+      QList<QString> names = (*am)->getAttributeArrayNames();
+      for(QList<QString>::iterator name = names.begin(); name != names.end(); ++name)
+      {
+        IDataArray::Pointer array = (*am)->getAttributeArray(*name);
+        if(NULL != array.get()) { array->invalidateWritePointers(); }
+      }
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
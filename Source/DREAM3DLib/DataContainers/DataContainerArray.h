@@ -139,6 +139,13 @@ class DREAM3DLib_EXPORT DataContainerArray : public QObject
      */
     virtual void duplicateDataContainer(const QString& name, const QString& newName);
 
+    /**
+     * @brief Calls invalidateWritePointers() on every array of every AttributeMatrix so that copies made after
+     * this point share memory with the arrays again. Only call this once no filter uses the raw pointers it
+     * fetched from the arrays any more.
+     */
+    void invalidateWritePointers();
+
 
     //////////////////////  AttributeMatrix Functions //////////////////////////
     /**
@@ -43,6 +43,7 @@
 
 #include "DREAM3DLib/DataArrays/DataArray.hpp"
 #include "DREAM3DLib/DataArrays/NeighborList.hpp"
+#include "DREAM3DLib/DataArrays/QuantizedFloatArray.hpp"
 #include "DREAM3DLib/DataArrays/StringDataArray.hpp"
 
 #define MIKESTEMP 1
@@ -88,6 +89,26 @@ namespace Detail
     }
     return ptr;
   }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+  IDataArray::Pointer restoreQuantizedArray(hid_t locId, const QString& datasetPath, IDataArray::Pointer ptr)
+  {
+    // Float arrays written from a QuantizedFloatArray carry the encoding they were stored with
+    QString encodingName;
+    if(NULL == ptr.get() || QH5Lite::readStringAttribute(locId, datasetPath, DREAM3D::HDF5::QuantizedEncoding, encodingName) < 0)
+    {
+      return ptr;
+    }
+    bool ok = false;
+    QuantizedFloatArray::Encoding encoding = QuantizedFloatArray::EncodingFromName(encodingName, ok);
+    if(false == ok)
+    {
+      return ptr;
+    }
+    return QuantizedFloatArray::FromFloatArray(FloatArrayType::SafePointerDownCast(ptr.get()), encoding);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -454,6 +475,7 @@ IDataArray::Pointer H5DataArrayReader::ReadIDataArray(hid_t gid, const QString&
           {
             ptr = DataArray<float>::CreateArray(tDims, cDims, name, false);
           }
+          ptr = Detail::restoreQuantizedArray(gid, name, ptr);
         }
         else if(attr_size == 8)
         {
@@ -0,0 +1,345 @@
+/* ============================================================================
+ * Copyright (c) 2014, Michael A. Jackson (BlueQuartz Software)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Jackson nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DREAM3DCounterRandom.h"
+
+#include <math.h>
+
+#include <QtCore/QDateTime>
+
+/* Philox4x32 round multipliers and Weyl sequence key increments */
+#define PHILOX_M4x32_0 0xD2511F53UL
+#define PHILOX_M4x32_1 0xCD9E8D57UL
+#define PHILOX_W32_0 0x9E3779B9UL
+#define PHILOX_W32_1 0xBB67AE85UL
+#define PHILOX_ROUNDS 10
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DREAM3DCounterRandom::DREAM3DCounterRandom(uint64_t seed, uint64_t stream) :
+  m_Seed(seed),
+  m_Stream(stream),
+  m_Block(0),
+  m_OutputIndex(4)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DREAM3DCounterRandom::~DREAM3DCounterRandom()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DREAM3DCounterRandom::setSeed(uint64_t seed)
+{
+  m_Seed = seed;
+  setPosition(0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DREAM3DCounterRandom::getSeed() const
+{
+  return m_Seed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DREAM3DCounterRandom::setStream(uint64_t stream)
+{
+  m_Stream = stream;
+  setPosition(0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DREAM3DCounterRandom::getStream() const
+{
+  return m_Stream;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DREAM3DCounterRandom::setPosition(uint64_t position)
+{
+  m_Block = position / 4;
+  m_OutputIndex = 4;
+  if (position % 4 != 0)
+  {
+    generateBlock();
+    m_OutputIndex = static_cast<int>(position % 4);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DREAM3DCounterRandom::getPosition() const
+{
+  // m_Block always points at the next block that has not been computed yet
+  if (m_OutputIndex == 4) { return m_Block * 4; }
+  return (m_Block - 1) * 4 + m_OutputIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DREAM3DCounterRandom DREAM3DCounterRandom::substream(uint64_t stream) const
+{
+  return DREAM3DCounterRandom(m_Seed, stream);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t DREAM3DCounterRandom::GenerateSeed()
+{
+  return static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DREAM3DCounterRandom::Philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4])
+{
+  uint32_t ctr[4] = { counter[0], counter[1], counter[2], counter[3] };
+  uint32_t k0 = key[0];
+  uint32_t k1 = key[1];
+  for (int r = 0; r < PHILOX_ROUNDS; r++)
+  {
+    uint64_t p0 = static_cast<uint64_t>(PHILOX_M4x32_0) * ctr[0];
+    uint64_t p1 = static_cast<uint64_t>(PHILOX_M4x32_1) * ctr[2];
+    uint32_t hi0 = static_cast<uint32_t>(p0 >> 32);
+    uint32_t lo0 = static_cast<uint32_t>(p0);
+    uint32_t hi1 = static_cast<uint32_t>(p1 >> 32);
+    uint32_t lo1 = static_cast<uint32_t>(p1);
+    ctr[0] = hi1 ^ ctr[1] ^ k0;
+    ctr[1] = lo1;
+    ctr[2] = hi0 ^ ctr[3] ^ k1;
+    ctr[3] = lo0;
+    k0 += static_cast<uint32_t>(PHILOX_W32_0);
+    k1 += static_cast<uint32_t>(PHILOX_W32_1);
+  }
+  output[0] = ctr[0];
+  output[1] = ctr[1];
+  output[2] = ctr[2];
+  output[3] = ctr[3];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DREAM3DCounterRandom::generateBlock()
+{
+  // The low half of the counter is the block within the stream, the high half is the stream id
+  uint32_t counter[4] =
+  {
+    static_cast<uint32_t>(m_Block),
+    static_cast<uint32_t>(m_Block >> 32),
+    static_cast<uint32_t>(m_Stream),
+    static_cast<uint32_t>(m_Stream >> 32)
+  };
+  uint32_t key[2] = { static_cast<uint32_t>(m_Seed), static_cast<uint32_t>(m_Seed >> 32) };
+  Philox4x32(counter, key, m_Output);
+  m_Block++;
+  m_OutputIndex = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint32_t DREAM3DCounterRandom::genrand_int32()
+{
+  if (m_OutputIndex == 4) { generateBlock(); }
+  return m_Output[m_OutputIndex++];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t DREAM3DCounterRandom::genrand_int31()
+{
+  return static_cast<int32_t>(genrand_int32() >> 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double DREAM3DCounterRandom::genrand_real1()
+{
+  return genrand_int32() * (1.0 / 4294967295.0);
+  /* divided by 2^32-1 */
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double DREAM3DCounterRandom::genrand_real2()
+{
+  return genrand_int32() * (1.0 / 4294967296.0);
+  /* divided by 2^32 */
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double DREAM3DCounterRandom::genrand_real3()
+{
+  return (((double)genrand_int32()) + 0.5) * (1.0 / 4294967296.0);
+  /* divided by 2^32 */
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double DREAM3DCounterRandom::genrand_res53()
+{
+  uint32_t a = genrand_int32() >> 5, b = genrand_int32() >> 6;
+  return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+}
+
+// -----------------------------------------------------------------------------
+// Same rational approximation of the inverse normal CDF as DREAM3DRandom::genrand_norm
+// -----------------------------------------------------------------------------
+double DREAM3DCounterRandom::genrand_norm(double m, double s)
+{
+  const double p0 = 0.322232431088;
+  const double q0 = 0.099348462606;
+  const double p1 = 1.0;
+  const double q1 = 0.588581570495;
+  const double p2 = 0.342242088547;
+  const double q2 = 0.531103462366;
+  const double p3 = 0.204231210245e-1;
+  const double q3 = 0.103537752850;
+  const double p4 = 0.453642210148e-4;
+  const double q4 = 0.385607006340e-2;
+  double u, t, p, q, z;
+
+  u = genrand_res53();
+  if (u < 0.5)
+  {
+    t = sqrt(-2.0 * log(u));
+  }
+  else
+  {
+    t = sqrt(-2.0 * log(1.0 - u));
+  }
+  p   = p0 + t * (p1 + t * (p2 + t * (p3 + t * p4)));
+  q   = q0 + t * (q1 + t * (q2 + t * (q3 + t * q4)));
+  if (u < 0.5)
+  {
+    z = (p / q) - t;
+  }
+  else
+  {
+    z = t - (p / q);
+  }
+  return (m + s * z);
+}
+
+// -----------------------------------------------------------------------------
+// Cheng (1978) as in ranlib's genbet: BB when both shape parameters are above 1,
+// BC otherwise. Unlike DREAM3DRandom::genrand_beta this keeps no static state.
+// -----------------------------------------------------------------------------
+double DREAM3DCounterRandom::genrand_beta(double aa, double bb)
+{
+  const double expmax = 89.0;
+  const double infnty = 1.0E38;
+  double a, b, alpha, beta, gamma, delta, k1, k2;
+  double r, s, t, u1, u2, v, w, y, z;
+
+  if (aa > 1.0 && bb > 1.0)
+  {
+    a = (aa < bb) ? aa : bb;
+    b = (aa < bb) ? bb : aa;
+    alpha = a + b;
+    beta = sqrt((alpha - 2.0) / (2.0 * a * b - alpha));
+    gamma = a + 1.0 / beta;
+    while (true)
+    {
+      u1 = genrand_real3();
+      u2 = genrand_real3();
+      v = beta * log(u1 / (1.0 - u1));
+      w = (v > expmax) ? infnty : a * exp(v);
+      z = u1 * u1 * u2;
+      r = gamma * v - 1.3862944;
+      s = a + r - w;
+      if (s + 2.609438 >= 5.0 * z) { break; }
+      t = log(z);
+      if (s > t) { break; }
+      if (r + alpha * log(alpha / (b + w)) >= t) { break; }
+    }
+  }
+  else
+  {
+    a = (aa > bb) ? aa : bb;
+    b = (aa > bb) ? bb : aa;
+    alpha = a + b;
+    beta = 1.0 / b;
+    delta = 1.0 + a - b;
+    k1 = delta * (0.0138889 + 0.0416667 * b) / (a * beta - 0.777778);
+    k2 = 0.25 + (0.5 + 0.25 / delta) * b;
+    while (true)
+    {
+      u1 = genrand_real3();
+      u2 = genrand_real3();
+      if (u1 < 0.5)
+      {
+        y = u1 * u2;
+        z = u1 * y;
+        if (0.25 * u2 + z - y >= k1) { continue; }
+      }
+      else
+      {
+        z = u1 * u1 * u2;
+        if (z <= 0.25)
+        {
+          v = beta * log(u1 / (1.0 - u1));
+          w = (v > expmax) ? infnty : a * exp(v);
+          break;
+        }
+        if (z >= k2) { continue; }
+      }
+      v = beta * log(u1 / (1.0 - u1));
+      w = (v > expmax) ? infnty : a * exp(v);
+      if (alpha * (log(alpha / (b + w)) + v) - 1.3862944 >= log(z)) { break; }
+    }
+  }
+  return (aa == a) ? w / (b + w) : b / (b + w);
+}
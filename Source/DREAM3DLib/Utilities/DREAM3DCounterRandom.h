@@ -0,0 +1,126 @@
+/* ============================================================================
+ * Copyright (c) 2014, Michael A. Jackson (BlueQuartz Software)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Jackson nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _DREAM3DCOUNTERRANDOM_H_
+#define _DREAM3DCOUNTERRANDOM_H_
+
+#include "DREAM3DLib/DREAM3DLib.h"
+
+/**
+ * @class DREAM3DCounterRandom DREAM3DCounterRandom.h DREAM3DLib/Utilities/DREAM3DCounterRandom.h
+ * @brief This is a counter based pseudorandom number generator using the Philox4x32-10 bijection
+ * (Salmon, Moraes, Dror and Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3", SC11).
+ *
+ * Each value is computed directly from the seed, a stream id and the position within that stream,
+ * so the generator has no state other than those three numbers. Giving every thread, Feature or
+ * Cell its own stream id produces the same numbers no matter how the work is split across threads,
+ * and setPosition() can jump anywhere in a stream without generating the values before it.
+ *
+ * The generating functions mirror the ones in DREAM3DRandom so the two can be swapped easily. Like
+ * DREAM3DRandom an instance is only thread safe if a single thread uses it; create one instance
+ * per thread (or per stream) instead.
+ */
+class DREAM3DLib_EXPORT DREAM3DCounterRandom
+{
+  public:
+    DREAM3DCounterRandom(uint64_t seed = 0, uint64_t stream = 0);
+    virtual ~DREAM3DCounterRandom();
+
+    /**
+     * @brief Sets the global seed (the Philox key) and rewinds the current stream to its start
+     */
+    void setSeed(uint64_t seed);
+    uint64_t getSeed() const;
+
+    /**
+     * @brief Selects the substream that values are drawn from and rewinds it to its start
+     */
+    void setStream(uint64_t stream);
+    uint64_t getStream() const;
+
+    /**
+     * @brief Moves to the given position (counted in 32 bit values) within the current stream
+     */
+    void setPosition(uint64_t position);
+    uint64_t getPosition() const;
+
+    /**
+     * @brief Returns a new generator with the same seed that draws from the given substream
+     */
+    DREAM3DCounterRandom substream(uint64_t stream) const;
+
+    /**
+     * @brief Computes a seed from the system clock for filters that do not use a fixed seed
+     */
+    static uint64_t GenerateSeed();
+
+    /**
+     * @brief Applies the Philox4x32-10 bijection to a 128 bit counter using a 64 bit key
+     * @param counter The four 32 bit words of the counter
+     * @param key The two 32 bit words of the key
+     * @param output The four 32 bit words of the result
+     */
+    static void Philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4]);
+
+    /* generates a random number on [0,0xffffffff]-interval */
+    uint32_t genrand_int32();
+
+    /* generates a random number on [0,0x7fffffff]-interval */
+    int32_t genrand_int31();
+
+    /* generates a random number on [0,1]-real-interval */
+    double genrand_real1();
+
+    /* generates a random number on [0,1)-real-interval */
+    double genrand_real2();
+
+    /* generates a random number on (0,1)-real-interval */
+    double genrand_real3();
+
+    /* generates a random number on [0,1) with 53-bit resolution*/
+    double genrand_res53();
+
+    /* generates a normally distributed number with mean m and standard deviation s */
+    double genrand_norm(double m, double s);
+
+    /* generates a beta distributed number with shape parameters aa and bb (Cheng's BB and BC algorithms) */
+    double genrand_beta(double aa, double bb);
+
+  private:
+    uint64_t m_Seed;
+    uint64_t m_Stream;
+    uint64_t m_Block;
+    uint32_t m_Output[4];
+    int m_OutputIndex; // == 4 means m_Output needs to be computed for m_Block
+
+    void generateBlock();
+};
+
+#endif /* _DREAM3DCOUNTERRANDOM_H_ */
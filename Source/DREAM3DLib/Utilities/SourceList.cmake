@@ -16,6 +16,7 @@ set(DREAM3DLib_Utilities_HDRS
   ${DREAM3DLib_SOURCE_DIR}/Utilities/TimeUtilities.h
   ${DREAM3DLib_SOURCE_DIR}/Utilities/DREAM3DEndian.h
   ${DREAM3DLib_SOURCE_DIR}/Utilities/DREAM3DRandom.h
+  ${DREAM3DLib_SOURCE_DIR}/Utilities/DREAM3DCounterRandom.h
   ${DREAM3DLib_SOURCE_DIR}/Utilities/FilePathGenerator.h
   ${DREAM3DLib_SOURCE_DIR}/Utilities/QMetaObjectUtilities.h
 )
@@ -25,6 +26,7 @@ set(DREAM3DLib_Utilities_SRCS
   ${DREAM3DLib_SOURCE_DIR}/Utilities/ImageUtilities.cpp
   ${DREAM3DLib_SOURCE_DIR}/Utilities/ColorUtilities.cpp
   ${DREAM3DLib_SOURCE_DIR}/Utilities/DREAM3DRandom.cpp
+  ${DREAM3DLib_SOURCE_DIR}/Utilities/DREAM3DCounterRandom.cpp
   ${DREAM3DLib_SOURCE_DIR}/Utilities/FilePathGenerator.cpp
   ${DREAM3DLib_SOURCE_DIR}/Utilities/QMetaObjectUtilities.cpp
 )
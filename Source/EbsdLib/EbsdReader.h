@@ -134,6 +134,16 @@ class EbsdLib_EXPORT EbsdReader
      */
     virtual void* getPointerByName(const QString& featureName) = 0;
 
+    /**
+     * @brief Hands the memory for a column of data over to the caller, who is then responsible for
+     * releasing it with free(), for example by wrapping it in a DataArray that owns its data. The reader
+     * forgets about the memory so getPointerByName() will return NULL for that column afterwards.
+     * @param featureName The name of the feature to release.
+     * @return The pointer or NULL if the column does not exist or its memory can not be handed over, in
+     * which case the caller should copy the values from getPointerByName() instead.
+     */
+    virtual void* releasePointerByName(const QString& featureName) { (void)(featureName); return NULL; }
+
     /**
      * @brief Returns an enumeration value that depicts the numerical
      * primitive type that the data is stored as (Int, Float, etc).
@@ -204,6 +214,29 @@ class EbsdLib_EXPORT EbsdReader
   protected:
     QMap<QString, EbsdHeaderEntry::Pointer> m_HeaderMap;
 
+    /**
+     * @brief Gives up ownership of memory that has been previously allocated and sets the pointer passed in
+     * as the argument to NULL. Memory this class does not manage, or that was allocated with an SSE aligned
+     * allocator, can not be released with free() so NULL is returned and the pointer is left alone.
+     * @param ptr The pointer to be released.
+     * @return The released pointer or NULL.
+     */
+    template<typename T>
+    T* releaseArrayData(T*& ptr)
+    {
+#if defined ( DREAM3D_USE_SSE ) && defined ( __SSE2__ )
+      return NULL;
+#else
+      if (ptr == NULL || this->m_ManageMemory == false)
+      {
+        return NULL;
+      }
+      T* released = ptr;
+      ptr = NULL;
+      return released;
+#endif
+    }
+
 
   private:
     EbsdReader(const EbsdReader&); // Copy Constructor Not Implemented
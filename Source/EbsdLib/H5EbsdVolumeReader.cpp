@@ -36,6 +36,8 @@
 
 #include "H5EbsdVolumeReader.h"
 
+#include <algorithm>
+
 
 
 #if defined (H5Support_NAMESPACE)
@@ -49,6 +51,10 @@ H5EbsdVolumeReader::H5EbsdVolumeReader() :
   m_Cancel(false),
   m_SliceStart(0),
   m_SliceEnd(0),
+  m_XStartIndex(0),
+  m_XEndIndex(-1),
+  m_YStartIndex(0),
+  m_YEndIndex(-1),
   m_ManageMemory(true),
   m_NumberOfElements(0),
   m_ReadAllArrays(true)
@@ -134,3 +140,48 @@ void H5EbsdVolumeReader::readAllArrays(bool b)
 {
   m_ReadAllArrays = b;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5EbsdVolumeReader::getRegionOfInterest(int64_t xpoints, int64_t ypoints, int64_t& xStart, int64_t& xEnd, int64_t& yStart, int64_t& yEnd)
+{
+  xStart = (m_XStartIndex < 0) ? 0 : m_XStartIndex;
+  yStart = (m_YStartIndex < 0) ? 0 : m_YStartIndex;
+  xEnd = (m_XEndIndex < 0 || m_XEndIndex >= xpoints) ? xpoints - 1 : m_XEndIndex;
+  yEnd = (m_YEndIndex < 0 || m_YEndIndex >= ypoints) ? ypoints - 1 : m_YEndIndex;
+  if (xStart > xEnd) { xStart = xEnd; }
+  if (yStart > yEnd) { yStart = yEnd; }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5EbsdVolumeReader::SliceRegion_t H5EbsdVolumeReader::getSliceRegion(int64_t xpoints, int64_t ypoints, int64_t xSlice, int64_t ySlice)
+{
+  int64_t xStart = 0, xEnd = 0, yStart = 0, yEnd = 0;
+  getRegionOfInterest(xpoints, ypoints, xStart, xEnd, yStart, yEnd);
+
+  // Position of the slice inside of the volume
+  int64_t xstartspot = (xpoints - xSlice) / 2;
+  int64_t ystartspot = (ypoints - ySlice) / 2;
+
+  int64_t xFirst = std::max(xStart, xstartspot);
+  int64_t xLast = std::min(xEnd, xstartspot + xSlice - 1);
+  int64_t yFirst = std::max(yStart, ystartspot);
+  int64_t yLast = std::min(yEnd, ystartspot + ySlice - 1);
+
+  SliceRegion_t region;
+  region.XStart = xFirst - xstartspot;
+  region.XCount = (xLast < xFirst) ? 0 : xLast - xFirst + 1;
+  region.YStart = yFirst - ystartspot;
+  region.YCount = (yLast < yFirst) ? 0 : yLast - yFirst + 1;
+  region.DestX = xFirst - xStart;
+  region.DestY = yFirst - yStart;
+  if (region.XCount == 0 || region.YCount == 0)
+  {
+    region.XCount = 0;
+    region.YCount = 0;
+  }
+  return region;
+}
@@ -82,6 +82,27 @@ class EbsdLib_EXPORT H5EbsdVolumeReader : public H5EbsdVolumeInfo
      */
     EBSD_INSTANCE_PROPERTY(int, SliceEnd)
 
+    /**
+     * @brief The first and last (inclusive) columns and rows of the volume that the user wants to load. A
+     * negative end index means the last column or row of the volume. Only this region of each slice is read
+     * from the HDF5 file and the loaded arrays are sized to it.
+     */
+    EBSD_INSTANCE_PROPERTY(int, XStartIndex)
+    EBSD_INSTANCE_PROPERTY(int, XEndIndex)
+    EBSD_INSTANCE_PROPERTY(int, YStartIndex)
+    EBSD_INSTANCE_PROPERTY(int, YEndIndex)
+
+    /**
+     * @brief Clamps the region of interest to a volume of the given size
+     * @param xpoints The number of x voxels of the whole volume
+     * @param ypoints The number of y voxels of the whole volume
+     * @param xStart First column of the region
+     * @param xEnd Last column of the region
+     * @param yStart First row of the region
+     * @param yEnd Last row of the region
+     */
+    void getRegionOfInterest(int64_t xpoints, int64_t ypoints, int64_t& xStart, int64_t& xEnd, int64_t& yStart, int64_t& yEnd);
+
     /**
      * @brief This method does the actual loading of the OIM data from the data
      * source (files, streams, etc) into the data structures. Subclasses need to
@@ -146,6 +167,32 @@ class EbsdLib_EXPORT H5EbsdVolumeReader : public H5EbsdVolumeInfo
   protected:
     H5EbsdVolumeReader();
 
+    /**
+     * @brief Describes the part of a slice that overlaps the region of interest: the columns
+     * [XStart, XStart + XCount) of the rows [YStart, YStart + YCount) of the slice which land
+     * in the region of interest starting at column DestX of row DestY.
+     */
+    typedef struct
+    {
+      int64_t XStart;
+      int64_t XCount;
+      int64_t YStart;
+      int64_t YCount;
+      int64_t DestX;
+      int64_t DestY;
+    } SliceRegion_t;
+
+    /**
+     * @brief Computes which part of a slice has to be read. Slices that are smaller than the volume are
+     * centered in it.
+     * @param xpoints The number of x voxels of the whole volume
+     * @param ypoints The number of y voxels of the whole volume
+     * @param xSlice The number of x voxels of the slice
+     * @param ySlice The number of y voxels of the slice
+     * @return The region of the slice. The counts are zero if the slice is outside of the region of interest.
+     */
+    SliceRegion_t getSliceRegion(int64_t xpoints, int64_t ypoints, int64_t xSlice, int64_t ySlice);
+
   private:
     QSet<QString>         m_ArrayNames;
     bool                  m_ReadAllArrays;
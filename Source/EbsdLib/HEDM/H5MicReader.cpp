@@ -36,6 +36,8 @@
 
 #include "H5MicReader.h"
 
+#include <algorithm>
+
 
 
 #include "H5Support/QH5Lite.h"
@@ -56,7 +58,10 @@ H5MicReader::H5MicReader() :
   MicReader(),
   m_ReadAllArrays(true)
 {
-
+  m_ReadRegion[0] = 0;
+  m_ReadRegion[1] = 0;
+  m_ReadRegion[2] = 0;
+  m_ReadRegion[3] = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -221,7 +226,11 @@ int H5MicReader::readHeader(hid_t parId)
     type* _##name = allocateArray<type>(totalDataRows);\
     if (NULL != _##name) {\
       ::memset(_##name, 0, numBytes);\
-      err = QH5Lite::readPointerDataset(gid, Ebsd::Mic::name, _##name);\
+      if (readRegion == true) {\
+        err = QH5Lite::readPointerDatasetRegion(gid, Ebsd::Mic::name, nCols, xStart, xCount, yStart, yCount, _##name);\
+      } else {\
+        err = QH5Lite::readPointerDataset(gid, Ebsd::Mic::name, _##name);\
+      }\
     }\
     set##name##Pointer(_##name);\
   }
@@ -248,6 +257,23 @@ int H5MicReader::readData(hid_t parId)
   }
 
   totalDataRows = xDim * yDim;
+  size_t nCols = xDim;
+  size_t nRows = yDim;
+
+  // Restrict the read to the requested region of the scan
+  hsize_t xStart = 0;
+  hsize_t xCount = nCols;
+  hsize_t yStart = 0;
+  hsize_t yCount = nRows;
+  bool readRegion = (m_ReadRegion[1] > 0 && m_ReadRegion[3] > 0);
+  if (readRegion == true)
+  {
+    xStart = std::min<hsize_t>(m_ReadRegion[0], nCols);
+    xCount = std::min<hsize_t>(m_ReadRegion[1], nCols - xStart);
+    yStart = std::min<hsize_t>(m_ReadRegion[2], nRows);
+    yCount = std::min<hsize_t>(m_ReadRegion[3], nRows - yStart);
+    totalDataRows = xCount * yCount;
+  }
 
   hid_t gid = H5Gopen(parId, Ebsd::H5::Data.toLatin1().data(), H5P_DEFAULT);
   if (gid < 0)
@@ -288,3 +314,14 @@ void H5MicReader::readAllArrays(bool b)
 {
   m_ReadAllArrays = b;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5MicReader::setReadRegion(int xStart, int xCount, int yStart, int yCount)
+{
+  m_ReadRegion[0] = xStart;
+  m_ReadRegion[1] = xCount;
+  m_ReadRegion[2] = yStart;
+  m_ReadRegion[3] = yCount;
+}
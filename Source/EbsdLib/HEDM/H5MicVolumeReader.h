@@ -46,6 +46,7 @@
 #include "EbsdLib/H5EbsdVolumeReader.h"
 
 #include "EbsdLib/HEDM/MicPhase.h"
+#include "EbsdLib/HEDM/H5MicReader.h"
 
 
 
@@ -119,6 +120,17 @@ class EbsdLib_EXPORT H5MicVolumeReader : public H5EbsdVolumeReader
   private:
     QVector<MicPhase::Pointer> m_Phases;
 
+    /**
+     * @brief Reads the part of a slice that is inside of the region of interest
+     * @param reader The slice reader to read into
+     * @param fileId The open .h5ebsd file
+     * @param slice The index of the slice relative to SliceStart
+     * @param xpoints The number of x voxels of the whole volume
+     * @param ypoints The number of y voxels of the whole volume
+     * @return error condition
+     */
+    int readSlice(H5MicReader* reader, hid_t fileId, int slice, int64_t xpoints, int64_t ypoints);
+
     H5MicVolumeReader(const H5MicVolumeReader&);    // Copy Constructor Not Implemented
     void operator=(const H5MicVolumeReader&);  // Operator '=' Not Implemented
 
@@ -222,6 +222,23 @@ void* MicReader::getPointerByName(const QString& featureName)
   return NULL;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* MicReader::releasePointerByName(const QString& featureName)
+{
+  if (featureName.compare(Ebsd::Mic::Euler1) == 0) { return static_cast<void*>(releaseArrayData(m_Euler1));}
+  if (featureName.compare(Ebsd::Mic::Euler2) == 0) { return static_cast<void*>(releaseArrayData(m_Euler2));}
+  if (featureName.compare(Ebsd::Mic::Euler3) == 0) { return static_cast<void*>(releaseArrayData(m_Euler3));}
+  if (featureName.compare(Ebsd::Mic::Confidence) == 0) { return static_cast<void*>(releaseArrayData(m_Conf));}
+  if (featureName.compare(Ebsd::Mic::Phase) == 0) { return static_cast<void*>(releaseArrayData(m_Phase));}
+  if (featureName.compare(Ebsd::Mic::Level) == 0) { return static_cast<void*>(releaseArrayData(m_Level));}
+  if (featureName.compare(Ebsd::Mic::Up) == 0) { return static_cast<void*>(releaseArrayData(m_Up));}
+  if (featureName.compare(Ebsd::Mic::X) == 0) { return static_cast<void*>(releaseArrayData(m_X));}
+  if (featureName.compare(Ebsd::Mic::Y) == 0) { return static_cast<void*>(releaseArrayData(m_Y));}
+  return NULL;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
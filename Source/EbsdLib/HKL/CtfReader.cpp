@@ -157,6 +157,30 @@ void* CtfReader::getPointerByName(const QString& featureName)
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* CtfReader::releasePointerByName(const QString& featureName)
+{
+#if defined ( DREAM3D_USE_SSE ) && defined ( __SSE2__ )
+  // The parsers allocate aligned memory which can not be released with free()
+  return NULL;
+#else
+  if(m_NamePointerMap.contains(featureName) == false)
+  {
+    return NULL;
+  }
+  DataParser::Pointer dparser = m_NamePointerMap.value(featureName);
+  if (dparser->getManageMemory() == false)
+  {
+    return NULL;
+  }
+  void* ptr = dparser->getVoidPointer();
+  dparser->setVoidPointer(NULL);
+  return ptr;
+#endif
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -118,6 +118,12 @@ class EbsdLib_EXPORT CtfReader : public EbsdReader
     void* getPointerByName(const QString& featureName);
     void setPointerByName(const QString& name, void* p);
 
+    /**
+     * @brief Hands the memory for a column of data over to the caller. See EbsdReader::releasePointerByName()
+     * @param featureName The name of the feature to release.
+     */
+    virtual void* releasePointerByName(const QString& featureName);
+
 
 
     /**
@@ -37,6 +37,8 @@
 
 #include "H5CtfReader.h"
 
+#include <algorithm>
+
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
@@ -55,6 +57,10 @@ H5CtfReader::H5CtfReader() :
   CtfReader(),
   m_ReadAllArrays(true)
 {
+  m_ReadRegion[0] = 0;
+  m_ReadRegion[1] = 0;
+  m_ReadRegion[2] = 0;
+  m_ReadRegion[3] = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -229,7 +235,11 @@ int H5CtfReader::readHeader(hid_t parId)
     type* _##name = allocateArray<type>(totalDataRows);\
     if (NULL != _##name) {\
       ::memset(_##name, 0, numBytes);\
-      err = QH5Lite::readPointerDataset(gid, Ebsd::Ctf::name, _##name);\
+      if (readRegion == true) {\
+        err = QH5Lite::readPointerDatasetRegion(gid, Ebsd::Ctf::name, nCols, xStart, xCount, yStart, yCount, _##name);\
+      } else {\
+        err = QH5Lite::readPointerDataset(gid, Ebsd::Ctf::name, _##name);\
+      }\
       if (err < 0) {\
         deallocateArrayData(_##name); /*deallocate the array*/\
         setErrorCode(-90020);\
@@ -256,7 +266,23 @@ int H5CtfReader::readData(hid_t parId)
   size_t yCells = getYCells();
   size_t xCells = getXCells();
   size_t totalDataRows = yCells * xCells;
-
+  size_t nCols = xCells;
+  size_t nRows = yCells;
+
+  // Restrict the read to the requested region of the scan
+  hsize_t xStart = 0;
+  hsize_t xCount = nCols;
+  hsize_t yStart = 0;
+  hsize_t yCount = nRows;
+  bool readRegion = (m_ReadRegion[1] > 0 && m_ReadRegion[3] > 0);
+  if (readRegion == true)
+  {
+    xStart = std::min<hsize_t>(m_ReadRegion[0], nCols);
+    xCount = std::min<hsize_t>(m_ReadRegion[1], nCols - xStart);
+    yStart = std::min<hsize_t>(m_ReadRegion[2], nRows);
+    yCount = std::min<hsize_t>(m_ReadRegion[3], nRows - yStart);
+    totalDataRows = xCount * yCount;
+  }
 
 
   hid_t gid = H5Gopen(parId, Ebsd::H5::Data.toAscii(), H5P_DEFAULT);
@@ -306,3 +332,14 @@ void H5CtfReader::readAllArrays(bool b)
 {
   m_ReadAllArrays = b;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5CtfReader::setReadRegion(int xStart, int xCount, int yStart, int yCount)
+{
+  m_ReadRegion[0] = xStart;
+  m_ReadRegion[1] = xCount;
+  m_ReadRegion[2] = yStart;
+  m_ReadRegion[3] = yCount;
+}
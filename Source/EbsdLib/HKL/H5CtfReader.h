@@ -124,21 +124,28 @@ class EbsdLib_EXPORT H5CtfReader : public CtfReader
      */
     virtual void readAllArrays(bool b);
 
-  protected:
-    H5CtfReader();
-
+    /**
+     * @brief Restricts readData() to the columns [xStart, xStart + xCount) of the rows [yStart, yStart + yCount)
+     * of the scan. The region is read with an HDF5 hyperslab so the rest of the scan is never read. The data
+     * arrays then hold xCount * yCount values. A count of zero reads the whole scan, which is the default.
+     */
+    void setReadRegion(int xStart, int xCount, int yStart, int yCount);
 
     /**
-     * @brief Reads the data section of the file
+     * @brief Reads the data section of the file. readHeader() has to be called before this.
      * @param Valid HDF5 Group ID
      * @return error condition
      */
     int readData(hid_t parId);
 
+  protected:
+    H5CtfReader();
+
   private:
     QVector<CtfPhase::Pointer> m_Phases;
     QSet<QString> m_ArrayNames;
     bool                  m_ReadAllArrays;
+    int                   m_ReadRegion[4];
 
     H5CtfReader(const H5CtfReader&); // Copy Constructor Not Implemented
     void operator=(const H5CtfReader&); // Operator '=' Not Implemented
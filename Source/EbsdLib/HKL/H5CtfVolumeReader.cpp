@@ -38,6 +38,10 @@
 
 #include <cmath>
 
+#include <QtCore/QString>
+#include <QtCore/QFuture>
+#include <QtCore/QtConcurrentRun>
+
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
@@ -203,6 +207,45 @@ QVector<CtfPhase::Pointer> H5CtfVolumeReader::getPhases()
   return m_Phases;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5CtfVolumeReader::readSlice(H5CtfReader* reader, hid_t fileId, int slice, int64_t xpoints, int64_t ypoints)
+{
+  int err = -1;
+  QString index = QString::number(slice + getSliceStart());
+  reader->setHDF5Path(index);
+  hid_t gid = H5Gopen(fileId, index.toAscii().data(), H5P_DEFAULT);
+  if (gid < 0)
+  {
+    reader->setErrorCode(-90001);
+    reader->setErrorMessage(QString("H5CtfVolumeReader Error: Could not open path '%1'").arg(index));
+    return reader->getErrorCode();
+  }
+  err = reader->readHeader(gid);
+  if (err < 0)
+  {
+    reader->setErrorCode(err);
+    reader->setErrorMessage(QString("H5CtfVolumeReader Error: Could not read the header of slice '%1'").arg(index));
+    H5Gclose(gid);
+    return err;
+  }
+  // Only the part of the slice that is inside of the region of interest is read from the file
+  SliceRegion_t region = getSliceRegion(xpoints, ypoints, reader->getXDimension(), reader->getYDimension());
+  if (region.XCount > 0)
+  {
+    reader->setReadRegion(region.XStart, region.XCount, region.YStart, region.YCount);
+    err = reader->readData(gid);
+  }
+  else
+  {
+    reader->deletePointers();
+  }
+  // Like H5CtfReader::readFile() problems with the data section are not fatal, only not finding the slice is
+  err = H5Gclose(gid);
+  return err;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -211,46 +254,81 @@ int H5CtfVolumeReader::loadData(int64_t xpoints,
                                 int64_t zpoints,
                                 uint32_t ZDir)
 {
-  int index = 0;
+  int64_t index = 0;
   int err = -1;
-// Initialize all the pointers
-  initPointers(xpoints * ypoints * zpoints);
-
-  int readerIndex = 0;
-  int64_t xpointsslice = 0;
-  int64_t ypointsslice = 0;
-  int64_t xpointstemp = 0;
-  int64_t ypointstemp = 0;
-  int zval = 0;
 
+  // Only the region of interest of each slice is loaded so the arrays are sized to it
+  int64_t xStart = 0, xEnd = 0, yStart = 0, yEnd = 0;
+  getRegionOfInterest(xpoints, ypoints, xStart, xEnd, yStart, yEnd);
+  int64_t xpointstemp = xEnd - xStart + 1;
+  int64_t ypointstemp = yEnd - yStart + 1;
 
-  int xstartspot = 0;
-  int ystartspot = 0;
+  // Initialize all the pointers
+  initPointers(xpointstemp * ypointstemp * zpoints);
+
+  int64_t readerIndex = 0;
+  int zval = 0;
 
   err = readVolumeInfo();
+  // If no stacking order preference was passed, read it from the file and use that value
+  if(ZDir == Ebsd::RefFrameZDir::UnknownRefFrameZDirection)
+  {
+    ZDir = getStackingOrder();
+  }
+
+  hid_t fileId = QH5Utilities::openFile(getFileName(), true);
+  if(fileId < 0)
+  {
+    std::cout << "H5CtfVolumeReader Error: Could not open .h5ebsd file for reading." << std::endl;
+    setErrorMessage("Error: Could not open .h5ebsd file for reading.");
+    setErrorCode(-90000);
+    return -1;
+  }
+
+  // Two slice readers take turns: the next slice is read on a worker thread while the current
+  // slice is copied into the volume. Only one thread is ever inside of the HDF5 library.
+  H5CtfReader::Pointer readers[2];
+  for (int r = 0; r < 2; ++r)
+  {
+    readers[r] = H5CtfReader::New();
+    readers[r]->setFileName(getFileName());
+    readers[r]->setUserZDir(getStackingOrder());
+    readers[r]->setSampleTransformationAngle(getSampleTransformationAngle());
+    readers[r]->setSampleTransformationAxis(getSampleTransformationAxis());
+    readers[r]->setEulerTransformationAngle(getEulerTransformationAngle());
+    readers[r]->setEulerTransformationAxis(getEulerTransformationAxis());
+    readers[r]->readAllArrays(getReadAllArrays());
+    readers[r]->setArraysToRead(getArraysToRead());
+  }
 
+  QFuture<int> nextSlice;
+  if (zpoints > 0)
+  {
+    nextSlice = QtConcurrent::run(this, &H5CtfVolumeReader::readSlice, readers[0].get(), fileId, 0, xpoints, ypoints);
+  }
   for (int slice = 0; slice < zpoints; ++slice)
   {
-    H5CtfReader::Pointer reader = H5CtfReader::New();
-    reader->setFileName(getFileName());
-    reader->setHDF5Path(QString::number(slice + getSliceStart()));
-    reader->setUserZDir(getStackingOrder());
-    reader->setSampleTransformationAngle(getSampleTransformationAngle());
-    reader->setSampleTransformationAxis(getSampleTransformationAxis());
-    reader->setEulerTransformationAngle(getEulerTransformationAngle());
-    reader->setEulerTransformationAxis(getEulerTransformationAxis());
-    reader->readAllArrays(getReadAllArrays());
-    reader->setArraysToRead(getArraysToRead());
-
-    err = reader->readFile();
+    err = nextSlice.result();
+    H5CtfReader* reader = readers[slice % 2].get();
     if (err < 0)
     {
       std::cout << "H5CtfVolumeReader Error: There was an issue loading the data from the hdf5 file." << std::endl;
+      setErrorCode(reader->getErrorCode());
+      setErrorMessage(reader->getErrorMessage());
+      QH5Utilities::closeFile(fileId);
       return -1;
     }
+    if (slice + 1 < zpoints)
+    {
+      nextSlice = QtConcurrent::run(this, &H5CtfVolumeReader::readSlice, readers[(slice + 1) % 2].get(), fileId, slice + 1, xpoints, ypoints);
+    }
+
+    SliceRegion_t region = getSliceRegion(xpoints, ypoints, reader->getXDimension(), reader->getYDimension());
+    if (region.XCount == 0)
+    {
+      continue;
+    }
     readerIndex = 0;
-    xpointsslice = reader->getXCells();
-    ypointsslice = reader->getYCells();
     int* phasePtr = reader->getPhasePointer();
     float* xPtr = reader->getXPointer();
     float* yPtr = reader->getYPointer();
@@ -263,25 +341,15 @@ int H5CtfVolumeReader::loadData(int64_t xpoints,
     int* bcPtr = reader->getBandContrastPointer();
     int* bsPtr = reader->getBandSlopePointer();
 
-    xpointstemp = xpoints;
-    ypointstemp = ypoints;
-    xstartspot = static_cast<int>( (xpointstemp - xpointsslice) / 2 );
-    ystartspot = static_cast<int>( (ypointstemp - ypointsslice) / 2 );
-
-    // If no stacking order preference was passed, read it from the file and use that value
-    if(ZDir == Ebsd::RefFrameZDir::UnknownRefFrameZDirection)
-    {
-      ZDir = getStackingOrder();
-    }
     if (ZDir == 0) { zval = slice; }
     if (ZDir == 1) { zval = static_cast<int>( (zpoints - 1) - slice ); }
 
     // Copy the data from the current storage into the Storage Location
-    for (int j = 0; j < ypointsslice; j++)
+    for (int64_t j = 0; j < region.YCount; j++)
     {
-      for (int i = 0; i < xpointsslice; i++)
+      for (int64_t i = 0; i < region.XCount; i++)
       {
-        index = static_cast<int>( (zval * xpointstemp * ypointstemp) + ((j + ystartspot) * xpointstemp) + (i + xstartspot) );
+        index = (zval * xpointstemp * ypointstemp) + ((j + region.DestY) * xpointstemp) + (i + region.DestX);
         if (NULL != phasePtr) {m_Phase[index] = phasePtr[readerIndex];} // Phase Add 1 to the phase number because .ctf files are zero based for phases
         if (NULL != xPtr) {m_X[index] = xPtr[readerIndex];}
         if (NULL != yPtr) {m_Y[index] = yPtr[readerIndex];}
@@ -312,7 +380,7 @@ int H5CtfVolumeReader::loadData(int64_t xpoints,
       }
     }
   }
+  QH5Utilities::closeFile(fileId);
   return err;
-
 }
 
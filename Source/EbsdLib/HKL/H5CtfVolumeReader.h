@@ -45,6 +45,7 @@
 #include "EbsdLib/EbsdConstants.h"
 #include "EbsdLib/H5EbsdVolumeReader.h"
 #include "EbsdLib/HKL/CtfPhase.h"
+#include "EbsdLib/HKL/H5CtfReader.h"
 
 
 /**
@@ -128,6 +129,17 @@ class EbsdLib_EXPORT H5CtfVolumeReader : public H5EbsdVolumeReader
   private:
     QVector<CtfPhase::Pointer> m_Phases;
 
+    /**
+     * @brief Reads the part of a slice that is inside of the region of interest
+     * @param reader The slice reader to read into
+     * @param fileId The open .h5ebsd file
+     * @param slice The index of the slice relative to SliceStart
+     * @param xpoints The number of x voxels of the whole volume
+     * @param ypoints The number of y voxels of the whole volume
+     * @return error condition
+     */
+    int readSlice(H5CtfReader* reader, hid_t fileId, int slice, int64_t xpoints, int64_t ypoints);
+
     H5CtfVolumeReader(const H5CtfVolumeReader&); // Copy Constructor Not Implemented
     void operator=(const H5CtfVolumeReader&); // Operator '=' Not Implemented
 
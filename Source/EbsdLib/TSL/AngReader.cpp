@@ -172,6 +172,24 @@ void* AngReader::getPointerByName(const QString& featureName)
   return NULL;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* AngReader::releasePointerByName(const QString& featureName)
+{
+  if (featureName.compare(Ebsd::Ang::Phi1) == 0) { return static_cast<void*>(releaseArrayData(m_Phi1));}
+  if (featureName.compare(Ebsd::Ang::Phi) == 0) { return static_cast<void*>(releaseArrayData(m_Phi));}
+  if (featureName.compare(Ebsd::Ang::Phi2) == 0) { return static_cast<void*>(releaseArrayData(m_Phi2));}
+  if (featureName.compare(Ebsd::Ang::ImageQuality) == 0) { return static_cast<void*>(releaseArrayData(m_Iq));}
+  if (featureName.compare(Ebsd::Ang::ConfidenceIndex) == 0) { return static_cast<void*>(releaseArrayData(m_Ci));}
+  if (featureName.compare(Ebsd::Ang::PhaseData) == 0) { return static_cast<void*>(releaseArrayData(m_PhaseData));}
+  if (featureName.compare(Ebsd::Ang::XPosition) == 0) { return static_cast<void*>(releaseArrayData(m_X));}
+  if (featureName.compare(Ebsd::Ang::YPosition) == 0) { return static_cast<void*>(releaseArrayData(m_Y));}
+  if (featureName.compare(Ebsd::Ang::SEMSignal) == 0) { return static_cast<void*>(releaseArrayData(m_SEMSignal));}
+  if (featureName.compare(Ebsd::Ang::Fit) == 0) { return static_cast<void*>(releaseArrayData(m_Fit));}
+  return NULL;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
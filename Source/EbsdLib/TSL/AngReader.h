@@ -108,6 +108,12 @@ class EbsdLib_EXPORT AngReader : public EbsdReader
      */
     void* getPointerByName(const QString& featureName);
 
+    /**
+     * @brief Hands the memory for a column of data over to the caller. See EbsdReader::releasePointerByName()
+     * @param featureName The name of the feature to release.
+     */
+    virtual void* releasePointerByName(const QString& featureName);
+
     /**
      * @brief Returns an enumeration value that depicts the numerical
      * primitive type that the data is stored as (Int, Float, etc).
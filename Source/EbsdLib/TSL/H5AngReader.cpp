@@ -36,6 +36,7 @@
 
 #include "H5AngReader.h"
 
+#include <algorithm>
 #include <vector>
 
 #include <QtCore/QtDebug>
@@ -61,6 +62,10 @@ H5AngReader::H5AngReader() :
   AngReader(),
   m_ReadAllArrays(true)
 {
+  m_ReadRegion[0] = 0;
+  m_ReadRegion[1] = 0;
+  m_ReadRegion[2] = 0;
+  m_ReadRegion[3] = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -313,7 +318,11 @@ int H5AngReader::readHKLFamilies(hid_t hklGid, AngPhase::Pointer phase)
     type* _##name = allocateArray<type>(totalDataRows);\
     if (NULL != _##name) {\
       ::memset(_##name, 0, numBytes);\
-      err = QH5Lite::readPointerDataset(gid, Ebsd::Ang::name, _##name);\
+      if (readRegion == true) {\
+        err = QH5Lite::readPointerDatasetRegion(gid, Ebsd::Ang::name, nCols, xStart, xCount, yStart, yCount, _##name);\
+      } else {\
+        err = QH5Lite::readPointerDataset(gid, Ebsd::Ang::name, _##name);\
+      }\
       if (err < 0) {\
         deallocateArrayData(_##name); /*deallocate the array*/\
         setErrorCode(-90020);\
@@ -344,6 +353,7 @@ int H5AngReader::readData(hid_t parId)
   size_t nOddCols = getNumOddCols();
   size_t nEvenCols = getNumEvenCols();
   size_t nRows = getNumRows();
+  size_t nCols = 0;
 
   if (nRows < 1)
   {
@@ -357,11 +367,13 @@ int H5AngReader::readData(hid_t parId)
     // if (nCols > 0) { numElements = nRows * nCols; }
     if (nOddCols > 0)
     {
-      totalDataRows = nRows * nOddCols;/* nCols = nOddCols;*/
+      totalDataRows = nRows * nOddCols;
+      nCols = nOddCols;
     }
     else if (nEvenCols > 0)
     {
-      totalDataRows = nRows * nEvenCols; /* nCols = nEvenCols; */
+      totalDataRows = nRows * nEvenCols;
+      nCols = nEvenCols;
     }
     else
     {
@@ -381,6 +393,21 @@ int H5AngReader::readData(hid_t parId)
     return -300;
   }
 
+  // Restrict the read to the requested region of the scan
+  hsize_t xStart = 0;
+  hsize_t xCount = nCols;
+  hsize_t yStart = 0;
+  hsize_t yCount = nRows;
+  bool readRegion = (m_ReadRegion[1] > 0 && m_ReadRegion[3] > 0);
+  if (readRegion == true)
+  {
+    xStart = std::min<hsize_t>(m_ReadRegion[0], nCols);
+    xCount = std::min<hsize_t>(m_ReadRegion[1], nCols - xStart);
+    yStart = std::min<hsize_t>(m_ReadRegion[2], nRows);
+    yCount = std::min<hsize_t>(m_ReadRegion[3], nRows - yStart);
+    totalDataRows = xCount * yCount;
+  }
+
 
   hid_t gid = H5Gopen(parId, Ebsd::H5::Data.toAscii().data(), H5P_DEFAULT);
   if (gid < 0)
@@ -447,3 +474,14 @@ void H5AngReader::readAllArrays(bool b)
 {
   m_ReadAllArrays = b;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void H5AngReader::setReadRegion(int xStart, int xCount, int yStart, int yCount)
+{
+  m_ReadRegion[0] = xStart;
+  m_ReadRegion[1] = xCount;
+  m_ReadRegion[2] = yStart;
+  m_ReadRegion[3] = yCount;
+}
@@ -153,6 +153,20 @@ class EbsdLib_EXPORT H5AngReader : public AngReader
      */
     virtual void readAllArrays(bool b);
 
+    /**
+     * @brief Restricts readData() to the columns [xStart, xStart + xCount) of the rows [yStart, yStart + yCount)
+     * of the scan. The region is read with an HDF5 hyperslab so the rest of the scan is never read. The data
+     * arrays then hold xCount * yCount values. A count of zero reads the whole scan, which is the default.
+     */
+    void setReadRegion(int xStart, int xCount, int yStart, int yCount);
+
+    /**
+     * @brief Reads the data section of the file. readHeader() has to be called before this.
+     * @param Valid HDF5 Group ID
+     * @return error condition
+     */
+    int readData(hid_t parId);
+
   protected:
     H5AngReader();
 
@@ -163,17 +177,11 @@ class EbsdLib_EXPORT H5AngReader : public AngReader
      */
     int readHKLFamilies(hid_t hklGid, AngPhase::Pointer phase);
 
-    /**
-     * @brief Reads the data section of the file
-     * @param Valid HDF5 Group ID
-     * @return error condition
-     */
-    int readData(hid_t parId);
-
   private:
     QVector<AngPhase::Pointer> m_Phases;
     QSet<QString>         m_ArrayNames;
     bool                  m_ReadAllArrays;
+    int                   m_ReadRegion[4];
 
     H5AngReader(const H5AngReader&); // Copy Constructor Not Implemented
     void operator=(const H5AngReader&); // Operator '=' Not Implemented
@@ -39,6 +39,8 @@
 #include <cmath>
 
 #include <QtCore/QString>
+#include <QtCore/QFuture>
+#include <QtCore/QtConcurrentRun>
 
 #include "H5Support/H5Lite.h"
 #include "H5Support/QH5Utilities.h"
@@ -203,6 +205,46 @@ QVector<AngPhase::Pointer> H5AngVolumeReader::getPhases()
 
 
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5AngVolumeReader::readSlice(H5AngReader* reader, hid_t fileId, int slice, int64_t xpoints, int64_t ypoints)
+{
+  int err = -1;
+  QString index = QString::number(slice + getSliceStart());
+  reader->setHDF5Path(index);
+  hid_t gid = H5Gopen(fileId, index.toAscii().data(), H5P_DEFAULT);
+  if (gid < 0)
+  {
+    reader->setErrorCode(-90001);
+    reader->setErrorMessage(QString("H5AngVolumeReader Error: Could not open path '%1'").arg(index));
+    return reader->getErrorCode();
+  }
+  err = reader->readHeader(gid);
+  if (err < 0)
+  {
+    H5Gclose(gid);
+    return err;
+  }
+  // Only the part of the slice that is inside of the region of interest is read from the file
+  SliceRegion_t region = getSliceRegion(xpoints, ypoints, reader->getXDimension(), reader->getYDimension());
+  if (region.XCount > 0)
+  {
+    reader->setReadRegion(region.XStart, region.XCount, region.YStart, region.YCount);
+    err = reader->readData(gid);
+  }
+  else
+  {
+    reader->deletePointers();
+  }
+  H5Gclose(gid);
+  if (err < 0)
+  {
+    return err;
+  }
+  return reader->getErrorCode();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -211,49 +253,88 @@ int H5AngVolumeReader::loadData(int64_t xpoints,
                                 int64_t zpoints,
                                 uint32_t ZDir )
 {
-  int index = 0;
+  int64_t index = 0;
   int err = -1;
-  // Initialize all the pointers
-  initPointers(xpoints * ypoints * zpoints);
 
+  // Only the region of interest of each slice is loaded so the arrays are sized to it
+  int64_t xStart = 0, xEnd = 0, yStart = 0, yEnd = 0;
+  getRegionOfInterest(xpoints, ypoints, xStart, xEnd, yStart, yEnd);
+  int64_t xpointstemp = xEnd - xStart + 1;
+  int64_t ypointstemp = yEnd - yStart + 1;
 
-  int readerIndex = 0;
-  int xpointsslice = 0;
-  int ypointsslice = 0;
-  int xpointstemp = 0;
-  int ypointstemp = 0;
-  int xstop = 0;
-  int ystop = 0;
-  int zval = 0;
+  // Initialize all the pointers
+  initPointers(xpointstemp * ypointstemp * zpoints);
 
-  int xstartspot = 0;
-  int ystartspot = 0;
+  int64_t readerIndex = 0;
+  int zval = 0;
 
   err = readVolumeInfo();
+  // If no stacking order preference was passed, read it from the file and use that value
+  if(ZDir == Ebsd::RefFrameZDir::UnknownRefFrameZDirection)
+  {
+    ZDir = getStackingOrder();
+  }
+
+  hid_t fileId = QH5Utilities::openFile(getFileName(), true);
+  if(fileId < 0)
+  {
+    setErrorMessage("Error: Could not open .h5ebsd file for reading.");
+    setErrorCode(-90000);
+    return getErrorCode();
+  }
+
+  // Two slice readers take turns: the next slice is read on a worker thread while the current
+  // slice is copied into the volume. Only one thread is ever inside of the HDF5 library.
+  H5AngReader::Pointer readers[2];
+  for (int r = 0; r < 2; ++r)
+  {
+    readers[r] = H5AngReader::New();
+    readers[r]->setFileName(getFileName());
+    readers[r]->setUserZDir(getStackingOrder());
+    readers[r]->setSampleTransformationAngle(getSampleTransformationAngle());
+    readers[r]->setSampleTransformationAxis(getSampleTransformationAxis());
+    readers[r]->setEulerTransformationAngle(getEulerTransformationAngle());
+    readers[r]->setEulerTransformationAxis(getEulerTransformationAxis());
+    readers[r]->readAllArrays(getReadAllArrays());
+    readers[r]->setArraysToRead(getArraysToRead());
+  }
+
+  QFuture<int> nextSlice;
+  if (zpoints > 0)
+  {
+    nextSlice = QtConcurrent::run(this, &H5AngVolumeReader::readSlice, readers[0].get(), fileId, 0, xpoints, ypoints);
+  }
   for (int slice = 0; slice < zpoints; ++slice)
   {
-    H5AngReader::Pointer reader = H5AngReader::New();
-    reader->setFileName(getFileName());
-    reader->setHDF5Path(QString::number(slice + getSliceStart()));
-    reader->setUserZDir(getStackingOrder());
-    reader->setSampleTransformationAngle(getSampleTransformationAngle());
-    reader->setSampleTransformationAxis(getSampleTransformationAxis());
-    reader->setEulerTransformationAngle(getEulerTransformationAngle());
-    reader->setEulerTransformationAxis(getEulerTransformationAxis());
-    reader->readAllArrays(getReadAllArrays());
-    reader->setArraysToRead(getArraysToRead());
-    err = reader->readFile();
+    err = nextSlice.result();
+    H5AngReader* reader = readers[slice % 2].get();
     if(err < 0)
     {
       setErrorCode(reader->getErrorCode());
       setErrorMessage(reader->getErrorMessage());
+      QH5Utilities::closeFile(fileId);
       return getErrorCode();
     }
+    if (slice + 1 < zpoints)
+    {
+      nextSlice = QtConcurrent::run(this, &H5AngVolumeReader::readSlice, readers[(slice + 1) % 2].get(), fileId, slice + 1, xpoints, ypoints);
+    }
+
+    SliceRegion_t region = getSliceRegion(xpoints, ypoints, reader->getXDimension(), reader->getYDimension());
+    if (region.XCount == 0)
+    {
+      continue;
+    }
     readerIndex = 0;
-    xpointsslice = reader->getNumEvenCols();
-    ypointsslice = reader->getNumRows();
     float* euler1Ptr = reader->getPhi1Pointer();
-    if (NULL == euler1Ptr) { setErrorCode(-99090); setErrorMessage("Euler1 Pointer was NULL from Reader"); return getErrorCode(); }
+    if (NULL == euler1Ptr)
+    {
+      nextSlice.waitForFinished();
+      QH5Utilities::closeFile(fileId);
+      setErrorCode(-99090);
+      setErrorMessage("Euler1 Pointer was NULL from Reader");
+      return getErrorCode();
+    }
     float* euler2Ptr = reader->getPhiPointer();
     float* euler3Ptr = reader->getPhi2Pointer();
     float* xPtr = reader->getXPositionPointer();
@@ -264,27 +345,15 @@ int H5AngVolumeReader::loadData(int64_t xpoints,
     float* sigPtr = reader->getSEMSignalPointer();
     float* fitPtr = reader->getFitPointer();
 
-    xpointstemp = static_cast<int>(xpoints);
-    ypointstemp = static_cast<int>(ypoints);
-    xstartspot = (xpointstemp - xpointsslice) / 2;
-    ystartspot = (ypointstemp - ypointsslice) / 2;
-    xstop = xpointsslice;
-    ystop = ypointsslice;
-
-    // If no stacking order preference was passed, read it from the file and use that value
-    if(ZDir == Ebsd::RefFrameZDir::UnknownRefFrameZDirection)
-    {
-      ZDir = getStackingOrder();
-    }
     if(ZDir == Ebsd::RefFrameZDir::LowtoHigh) { zval = slice; }
     if(ZDir == Ebsd::RefFrameZDir::HightoLow) { zval = static_cast<int>( (zpoints - 1) - slice ); }
 
     // Copy the data from the current storage into the new memory Location
-    for (int j = 0; j < ystop; j++)
+    for (int64_t j = 0; j < region.YCount; j++)
     {
-      for (int i = 0; i < xstop; i++)
+      for (int64_t i = 0; i < region.XCount; i++)
       {
-        index = (zval * xpointstemp * ypointstemp) + ((j + ystartspot) * xpointstemp) + (i + xstartspot);
+        index = (zval * xpointstemp * ypointstemp) + ((j + region.DestY) * xpointstemp) + (i + region.DestX);
         if (NULL != euler1Ptr) {m_Phi1[index] = euler1Ptr[readerIndex];}
         if (NULL != euler2Ptr) {m_Phi[index] = euler2Ptr[readerIndex];}
         if (NULL != euler3Ptr) {m_Phi2[index] = euler3Ptr[readerIndex];}
@@ -312,7 +381,7 @@ int H5AngVolumeReader::loadData(int64_t xpoints,
       }
     }
   }
+  QH5Utilities::closeFile(fileId);
   return err;
 }
 
-
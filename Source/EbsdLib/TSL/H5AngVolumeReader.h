@@ -46,6 +46,7 @@
 #include "EbsdLib/H5EbsdVolumeReader.h"
 
 #include "EbsdLib/TSL/AngPhase.h"
+#include "EbsdLib/TSL/H5AngReader.h"
 
 
 
@@ -122,6 +123,17 @@ class EbsdLib_EXPORT H5AngVolumeReader : public H5EbsdVolumeReader
   private:
     QVector<AngPhase::Pointer> m_Phases;
 
+    /**
+     * @brief Reads the part of a slice that is inside of the region of interest
+     * @param reader The slice reader to read into
+     * @param fileId The open .h5ebsd file
+     * @param slice The index of the slice relative to SliceStart
+     * @param xpoints The number of x voxels of the whole volume
+     * @param ypoints The number of y voxels of the whole volume
+     * @return error condition
+     */
+    int readSlice(H5AngReader* reader, hid_t fileId, int slice, int64_t xpoints, int64_t ypoints);
+
     H5AngVolumeReader(const H5AngVolumeReader&);    // Copy Constructor Not Implemented
     void operator=(const H5AngVolumeReader&);  // Operator '=' Not Implemented
 
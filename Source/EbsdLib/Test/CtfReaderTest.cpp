@@ -35,6 +35,7 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 
+#include <stdlib.h>
 #include <string.h>
 
 
@@ -162,6 +163,31 @@ void TestMultiplePhases_US()
   DREAM3D_REQUIRE(euler3[1] == 29.394f)
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestReleasePointer()
+{
+  CtfReader reader;
+  reader.setFileName(UnitTest::CtfReaderTest::USInputFile2);
+  int err =  reader.readFile();
+  DREAM3D_REQUIRE(err >= 0);
+
+  DREAM3D_REQUIRE(reader.releasePointerByName("Not A Column") == NULL)
+
+  float* euler1 = reinterpret_cast<float*>(reader.releasePointerByName(Ebsd::Ctf::Euler1));
+  DREAM3D_REQUIRE(euler1 != NULL)
+  DREAM3D_REQUIRE(euler1[1] == 103.85f)
+  // The reader must have forgotten the memory we now own
+  DREAM3D_REQUIRE(reader.getPointerByName(Ebsd::Ctf::Euler1) == NULL)
+  DREAM3D_REQUIRE(reader.releasePointerByName(Ebsd::Ctf::Euler1) == NULL)
+  free(euler1);
+
+  float* euler2 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ctf::Euler2));
+  DREAM3D_REQUIRE(euler2 != NULL)
+  DREAM3D_REQUIRE(euler2[1] == 40.207f)
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -204,6 +230,7 @@ int main(int argc, char** argv)
   DREAM3D_REGISTER_TEST( TestCtfReader() )
   DREAM3D_REGISTER_TEST( TestMultiplePhases_European() )
   DREAM3D_REGISTER_TEST( TestMultiplePhases_US() )
+  DREAM3D_REGISTER_TEST( TestReleasePointer() )
   DREAM3D_REGISTER_TEST( TestCellCountToLarge() )
   DREAM3D_REGISTER_TEST( TestShortFile() )
   DREAM3D_REGISTER_TEST( TestZeroXYCells() )
@@ -1098,6 +1098,101 @@ namespace H5Support_NAMESPACE
       }
 
 
+      /**
+       * @brief Reads a rectangular region of a 1D dataset that stores a 2D grid one row after the
+       * other into a preallocated array. The region is selected with a hyperslab so the values outside
+       * of it are never read from the file.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param rowLength The number of values in each row of the grid
+       * @param xStart The first column of the region
+       * @param xCount The number of columns in the region
+       * @param yStart The first row of the region
+       * @param yCount The number of rows in the region
+       * @param data A Pointer to the PreAllocated Array of Data which must hold xCount * yCount values
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetRegion(hid_t loc_id,
+                                             const std::string& dsetName,
+                                             hsize_t rowLength,
+                                             hsize_t xStart, hsize_t xCount,
+                                             hsize_t yStart, hsize_t yCount,
+                                             T* data)
+      {
+        hid_t did;
+        herr_t err = 0;
+        herr_t retErr = 0;
+        hid_t dataType = 0;
+        T test = 0x00;
+        dataType = H5Lite::HDFTypeForPrimitive(test);
+        if (dataType == -1)
+        {
+          std::cout  << "dataType was not supported." << std::endl;
+          return -10;
+        }
+        if (loc_id < 0)
+        {
+          std::cout  << "loc_id was Negative: This is not allowed." << std::endl;
+          return -2;
+        }
+        if (NULL == data)
+        {
+          std::cout  << "The Pointer to hold the data is NULL. This is NOT allowed." << std::endl;
+          return -3;
+        }
+        if (xStart + xCount > rowLength)
+        {
+          std::cout  << "The region is wider than the rows of the dataset." << std::endl;
+          return -4;
+        }
+        did = H5Dopen( loc_id, dsetName.c_str(), H5P_DEFAULT );
+        if ( did < 0 )
+        {
+          std::cout  << " Error opening Dataset: " << did << std::endl;
+          return -1;
+        }
+        hid_t fileSpaceId = H5Dget_space(did);
+        if (fileSpaceId < 0 || H5Sget_simple_extent_ndims(fileSpaceId) != 1)
+        {
+          std::cout  << "Error: The dataset must be 1 dimensional to read a region from it." << std::endl;
+          if (fileSpaceId >= 0) { H5Sclose(fileSpaceId); }
+          H5Dclose(did);
+          return -5;
+        }
+        // Each row of the region is one block, the blocks are a full row apart in the file
+        hsize_t start[1] = { yStart * rowLength + xStart };
+        hsize_t stride[1] = { rowLength };
+        hsize_t count[1] = { yCount };
+        hsize_t block[1] = { xCount };
+        hsize_t memDims[1] = { xCount * yCount };
+        hid_t memSpaceId = H5Screate_simple(1, memDims, NULL);
+        err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, start, stride, count, block);
+        if (err < 0)
+        {
+          std::cout  << "Error selecting the region of the Dataset." << std::endl;
+          retErr = err;
+        }
+        else
+        {
+          err = H5Dread(did, dataType, memSpaceId, fileSpaceId, H5P_DEFAULT, data );
+          if (err < 0)
+          {
+            std::cout  << "Error Reading Data." << std::endl;
+            retErr = err;
+          }
+        }
+        H5Sclose(memSpaceId);
+        H5Sclose(fileSpaceId);
+        err = H5Dclose( did );
+        if (err < 0 )
+        {
+          std::cout  << "Error Closing Dataset id" << std::endl;
+          retErr = err;
+        }
+        return retErr;
+      }
+
       /**
        * @brief Reads data from the HDF5 File into an std::vector<T> object. If the dataset
        * is very large this can be an expensive method to use. It is here for convenience
@@ -436,6 +436,30 @@ namespace H5Support_NAMESPACE
         return H5Lite::readPointerDataset(loc_id, dsetName.toStdString(), data);
       }
 
+      /**
+       * @brief Reads a rectangular region of a 1D dataset that stores a 2D grid one row after the
+       * other into a preallocated array. See H5Lite::readPointerDatasetRegion.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param rowLength The number of values in each row of the grid
+       * @param xStart The first column of the region
+       * @param xCount The number of columns in the region
+       * @param yStart The first row of the region
+       * @param yCount The number of rows in the region
+       * @param data A Pointer to the PreAllocated Array of Data which must hold xCount * yCount values
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetRegion(hid_t loc_id,
+                                             const QString& dsetName,
+                                             hsize_t rowLength,
+                                             hsize_t xStart, hsize_t xCount,
+                                             hsize_t yStart, hsize_t yCount,
+                                             T* data)
+      {
+        return H5Lite::readPointerDatasetRegion(loc_id, dsetName.toStdString(), rowLength, xStart, xCount, yStart, yCount, data);
+      }
+
 
 
       /**
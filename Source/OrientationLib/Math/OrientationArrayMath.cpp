@@ -0,0 +1,750 @@
+/* ============================================================================
+ * Copyright (c) 2011 Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2011 Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * Copyright (c) 2014 Dr. Joseph C. Tucker (UES, Inc.)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Joseph C. Tucker, Michael A. Groeber, Michael A. Jackson,
+ * UES, Inc., the US Air Force, BlueQuartz Software nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                   FA8650-07-D-5800 and FA8650-10-D-5226
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "OrientationArrayMath.h"
+
+#include <cmath>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "DREAM3DLib/Math/DREAM3DMath.h"
+
+/*
+ * The kernels below repeat the arithmetic of the matching OrientationMath functions
+ * exactly, but work straight on the interleaved float arrays with no QuatF or float[3][3]
+ * temporaries and no calls across translation units, so each loop body is a flat run
+ * of math the compiler can schedule (and vectorize where the math library allows).
+ */
+
+namespace Detail
+{
+  namespace OrientationArray
+  {
+    typedef void (*KernelFunc)(const float*, float*, size_t);
+
+    // Tuples converted per step. Chained conversions keep their intermediate arrays this
+    // size so they stay in cache.
+    static const size_t k_BlockSize = 2048;
+
+    // Same as Mod<float>::WrapTwoPI in OrientationMath.cpp: wraps to [0..TWO_PI)
+    inline float WrapTwoPI(float x)
+    {
+      float y = DREAM3D::Constants::k_2Pi;
+      double m = x - y * floor(x / y);
+      if (m >= y)
+      { return 0; }
+      if (m < 0 )
+      {
+        if (y + m == y)
+        { return 0; }
+        else
+        { return y + m; }
+      }
+      return m;
+    }
+
+    // Same as QuaternionMathF::UnitQuaternion
+    inline void UnitQuaternion(float* q)
+    {
+      double length = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+      q[0] = static_cast<float>( q[0] / length );
+      q[1] = static_cast<float>( q[1] / length );
+      q[2] = static_cast<float>( q[2] / length );
+      q[3] = static_cast<float>( q[3] / length );
+    }
+
+    inline bool closeEnough(float a, float b)
+    {
+      return (std::numeric_limits<float>::epsilon() > std::abs(a - b));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+OrientationArrayMath::OrientationArrayMath()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+OrientationArrayMath::~OrientationArrayMath()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int OrientationArrayMath::GetComponentCount(Representation rep)
+{
+  switch(rep)
+  {
+    case EulerType:
+    case RodriguesType:
+    case HomochoricType:
+      return 3;
+    case QuaternionType:
+    case AxisAngleType:
+      return 4;
+    case MatrixType:
+      return 9;
+    default:
+      break;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::EulertoQuat(const float* eulers, float* quats, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* e = eulers + 3 * i;
+    float* q = quats + 4 * i;
+    float s, c, s1, c1, s2, c2;
+    s = sinf(0.5f * e[1]);
+    c = cosf(0.5f * e[1]);
+    s1 = sinf(0.5f * (e[0] - e[2]));
+    c1 = cosf(0.5f * (e[0] - e[2]));
+    s2 = sinf(0.5f * (e[0] + e[2]));
+    c2 = cosf(0.5f * (e[0] + e[2]));
+    q[0] = s * c1;
+    q[1] = s * s1;
+    q[2] = c * s2;
+    q[3] = c * c2;
+    Detail::OrientationArray::UnitQuaternion(q);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::EulertoRod(const float* eulers, float* rods, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* e = eulers + 3 * i;
+    float* r = rods + 3 * i;
+    float sum, diff, csum, cdiff, sdiff, t2;
+    sum = (e[0] + e[2]) * 0.5;
+    diff = (e[0] - e[2]) * 0.5;
+    csum = cosf(sum);
+    cdiff = cosf(diff);
+    sdiff = sinf(diff);
+    t2 = tanf(e[1] * 0.5);
+    r[0] = t2 * cdiff / csum;
+    r[1] = t2 * sdiff / csum;
+    r[2] = tanf(sum);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::EulertoAxisAngle(const float* eulers, float* axisAngles, size_t count)
+{
+  // OrientationMath::EulerToAxisAngle goes through Rodrigues as well
+  for (size_t i = 0; i < count; i += Detail::OrientationArray::k_BlockSize)
+  {
+    size_t n = std::min(count - i, Detail::OrientationArray::k_BlockSize);
+    float rods[3 * Detail::OrientationArray::k_BlockSize];
+    EulertoRod(eulers + 3 * i, rods, n);
+    RodtoAxisAngle(rods, axisAngles + 4 * i, n);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::EulertoMat(const float* eulers, float* mats, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* e = eulers + 3 * i;
+    float* g = mats + 9 * i;
+    float cp1 = cosf(e[0]);
+    float sp1 = sinf(e[0]);
+    float cp = cosf(e[1]);
+    float sp = sinf(e[1]);
+    float cp2 = cosf(e[2]);
+    float sp2 = sinf(e[2]);
+
+    g[0] = cp1 * cp2 - sp1 * sp2 * cp;
+    g[1] = sp1 * cp2 + cp1 * sp2 * cp;
+    g[2] = sp2 * sp;
+    g[3] = -cp1 * sp2 - sp1 * cp2 * cp;
+    g[4] = -sp1 * sp2 + cp1 * cp2 * cp;
+    g[5] = cp2 * sp;
+    g[6] = sp1 * sp;
+    g[7] = -cp1 * sp;
+    g[8] = cp;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::QuattoEuler(const float* quats, float* eulers, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* q = quats + 4 * i;
+    float* e = eulers + 3 * i;
+    float diff, sum, tmp;
+    diff = atan2(-q[1], -q[0]);
+    sum = atan2(-q[2], -q[3]);
+    tmp = (q[2] * q[2]) + (q[3] * q[3]);
+    tmp = sqrt(tmp);
+    tmp = std::min(tmp, 1.0f);
+    float ea1 = (diff + sum) + DREAM3D::Constants::k_2Pi;
+    float ea3 = (sum - diff) + DREAM3D::Constants::k_2Pi;
+    e[0] = fmodf(ea1, DREAM3D::Constants::k_2Pi);
+    e[1] = 2 * acos(tmp);
+    e[2] = fmodf(ea3, DREAM3D::Constants::k_2Pi);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::QuattoRod(const float* quats, float* rods, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* q = quats + 4 * i;
+    float* r = rods + 3 * i;
+    float qmag = (q[0] * q[0]) + (q[1] * q[1]) + (q[2] * q[2]);
+    qmag = sqrt(qmag);
+    if(qmag == 0.0)
+    {
+      r[0] = 0.0f, r[1] = 0.0f, r[2] = 0.0f;
+      continue;
+    }
+    float w = static_cast<float>( 2.0 * acos(q[3]) );
+    float const1 = tanf(w * 0.5f);
+    r[0] = (q[0] / qmag) * const1;
+    r[1] = (q[1] / qmag) * const1;
+    r[2] = (q[2] / qmag) * const1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::QuattoAxisAngle(const float* quats, float* axisAngles, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* q = quats + 4 * i;
+    float* a = axisAngles + 4 * i;
+    if(q[3] == 1.0)
+    {
+      a[0] = 0.0, a[1] = 0.0f, a[2] = 0.0f, a[3] = 1.0f;
+      continue;
+    }
+    float w = static_cast<float>( 2.0 * acos(q[3]) );
+    float sinHalf = sqrt(1 - (q[3] * q[3]));
+    float n1 = q[0] / sinHalf;
+    float n2 = q[1] / sinHalf;
+    float n3 = q[2] / sinHalf;
+    if(w > DREAM3D::Constants::k_Pi)
+    {
+      w = (2 * DREAM3D::Constants::k_Pi) - w;
+      n1 = -n1;
+      n2 = -n2;
+      n3 = -n3;
+    }
+    a[0] = w;
+    a[1] = n1;
+    a[2] = n2;
+    a[3] = n3;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::QuattoMat(const float* quats, float* mats, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* q = quats + 4 * i;
+    float* g = mats + 9 * i;
+    g[0] = (1 - (2 * q[1] * q[1]) - (2 * q[2] * q[2]));
+    g[1] = ((2 * q[0] * q[1]) + (2 * q[2] * q[3]));
+    g[2] = ((2 * q[0] * q[2]) - (2 * q[1] * q[3]));
+    g[3] = ((2 * q[0] * q[1]) - (2 * q[2] * q[3]));
+    g[4] = (1 - (2 * q[0] * q[0]) - (2 * q[2] * q[2]));
+    g[5] = ((2 * q[1] * q[2]) + (2 * q[0] * q[3]));
+    g[6] = ((2 * q[0] * q[2]) + (2 * q[1] * q[3]));
+    g[7] = ((2 * q[1] * q[2]) - (2 * q[0] * q[3]));
+    g[8] = (1 - (2 * q[0] * q[0]) - (2 * q[1] * q[1]));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::RodtoEuler(const float* rods, float* eulers, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* r = rods + 3 * i;
+    float* e = eulers + 3 * i;
+    float sum = atan(r[2]);
+    float diff = atan(r[1] / r[0]);
+    e[0] = sum + diff;
+    e[1] = static_cast<float>( 2. * atan(r[0] * cosf(sum) / cosf(diff)) );
+    e[2] = sum - diff;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::RodtoQuat(const float* rods, float* quats, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* r = rods + 3 * i;
+    float* q = quats + 4 * i;
+    float rmag = (r[0] * r[0]) + (r[1] * r[1]) + (r[2] * r[2]);
+    rmag = sqrt(rmag);
+    if(rmag == 0.0)
+    {
+      q[0] = 0.0, q[1] = 0.0, q[2] = 0.0, q[3] = 1.0;
+      continue;
+    }
+    float w = 2.0f * atan(rmag);
+    float const1 = sinf(w / 2.0f);
+    q[0] = (r[0] / rmag) * const1;
+    q[1] = (r[1] / rmag) * const1;
+    q[2] = (r[2] / rmag) * const1;
+    q[3] = static_cast<float>( cosf(w / 2.0f) );
+    Detail::OrientationArray::UnitQuaternion(q);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::RodtoAxisAngle(const float* rods, float* axisAngles, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* r = rods + 3 * i;
+    float* a = axisAngles + 4 * i;
+    float rmag = (r[0] * r[0]) + (r[1] * r[1]) + (r[2] * r[2]);
+    rmag = sqrt(rmag);
+    if(rmag == 0.0)
+    {
+      a[0] = 0.0, a[1] = 0.0f, a[2] = 0.0f, a[3] = 1.0f;
+      continue;
+    }
+    float w = static_cast<float>( 2.0 * atan(rmag) );
+    float n1 = r[0] / rmag;
+    float n2 = r[1] / rmag;
+    float n3 = r[2] / rmag;
+    if(w > DREAM3D::Constants::k_Pi)
+    {
+      w = (2 * DREAM3D::Constants::k_Pi) - w;
+      n1 = -n1;
+      n2 = -n2;
+      n3 = -n3;
+    }
+    a[0] = w;
+    a[1] = n1;
+    a[2] = n2;
+    a[3] = n3;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::RodtoHomochoric(const float* rods, float* homochoric, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* r = rods + 3 * i;
+    float* h = homochoric + 3 * i;
+    float rmag = (r[0] * r[0]) + (r[1] * r[1]) + (r[2] * r[2]);
+    rmag = sqrt(rmag);
+    if(rmag == 0.0)
+    {
+      h[0] = 0.0f, h[1] = 0.0f, h[2] = 0.0f;
+      continue;
+    }
+    float w = static_cast<float>( 2.0 * atan(rmag) );
+    float const1 = powf(((3.0f / 4.0f) * (w - sinf(w))), DREAM3D::Constants::k_1Over3);
+    h[0] = (r[0] / rmag) * const1;
+    h[1] = (r[1] / rmag) * const1;
+    h[2] = (r[2] / rmag) * const1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::AxisAngletoQuat(const float* axisAngles, float* quats, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* a = axisAngles + 4 * i;
+    float* q = quats + 4 * i;
+    float denom = (a[1] * a[1]) + (a[2] * a[2]) + (a[3] * a[3]);
+    denom = sqrt(denom);
+    if(denom == 0.0)
+    {
+      q[0] = 0.0, q[1] = 0.0, q[2] = 0.0, q[3] = 1.0;
+      continue;
+    }
+    float const1 = cosf(a[0] * 0.5f);
+    float const2 = sinf(a[0] * 0.5f);
+    q[0] = (a[1] / denom) * const2;
+    q[1] = (a[2] / denom) * const2;
+    q[2] = (a[3] / denom) * const2;
+    q[3] = const1;
+    Detail::OrientationArray::UnitQuaternion(q);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::AxisAngletoRod(const float* axisAngles, float* rods, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* a = axisAngles + 4 * i;
+    float* r = rods + 3 * i;
+    float denom = (a[1] * a[1]) + (a[2] * a[2]) + (a[3] * a[3]);
+    denom = sqrt(denom);
+    if(denom == 0.0)
+    {
+      r[0] = 0.0, r[1] = 0.0, r[2] = 0.0;
+      continue;
+    }
+    float const1 = tanf(a[0] / 2.0f);
+    r[0] = (a[1] / denom) * const1;
+    r[1] = (a[2] / denom) * const1;
+    r[2] = (a[3] / denom) * const1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::AxisAngletoMat(const float* axisAngles, float* mats, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* a = axisAngles + 4 * i;
+    float* g = mats + 9 * i;
+    float c = cosf(a[0]);
+    float s = sinf(a[0]);
+    float t = 1 - c;
+
+    float denom = (a[1] * a[1]) + (a[2] * a[2]) + (a[3] * a[3]);
+    denom = sqrt(denom);
+    if(denom == 0.0)
+    {
+      g[0] = 1.0f, g[1] = 0.0f, g[2] = 0.0f;
+      g[3] = 0.0f, g[4] = 1.0f, g[5] = 0.0f;
+      g[6] = 0.0f, g[7] = 0.0f, g[8] = 1.0f;
+      continue;
+    }
+    float n1 = a[1] / denom;
+    float n2 = a[2] / denom;
+    float n3 = a[3] / denom;
+
+    g[0] = t * n1 * n1 + c;
+    g[1] = t * n1 * n2 - n3 * s;
+    g[2] = t * n1 * n3 + n2 * s;
+    g[3] = t * n1 * n2 + n3 * s;
+    g[4] = t * n2 * n2 + c;
+    g[5] = t * n2 * n3 - n1 * s;
+    g[6] = t * n1 * n3 - n2 * s;
+    g[7] = t * n2 * n3 + n1 * s;
+    g[8] = t * n3 * n3 + c;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::AxisAngletoHomochoric(const float* axisAngles, float* homochoric, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* a = axisAngles + 4 * i;
+    float* h = homochoric + 3 * i;
+    // Bring omega into proper range.
+    float w = Detail::OrientationArray::WrapTwoPI(a[0]);
+
+    float denom = (a[1] * a[1]) + (a[2] * a[2]) + (a[3] * a[3]);
+    denom = sqrt(denom);
+    if(denom == 0.0)
+    {
+      h[0] = 0.0, h[1] = 0.0, h[2] = 0.0;
+      continue;
+    }
+    float temp;
+    if (w >= 0.0f && w < DREAM3D::Constants::k_Pi)
+    {
+      temp = powf(((0.75f) * (w - sinf(w))), DREAM3D::Constants::k_1Over3);
+    }
+    else
+    {
+      temp = powf(((0.75f) * (DREAM3D::Constants::k_2Pi - w + sinf(w))), DREAM3D::Constants::k_1Over3);
+    }
+    h[0] = (a[1] / denom) * temp;
+    h[1] = (a[2] / denom) * temp;
+    h[2] = (a[3] / denom) * temp;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::HomochorictoRod(const float* homochoric, float* rods, size_t count)
+{
+  static const double c[7] = { -0.5000096149170321, -0.02486606148871731, -0.004549381779362819,
+                               0.0005118668366387526, -0.0016500827333575548, 0.0007593352203388718, -0.0002040422502566876
+                             };
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* h = homochoric + 3 * i;
+    float* r = rods + 3 * i;
+    float hmag = (h[0] * h[0]) + (h[1] * h[1]) + (h[2] * h[2]);
+    hmag = sqrt(hmag);
+    if(hmag == 0.0)
+    {
+      r[0] = 0.0f, r[1] = 0.0f, r[2] = 0.0f;
+      continue;
+    }
+    // Same series and the same pow() calls as OrientationMath::HomochorictoRod so the results match it exactly
+    double sum = 0.0;
+    for(int j = 0; j < 7; ++j)
+    {
+      sum = sum + c[j] * pow(hmag, 2 * (j + 1));
+    }
+    float w = (1.0 + sum);
+    float const1 = sqrt(1.0 - (w * w)) / w;
+    r[0] = (h[0] / hmag) * const1;
+    r[1] = (h[1] / hmag) * const1;
+    r[2] = (h[2] / hmag) * const1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OrientationArrayMath::MattoEuler(const float* mats, float* eulers, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    const float* g = mats + 9 * i;
+    float* e = eulers + 3 * i;
+    if(Detail::OrientationArray::closeEnough(g[8], 1.0) )
+    {
+      e[0] = atan(g[1] / g[0]) / 2.0f;
+      e[1] = 0.0;
+      e[2] = e[0];
+    }
+    else if ( Detail::OrientationArray::closeEnough(g[8], -1.0) )
+    {
+      e[0] = atan(g[1] / g[0]) / 2.0f;
+      e[1] = 180.0;
+      e[2] = -e[0];
+    }
+    else
+    {
+      e[1] = acos(g[8]);
+      double s = sin(e[1]);
+      e[0] = atan2(g[6] / s, -g[7] / s );
+      e[2] = atan2(g[2] / s, g[5] / s );
+    }
+  }
+}
+
+namespace Detail
+{
+  namespace OrientationArray
+  {
+    /**
+     * @brief DirectKernel Returns the kernel that converts inRep straight to outRep or NULL if
+     * the pair has to go through another representation
+     */
+    KernelFunc DirectKernel(OrientationArrayMath::Representation inRep, OrientationArrayMath::Representation outRep)
+    {
+      typedef OrientationArrayMath OAM;
+      static const KernelFunc kernels[6][6] =
+      {
+        // to:  Euler,          Quaternion,           Rodrigues,           AxisAngle,              Homochoric,                Matrix
+        { NULL,                 OAM::EulertoQuat,     OAM::EulertoRod,     OAM::EulertoAxisAngle,  NULL,                      OAM::EulertoMat },
+        { OAM::QuattoEuler,     NULL,                 OAM::QuattoRod,      OAM::QuattoAxisAngle,   NULL,                      OAM::QuattoMat },
+        { OAM::RodtoEuler,      OAM::RodtoQuat,       NULL,                OAM::RodtoAxisAngle,    OAM::RodtoHomochoric,      NULL },
+        { NULL,                 OAM::AxisAngletoQuat, OAM::AxisAngletoRod, NULL,                   OAM::AxisAngletoHomochoric, OAM::AxisAngletoMat },
+        { NULL,                 NULL,                 OAM::HomochorictoRod, NULL,                  NULL,                      NULL },
+        { OAM::MattoEuler,      NULL,                 NULL,                NULL,                   NULL,                      NULL }
+      };
+      return kernels[inRep][outRep];
+    }
+
+    /**
+     * @brief Intermediate Picks the representation to go through when there is no direct kernel
+     */
+    OrientationArrayMath::Representation Intermediate(OrientationArrayMath::Representation inRep, OrientationArrayMath::Representation outRep)
+    {
+      if (inRep == OrientationArrayMath::HomochoricType || outRep == OrientationArrayMath::HomochoricType)
+      {
+        return OrientationArrayMath::RodriguesType;
+      }
+      if (inRep == OrientationArrayMath::MatrixType)
+      {
+        return OrientationArrayMath::EulerType;
+      }
+      return OrientationArrayMath::QuaternionType;
+    }
+
+    /**
+     * @brief ConvertBlock Converts at most k_BlockSize tuples
+     */
+    void ConvertBlock(OrientationArrayMath::Representation inRep, const float* input, OrientationArrayMath::Representation outRep, float* output, size_t count)
+    {
+      if (inRep == outRep)
+      {
+        ::memcpy(output, input, sizeof(float) * count * OrientationArrayMath::GetComponentCount(inRep));
+        return;
+      }
+      KernelFunc kernel = DirectKernel(inRep, outRep);
+      if (NULL != kernel)
+      {
+        kernel(input, output, count);
+        return;
+      }
+      OrientationArrayMath::Representation via = Intermediate(inRep, outRep);
+      std::vector<float> temp(count * OrientationArrayMath::GetComponentCount(via));
+      ConvertBlock(inRep, input, via, &(temp.front()), count);
+      ConvertBlock(via, &(temp.front()), outRep, output, count);
+    }
+  }
+}
+
+/**
+ * @brief The ConvertOrientationArrayImpl class converts a range of tuples one block at a time
+ */
+class ConvertOrientationArrayImpl
+{
+  public:
+    ConvertOrientationArrayImpl(OrientationArrayMath::Representation inRep, const float* input, OrientationArrayMath::Representation outRep, float* output) :
+      m_InRep(inRep),
+      m_Input(input),
+      m_OutRep(outRep),
+      m_Output(output),
+      m_InComps(OrientationArrayMath::GetComponentCount(inRep)),
+      m_OutComps(OrientationArrayMath::GetComponentCount(outRep))
+    {}
+    virtual ~ConvertOrientationArrayImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      for (size_t i = start; i < end; i += Detail::OrientationArray::k_BlockSize)
+      {
+        size_t n = std::min(end - i, Detail::OrientationArray::k_BlockSize);
+        Detail::OrientationArray::ConvertBlock(m_InRep, m_Input + i * m_InComps, m_OutRep, m_Output + i * m_OutComps, n);
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+  private:
+    OrientationArrayMath::Representation m_InRep;
+    const float* m_Input;
+    OrientationArrayMath::Representation m_OutRep;
+    float* m_Output;
+    size_t m_InComps;
+    size_t m_OutComps;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool OrientationArrayMath::Convert(Representation inRep, const float* input, Representation outRep, float* output, size_t count, bool parallel)
+{
+  if (GetComponentCount(inRep) == 0 || GetComponentCount(outRep) == 0)
+  {
+    return false;
+  }
+  if (count == 0)
+  {
+    return true;
+  }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  if (parallel == true && count > Detail::OrientationArray::k_BlockSize)
+  {
+    tbb::task_scheduler_init init;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, Detail::OrientationArray::k_BlockSize),
+                      ConvertOrientationArrayImpl(inRep, input, outRep, output), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ConvertOrientationArrayImpl serial(inRep, input, outRep, output);
+    serial.convert(0, count);
+  }
+  return true;
+}
@@ -0,0 +1,134 @@
+/* ============================================================================
+ * Copyright (c) 2011 Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2011 Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * Copyright (c) 2014 Dr. Joseph C. Tucker (UES, Inc.)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Joseph C. Tucker, Michael A. Groeber, Michael A. Jackson,
+ * UES, Inc., the US Air Force, BlueQuartz Software nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                   FA8650-07-D-5800 and FA8650-10-D-5226
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _OrientationArrayMath_H_
+#define _OrientationArrayMath_H_
+
+#include <cstddef>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+
+#include "OrientationLib/OrientationLib.h"
+
+/*
+ * @class OrientationArrayMath OrientationArrayMath.h OrientationLib/Math/OrientationArrayMath.h
+ * @brief This class converts whole arrays of orientations between the representations
+ * supported by OrientationMath. Every array is stored the same way the DataArrays store
+ * them, one tuple after another:
+ *  Euler Angles:  phi1, Phi, phi2 (Radians)
+ *  Quaternions:   x, y, z, w (the layout of QuatF)
+ *  Rodrigues:     r1, r2, r3
+ *  Axis Angles:   w (Radians), n1, n2, n3
+ *  Homochoric:    h1, h2, h3
+ *  Matrices:      g[3][3] ordered Row X Column (Passive, as OrientationMath::EulertoMat)
+ *
+ * Each kernel gives the same result as calling the matching OrientationMath function on every
+ * tuple (HomochorictoRod to within rounding, as it sums its series without calling pow()).
+ * Quaternion outputs are normalized the same way QuaternionMathF::UnitQuaternion does.
+ */
+class OrientationLib_EXPORT OrientationArrayMath
+{
+  public:
+
+    enum Representation
+    {
+      EulerType = 0,
+      QuaternionType = 1,
+      RodriguesType = 2,
+      AxisAngleType = 3,
+      HomochoricType = 4,
+      MatrixType = 5,
+      UnknownType = 6
+    };
+
+    virtual ~OrientationArrayMath();
+
+    /**
+     * @brief GetComponentCount Returns the number of floats each tuple of the representation uses
+     * @param rep
+     * @return 0 for an unknown representation
+     */
+    static int GetComponentCount(Representation rep);
+
+    /**
+     * @brief Convert Converts count tuples from one representation to another. Pairs without a
+     * direct kernel are chained through an intermediate representation one block at a time, so
+     * every pair is supported. The work is spread over all cores when DREAM3D is built with
+     * parallel algorithms.
+     * @param inRep Representation of the input array
+     * @param input Input array of count * GetComponentCount(inRep) floats
+     * @param outRep Representation of the output array
+     * @param output Output array of count * GetComponentCount(outRep) floats. Must not overlap input.
+     * @param count Number of tuples
+     * @param parallel Set to false when calling from code that is already running in parallel
+     * @return false if either representation is unknown
+     */
+    static bool Convert(Representation inRep, const float* input, Representation outRep, float* output, size_t count, bool parallel = true);
+
+    static void EulertoQuat(const float* eulers, float* quats, size_t count);
+    static void EulertoRod(const float* eulers, float* rods, size_t count);
+    static void EulertoAxisAngle(const float* eulers, float* axisAngles, size_t count);
+    static void EulertoMat(const float* eulers, float* mats, size_t count);
+
+    static void QuattoEuler(const float* quats, float* eulers, size_t count);
+    static void QuattoRod(const float* quats, float* rods, size_t count);
+    static void QuattoAxisAngle(const float* quats, float* axisAngles, size_t count);
+    static void QuattoMat(const float* quats, float* mats, size_t count);
+
+    static void RodtoEuler(const float* rods, float* eulers, size_t count);
+    static void RodtoQuat(const float* rods, float* quats, size_t count);
+    static void RodtoAxisAngle(const float* rods, float* axisAngles, size_t count);
+    static void RodtoHomochoric(const float* rods, float* homochoric, size_t count);
+
+    static void AxisAngletoQuat(const float* axisAngles, float* quats, size_t count);
+    static void AxisAngletoRod(const float* axisAngles, float* rods, size_t count);
+    static void AxisAngletoMat(const float* axisAngles, float* mats, size_t count);
+    static void AxisAngletoHomochoric(const float* axisAngles, float* homochoric, size_t count);
+
+    static void HomochorictoRod(const float* homochoric, float* rods, size_t count);
+
+    static void MattoEuler(const float* mats, float* eulers, size_t count);
+
+  protected:
+    OrientationArrayMath();
+
+  private:
+    OrientationArrayMath(const OrientationArrayMath&); // Copy Constructor Not Implemented
+    void operator=(const OrientationArrayMath&); // Operator '=' Not Implemented
+};
+
+#endif /* _OrientationArrayMath_H_ */
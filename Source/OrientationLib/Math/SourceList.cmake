@@ -13,9 +13,11 @@
 
 set(OrientationLib_Math_HDRS
   ${OrientationLib_SOURCE_DIR}/Math/OrientationMath.h
+  ${OrientationLib_SOURCE_DIR}/Math/OrientationArrayMath.h
 )
 set(OrientationLib_Math_SRCS
   ${OrientationLib_SOURCE_DIR}/Math/OrientationMath.cpp
+  ${OrientationLib_SOURCE_DIR}/Math/OrientationArrayMath.cpp
 )
 cmp_IDE_SOURCE_PROPERTIES( "OrientationLib/Math" "${OrientationLib_Math_HDRS}" "${OrientationLib_Math_SRCS}" "0")
 if( ${PROJECT_INSTALL_HEADERS} EQUAL 1 )
@@ -220,6 +220,12 @@ float CubicLowOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float
   return _calcMisoQuat(CubicLowQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float CubicLowOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(30 deg): a quarter of the 120 degree threefold rotation
+  return _calcMisoQuatFast(0.866025404f, q1, q2, n1, n2, n3);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -374,6 +380,13 @@ void CubicLowOps::getNearestQuat(QuatF& q1, QuatF& q2)
   _calcNearestQuat(CubicLowQuatSym, numsym, q1, q2);
 }
 
+void CubicLowOps::getFZQuat(QuatF& qr)
+{
+  int numsym = 12;
+
+  _calcQuatNearestOrigin(CubicLowQuatSym, numsym, qr);
+}
+
 int CubicLowOps::getMisoBin(float r1, float r2, float r3)
 {
   float dim[3];
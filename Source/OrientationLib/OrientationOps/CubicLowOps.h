@@ -56,7 +56,7 @@
  * @version 1.0
  */
 
-class OrientationLib_EXPORT CubicLowOps : public OrientationOps
+class OrientationLib_EXPORT CubicLowOps : public OrientationOpsBatchColors<CubicLowOps>
 {
   public:
     DREAM3D_SHARED_POINTERS(CubicLowOps)
@@ -78,12 +78,14 @@ class OrientationLib_EXPORT CubicLowOps : public OrientationOps
     QString getSymmetryName() { return "Cubic-Low m3 (Tetrahedral)"; }
 
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
+    virtual float getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
     virtual void getQuatSymOp(int i, QuatF& q);
     virtual void getRodSymOp(int i, float* r);
     virtual void getMatSymOp(int i, float g[3][3]);
     virtual void getODFFZRod(float& r1, float& r2, float& r3);
     virtual void getMDFFZRod(float& r1, float& r2, float& r3);
     virtual void getNearestQuat(QuatF& q1, QuatF& q2);
+    virtual void getFZQuat(QuatF& qr);
     virtual int getMisoBin(float r1, float r2, float r3);
     virtual bool inUnitTriangle(float eta, float chi);
     virtual void determineEulerAngles(int choose, float& synea1, float& synea2, float& synea3);
@@ -307,6 +307,15 @@ float CubicOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n
   return _calcMisoQuat(CubicQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float CubicOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(22.5 deg): a quarter of the 90 degree fourfold rotation
+  return _calcMisoQuatFast(0.923879533f, q1, q2, n1, n2, n3);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
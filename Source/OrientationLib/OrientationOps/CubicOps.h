@@ -55,7 +55,7 @@
  * @date May 5, 2011
  * @version 1.0
  */
-class OrientationLib_EXPORT CubicOps : public OrientationOps
+class OrientationLib_EXPORT CubicOps : public OrientationOpsBatchColors<CubicOps>
 {
   public:
     DREAM3D_SHARED_POINTERS(CubicOps)
@@ -76,6 +76,7 @@ class OrientationLib_EXPORT CubicOps : public OrientationOps
     QString getSymmetryName() { return "Cubic-High m3m"; }
 
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
+    virtual float getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
     virtual void getQuatSymOp(int i, QuatF& q);
     virtual void getRodSymOp(int i, float* r);
     virtual void getMatSymOp(int i, float g[3][3]);
@@ -208,6 +208,12 @@ float HexagonalLowOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, f
   return _calcMisoQuat(HexQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float HexagonalLowOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(15 deg): a quarter of the 60 degree sixfold rotation
+  return _calcMisoQuatFast(0.965925826f, q1, q2, n1, n2, n3);
+}
+
 void HexagonalLowOps::getQuatSymOp(int i, QuatF& q)
 {
   QuaternionMathF::Copy(HexQuatSym[i], q);
@@ -296,6 +302,13 @@ void HexagonalLowOps::getNearestQuat(QuatF& q1, QuatF& q2)
   _calcNearestQuat(HexQuatSym, numsym, q1, q2);
 }
 
+void HexagonalLowOps::getFZQuat(QuatF& qr)
+{
+  int numsym = 6;
+
+  _calcQuatNearestOrigin(HexQuatSym, numsym, qr);
+}
+
 int HexagonalLowOps::getMisoBin(float r1, float r2, float r3)
 {
   float dim[3];
@@ -253,6 +253,12 @@ float HexagonalOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, floa
   return _calcMisoQuat(HexQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float HexagonalOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(15 deg): a quarter of the 60 degree sixfold rotation
+  return _calcMisoQuatFast(0.965925826f, q1, q2, n1, n2, n3);
+}
+
 void HexagonalOps::getQuatSymOp(int i, QuatF& q)
 {
   QuaternionMathF::Copy(HexQuatSym[i], q);
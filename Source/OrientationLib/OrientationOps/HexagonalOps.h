@@ -54,7 +54,7 @@
  * @date May 5, 2011
  * @version 1.0
  */
-class OrientationLib_EXPORT HexagonalOps : public OrientationOps
+class OrientationLib_EXPORT HexagonalOps : public OrientationOpsBatchColors<HexagonalOps>
 {
   public:
     DREAM3D_SHARED_POINTERS(HexagonalOps)
@@ -75,6 +75,7 @@ class OrientationLib_EXPORT HexagonalOps : public OrientationOps
     QString getSymmetryName() { return "Hexagonal-High 6/mmm"; }
 
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
+    virtual float getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
     virtual void getQuatSymOp(int i, QuatF& q);
     virtual void getRodSymOp(int i, float* r);
     virtual void getMatSymOp(int i, float g[3][3]);
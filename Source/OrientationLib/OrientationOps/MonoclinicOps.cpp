@@ -121,6 +121,12 @@ float MonoclinicOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, flo
   return _calcMisoQuat(MonoclinicQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float MonoclinicOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(45 deg): a quarter of the 180 degree twofold rotation
+  return _calcMisoQuatFast(0.707106781f, q1, q2, n1, n2, n3);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -233,6 +239,13 @@ void MonoclinicOps::getNearestQuat(QuatF& q1, QuatF& q2)
   _calcNearestQuat(MonoclinicQuatSym, numsym, q1, q2);
 }
 
+void MonoclinicOps::getFZQuat(QuatF& qr)
+{
+  int numsym = 2;
+
+  _calcQuatNearestOrigin(MonoclinicQuatSym, numsym, qr);
+}
+
 int MonoclinicOps::getMisoBin(float r1, float r2, float r3)
 {
   float dim[3];
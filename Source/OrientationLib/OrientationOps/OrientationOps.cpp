@@ -151,6 +151,54 @@ float OrientationOps::_calcMisoQuat(const QuatF quatsym[24], int numsym,
   return wmin;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float OrientationOps::_calcMisoQuatFast(float minCosHalfAngle,
+                                        QuatF& q1, QuatF& q2,
+                                        float& n1, float& n2, float& n3)
+{
+  QuatF qc;
+  QuatF q2inv;
+
+  QuaternionMathF::Copy(q2, q2inv);
+  QuaternionMathF::Conjugate(q2inv);
+  QuaternionMathF::Multiply(q2inv, q1, qc);
+  if (fabs(qc.w) < minCosHalfAngle)
+  {
+    return getMisoQuat(q1, q2, n1, n2, n3);
+  }
+
+  // The identity operator wins, so this is the first pass of the _calcMisoQuat loop
+  float w = 0;
+  if (qc.w < -1)
+  {
+    qc.w = -1;
+  }
+  else if (qc.w > 1)
+  {
+    qc.w = 1;
+  }
+  OrientationMath::QuattoAxisAngle(qc, w, n1, n2, n3);
+  if (w > DREAM3D::Constants::k_Pi)
+  {
+    w = DREAM3D::Constants::k_2Pi - w;
+  }
+  float denom = sqrt((n1 * n1 + n2 * n2 + n3 * n3));
+  n1 = n1 / denom;
+  n2 = n2 / denom;
+  n3 = n3 / denom;
+  if(denom == 0)
+  {
+    n1 = 0.0, n2 = 0.0, n3 = 1.0;
+  }
+  if(w == 0)
+  {
+    n1 = 0.0, n2 = 0.0, n3 = 1.0;
+  }
+  return w;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -44,6 +44,9 @@
 #include "DREAM3DLib/Common/DREAM3DSetGetMacros.h"
 #include "DREAM3DLib/DataArrays/DataArray.hpp"
 #include "DREAM3DLib/Math/QuaternionMath.hpp"
+#include "DREAM3DLib/Math/MatrixMath.h"
+#include "DREAM3DLib/Utilities/ColorTable.h"
+#include "OrientationLib/Math/OrientationMath.h"
 #include "OrientationLib/Utilities/PoleFigureUtilities.h"
 
 
@@ -122,6 +125,23 @@ class OrientationLib_EXPORT OrientationOps
      */
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3) = 0;
 
+    /**
+     * @brief getMisoQuatFast Finds the same misorientation angle as getMisoQuat, up to rounding in the last bits when
+     * the two take different arithmetic paths (the closed-form cubic getMisoQuat for example). When q1 and q2 are within half of
+     * the smallest symmetry rotation of each other no other symmetry operator can give a smaller angle, so the search
+     * over the operators is skipped. The axis is then the one of the identity operator, which may be a symmetrically
+     * equivalent axis to the one getMisoQuat returns (CubicOps::getMisoQuat, for instance, returns it sorted into
+     * the standard stereographic triangle). That is the usual case for two voxels of the same grain once both quaternions
+     * have been reduced with getFZQuat (see the Fundamental Zone Quats option of Find Cell Quaternions).
+     * @param q1
+     * @param q2
+     * @param n1
+     * @param n2
+     * @param n3
+     * @return
+     */
+    virtual float getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3) = 0;
+
     /**
      * @brief getQuatSymOp Copies the symmetry operator at index i into q
      * @param i The index into the Symmetry operators array
@@ -190,6 +210,36 @@ class OrientationLib_EXPORT OrientationOps
      */
     virtual DREAM3D::Rgb generateMisorientationColor(const QuatF& q, const QuatF& refFrame) = 0;
 
+    /**
+     * @brief generateIPFColors Generates the IPF colors of a batch of orientations that all belong to this Laue class.
+     * This gives the same colors as calling generateIPFColor on each orientation without the per orientation virtual call.
+     * @param eulers The Euler Angles in radians, 3 per orientation
+     * @param refDirs The unit Reference Directions, 3 per orientation or a single direction shared by the batch
+     * @param refDirStride 3 if there is a Reference Direction per orientation, 0 if the batch shares refDirs[0..2]
+     * @param count The number of orientations
+     * @param rgb [output] The RGB colors, 3 values per orientation
+     */
+    virtual void generateIPFColors(const float* eulers, const float* refDirs, size_t refDirStride, size_t count, uint8_t* rgb) = 0;
+
+    /**
+     * @brief generateRodriguesColors Generates the Rodrigues colors of a batch of orientations that all belong to this Laue class.
+     * @param eulers The Euler Angles in radians, 3 per orientation
+     * @param count The number of orientations
+     * @param rgb [output] The RGB colors, 3 values per orientation
+     */
+    virtual void generateRodriguesColors(const float* eulers, size_t count, uint8_t* rgb) = 0;
+
+    /**
+     * @brief generateMisorientationColors Generates the misorientation colors of a batch of orientations that all belong
+     * to this Laue class.
+     * @param quats The orientations
+     * @param refFrames The reference frames, 1 per orientation or a single frame shared by the batch
+     * @param refFrameStride 1 if there is a reference frame per orientation, 0 if the batch shares refFrames[0]
+     * @param count The number of orientations
+     * @param rgb [output] The RGB colors, 3 values per orientation
+     */
+    virtual void generateMisorientationColors(const QuatF* quats, const QuatF* refFrames, size_t refFrameStride, size_t count, uint8_t* rgb) = 0;
+
 
     /**
      * @brief generatePoleFigure This method will generate a number of pole figures for this crystal symmetry and the Euler
@@ -209,6 +259,15 @@ class OrientationLib_EXPORT OrientationOps
                         QuatF& q1, QuatF& q2,
                         float& n1, float& n2, float& n3);
 
+    /**
+     * @brief _calcMisoQuatFast Returns the misorientation from the identity operator when the half angle of
+     * q2^-1 * q1 has a cosine of at least minCosHalfAngle, which must be cos(1/4 of the smallest symmetry rotation).
+     * Anything further apart goes through getMisoQuat.
+     */
+    float _calcMisoQuatFast(float minCosHalfAngle,
+                            QuatF& q1, QuatF& q2,
+                            float& n1, float& n2, float& n3);
+
     void _calcRodNearestOrigin(const float rodsym[24][3], int numsym, float& r1, float& r2, float& r3);
     void _calcNearestQuat(const QuatF quatsym[24], int numsym, QuatF& q1, QuatF& q2);
     void _calcQuatNearestOrigin(const QuatF quatsym[24], int numsym, QuatF& qr);
@@ -222,5 +281,126 @@ class OrientationLib_EXPORT OrientationOps
     void operator=(const OrientationOps&); // Operator '=' Not Implemented
 };
 
+/**
+ * @class OrientationOpsBatchColors OrientationOps.h OrientationLib/OrientationOps/OrientationOps.h
+ * @brief Implements the batch coloring methods of OrientationOps once for all of the Laue classes. Each
+ * Laue class derives from OrientationOpsBatchColors<ItsOwnType>, so the per orientation calls in the loops
+ * below are qualified with the concrete class: they are not virtual and can be inlined. The batches are
+ * arrays of structures (3 Euler angles or 1 quaternion per orientation), which is how the filters store them.
+ */
+template<typename OpsType>
+class OrientationOpsBatchColors : public OrientationOps
+{
+  public:
+    virtual ~OrientationOpsBatchColors() {}
+
+    /**
+     * @brief generateIPFColors Reimplemented from @see OrientationOps. The rotation matrix of q * s is
+     * g(s) * g(q), so each orientation is only turned into a matrix once and the symmetry operators are turned
+     * into matrices once per batch. The crystal direction that lands in the unit triangle is colored by
+     * OpsType::generateIPFColor at the identity orientation.
+     */
+    virtual void generateIPFColors(const float* eulers, const float* refDirs, size_t refDirStride, size_t count, uint8_t* rgb)
+    {
+      OpsType* ops = static_cast<OpsType*>(this);
+      int numsym = ops->OpsType::getNumSymOps();
+      float symMat[24][3][3];
+      QuatF qs;
+      for (int j = 0; j < numsym; j++)
+      {
+        ops->OpsType::getQuatSymOp(j, qs);
+        OrientationMath::QuattoMat(qs, symMat[j]);
+      }
+      bool hasInversion = ops->OpsType::getHasInversion();
+
+      QuatF q1;
+      float g[3][3];
+      float refDirection[3];
+      float v[3];
+      float p[3];
+      float chi = 0.0f, eta = 0.0f;
+      DREAM3D::Rgb argb = 0x00000000;
+      for (size_t i = 0; i < count; i++)
+      {
+        OrientationMath::EulertoQuat(eulers[3 * i], eulers[3 * i + 1], eulers[3 * i + 2], q1);
+        OrientationMath::QuattoMat(q1, g);
+        refDirection[0] = refDirs[i * refDirStride];
+        refDirection[1] = refDirs[i * refDirStride + 1];
+        refDirection[2] = refDirs[i * refDirStride + 2];
+        MatrixMath::Multiply3x3with3x1(g, refDirection, v);
+
+        for (int j = 0; j < numsym; j++)
+        {
+          MatrixMath::Multiply3x3with3x1(symMat[j], v, p);
+          MatrixMath::Normalize3x1(p);
+
+          if(hasInversion == false && p[2] < 0)
+          {
+            continue;
+          }
+          else if(hasInversion == true && p[2] < 0)
+          {
+            p[0] = -p[0], p[1] = -p[1], p[2] = -p[2];
+          }
+          chi = acos(p[2]);
+          eta = atan2(p[1], p[0]);
+          if(ops->OpsType::inUnitTriangle(eta, chi) == true)
+          {
+            break;
+          }
+        }
+
+        // The identity orientation leaves the crystal direction where it is
+        argb = ops->OpsType::generateIPFColor(0.0, 0.0, 0.0, p[0], p[1], p[2], false);
+        rgb[3 * i] = RgbColor::dRed(argb);
+        rgb[3 * i + 1] = RgbColor::dGreen(argb);
+        rgb[3 * i + 2] = RgbColor::dBlue(argb);
+      }
+    }
+
+    /**
+     * @brief generateRodriguesColors Reimplemented from @see OrientationOps. Calls OpsType::generateRodriguesColor
+     * for each orientation.
+     */
+    virtual void generateRodriguesColors(const float* eulers, size_t count, uint8_t* rgb)
+    {
+      OpsType* ops = static_cast<OpsType*>(this);
+      float r1 = 0.0f, r2 = 0.0f, r3 = 0.0f;
+      DREAM3D::Rgb argb = 0x00000000;
+      for (size_t i = 0; i < count; i++)
+      {
+        OrientationMath::EulertoRod(eulers[3 * i], eulers[3 * i + 1], eulers[3 * i + 2], r1, r2, r3);
+        argb = ops->OpsType::generateRodriguesColor(r1, r2, r3);
+        rgb[3 * i] = RgbColor::dRed(argb);
+        rgb[3 * i + 1] = RgbColor::dGreen(argb);
+        rgb[3 * i + 2] = RgbColor::dBlue(argb);
+      }
+    }
+
+    /**
+     * @brief generateMisorientationColors Reimplemented from @see OrientationOps. Calls
+     * OpsType::generateMisorientationColor for each orientation.
+     */
+    virtual void generateMisorientationColors(const QuatF* quats, const QuatF* refFrames, size_t refFrameStride, size_t count, uint8_t* rgb)
+    {
+      OpsType* ops = static_cast<OpsType*>(this);
+      DREAM3D::Rgb argb = 0x00000000;
+      for (size_t i = 0; i < count; i++)
+      {
+        argb = ops->OpsType::generateMisorientationColor(quats[i], refFrames[i * refFrameStride]);
+        rgb[3 * i] = RgbColor::dRed(argb);
+        rgb[3 * i + 1] = RgbColor::dGreen(argb);
+        rgb[3 * i + 2] = RgbColor::dBlue(argb);
+      }
+    }
+
+  protected:
+    OrientationOpsBatchColors() : OrientationOps() {}
+
+  private:
+    OrientationOpsBatchColors(const OrientationOpsBatchColors&); // Copy Constructor Not Implemented
+    void operator=(const OrientationOpsBatchColors&); // Operator '=' Not Implemented
+};
+
 #endif /* _OrientationOps_H_ */
 
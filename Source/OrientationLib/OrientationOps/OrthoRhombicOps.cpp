@@ -196,6 +196,12 @@ float OrthoRhombicOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, f
   return _calcMisoQuat(OrthoQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float OrthoRhombicOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(45 deg): a quarter of the 180 degree twofold rotations
+  return _calcMisoQuatFast(0.707106781f, q1, q2, n1, n2, n3);
+}
+
 void OrthoRhombicOps::getQuatSymOp(int i, QuatF& q)
 {
   QuaternionMathF::Copy(OrthoQuatSym[i], q);
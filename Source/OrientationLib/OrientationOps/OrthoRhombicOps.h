@@ -54,7 +54,7 @@
  * @date May 5, 2011
  * @version 1.0
  */
-class OrientationLib_EXPORT OrthoRhombicOps : public OrientationOps
+class OrientationLib_EXPORT OrthoRhombicOps : public OrientationOpsBatchColors<OrthoRhombicOps>
 {
   public:
     DREAM3D_SHARED_POINTERS(OrthoRhombicOps)
@@ -76,6 +76,7 @@ class OrientationLib_EXPORT OrthoRhombicOps : public OrientationOps
     QString getSymmetryName() { return "OrthoRhombic mmm"; }
 
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
+    virtual float getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
     virtual void getQuatSymOp(int i, QuatF& q);
     virtual void getRodSymOp(int i, float* r);
     virtual void getMatSymOp(int i, float g[3][3]);
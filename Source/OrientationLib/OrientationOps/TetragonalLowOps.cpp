@@ -193,6 +193,12 @@ float TetragonalLowOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2,
   return _calcMisoQuat(TetraQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float TetragonalLowOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(22.5 deg): a quarter of the 90 degree fourfold rotation
+  return _calcMisoQuatFast(0.923879533f, q1, q2, n1, n2, n3);
+}
+
 void TetragonalLowOps::getQuatSymOp(int i, QuatF& q)
 {
   QuaternionMathF::Copy(TetraQuatSym[i], q);
@@ -247,6 +253,13 @@ void TetragonalLowOps::getNearestQuat(QuatF& q1, QuatF& q2)
   _calcNearestQuat(TetraQuatSym, numsym, q1, q2);
 }
 
+void TetragonalLowOps::getFZQuat(QuatF& qr)
+{
+  int numsym = 4;
+
+  _calcQuatNearestOrigin(TetraQuatSym, numsym, qr);
+}
+
 int TetragonalLowOps::getMisoBin(float r1, float r2, float r3)
 {
   float dim[3];
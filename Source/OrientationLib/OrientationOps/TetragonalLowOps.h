@@ -54,7 +54,7 @@
  * @date May 5, 2011
  * @version 1.0
  */
-class OrientationLib_EXPORT TetragonalLowOps : public OrientationOps
+class OrientationLib_EXPORT TetragonalLowOps : public OrientationOpsBatchColors<TetragonalLowOps>
 {
   public:
     DREAM3D_SHARED_POINTERS(TetragonalLowOps)
@@ -76,12 +76,14 @@ class OrientationLib_EXPORT TetragonalLowOps : public OrientationOps
     QString getSymmetryName() { return "Tetragonal-Low 4/m"; }
 
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
+    virtual float getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
     virtual void getQuatSymOp(int i, QuatF& q);
     virtual void getRodSymOp(int i, float* r);
     virtual void getMatSymOp(int i, float g[3][3]);
     virtual void getODFFZRod(float& r1, float& r2, float& r3);
     virtual void getMDFFZRod(float& r1, float& r2, float& r3);
     virtual void getNearestQuat(QuatF& q1, QuatF& q2);
+    virtual void getFZQuat(QuatF& qr);
     virtual int getMisoBin(float r1, float r2, float r3);
     virtual bool inUnitTriangle(float eta, float chi);
     virtual void determineEulerAngles(int choose, float& synea1, float& synea2, float& synea3);
@@ -217,6 +217,12 @@ float TetragonalOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, flo
   return _calcMisoQuat(TetraQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float TetragonalOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(22.5 deg): a quarter of the 90 degree fourfold rotation
+  return _calcMisoQuatFast(0.923879533f, q1, q2, n1, n2, n3);
+}
+
 void TetragonalOps::getQuatSymOp(int i, QuatF& q)
 {
   QuaternionMathF::Copy(TetraQuatSym[i], q);
@@ -275,6 +281,13 @@ void TetragonalOps::getNearestQuat(QuatF& q1, QuatF& q2)
   _calcNearestQuat(TetraQuatSym, numsym, q1, q2);
 }
 
+void TetragonalOps::getFZQuat(QuatF& qr)
+{
+  int numsym = 8;
+
+  _calcQuatNearestOrigin(TetraQuatSym, numsym, qr);
+}
+
 int TetragonalOps::getMisoBin(float r1, float r2, float r3)
 {
   float dim[3];
@@ -112,6 +112,12 @@ float TriclinicOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, floa
   return _calcMisoQuat(TriclinicQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float TriclinicOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // No symmetry operators besides the identity, so there is never anything to search
+  return _calcMisoQuatFast(0.0f, q1, q2, n1, n2, n3);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -223,6 +229,13 @@ void TriclinicOps::getNearestQuat(QuatF& q1, QuatF& q2)
   _calcNearestQuat(TriclinicQuatSym, numsym, q1, q2);
 }
 
+void TriclinicOps::getFZQuat(QuatF& qr)
+{
+  int numsym = 1;
+
+  _calcQuatNearestOrigin(TriclinicQuatSym, numsym, qr);
+}
+
 int TriclinicOps::getMisoBin(float r1, float r2, float r3)
 {
   float dim[3];
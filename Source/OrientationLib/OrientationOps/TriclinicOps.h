@@ -55,7 +55,7 @@
  * @date May 5, 2011
  * @version 1.0
  */
-class OrientationLib_EXPORT TriclinicOps : public OrientationOps
+class OrientationLib_EXPORT TriclinicOps : public OrientationOpsBatchColors<TriclinicOps>
 {
   public:
     DREAM3D_SHARED_POINTERS(TriclinicOps)
@@ -76,12 +76,14 @@ class OrientationLib_EXPORT TriclinicOps : public OrientationOps
     QString getSymmetryName() { return "TriClinic -1"; }
 
     virtual float getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
+    virtual float getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3);
     virtual void getQuatSymOp(int i, QuatF& q);
     virtual void getRodSymOp(int i, float* r);
     virtual void getMatSymOp(int i, float g[3][3]);
     virtual void getODFFZRod(float& r1, float& r2, float& r3);
     virtual void getMDFFZRod(float& r1, float& r2, float& r3);
     virtual void getNearestQuat(QuatF& q1, QuatF& q2);
+    virtual void getFZQuat(QuatF& qr);
     virtual int getMisoBin(float r1, float r2, float r3);
     virtual bool inUnitTriangle(float eta, float chi);
     virtual void determineEulerAngles(int choose, float& synea1, float& synea2, float& synea3);
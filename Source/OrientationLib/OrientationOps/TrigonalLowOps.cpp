@@ -185,6 +185,12 @@ float TrigonalLowOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, fl
   return _calcMisoQuat(TrigQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float TrigonalLowOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(30 deg): a quarter of the 120 degree threefold rotation
+  return _calcMisoQuatFast(0.866025404f, q1, q2, n1, n2, n3);
+}
+
 void TrigonalLowOps::getQuatSymOp(int i, QuatF& q)
 {
   QuaternionMathF::Copy(TrigQuatSym[i], q);
@@ -273,6 +279,13 @@ void TrigonalLowOps::getNearestQuat(QuatF& q1, QuatF& q2)
   _calcNearestQuat(TrigQuatSym, numsym, q1, q2);
 }
 
+void TrigonalLowOps::getFZQuat(QuatF& qr)
+{
+  int numsym = 3;
+
+  _calcQuatNearestOrigin(TrigQuatSym, numsym, qr);
+}
+
 int TrigonalLowOps::getMisoBin(float r1, float r2, float r3)
 {
   float dim[3];
@@ -206,6 +206,12 @@ float TrigonalOps::getMisoQuat(QuatF& q1, QuatF& q2, float& n1, float& n2, float
   return _calcMisoQuat(TrigQuatSym, numsym, q1, q2, n1, n2, n3);
 }
 
+float TrigonalOps::getMisoQuatFast(QuatF& q1, QuatF& q2, float& n1, float& n2, float& n3)
+{
+  // cos(30 deg): a quarter of the 120 degree threefold rotation
+  return _calcMisoQuatFast(0.866025404f, q1, q2, n1, n2, n3);
+}
+
 void TrigonalOps::getQuatSymOp(int i, QuatF& q)
 {
   QuaternionMathF::Copy(TrigQuatSym[i], q);
@@ -294,6 +300,13 @@ void TrigonalOps::getNearestQuat(QuatF& q1, QuatF& q2)
   _calcNearestQuat(TrigQuatSym, numsym, q1, q2);
 }
 
+void TrigonalOps::getFZQuat(QuatF& qr)
+{
+  int numsym = 6;
+
+  _calcQuatNearestOrigin(TrigQuatSym, numsym, qr);
+}
+
 int TrigonalOps::getMisoBin(float r1, float r2, float r3)
 {
   float dim[3];
@@ -0,0 +1,189 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/ModifiedLambertProjection.h"
+#include "DREAM3DLib/DataArrays/DataArray.hpp"
+
+#include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
+
+namespace ModifiedLambertProjectionTest
+{
+  const size_t NumPoints = 20000;
+  const int LambertDimension = 72;
+  const int StereoDimension = 128;
+  const float SphereRadius = 1.0f;
+}
+
+// -----------------------------------------------------------------------------
+//  Random unit vectors, plus the poles and points on the equator where the
+//  hemisphere test and the square mapping have their special cases.
+// -----------------------------------------------------------------------------
+FloatArrayType::Pointer CreateUnitVectors(size_t numPoints)
+{
+  srand(97531);
+  FloatArrayType::Pointer xyz = FloatArrayType::CreateArray(numPoints, QVector<size_t>(1, 3), "xyz");
+  float special[6][3] = { { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, -1.0f }, { 1.0f, 0.0f, 0.0f },
+    { 0.0f, -1.0f, 0.0f }, { 0.70710678f, 0.70710678f, 0.0f }, { -0.6f, 0.0f, 0.8f }
+  };
+  for (size_t i = 0; i < numPoints; i++)
+  {
+    float* v = xyz->getPointer(i * 3);
+    if (i < 6)
+    {
+      v[0] = special[i][0];
+      v[1] = special[i][1];
+      v[2] = special[i][2];
+      continue;
+    }
+    float length = 0.0f;
+    do
+    {
+      v[0] = 2.0f * static_cast<float>(rand()) / static_cast<float>(RAND_MAX) - 1.0f;
+      v[1] = 2.0f * static_cast<float>(rand()) / static_cast<float>(RAND_MAX) - 1.0f;
+      v[2] = 2.0f * static_cast<float>(rand()) / static_cast<float>(RAND_MAX) - 1.0f;
+      length = sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    }
+    while (length < 0.01f || length > 1.0f);
+    v[0] /= length;
+    v[1] /= length;
+    v[2] /= length;
+  }
+  return xyz;
+}
+
+// -----------------------------------------------------------------------------
+//  Bins the points one at a time, in order, through the public interface.
+// -----------------------------------------------------------------------------
+ModifiedLambertProjection::Pointer CreateSerialProjection(FloatArrayType* xyz, int dimension, float sphereRadius)
+{
+  ModifiedLambertProjection::Pointer projection = ModifiedLambertProjection::New();
+  projection->initializeSquares(dimension, sphereRadius);
+  float sqCoord[2];
+  for (size_t i = 0; i < xyz->getNumberOfTuples(); i++)
+  {
+    sqCoord[0] = 0.0f;
+    sqCoord[1] = 0.0f;
+    bool nhCheck = projection->getSquareCoord(xyz->getPointer(i * 3), sqCoord);
+    projection->addInterpolatedValues(nhCheck ? ModifiedLambertProjection::NorthSquare : ModifiedLambertProjection::SouthSquare, sqCoord, 1.0);
+  }
+  return projection;
+}
+
+// -----------------------------------------------------------------------------
+//  The parallel binning only changes the order of the additions, and every point
+//  spreads a total weight of 1 over its 4 bins.
+// -----------------------------------------------------------------------------
+void TestBinningMatchesSerial()
+{
+  FloatArrayType::Pointer xyz = CreateUnitVectors(ModifiedLambertProjectionTest::NumPoints);
+  ModifiedLambertProjection::Pointer parallel = ModifiedLambertProjection::CreateProjectionFromXYZCoords(xyz.get(), ModifiedLambertProjectionTest::LambertDimension, ModifiedLambertProjectionTest::SphereRadius);
+  ModifiedLambertProjection::Pointer serial = CreateSerialProjection(xyz.get(), ModifiedLambertProjectionTest::LambertDimension, ModifiedLambertProjectionTest::SphereRadius);
+
+  DoubleArrayType::Pointer squares[2][2] = { { parallel->getNorthSquare(), parallel->getSouthSquare() }, { serial->getNorthSquare(), serial->getSouthSquare() } };
+  double total = 0.0;
+  for (int s = 0; s < 2; s++)
+  {
+    size_t count = squares[0][s]->getNumberOfTuples();
+    DREAM3D_REQUIRE_EQUAL(count, static_cast<size_t>(ModifiedLambertProjectionTest::LambertDimension * ModifiedLambertProjectionTest::LambertDimension))
+    DREAM3D_REQUIRE_EQUAL(squares[1][s]->getNumberOfTuples(), count)
+    for (size_t i = 0; i < count; i++)
+    {
+      double expected = squares[1][s]->getValue(i);
+      double value = squares[0][s]->getValue(i);
+      DREAM3D_REQUIRE(value >= 0.0)
+      DREAM3D_REQUIRE(fabs(value - expected) <= 1.0e-9 * (expected > 1.0 ? expected : 1.0))
+      total += value;
+    }
+  }
+  DREAM3D_REQUIRE(fabs(total - static_cast<double>(ModifiedLambertProjectionTest::NumPoints)) < 1.0e-6 * ModifiedLambertProjectionTest::NumPoints)
+}
+
+// -----------------------------------------------------------------------------
+//  The stereographic projection only reads the squares from all threads. It must
+//  not give the projection its own copy of a buffer that is shared with a copy of
+//  the squares, and the result must match the one from unshared squares.
+// -----------------------------------------------------------------------------
+void TestStereographicProjectionLeavesSharedSquares()
+{
+  FloatArrayType::Pointer xyz = CreateUnitVectors(ModifiedLambertProjectionTest::NumPoints);
+  ModifiedLambertProjection::Pointer projection = ModifiedLambertProjection::CreateProjectionFromXYZCoords(xyz.get(), ModifiedLambertProjectionTest::LambertDimension, ModifiedLambertProjectionTest::SphereRadius);
+  projection->normalizeSquaresToMRD();
+
+  int dim = ModifiedLambertProjectionTest::StereoDimension;
+  QVector<size_t> tDims(2, dim);
+  QVector<size_t> cDims(1, 1);
+  DoubleArrayType::Pointer unsharedIntensity = DoubleArrayType::CreateArray(tDims, cDims, "UnsharedIntensity");
+  projection->createStereographicProjection(dim, unsharedIntensity.get());
+
+  // As FilterPipeline does between filters, so that the copies share the buffers
+  projection->getNorthSquare()->invalidateWritePointers();
+  projection->getSouthSquare()->invalidateWritePointers();
+  IDataArray::Pointer northCopy = projection->getNorthSquare()->deepCopy();
+  IDataArray::Pointer southCopy = projection->getSouthSquare()->deepCopy();
+  DREAM3D_REQUIRE_EQUAL(projection->getNorthSquare()->isSharedBuffer(), true)
+  DREAM3D_REQUIRE_EQUAL(projection->getSouthSquare()->isSharedBuffer(), true)
+
+  DoubleArrayType::Pointer sharedIntensity = DoubleArrayType::CreateArray(tDims, cDims, "SharedIntensity");
+  projection->createStereographicProjection(dim, sharedIntensity.get());
+  DREAM3D_REQUIRE_EQUAL(projection->getNorthSquare()->isSharedBuffer(), true)
+  DREAM3D_REQUIRE_EQUAL(projection->getSouthSquare()->isSharedBuffer(), true)
+
+  size_t nonZero = 0;
+  for (size_t i = 0; i < sharedIntensity->getNumberOfTuples(); i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(sharedIntensity->getValue(i), unsharedIntensity->getValue(i))
+    if (sharedIntensity->getValue(i) > 0.0) { nonZero++; }
+  }
+  DREAM3D_REQUIRE(nonZero > 0)
+}
+
+// -----------------------------------------------------------------------------
+//  Use unit test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  int err = EXIT_SUCCESS;
+
+  DREAM3D_REGISTER_TEST( TestBinningMatchesSerial() )
+  DREAM3D_REGISTER_TEST( TestStereographicProjectionLeavesSharedSquares() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
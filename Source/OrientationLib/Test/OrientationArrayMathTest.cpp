@@ -0,0 +1,272 @@
+/* ============================================================================
+ * Copyright (c) 2011 Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2011 Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * Copyright (c) 2014 Dr. Joseph C. Tucker (UES, Inc.)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Joseph C. Tucker, Michael A. Groeber, Michael A. Jackson,
+ * UES, Inc., the US Air Force, BlueQuartz Software nor the names of its contributors
+ * may be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                   FA8650-07-D-5800 and FA8650-10-D-5226
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Math/DREAM3DMath.h"
+#include "DREAM3DLib/Math/QuaternionMath.hpp"
+#include "OrientationLib/Math/OrientationMath.h"
+#include "OrientationLib/Math/OrientationArrayMath.h"
+
+#include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
+#include "TestFileLocations.h"
+
+typedef OrientationArrayMath OAM;
+
+// Enough tuples to span several conversion blocks
+static const size_t k_NumTuples = 10007;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool CloseEnough(const std::vector<float>& a, const std::vector<float>& b, float tol)
+{
+  if (a.size() != b.size()) { return false; }
+  for (size_t i = 0; i < a.size(); i++)
+  {
+    if (fabs(a[i] - b[i]) > tol * (1.0f + fabs(b[i]))) { return false; }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> MakeEulers()
+{
+  std::vector<float> eulers(3 * k_NumTuples);
+  for (size_t i = 0; i < k_NumTuples; i++)
+  {
+    // Spread the angles over the whole Euler space without hitting Phi == 0 or Pi exactly
+    eulers[3 * i] = DREAM3D::Constants::k_2Pi * static_cast<float>((i * 37) % 1009) / 1009.0f;
+    eulers[3 * i + 1] = DREAM3D::Constants::k_Pi * (0.5f + static_cast<float>((i * 53) % 997)) / 998.0f;
+    eulers[3 * i + 2] = DREAM3D::Constants::k_2Pi * static_cast<float>((i * 71) % 1013) / 1013.0f;
+  }
+  return eulers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestEulerConversions()
+{
+  std::vector<float> eulers = MakeEulers();
+  std::vector<float> quats(4 * k_NumTuples), rods(3 * k_NumTuples), axisAngles(4 * k_NumTuples), mats(9 * k_NumTuples);
+  for (size_t i = 0; i < k_NumTuples; i++)
+  {
+    const float* e = &(eulers[3 * i]);
+    QuatF q;
+    OrientationMath::EulertoQuat(e[0], e[1], e[2], q);
+    QuaternionMathF::UnitQuaternion(q);
+    quats[4 * i] = q.x, quats[4 * i + 1] = q.y, quats[4 * i + 2] = q.z, quats[4 * i + 3] = q.w;
+    OrientationMath::EulertoRod(e[0], e[1], e[2], rods[3 * i], rods[3 * i + 1], rods[3 * i + 2]);
+    OrientationMath::EulerToAxisAngle(e[0], e[1], e[2], axisAngles[4 * i], axisAngles[4 * i + 1], axisAngles[4 * i + 2], axisAngles[4 * i + 3]);
+    OrientationMath::EulertoMat(e[0], e[1], e[2], *reinterpret_cast<float(*)[3][3]>(&(mats[9 * i])));
+  }
+
+  std::vector<float> out(4 * k_NumTuples);
+  DREAM3D_REQUIRE_EQUAL(OAM::Convert(OAM::EulerType, &(eulers.front()), OAM::QuaternionType, &(out.front()), k_NumTuples), true)
+  DREAM3D_REQUIRE(CloseEnough(out, quats, 1.0e-6f))
+
+  out.resize(3 * k_NumTuples);
+  OAM::Convert(OAM::EulerType, &(eulers.front()), OAM::RodriguesType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, rods, 1.0e-6f))
+
+  out.resize(4 * k_NumTuples);
+  OAM::Convert(OAM::EulerType, &(eulers.front()), OAM::AxisAngleType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, axisAngles, 1.0e-6f))
+
+  out.resize(9 * k_NumTuples);
+  OAM::Convert(OAM::EulerType, &(eulers.front()), OAM::MatrixType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, mats, 1.0e-6f))
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestQuatConversions()
+{
+  std::vector<float> eulers = MakeEulers();
+  std::vector<float> quats(4 * k_NumTuples);
+  OAM::EulertoQuat(&(eulers.front()), &(quats.front()), k_NumTuples);
+
+  std::vector<float> eulersOut(3 * k_NumTuples), rods(3 * k_NumTuples), axisAngles(4 * k_NumTuples), mats(9 * k_NumTuples);
+  for (size_t i = 0; i < k_NumTuples; i++)
+  {
+    QuatF q = QuaternionMathF::New(quats[4 * i], quats[4 * i + 1], quats[4 * i + 2], quats[4 * i + 3]);
+    OrientationMath::QuattoEuler(q, eulersOut[3 * i], eulersOut[3 * i + 1], eulersOut[3 * i + 2]);
+    OrientationMath::QuattoRod(q, rods[3 * i], rods[3 * i + 1], rods[3 * i + 2]);
+    OrientationMath::QuattoAxisAngle(q, axisAngles[4 * i], axisAngles[4 * i + 1], axisAngles[4 * i + 2], axisAngles[4 * i + 3]);
+    OrientationMath::QuattoMat(q, *reinterpret_cast<float(*)[3][3]>(&(mats[9 * i])));
+  }
+
+  std::vector<float> out(3 * k_NumTuples);
+  OAM::Convert(OAM::QuaternionType, &(quats.front()), OAM::EulerType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, eulersOut, 1.0e-6f))
+
+  OAM::Convert(OAM::QuaternionType, &(quats.front()), OAM::RodriguesType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, rods, 1.0e-6f))
+
+  out.resize(4 * k_NumTuples);
+  OAM::Convert(OAM::QuaternionType, &(quats.front()), OAM::AxisAngleType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, axisAngles, 1.0e-6f))
+
+  out.resize(9 * k_NumTuples);
+  OAM::Convert(OAM::QuaternionType, &(quats.front()), OAM::MatrixType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, mats, 1.0e-6f))
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestRodAndAxisAngleConversions()
+{
+  std::vector<float> eulers = MakeEulers();
+  std::vector<float> rods(3 * k_NumTuples), axisAngles(4 * k_NumTuples);
+  OAM::EulertoRod(&(eulers.front()), &(rods.front()), k_NumTuples);
+  OAM::EulertoAxisAngle(&(eulers.front()), &(axisAngles.front()), k_NumTuples);
+
+  std::vector<float> rodEulers(3 * k_NumTuples), rodQuats(4 * k_NumTuples), homochoric(3 * k_NumTuples), homochoricRods(3 * k_NumTuples);
+  std::vector<float> aaQuats(4 * k_NumTuples), aaRods(3 * k_NumTuples), aaMats(9 * k_NumTuples), aaHomochoric(3 * k_NumTuples);
+  for (size_t i = 0; i < k_NumTuples; i++)
+  {
+    const float* r = &(rods[3 * i]);
+    const float* a = &(axisAngles[4 * i]);
+    QuatF q;
+    OrientationMath::RodtoEuler(r[0], r[1], r[2], rodEulers[3 * i], rodEulers[3 * i + 1], rodEulers[3 * i + 2]);
+    OrientationMath::RodtoQuat(q, r[0], r[1], r[2]);
+    QuaternionMathF::UnitQuaternion(q);
+    rodQuats[4 * i] = q.x, rodQuats[4 * i + 1] = q.y, rodQuats[4 * i + 2] = q.z, rodQuats[4 * i + 3] = q.w;
+    float h[3] = { r[0], r[1], r[2] };
+    OrientationMath::RodtoHomochoric(h[0], h[1], h[2]);
+    homochoric[3 * i] = h[0], homochoric[3 * i + 1] = h[1], homochoric[3 * i + 2] = h[2];
+    OrientationMath::HomochorictoRod(h[0], h[1], h[2]);
+    homochoricRods[3 * i] = h[0], homochoricRods[3 * i + 1] = h[1], homochoricRods[3 * i + 2] = h[2];
+
+    OrientationMath::AxisAngletoQuat(a[0], a[1], a[2], a[3], q);
+    QuaternionMathF::UnitQuaternion(q);
+    aaQuats[4 * i] = q.x, aaQuats[4 * i + 1] = q.y, aaQuats[4 * i + 2] = q.z, aaQuats[4 * i + 3] = q.w;
+    OrientationMath::AxisAngletoRod(a[0], a[1], a[2], a[3], aaRods[3 * i], aaRods[3 * i + 1], aaRods[3 * i + 2]);
+    OrientationMath::AxisAngletoMat(a[0], a[1], a[2], a[3], *reinterpret_cast<float(*)[3][3]>(&(aaMats[9 * i])));
+    OrientationMath::AxisAngletoHomochoric(a[0], a[1], a[2], a[3], aaHomochoric[3 * i], aaHomochoric[3 * i + 1], aaHomochoric[3 * i + 2]);
+  }
+
+  std::vector<float> out(3 * k_NumTuples);
+  OAM::Convert(OAM::RodriguesType, &(rods.front()), OAM::EulerType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, rodEulers, 1.0e-6f))
+  OAM::Convert(OAM::RodriguesType, &(rods.front()), OAM::HomochoricType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, homochoric, 1.0e-6f))
+  OAM::Convert(OAM::HomochoricType, &(homochoric.front()), OAM::RodriguesType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, homochoricRods, 1.0e-6f))
+  OAM::Convert(OAM::AxisAngleType, &(axisAngles.front()), OAM::RodriguesType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, aaRods, 1.0e-6f))
+  OAM::Convert(OAM::AxisAngleType, &(axisAngles.front()), OAM::HomochoricType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, aaHomochoric, 1.0e-6f))
+
+  out.resize(4 * k_NumTuples);
+  OAM::Convert(OAM::RodriguesType, &(rods.front()), OAM::QuaternionType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, rodQuats, 1.0e-6f))
+  OAM::Convert(OAM::AxisAngleType, &(axisAngles.front()), OAM::QuaternionType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, aaQuats, 1.0e-6f))
+
+  out.resize(9 * k_NumTuples);
+  OAM::Convert(OAM::AxisAngleType, &(axisAngles.front()), OAM::MatrixType, &(out.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(out, aaMats, 1.0e-6f))
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestChainedConversions()
+{
+  std::vector<float> eulers = MakeEulers();
+  std::vector<float> mats(9 * k_NumTuples);
+  OAM::EulertoMat(&(eulers.front()), &(mats.front()), k_NumTuples);
+
+  // None of these pairs has a direct kernel; they all have to land on the same orientation
+  OAM::Representation reps[4] = { OAM::AxisAngleType, OAM::HomochoricType, OAM::RodriguesType, OAM::MatrixType };
+  for (int r = 0; r < 4; r++)
+  {
+    std::vector<float> rep(OAM::GetComponentCount(reps[r]) * k_NumTuples);
+    std::vector<float> back(3 * k_NumTuples);
+    std::vector<float> outMats(9 * k_NumTuples);
+    OAM::Convert(OAM::EulerType, &(eulers.front()), reps[r], &(rep.front()), k_NumTuples);
+    OAM::Convert(reps[r], &(rep.front()), OAM::EulerType, &(back.front()), k_NumTuples);
+    OAM::Convert(OAM::EulerType, &(back.front()), OAM::MatrixType, &(outMats.front()), k_NumTuples);
+    DREAM3D_REQUIRE(CloseEnough(outMats, mats, 2.0e-3f))
+  }
+
+  std::vector<float> homochoric(3 * k_NumTuples);
+  std::vector<float> outMats(9 * k_NumTuples);
+  OAM::Convert(OAM::MatrixType, &(mats.front()), OAM::HomochoricType, &(homochoric.front()), k_NumTuples);
+  OAM::Convert(OAM::HomochoricType, &(homochoric.front()), OAM::MatrixType, &(outMats.front()), k_NumTuples);
+  DREAM3D_REQUIRE(CloseEnough(outMats, mats, 2.0e-3f))
+
+  DREAM3D_REQUIRE_EQUAL(OAM::GetComponentCount(OAM::UnknownType), 0)
+  DREAM3D_REQUIRE_EQUAL(OAM::Convert(OAM::UnknownType, &(mats.front()), OAM::EulerType, &(eulers.front()), k_NumTuples), false)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestParallelMatchesSerial()
+{
+  std::vector<float> eulers = MakeEulers();
+  std::vector<float> parallel(4 * k_NumTuples), serial(4 * k_NumTuples);
+  OAM::Convert(OAM::EulerType, &(eulers.front()), OAM::AxisAngleType, &(parallel.front()), k_NumTuples, true);
+  OAM::Convert(OAM::EulerType, &(eulers.front()), OAM::AxisAngleType, &(serial.front()), k_NumTuples, false);
+  DREAM3D_REQUIRE_EQUAL(::memcmp(&(parallel.front()), &(serial.front()), sizeof(float) * parallel.size()), 0)
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  int err = EXIT_SUCCESS;
+  DREAM3D_REGISTER_TEST( TestEulerConversions() )
+  DREAM3D_REGISTER_TEST( TestQuatConversions() )
+  DREAM3D_REGISTER_TEST( TestRodAndAxisAngleConversions() )
+  DREAM3D_REGISTER_TEST( TestChainedConversions() )
+  DREAM3D_REGISTER_TEST( TestParallelMatchesSerial() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
@@ -37,8 +37,16 @@
 
 
 
+#include <stdlib.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "EbsdLib/EbsdConstants.h"
+
 #include "DREAM3DLib/Math/QuaternionMath.hpp"
 #include "OrientationLib/Math/OrientationMath.h"
+#include "OrientationLib/OrientationOps/OrientationOps.h"
 
 
 #include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
@@ -262,6 +270,136 @@ void TestMisc()
   Print(std::cout, active);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestMisoQuatFast()
+{
+  QVector<OrientationOps::Pointer> ops = OrientationOps::getOrientationOpsQVector();
+  int cubicChecked = 0;
+  srand(1234);
+  for (int xtal = 0; xtal < ops.size(); xtal++)
+  {
+    for (int i = 0; i < 2000; i++)
+    {
+      float e[3] = { DREAM3D::Constants::k_2Pi * rand() / RAND_MAX, DREAM3D::Constants::k_Pi * rand() / RAND_MAX, DREAM3D::Constants::k_2Pi * rand() / RAND_MAX };
+      QuatF q1 = OrientationMath::EulertoQuat(e);
+      // Every other pair is a small perturbation so both the early out and the full search are exercised
+      if (i % 2 == 0)
+      {
+        e[0] += 0.2f * rand() / RAND_MAX, e[1] += 0.2f * rand() / RAND_MAX, e[2] -= 0.2f * rand() / RAND_MAX;
+      }
+      else
+      {
+        e[0] = DREAM3D::Constants::k_2Pi * rand() / RAND_MAX, e[1] = DREAM3D::Constants::k_Pi * rand() / RAND_MAX;
+      }
+      QuatF q2 = OrientationMath::EulertoQuat(e);
+      if (i % 4 < 2)
+      {
+        ops[xtal]->getFZQuat(q1);
+        ops[xtal]->getFZQuat(q2);
+      }
+
+      float n[3] = { 0.0f, 0.0f, 0.0f };
+      float nFast[3] = { 0.0f, 0.0f, 0.0f };
+      float w = ops[xtal]->getMisoQuat(q1, q2, n[0], n[1], n[2]);
+      float wFast = ops[xtal]->getMisoQuatFast(q1, q2, nFast[0], nFast[1], nFast[2]);
+      if (xtal != Ebsd::CrystalStructure::Cubic_High)
+      {
+        DREAM3D_REQUIRE_EQUAL(w, wFast)
+        DREAM3D_REQUIRE_EQUAL(n[0], nFast[0])
+        DREAM3D_REQUIRE_EQUAL(n[1], nFast[1])
+        DREAM3D_REQUIRE_EQUAL(n[2], nFast[2])
+        continue;
+      }
+      // The closed form cubic misorientation computes the angle differently and returns the axis sorted into
+      // the standard triangle, so the early out agrees up to rounding and a cubic symmetry of the axis
+      DREAM3D_REQUIRE(fabs(w - wFast) < 1.0e-4f)
+      if (w > 1.0e-3f)
+      {
+        float sorted[3] = { fabs(nFast[0]), fabs(nFast[1]), fabs(nFast[2]) };
+        std::sort(sorted, sorted + 3);
+        DREAM3D_REQUIRE(fabs(sorted[0] - n[0]) < 1.0e-3f)
+        DREAM3D_REQUIRE(fabs(sorted[1] - n[1]) < 1.0e-3f)
+        DREAM3D_REQUIRE(fabs(sorted[2] - n[2]) < 1.0e-3f)
+      }
+      cubicChecked++;
+    }
+  }
+  DREAM3D_REQUIRE_EQUAL(cubicChecked, 2000)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestBatchColors()
+{
+  QVector<OrientationOps::Pointer> ops = OrientationOps::getOrientationOpsQVector();
+  const size_t batchSize = 1000;
+  const int numBatches = 20;
+  std::vector<float> eulers(3 * batchSize);
+  std::vector<float> refDirs(3 * batchSize);
+  std::vector<QuatF> quats(batchSize);
+  std::vector<uint8_t> rgb(3 * batchSize);
+  srand(4321);
+  for (int xtal = 0; xtal < ops.size(); xtal++)
+  {
+    size_t boundaryCases = 0;
+    for (int b = 0; b < numBatches; b++)
+    {
+      // Odd batches share a single Reference Direction, even batches have one per orientation
+      size_t refDirStride = (b % 2 == 0) ? 3 : 0;
+      for (size_t i = 0; i < batchSize; i++)
+      {
+        eulers[3 * i] = DREAM3D::Constants::k_2Pi * rand() / RAND_MAX;
+        eulers[3 * i + 1] = DREAM3D::Constants::k_Pi * rand() / RAND_MAX;
+        eulers[3 * i + 2] = DREAM3D::Constants::k_2Pi * rand() / RAND_MAX;
+        float dir[3] = { 2.0f * rand() / RAND_MAX - 1.0f, 2.0f * rand() / RAND_MAX - 1.0f, 2.0f * rand() / RAND_MAX - 1.0f };
+        MatrixMath::Normalize3x1(dir);
+        refDirs[3 * i] = dir[0];
+        refDirs[3 * i + 1] = dir[1];
+        refDirs[3 * i + 2] = dir[2];
+        quats[i] = OrientationMath::EulertoQuat(&(eulers[3 * i]));
+      }
+
+      ops[xtal]->generateIPFColors(&(eulers[0]), &(refDirs[0]), refDirStride, batchSize, &(rgb[0]));
+      for (size_t i = 0; i < batchSize; i++)
+      {
+        const float* dir = &(refDirs[i * refDirStride]);
+        DREAM3D::Rgb argb = ops[xtal]->generateIPFColor(eulers[3 * i], eulers[3 * i + 1], eulers[3 * i + 2], dir[0], dir[1], dir[2], false);
+        int dr = abs(static_cast<int>(rgb[3 * i]) - RgbColor::dRed(argb));
+        int dg = abs(static_cast<int>(rgb[3 * i + 1]) - RgbColor::dGreen(argb));
+        int db = abs(static_cast<int>(rgb[3 * i + 2]) - RgbColor::dBlue(argb));
+        // The batch rotates by g(s) * g(q) instead of g(q * s), so a direction that lies on the edge of the unit
+        // triangle can round into a neighboring symmetric equivalent; everything else agrees to the last bit
+        if (dr > 1 || dg > 1 || db > 1) { boundaryCases++; }
+      }
+
+      ops[xtal]->generateRodriguesColors(&(eulers[0]), batchSize, &(rgb[0]));
+      for (size_t i = 0; i < batchSize; i++)
+      {
+        float r1 = 0.0f, r2 = 0.0f, r3 = 0.0f;
+        OrientationMath::EulertoRod(eulers[3 * i], eulers[3 * i + 1], eulers[3 * i + 2], r1, r2, r3);
+        DREAM3D::Rgb argb = ops[xtal]->generateRodriguesColor(r1, r2, r3);
+        DREAM3D_REQUIRE_EQUAL(static_cast<int>(rgb[3 * i]), RgbColor::dRed(argb))
+        DREAM3D_REQUIRE_EQUAL(static_cast<int>(rgb[3 * i + 1]), RgbColor::dGreen(argb))
+        DREAM3D_REQUIRE_EQUAL(static_cast<int>(rgb[3 * i + 2]), RgbColor::dBlue(argb))
+      }
+
+      size_t refFrameStride = refDirStride / 3;
+      ops[xtal]->generateMisorientationColors(&(quats[0]), &(quats[batchSize / 2]), refFrameStride, batchSize / 2, &(rgb[0]));
+      for (size_t i = 0; i < batchSize / 2; i++)
+      {
+        DREAM3D::Rgb argb = ops[xtal]->generateMisorientationColor(quats[i], quats[batchSize / 2 + i * refFrameStride]);
+        DREAM3D_REQUIRE_EQUAL(static_cast<int>(rgb[3 * i]), RgbColor::dRed(argb))
+        DREAM3D_REQUIRE_EQUAL(static_cast<int>(rgb[3 * i + 1]), RgbColor::dGreen(argb))
+        DREAM3D_REQUIRE_EQUAL(static_cast<int>(rgb[3 * i + 2]), RgbColor::dBlue(argb))
+      }
+    }
+    DREAM3D_REQUIRE(boundaryCases * 1000 < batchSize * numBatches)
+  }
+}
+
 // Floating-point modulo
 // The result (the remainder) has same sign as the divisor.
 // Similar to matlab's mod(); Not similar to fmod() -   Mod(-3,4)= 1   fmod(-3,4)= -3
@@ -375,6 +513,8 @@ int main(int argc, char** argv)
   TestFMod();
 
   DREAM3D_REGISTER_TEST( TestQuatMath() )
+  DREAM3D_REGISTER_TEST( TestMisoQuatFast() )
+  DREAM3D_REGISTER_TEST( TestBatchColors() )
 
       PRINT_TEST_SUMMARY();
   return err;
@@ -34,24 +34,220 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <stdlib.h>
+#include <math.h>
 
-#include <iostream>
 #include <vector>
-#include <string>
+
+#include "DREAM3DLib/DREAM3DLib.h"
 #include "DREAM3DLib/Common/Texture.hpp"
+#include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "OrientationLib/Math/OrientationMath.h"
 #include "OrientationLib/OrientationOps/CubicOps.h"
+#include "OrientationLib/OrientationOps/HexagonalOps.h"
+#include "OrientationLib/OrientationOps/OrthoRhombicOps.h"
 
+#include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
 
-/**
- * @brief These tests are just here to make sure the code compiles. The tests will
- * not actually work or would probably produced undefined results.
- * @param argc
- * @param argv
- * @return
- */
-int main(int argc, char** argv)
+namespace TextureTest
+{
+  const size_t NumEntries = 500;
+  const int MaxSigma = 4;
+}
+
+typedef void (*CalculateODFFunc)(float*, float*, float*, float*, float*, bool, float*, size_t);
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+class TextureTestInputs
+{
+  public:
+    TextureTestInputs(size_t numEntries, float minWeight, float maxWeight)
+    {
+      DREAM3D_RANDOMNG_NEW()
+      for (size_t i = 0; i < numEntries; i++)
+      {
+        e1s.push_back(static_cast<float>(2.0 * DREAM3D::Constants::k_Pi * rg.genrand_res53()));
+        e2s.push_back(static_cast<float>(acos(2.0 * (rg.genrand_res53() - 0.5))));
+        e3s.push_back(static_cast<float>(2.0 * DREAM3D::Constants::k_Pi * rg.genrand_res53()));
+        weights.push_back(static_cast<float>(minWeight + (maxWeight - minWeight) * rg.genrand_res53()));
+        // Whole bin sigmas like the StatsGenerator tables, including 0
+        sigmas.push_back(static_cast<float>(i % (TextureTest::MaxSigma + 1)));
+      }
+    }
+
+    std::vector<float> e1s;
+    std::vector<float> e2s;
+    std::vector<float> e3s;
+    std::vector<float> weights;
+    std::vector<float> sigmas;
+};
+
+// -----------------------------------------------------------------------------
+// The serial binning the TextureBinsImpl replaces, calling through the virtual interface
+// -----------------------------------------------------------------------------
+void SerialBins(OrientationOps* ops, TextureTestInputs& inputs, std::vector<int32_t>& bins)
+{
+  float r1 = 0.0f, r2 = 0.0f, r3 = 0.0f;
+  bins.resize(inputs.e1s.size());
+  for (size_t i = 0; i < inputs.e1s.size(); i++)
+  {
+    OrientationMath::EulertoRod(inputs.e1s[i], inputs.e2s[i], inputs.e3s[i], r1, r2, r3);
+    ops->getODFFZRod(r1, r2, r3);
+    bins[i] = ops->getOdfBin(r1, r2, r3);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// The serial smoothing the TextureSmoothingImpl replaces. It visits the whole (2 * sigma + 1)^3 box of every
+// entry and tests each bin against the ODF bounds and the sigma sphere.
+// -----------------------------------------------------------------------------
+float SerialSmoothing(const std::vector<int32_t>& bins, TextureTestInputs& inputs, const int dims[3], std::vector<float>& odf)
+{
+  float totaladdweight = 0.0f;
+  odf.assign(dims[0] * dims[1] * dims[2], 0.0f);
+  for (size_t i = 0; i < bins.size(); i++)
+  {
+    int bin = bins[i];
+    int bin1 = bin % dims[0];
+    int bin2 = (bin / dims[0]) % dims[1];
+    int bin3 = bin / (dims[0] * dims[1]);
+    float sigma = inputs.sigmas[i];
+    for (int j = -sigma; j <= sigma; j++)
+    {
+      for (int k = -sigma; k <= sigma; k++)
+      {
+        for (int l = -sigma; l <= sigma; l++)
+        {
+          int addbin1 = bin1 + j;
+          int addbin2 = bin2 + k;
+          int addbin3 = bin3 + l;
+          if(addbin1 < 0 || addbin1 >= dims[0] || addbin2 < 0 || addbin2 >= dims[1] || addbin3 < 0 || addbin3 >= dims[2]) { continue; }
+          float dist = powf(static_cast<float>(j * j + k * k + l * l), 0.5f);
+          if(dist > int(sigma)) { continue; }
+          float addweight = inputs.weights[i];
+          if(sigma != 0.0f)
+          {
+            addweight = inputs.weights[i] * (1.0 - (double(dist / int(sigma)) * double(dist / int(sigma))));
+          }
+          odf[(addbin3 * dims[1] + addbin2) * dims[0] + addbin1] += addweight;
+          totaladdweight += addweight;
+        }
+      }
+    }
+  }
+  return totaladdweight;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RequireClose(float value, float expected, float tolerance)
+{
+  float scale = fabsf(expected) > 1.0f ? fabsf(expected) : 1.0f;
+  DREAM3D_REQUIRE(fabsf(value - expected) <= tolerance * scale)
+}
+
+// -----------------------------------------------------------------------------
+// The parallel binning has to find exactly the bins of the serial binning
+// -----------------------------------------------------------------------------
+template<class OpsType>
+void TestBinning()
+{
+  TextureTestInputs inputs(TextureTest::NumEntries, 0.0f, 1.0f);
+  OpsType ops;
+  std::vector<int32_t> expected;
+  SerialBins(&ops, inputs, expected);
+
+  std::vector<int32_t> bins(TextureTest::NumEntries, -1);
+  TextureBinsImpl<float, OpsType> binner(&(inputs.e1s.front()), &(inputs.e2s.front()), &(inputs.e3s.front()), &(bins.front()));
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, TextureTest::NumEntries), binner, tbb::auto_partitioner());
+#else
+  binner.convert(0, TextureTest::NumEntries);
+#endif
+  for (size_t i = 0; i < TextureTest::NumEntries; i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(bins[i], expected[i])
+  }
+}
+
+// -----------------------------------------------------------------------------
+// The clipped, per thread smoothing has to spread the same weights as the serial loops. Only the order of the
+// additions differs.
+// -----------------------------------------------------------------------------
+template<class OpsType>
+void TestSmoothing(int dim1, int dim2, int dim3)
+{
+  const int dims[3] = { dim1, dim2, dim3 };
+  TextureTestInputs inputs(TextureTest::NumEntries, 0.0f, 10.0f);
+  OpsType ops;
+  std::vector<int32_t> bins;
+  SerialBins(&ops, inputs, bins);
+  // Put a few entries into corner bins so the stencil gets clipped on every side
+  bins[0] = 0;
+  bins[4] = dim1 * dim2 * dim3 - 1;
+  bins[9] = dim1 - 1;
+  bins[14] = (dim3 - 1) * dim1 * dim2;
+
+  std::vector<float> expected;
+  float expectedTotal = SerialSmoothing(bins, inputs, dims, expected);
+
+  TextureSmoothingImpl<float> smoother(&(bins.front()), &(inputs.weights.front()), &(inputs.sigmas.front()), dims);
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  tbb::parallel_reduce(tbb::blocked_range<size_t>(0, TextureTest::NumEntries), smoother, tbb::auto_partitioner());
+#else
+  smoother.smooth(0, TextureTest::NumEntries);
+#endif
+  const std::vector<float>& odf = smoother.getODF();
+  DREAM3D_REQUIRE_EQUAL(odf.size(), expected.size())
+  for (size_t i = 0; i < odf.size(); i++)
+  {
+    RequireClose(odf[i], expected[i], 1.0e-4f);
+  }
+  RequireClose(static_cast<float>(smoother.getTotalAddWeight()), expectedTotal, 1.0e-4f);
+}
+
+// -----------------------------------------------------------------------------
+// Compares a complete ODF calculation with the serial binning and smoothing. The weights are large enough that
+// the ODF is scaled down to the total weight, so the random fill has (up to rounding) nothing left to add.
+// -----------------------------------------------------------------------------
+template<class OpsType>
+void TestCalculateODFData(CalculateODFFunc calculate, int dim1, int dim2, int dim3)
 {
+  const int dims[3] = { dim1, dim2, dim3 };
+  const size_t odfSize = dim1 * dim2 * dim3;
+  const float totalweight = static_cast<float>(3 * odfSize);
+  TextureTestInputs inputs(TextureTest::NumEntries, 1000.0f, 2000.0f);
+  OpsType ops;
+  std::vector<int32_t> bins;
+  SerialBins(&ops, inputs, bins);
+  std::vector<float> expected;
+  float totaladdweight = SerialSmoothing(bins, inputs, dims, expected);
+  DREAM3D_REQUIRE(totaladdweight > totalweight)
+  float scale = totaladdweight / totalweight;
 
+  std::vector<float> odf(odfSize, 0.0f);
+  calculate(&(inputs.e1s.front()), &(inputs.e2s.front()), &(inputs.e3s.front()), &(inputs.weights.front()), &(inputs.sigmas.front()),
+            true, &(odf.front()), TextureTest::NumEntries);
+  double sum = 0.0;
+  for (size_t i = 0; i < odfSize; i++)
+  {
+    float value = expected[i] / scale / totalweight;
+    DREAM3D_REQUIRE(fabsf(odf[i] - value) <= 1.0e-4f)
+    sum += odf[i];
+  }
+  DREAM3D_REQUIRE(fabs(sum - 1.0) < 1.0e-3)
+}
+
+// -----------------------------------------------------------------------------
+// Without any entries all of the weight comes from the random fill
+// -----------------------------------------------------------------------------
+void TestNoEntries()
+{
   QVector<float> e1s;
   QVector<float> e2s;
   QVector<float> e3s;
@@ -62,24 +258,68 @@ int main(int argc, char** argv)
   size_t numEntries = e1s.size();
   odf.resize(CubicOps::k_OdfSize);
   Texture::CalculateCubicODFData(e1s.data(), e2s.data(), e3s.data(), weights.data(), sigmas.data(), true, odf.data(), numEntries);
-  odf.resize(HexagonalOps::k_OdfSize);
-  Texture::CalculateHexODFData(e1s.data(), e2s.data(), e3s.data(), weights.data(), sigmas.data(), true,
-                               odf.data(), numEntries);
+  double sum = 0.0;
+  for (int i = 0; i < odf.size(); i++)
+  {
+    DREAM3D_REQUIRE(odf[i] >= 0.0f)
+    sum += odf[i];
+  }
+  DREAM3D_REQUIRE(fabs(sum - 1.0) < 1.0e-3)
 
-
-  odf.resize(OrthoRhombicOps::k_OdfSize);
-  Texture::CalculateOrthoRhombicODFData(e1s.data(), e2s.data(), e3s.data(), weights.data(), sigmas.data(), true,
-                                        odf.data(), numEntries);
-
-
-  //int size = 1000;
-  // Now generate the actual XY point data that gets plotted.
-  // These are the output vectors
   QVector<float> angles;
   QVector<float> axes;
   QVector<float> mdf(CubicOps::k_MdfSize);
-
   Texture::CalculateMDFData<float, CubicOps>(angles.data(), axes.data(), weights.data(), odf.data(), mdf.data(), angles.size());
+  sum = 0.0;
+  for (int i = 0; i < mdf.size(); i++)
+  {
+    sum += mdf[i];
+  }
+  DREAM3D_REQUIRE(fabs(sum - 1.0) < 1.0e-3)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestCubic()
+{
+  TestBinning<CubicOps>();
+  TestSmoothing<CubicOps>(18, 18, 18);
+  TestCalculateODFData<CubicOps>(&Texture::CalculateCubicODFData<float>, 18, 18, 18);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestHexagonal()
+{
+  TestBinning<HexagonalOps>();
+  TestSmoothing<HexagonalOps>(36, 36, 12);
+  TestCalculateODFData<HexagonalOps>(&Texture::CalculateHexODFData<float>, 36, 36, 12);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestOrthoRhombic()
+{
+  TestBinning<OrthoRhombicOps>();
+  TestSmoothing<OrthoRhombicOps>(36, 36, 36);
+  TestCalculateODFData<OrthoRhombicOps>(&Texture::CalculateOrthoRhombicODFData<float>, 36, 36, 36);
+}
+
+// -----------------------------------------------------------------------------
+//  Use unit test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  int err = EXIT_SUCCESS;
+
+  DREAM3D_REGISTER_TEST( TestNoEntries() )
+  DREAM3D_REGISTER_TEST( TestCubic() )
+  DREAM3D_REGISTER_TEST( TestHexagonal() )
+  DREAM3D_REGISTER_TEST( TestOrthoRhombic() )
 
-  return EXIT_SUCCESS;
+  PRINT_TEST_SUMMARY();
+  return err;
 }
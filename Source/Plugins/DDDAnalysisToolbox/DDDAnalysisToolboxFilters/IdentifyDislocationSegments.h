@@ -143,8 +143,8 @@ class IdentifyDislocationSegments : public AbstractFilter
     void updateEdgeFeatureInstancePointers();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, BurgersVectors)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, SlipPlaneNormals)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, BurgersVectors)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, SlipPlaneNormals)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, DislocationIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(bool, Active)
 
@@ -36,278 +36,14 @@
 
 #include "ConvertOrientations.h"
 
-#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
-#include <tbb/parallel_for.h>
-#include <tbb/blocked_range.h>
-#include <tbb/partitioner.h>
-#include <tbb/task_scheduler_init.h>
-#endif
-
 #include <sstream>
 
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/DataArrays/IDataArray.h"
-#include "OrientationLib/Math/OrientationMath.h"
+#include "OrientationLib/Math/OrientationArrayMath.h"
 
 #include "Generic/GenericConstants.h"
 
-class ConvertOrientationsImpl
-{
-
-  public:
-    ConvertOrientationsImpl(float* inputEulers, float* inputQuats, float* inputRods, float* inputAxisAngles, float* outputEulers, float* outputQuats, float* outputRods, float* outputAxisAngles, int32_t* cellPhases, unsigned int* crystalStructures, int inputType, int outputType) :
-      m_InputEulerAngles(inputEulers),
-      m_InputQuats(inputQuats),
-      m_InputRods(inputRods),
-      m_InputAxisAngles(inputAxisAngles),
-      m_OutputEulerAngles(outputEulers),
-      m_OutputQuats(outputQuats),
-      m_OutputRods(outputRods),
-      m_OutputAxisAngles(outputAxisAngles),
-      m_CellPhases(cellPhases),
-      m_CrystalStructures(crystalStructures),
-      m_InputType(inputType),
-      m_OutputType(outputType)
-    {}
-    virtual ~ConvertOrientationsImpl() {}
-
-    void convert(size_t start, size_t end) const
-    {
-      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      //quats -> ?
-      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      if( 0 == m_InputType && 1 == m_OutputType )//euler angles->quats
-      {
-        QuatF* quats = reinterpret_cast<QuatF*>(m_OutputQuats);
-        QuatF q;
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            QuaternionMathF::Identity(q);
-          }
-          else
-          {
-            OrientationMath::EulertoQuat( m_InputEulerAngles[3 * i], m_InputEulerAngles[3 * i + 1], m_InputEulerAngles[3 * i + 2], q );
-            QuaternionMathF::UnitQuaternion(q);
-          }
-          QuaternionMathF::Copy(q, quats[i]);
-        }
-      }
-      else if( 0 == m_InputType && 2 == m_OutputType )//euler angles->rods
-      {
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            m_OutputRods[3 * i] = 0;
-            m_OutputRods[3 * i + 1] = 0;
-            m_OutputRods[3 * i + 2] = 0;
-          }
-          else
-          {
-            OrientationMath::EulertoRod( m_InputEulerAngles[3 * i], m_InputEulerAngles[3 * i + 1], m_InputEulerAngles[3 * i + 2], m_OutputRods[3 * i], m_OutputRods[3 * i + 1], m_OutputRods[3 * i + 2] );
-          }
-        }
-      }
-      else if( 0 == m_InputType && 3 == m_OutputType )//euler angles->axis angles
-      {
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            m_OutputAxisAngles[4 * i] = 0;
-            m_OutputAxisAngles[4 * i + 1] = 0;
-            m_OutputAxisAngles[4 * i + 2] = 0;
-            m_OutputAxisAngles[4 * i + 3] = 0;
-          }
-          else
-          {
-            OrientationMath::EulerToAxisAngle( m_InputEulerAngles[3 * i], m_InputEulerAngles[3 * i + 1], m_InputEulerAngles[3 * i + 2], m_OutputAxisAngles[4 * i], m_OutputAxisAngles[4 * i + 1], m_OutputAxisAngles[4 * i + 2], m_OutputAxisAngles[4 * i + 3] );
-          }
-        }
-      }
-      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      //quats -> ?
-      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      else if( 1 == m_InputType && 0 == m_OutputType )//quats->euler angles
-      {
-        QuatF* cellQuats = reinterpret_cast<QuatF*>(m_InputQuats);
-        QuatF q;
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            m_OutputEulerAngles[3 * i] = 0;
-            m_OutputEulerAngles[3 * i + 1] = 0;
-            m_OutputEulerAngles[3 * i + 2] = 0;
-          }
-          else
-          {
-            QuaternionMathF::Copy(cellQuats[i], q);
-            OrientationMath::QuattoEuler(q, m_OutputEulerAngles[3 * i], m_OutputEulerAngles[3 * i + 1], m_OutputEulerAngles[3 * i + 2] );
-          }
-        }
-      }
-      else if( 1 == m_InputType && 2 == m_OutputType )//quats->rods
-      {
-        QuatF* cellQuats = reinterpret_cast<QuatF*>(m_InputQuats);
-        QuatF q;
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            m_OutputRods[3 * i] = 0;
-            m_OutputRods[3 * i + 1] = 0;
-            m_OutputRods[3 * i + 2] = 0;
-          }
-          else
-          {
-            QuaternionMathF::Copy(cellQuats[i], q);
-            OrientationMath::QuattoRod(q, m_OutputRods[3 * i], m_OutputRods[3 * i + 1], m_OutputRods[3 * i + 2] );
-          }
-        }
-      }
-      else if( 1 == m_InputType && 3 == m_OutputType )//quats->axis angles
-      {
-        QuatF* cellQuats = reinterpret_cast<QuatF*>(m_InputQuats);
-        QuatF q;
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            m_OutputAxisAngles[4 * i] = 0;
-            m_OutputAxisAngles[4 * i + 1] = 0;
-            m_OutputAxisAngles[4 * i + 2] = 0;
-            m_OutputAxisAngles[4 * i + 3] = 0;
-          }
-          else
-          {
-            QuaternionMathF::Copy(cellQuats[i], q);
-            OrientationMath::QuattoAxisAngle(q, m_OutputAxisAngles[4 * i], m_OutputAxisAngles[4 * i + 1], m_OutputAxisAngles[4 * i + 2], m_OutputAxisAngles[4 * i + 3] );
-          }
-        }
-      }
-      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      //rods -> ?
-      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      else if( 2 == m_InputType && 0 == m_OutputType )//rods->euler angles
-      {
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            m_OutputEulerAngles[3 * i] = 0;
-            m_OutputEulerAngles[3 * i + 1] = 0;
-            m_OutputEulerAngles[3 * i + 2] = 0;
-          }
-          else
-          {
-            OrientationMath::RodtoEuler( m_InputRods[3 * i], m_InputRods[3 * i + 1], m_InputRods[3 * i + 2], m_OutputEulerAngles[3 * i], m_OutputEulerAngles[3 * i + 1], m_OutputEulerAngles[3 * i + 2] );
-          }
-        }
-      }
-      else if( 2 == m_InputType && 1 == m_OutputType )//rods->quats
-      {
-        QuatF* quats = reinterpret_cast<QuatF*>(m_OutputQuats);
-        QuatF q;
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            QuaternionMathF::Identity(q);
-          }
-          else
-          {
-            OrientationMath::RodtoQuat( q, m_InputRods[3 * i], m_InputRods[3 * i + 1], m_InputRods[3 * i + 2] );
-            QuaternionMathF::UnitQuaternion(q);
-          }
-          QuaternionMathF::Copy(q, quats[i]);
-        }
-      }
-      else if( 2 == m_InputType && 3 == m_OutputType )//rods->axis angles
-      {
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            m_OutputAxisAngles[4 * i] = 0;
-            m_OutputAxisAngles[4 * i + 1] = 0;
-            m_OutputAxisAngles[4 * i + 2] = 0;
-            m_OutputAxisAngles[4 * i + 3] = 0;
-          }
-          else
-          {
-            OrientationMath::RodtoAxisAngle( m_InputRods[3 * i], m_InputRods[3 * i + 1], m_InputRods[3 * i + 2], m_OutputAxisAngles[4 * i], m_OutputAxisAngles[4 * i + 1], m_OutputAxisAngles[4 * i + 2], m_OutputAxisAngles[4 * i + 3] );
-          }
-        }
-      }
-      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      //axis angles -> ?
-      //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-      else if( 3 == m_InputType && 0 == m_OutputType )//axis angles->euler angles (currently unsupported)
-      {
-
-      }
-      else if( 3 == m_InputType && 1 == m_OutputType )//axis angles->quats
-      {
-        QuatF* quats = reinterpret_cast<QuatF*>(m_OutputQuats);
-        QuatF q;
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            QuaternionMathF::Identity(q);
-          }
-          else
-          {
-            OrientationMath::AxisAngletoQuat( m_InputAxisAngles[4 * i], m_InputAxisAngles[4 * i + 1], m_InputAxisAngles[4 * i + 2], m_InputAxisAngles[4 * i + 3], q );
-            QuaternionMathF::UnitQuaternion(q);
-          }
-          QuaternionMathF::Copy(q, quats[i]);
-        }
-      }
-      else if( 3 == m_InputType && 2 == m_OutputType )//axis angles->rods
-      {
-        for(size_t i = start; i < end; i++)
-        {
-          if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            m_OutputRods[3 * i] = 0;
-            m_OutputRods[3 * i + 1] = 0;
-            m_OutputRods[3 * i + 2] = 0;
-          }
-          else
-          {
-            OrientationMath::AxisAngletoRod( m_InputAxisAngles[4 * i], m_InputAxisAngles[4 * i + 1], m_InputAxisAngles[4 * i + 2], m_InputAxisAngles[4 * i + 3], m_OutputRods[3 * i], m_OutputRods[3 * i + 1], m_OutputRods[3 * i + 2] );
-          }
-        }
-      }
-    }
-
-#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
-    void operator()(const tbb::blocked_range<size_t>& r) const
-    {
-      convert(r.begin(), r.end());
-    }
-#endif
-  private:
-    float* m_InputEulerAngles;
-    float* m_InputQuats;
-    float* m_InputRods;
-    float* m_InputAxisAngles;
-    float* m_OutputEulerAngles;
-    float* m_OutputQuats;
-    float* m_OutputRods;
-    float* m_OutputAxisAngles;
-    int32_t* m_CellPhases;
-    unsigned int* m_CrystalStructures;
-    int m_InputType;
-    int m_OutputType;
-
-};
-
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -455,14 +191,6 @@ void ConvertOrientations::dataCheck()
     return;
   }
 
-  if(  (0 == getInputType() && 3 == getOutputType()) || (3 == getInputType() && 0 == getOutputType() ) )
-  {
-    QString ss = QObject::tr("Direct conversion between Axis Angle and Euler Angle is currently not implemented");
-    notifyErrorMessage(getHumanLabel(), ss, -1001);
-    setErrorCondition(-1001);
-    return;
-  }
-
   switch(getInputType())
   {
     case 0://euler angles
@@ -569,7 +297,7 @@ void ConvertOrientations::dataCheck()
   QVector<size_t> dims(1, 1);
   m_CellPhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getCellPhasesArrayPath(), dims);
   if( NULL != m_CellPhasesPtr.lock().get() )
-  { m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0); }
+  { m_CellPhases = m_CellPhasesPtr.lock()->getConstPointer(0); }
 
   m_CrystalStructuresPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<unsigned int>, AbstractFilter>(this, getCrystalStructuresArrayPath(), dims);
   if( NULL != m_CrystalStructuresPtr.lock().get() )
@@ -598,50 +326,69 @@ void ConvertOrientations::execute()
   dataCheck();
   if(getErrorCondition() < 0) { return; }
 
-  int64_t totalPoints;
+  // The filter's representation indices match the first four OrientationArrayMath representations
+  int64_t totalPoints = 0;
+  const float* input = NULL;
   switch(getInputType())
   {
     case 0://euler angles
     {
       totalPoints = m_CellEulerAnglesPtr.lock()->getNumberOfTuples();
+      input = m_CellEulerAngles;
     }
     break;
 
     case 1://quats
     {
       totalPoints = m_CellQuatsPtr.lock()->getNumberOfTuples();
+      input = m_CellQuats;
     }
     break;
 
     case 2://rods
     {
       totalPoints = m_CellRodriguesVectorsPtr.lock()->getNumberOfTuples();
+      input = m_CellRodriguesVectors;
     }
     break;
 
     case 3://axis angle
     {
       totalPoints = m_CellAxisAnglesPtr.lock()->getNumberOfTuples();
+      input = m_CellAxisAngles;
     }
     break;
   }
 
-#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
-  tbb::task_scheduler_init init;
-  bool doParallel = true;
-#endif
-
-#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
-  if (doParallel == true)
+  float* output = NULL;
+  switch(getOutputType())
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints),
-                      ConvertOrientationsImpl(m_CellEulerAngles, m_CellQuats, m_CellRodriguesVectors, m_CellAxisAngles, m_EulerAngles, m_Quats, m_RodriguesVectors, m_AxisAngles, m_CellPhases, m_CrystalStructures, m_InputType, m_OutputType), tbb::auto_partitioner());
+    case 0: output = m_EulerAngles; break;
+    case 1: output = m_Quats; break;
+    case 2: output = m_RodriguesVectors; break;
+    case 3: output = m_AxisAngles; break;
   }
-  else
-#endif
+
+  OrientationArrayMath::Representation inRep = static_cast<OrientationArrayMath::Representation>(getInputType());
+  OrientationArrayMath::Representation outRep = static_cast<OrientationArrayMath::Representation>(getOutputType());
+  OrientationArrayMath::Convert(inRep, input, outRep, output, totalPoints);
+
+  // Cells whose phase has no known crystal structure get the identity quaternion or zeros
+  int numComps = OrientationArrayMath::GetComponentCount(outRep);
+  for (int64_t i = 0; i < totalPoints; i++)
   {
-    ConvertOrientationsImpl serial(m_CellEulerAngles, m_CellQuats, m_CellRodriguesVectors, m_CellAxisAngles, m_EulerAngles, m_Quats, m_RodriguesVectors, m_AxisAngles, m_CellPhases, m_CrystalStructures, m_InputType, m_OutputType);
-    serial.convert(0, totalPoints);
+    if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
+    {
+      float* o = output + numComps * i;
+      for (int j = 0; j < numComps; j++)
+      {
+        o[j] = 0.0f;
+      }
+      if (outRep == OrientationArrayMath::QuaternionType)
+      {
+        o[3] = 1.0f;
+      }
+    }
   }
 
   notifyStatusMessage(getHumanLabel(), "Complete");
@@ -134,7 +134,7 @@ class  ConvertOrientations : public AbstractFilter
     ConvertOrientations();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
 
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, EulerAngles)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, Quats)
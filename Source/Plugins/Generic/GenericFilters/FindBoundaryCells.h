@@ -99,7 +99,7 @@ class  FindBoundaryCells : public AbstractFilter
     FindBoundaryCells();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int8_t, BoundaryCells)
 
     void dataCheck();
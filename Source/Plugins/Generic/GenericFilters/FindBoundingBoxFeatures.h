@@ -117,9 +117,9 @@ class  FindBoundingBoxFeatures : public AbstractFilter
     FindBoundingBoxFeatures();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, Phases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Centroids)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, SurfaceFeatures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, Phases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, Centroids)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, SurfaceFeatures)
     DEFINE_CREATED_DATAARRAY_VARIABLE(bool, BiasedFeatures)
 
     void dataCheck();
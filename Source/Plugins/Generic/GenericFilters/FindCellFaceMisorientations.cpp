@@ -0,0 +1,312 @@
+/* ============================================================================
+ * Copyright (c) 2011 Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2011 Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FindCellFaceMisorientations.h"
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "DREAM3DLib/Common/Constants.h"
+#include "DREAM3DLib/DataArrays/IDataArray.h"
+
+#include "Generic/GenericConstants.h"
+
+/**
+ * @brief The FindCellFaceMisorientationsImpl class fills the face misorientations of a range of X rows (a row
+ * being the dims[0] Cells that share a Y and Z index). Each Cell only writes its own 3 values so rows are independent.
+ * Faces that are not compared get 10000, the value the consumers start from, so they never pass a tolerance.
+ */
+class FindCellFaceMisorientationsImpl
+{
+  public:
+    FindCellFaceMisorientationsImpl(float* quats, int32_t* phases, unsigned int* crystalStructures, QVector<OrientationOps::Pointer> ops,
+                                    size_t dims[3], float* faceMisorientations) :
+      m_Quats(quats),
+      m_CellPhases(phases),
+      m_CrystalStructures(crystalStructures),
+      m_OrientationOps(ops),
+      m_FaceMisorientations(faceMisorientations)
+    {
+      m_Dims[0] = dims[0];
+      m_Dims[1] = dims[1];
+      m_Dims[2] = dims[2];
+    }
+    virtual ~FindCellFaceMisorientationsImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
+      size_t strides[3] = { 1, m_Dims[0], m_Dims[0] * m_Dims[1] };
+      QuatF q1;
+      QuatF q2;
+      float n1, n2, n3;
+
+      for (size_t r = start; r < end; r++)
+      {
+        size_t row = r % m_Dims[1];
+        size_t plane = r / m_Dims[1];
+        bool hasNeighbor[3] = { true, row < m_Dims[1] - 1, plane < m_Dims[2] - 1 };
+        size_t rowStart = r * m_Dims[0];
+        for (size_t col = 0; col < m_Dims[0]; col++)
+        {
+          size_t i = rowStart + col;
+          hasNeighbor[0] = (col < m_Dims[0] - 1);
+          int32_t phase = m_CellPhases[i];
+          unsigned int xtal = m_CrystalStructures[phase];
+          for (int d = 0; d < 3; d++)
+          {
+            float w = 10000.0f;
+            if (hasNeighbor[d] == true && xtal < static_cast<unsigned int>(m_OrientationOps.size()))
+            {
+              size_t neighbor = i + strides[d];
+              if (m_CellPhases[neighbor] == phase)
+              {
+                QuaternionMathF::Copy(quats[i], q1);
+                QuaternionMathF::Copy(quats[neighbor], q2);
+                w = m_OrientationOps[xtal]->getMisoQuatFast(q1, q2, n1, n2, n3);
+              }
+            }
+            m_FaceMisorientations[3 * i + d] = w;
+          }
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+  private:
+    float* m_Quats;
+    int32_t* m_CellPhases;
+    unsigned int* m_CrystalStructures;
+    QVector<OrientationOps::Pointer> m_OrientationOps;
+    size_t m_Dims[3];
+    float* m_FaceMisorientations;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FindCellFaceMisorientations::FindCellFaceMisorientations() :
+  AbstractFilter(),
+  m_QuatsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Quats),
+  m_CellPhasesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases),
+  m_CrystalStructuresArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::EnsembleData::CrystalStructures),
+  m_FaceMisorientationsArrayName(DREAM3D::CellData::FaceMisorientations),
+  m_QuatsArrayName(DREAM3D::CellData::Quats),
+  m_Quats(NULL),
+  m_CellPhasesArrayName(DREAM3D::CellData::Phases),
+  m_CellPhases(NULL),
+  m_CrystalStructuresArrayName(DREAM3D::EnsembleData::CrystalStructures),
+  m_CrystalStructures(NULL),
+  m_FaceMisorientations(NULL)
+{
+  m_OrientationOps = OrientationOps::getOrientationOpsQVector();
+
+  setupFilterParameters();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FindCellFaceMisorientations::~FindCellFaceMisorientations()
+{
+}
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindCellFaceMisorientations::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+  parameters.push_back(FilterParameter::New("Required Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
+  parameters.push_back(FilterParameter::New("Quats", "QuatsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getQuatsArrayPath(), true, ""));
+  parameters.push_back(FilterParameter::New("Cell Phases", "CellPhasesArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getCellPhasesArrayPath(), true, ""));
+  parameters.push_back(FilterParameter::New("Crystal Structures", "CrystalStructuresArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getCrystalStructuresArrayPath(), true, ""));
+  parameters.push_back(FilterParameter::New("Created Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
+  parameters.push_back(FilterParameter::New("Face Misorientations", "FaceMisorientationsArrayName", FilterParameterWidgetType::StringWidget, getFaceMisorientationsArrayName(), true, ""));
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+void FindCellFaceMisorientations::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setFaceMisorientationsArrayName(reader->readString("FaceMisorientationsArrayName", getFaceMisorientationsArrayName() ) );
+  setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath() ) );
+  setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath() ) );
+  setQuatsArrayPath(reader->readDataArrayPath("QuatsArrayPath", getQuatsArrayPath() ) );
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FindCellFaceMisorientations::writeFilterParameters(AbstractFilterParametersWriter* writer, int index)
+{
+  writer->openFilterGroup(this, index);
+  DREAM3D_FILTER_WRITE_PARAMETER(FaceMisorientationsArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(CrystalStructuresArrayPath)
+  DREAM3D_FILTER_WRITE_PARAMETER(CellPhasesArrayPath)
+  DREAM3D_FILTER_WRITE_PARAMETER(QuatsArrayPath)
+  writer->closeFilterGroup();
+  return ++index; // we want to return the next index that was just written to
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindCellFaceMisorientations::dataCheck()
+{
+  DataArrayPath tempPath;
+  setErrorCondition(0);
+
+  QVector<size_t> dims(1, 4);
+  m_QuatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getQuatsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+  if( NULL != m_QuatsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+  { m_Quats = m_QuatsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  dims[0] = 1;
+  m_CellPhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getCellPhasesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+  if( NULL != m_CellPhasesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+  { m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  m_CrystalStructuresPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<unsigned int>, AbstractFilter>(this, getCrystalStructuresArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+  if( NULL != m_CrystalStructuresPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+  { m_CrystalStructures = m_CrystalStructuresPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+
+  dims[0] = 3;
+  tempPath.update(getQuatsArrayPath().getDataContainerName(), getQuatsArrayPath().getAttributeMatrixName(), getFaceMisorientationsArrayName() );
+  m_FaceMisorientationsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 10000.0f, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+  if( NULL != m_FaceMisorientationsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+  { m_FaceMisorientations = m_FaceMisorientationsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindCellFaceMisorientations::preflight()
+{
+  setInPreflight(true);
+  emit preflightAboutToExecute();
+  emit updateFilterParameters(this);
+  dataCheck();
+  emit preflightExecuted();
+  setInPreflight(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindCellFaceMisorientations::execute()
+{
+  setErrorCondition(0);
+  dataCheck();
+  if(getErrorCondition() < 0) { return; }
+
+  VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(m_QuatsArrayPath.getDataContainerName());
+  size_t udims[3] = {0, 0, 0};
+  m->getDimensions(udims);
+  size_t totalRows = udims[1] * udims[2];
+  if (udims[0] * totalRows != m_QuatsPtr.lock()->getNumberOfTuples())
+  {
+    setErrorCondition(-10000);
+    notifyErrorMessage(getHumanLabel(), "The number of Quats does not match the dimensions of the volume", getErrorCondition());
+    return;
+  }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalRows),
+                      FindCellFaceMisorientationsImpl(m_Quats, m_CellPhases, m_CrystalStructures, m_OrientationOps, udims, m_FaceMisorientations), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    FindCellFaceMisorientationsImpl serial(m_Quats, m_CellPhases, m_CrystalStructures, m_OrientationOps, udims, m_FaceMisorientations);
+    serial.convert(0, totalRows);
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer FindCellFaceMisorientations::newFilterInstance(bool copyFilterParameters)
+{
+  FindCellFaceMisorientations::Pointer filter = FindCellFaceMisorientations::New();
+  if(true == copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FindCellFaceMisorientations::getCompiledLibraryName()
+{ return Generic::GenericBaseName; }
+
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FindCellFaceMisorientations::getGroupName()
+{ return DREAM3D::FilterGroups::GenericFilters; }
+
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FindCellFaceMisorientations::getSubGroupName()
+{ return DREAM3D::FilterSubGroups::CrystallographyFilters; }
+
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FindCellFaceMisorientations::getHumanLabel()
+{ return "Find Cell Face Misorientations"; }
+
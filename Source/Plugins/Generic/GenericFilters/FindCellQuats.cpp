@@ -36,14 +36,63 @@
 
 #include "FindCellQuats.h"
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/DataArrays/IDataArray.h"
-#include "OrientationLib/Math/OrientationMath.h"
+#include "OrientationLib/Math/OrientationArrayMath.h"
 
 #include "Generic/GenericConstants.h"
 
+class FindFZQuatsImpl
+{
+  public:
+    FindFZQuatsImpl(QuatF* quats, int32_t* phases, unsigned int* crystalStructures, QVector<OrientationOps::Pointer> ops) :
+      m_Quats(quats),
+      m_CellPhases(phases),
+      m_CrystalStructures(crystalStructures),
+      m_OrientationOps(ops)
+    {}
+    virtual ~FindFZQuatsImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      for (size_t i = start; i < end; i++)
+      {
+        unsigned int xtal = m_CrystalStructures[m_CellPhases[i]];
+        if (xtal < static_cast<unsigned int>(m_OrientationOps.size()))
+        {
+          m_OrientationOps[xtal]->getFZQuat(m_Quats[i]);
+        }
+        else
+        {
+          QuaternionMathF::Identity(m_Quats[i]);
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+  private:
+    QuatF* m_Quats;
+    int32_t* m_CellPhases;
+    unsigned int* m_CrystalStructures;
+    QVector<OrientationOps::Pointer> m_OrientationOps;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -53,9 +102,13 @@ FindCellQuats::FindCellQuats() :
   m_CellPhasesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases),
   m_CrystalStructuresArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::EnsembleData::CrystalStructures),
   m_QuatsArrayName(DREAM3D::CellData::Quats),
+  m_CompactQuats(false),
+  m_CreateFZQuats(false),
+  m_FZQuatsArrayName(DREAM3D::CellData::FZQuats),
   m_CellPhasesArrayName(DREAM3D::CellData::Phases),
   m_CellPhases(NULL),
   m_Quats(NULL),
+  m_FZQuats(NULL),
   m_CellEulerAnglesArrayName(DREAM3D::CellData::EulerAngles),
   m_CellEulerAngles(NULL),
   m_CrystalStructuresArrayName(DREAM3D::EnsembleData::CrystalStructures),
@@ -84,6 +137,9 @@ void FindCellQuats::setupFilterParameters()
   parameters.push_back(FilterParameter::New("Crystal Structures", "CrystalStructuresArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getCrystalStructuresArrayPath(), true, ""));
   parameters.push_back(FilterParameter::New("Created Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
   parameters.push_back(FilterParameter::New("Quats", "QuatsArrayName", FilterParameterWidgetType::StringWidget, getQuatsArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("Store Quats As 16 Bit Fixed Point", "CompactQuats", FilterParameterWidgetType::BooleanWidget, getCompactQuats(), false));
+  parameters.push_back(FilterParameter::New("Also Create Fundamental Zone Quats", "CreateFZQuats", FilterParameterWidgetType::BooleanWidget, getCreateFZQuats(), false));
+  parameters.push_back(FilterParameter::New("Fundamental Zone Quats", "FZQuatsArrayName", FilterParameterWidgetType::StringWidget, getFZQuatsArrayName(), true, ""));
   setFilterParameters(parameters);
 }
 
@@ -92,6 +148,9 @@ void FindCellQuats::readFilterParameters(AbstractFilterParametersReader* reader,
 {
   reader->openFilterGroup(this, index);
   setQuatsArrayName(reader->readString("QuatsArrayName", getQuatsArrayName() ) );
+  setCompactQuats(reader->readValue("CompactQuats", getCompactQuats() ) );
+  setCreateFZQuats(reader->readValue("CreateFZQuats", getCreateFZQuats() ) );
+  setFZQuatsArrayName(reader->readString("FZQuatsArrayName", getFZQuatsArrayName() ) );
   setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath() ) );
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath() ) );
   setCellEulerAnglesArrayPath(reader->readDataArrayPath("CellEulerAnglesArrayPath", getCellEulerAnglesArrayPath() ) );
@@ -105,6 +164,9 @@ int FindCellQuats::writeFilterParameters(AbstractFilterParametersWriter* writer,
 {
   writer->openFilterGroup(this, index);
   DREAM3D_FILTER_WRITE_PARAMETER(QuatsArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(CompactQuats)
+  DREAM3D_FILTER_WRITE_PARAMETER(CreateFZQuats)
+  DREAM3D_FILTER_WRITE_PARAMETER(FZQuatsArrayName)
   DREAM3D_FILTER_WRITE_PARAMETER(CrystalStructuresArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(CellPhasesArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(CellEulerAnglesArrayPath)
@@ -121,9 +183,21 @@ void FindCellQuats::dataCheck()
   setErrorCondition(0);
 
   QVector<size_t> dims(1, 3);
-  m_CellEulerAnglesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getCellEulerAnglesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
-  if( NULL != m_CellEulerAnglesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_CellEulerAngles = m_CellEulerAnglesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  // Half precision Euler angles (ReadH5Ebsd) are decoded block by block in execute() instead of being expanded
+  m_CompactCellEulerAnglesPtr.reset();
+  m_CellEulerAnglesPtr.reset();
+  m_CellEulerAngles = NULL;
+  m_CompactCellEulerAnglesPtr = getDataContainerArray()->getExistingPrereqArrayFromPath<QuantizedFloatArray, AbstractFilter>(NULL, getCellEulerAnglesArrayPath());
+  if (NULL != m_CompactCellEulerAnglesPtr.lock().get() && m_CompactCellEulerAnglesPtr.lock()->getNumberOfComponents() != 3)
+  {
+    m_CompactCellEulerAnglesPtr.reset();
+  }
+  if (NULL == m_CompactCellEulerAnglesPtr.lock().get())
+  {
+    m_CellEulerAnglesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getCellEulerAnglesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_CellEulerAnglesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_CellEulerAngles = m_CellEulerAnglesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
   dims[0] = 1;
   m_CellPhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getCellPhasesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_CellPhasesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
@@ -134,7 +208,34 @@ void FindCellQuats::dataCheck()
   { m_CrystalStructures = m_CrystalStructuresPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
 
   dims[0] = 4;
+  m_FZQuatsPtr.reset();
+  m_FZQuats = NULL;
+  if (getCreateFZQuats() == true)
+  {
+    tempPath.update(getCellEulerAnglesArrayPath().getDataContainerName(), getCellEulerAnglesArrayPath().getAttributeMatrixName(), getFZQuatsArrayName() );
+    m_FZQuatsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_FZQuatsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_FZQuats = m_FZQuatsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
+
   tempPath.update(getCellEulerAnglesArrayPath().getDataContainerName(), getCellEulerAnglesArrayPath().getAttributeMatrixName(), getQuatsArrayName() );
+  m_CompactQuatsPtr.reset();
+  if (getCompactQuats() == true)
+  {
+    // Unit quaternion components all lie in [-1, 1] so they keep about 4.5 decimal digits in 16 bit fixed point
+    AttributeMatrix::Pointer cellAttrMat = getDataContainerArray()->getPrereqAttributeMatrixFromPath<VolumeDataContainer, AbstractFilter>(this, tempPath, -301);
+    if(getErrorCondition() < 0) { return; }
+    if (getQuatsArrayName().isEmpty() == true)
+    {
+      setErrorCondition(-10002);
+      notifyErrorMessage(getHumanLabel(), "The name of the Quats array was empty. Please provide a name for this array.", getErrorCondition());
+      return;
+    }
+    QuantizedFloatArray::Pointer quatsPtr = QuantizedFloatArray::CreateArray(cellAttrMat->getNumTuples(), dims, getQuatsArrayName(), QuantizedFloatArray::UnitFixed16, !getInPreflight());
+    cellAttrMat->addAttributeArray(getQuatsArrayName(), quatsPtr);
+    m_CompactQuatsPtr = quatsPtr;
+    return;
+  }
   m_QuatsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_QuatsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
   { m_Quats = m_QuatsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
@@ -162,26 +263,98 @@ void FindCellQuats::execute()
   dataCheck();
   if(getErrorCondition() < 0) { return; }
 
-  int64_t totalPoints = m_CellEulerAnglesPtr.lock()->getNumberOfTuples();
+  QuantizedFloatArray* compactEulers = m_CompactCellEulerAnglesPtr.lock().get();
+  int64_t totalPoints = 0;
+  if (NULL != compactEulers)
+  {
+    // Decode the half precision angles a block at a time so the array keeps its compact storage
+    totalPoints = compactEulers->getNumberOfTuples();
+    const int64_t blockSize = 65536;
+    std::vector<float> eulers(3 * blockSize);
+    for (int64_t start = 0; start < totalPoints; start += blockSize)
+    {
+      int64_t count = std::min(blockSize, totalPoints - start);
+      for (int64_t i = 0; i < count; i++)
+      {
+        compactEulers->getTuple(start + i, &(eulers[3 * i]));
+      }
+      findQuats(&(eulers.front()), start, count);
+    }
+  }
+  else
+  {
+    totalPoints = m_CellEulerAnglesPtr.lock()->getNumberOfTuples();
+    findQuats(m_CellEulerAngles, 0, totalPoints);
+  }
 
-  QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
-  QuatF qr;
-  int phase = -1;
-  for (int i = 0; i < totalPoints; i++)
+  if (NULL != m_FZQuats)
   {
-    phase = m_CellPhases[i];
-    OrientationMath::EulertoQuat( m_CellEulerAngles[3 * i], m_CellEulerAngles[3 * i + 1], m_CellEulerAngles[3 * i + 2], qr);
-    QuaternionMathF::UnitQuaternion(qr);
-    if (m_CrystalStructures[phase] == Ebsd::CrystalStructure::UnknownCrystalStructure)
+    // Reduce every quaternion into the fundamental zone of its Laue class once, so the misorientation
+    // filters that read this array usually take the getMisoQuatFast early out
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+    if (doParallel == true)
     {
-      QuaternionMathF::Identity(qr);
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints),
+                        FindFZQuatsImpl(reinterpret_cast<QuatF*>(m_FZQuats), m_CellPhases, m_CrystalStructures, m_OrientationOps), tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      FindFZQuatsImpl serial(reinterpret_cast<QuatF*>(m_FZQuats), m_CellPhases, m_CrystalStructures, m_OrientationOps);
+      serial.convert(0, totalPoints);
     }
-    QuaternionMathF::Copy(qr, quats[i]);
   }
 
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindCellQuats::findQuats(const float* eulers, int64_t start, int64_t count)
+{
+  QuantizedFloatArray* compactQuats = m_CompactQuatsPtr.lock().get();
+  if (NULL != compactQuats)
+  {
+    // Convert a block at a time into a scratch buffer, then pack it into the fixed point array
+    const int64_t blockSize = 4096;
+    std::vector<float> block(4 * blockSize);
+    for (int64_t offset = 0; offset < count; offset += blockSize)
+    {
+      int64_t blockCount = std::min(blockSize, count - offset);
+      OrientationArrayMath::EulertoQuat(eulers + 3 * offset, &(block.front()), blockCount);
+      for (int64_t i = 0; i < blockCount; i++)
+      {
+        float* qr = &(block[4 * i]);
+        if (m_CrystalStructures[m_CellPhases[start + offset + i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
+        {
+          qr[0] = 0.0f, qr[1] = 0.0f, qr[2] = 0.0f, qr[3] = 1.0f;
+        }
+        compactQuats->setTuple(start + offset + i, qr);
+      }
+    }
+  }
+  else
+  {
+    OrientationArrayMath::Convert(OrientationArrayMath::EulerType, eulers, OrientationArrayMath::QuaternionType, m_Quats + 4 * start, count);
+    QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
+    for (int64_t i = start; i < start + count; i++)
+    {
+      if (m_CrystalStructures[m_CellPhases[i]] == Ebsd::CrystalStructure::UnknownCrystalStructure)
+      {
+        QuaternionMathF::Identity(quats[i]);
+      }
+    }
+  }
+
+  if (NULL != m_FZQuats)
+  {
+    OrientationArrayMath::Convert(OrientationArrayMath::EulerType, eulers, OrientationArrayMath::QuaternionType, m_FZQuats + 4 * start, count);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
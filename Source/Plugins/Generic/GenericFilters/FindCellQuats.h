@@ -42,6 +42,7 @@
 #include "DREAM3DLib/DREAM3DLib.h"
 #include "DREAM3DLib/Common/DREAM3DSetGetMacros.h"
 #include "DREAM3DLib/DataArrays/IDataArray.h"
+#include "DREAM3DLib/DataArrays/QuantizedFloatArray.hpp"
 #include "DREAM3DLib/Common/Constants.h"
 
 #include "DREAM3DLib/Common/AbstractFilter.h"
@@ -73,6 +74,15 @@ class  FindCellQuats : public AbstractFilter
     DREAM3D_FILTER_PARAMETER(QString, QuatsArrayName)
     Q_PROPERTY(QString QuatsArrayName READ getQuatsArrayName WRITE setQuatsArrayName)
 
+    DREAM3D_FILTER_PARAMETER(bool, CompactQuats)
+    Q_PROPERTY(bool CompactQuats READ getCompactQuats WRITE setCompactQuats)
+
+    DREAM3D_FILTER_PARAMETER(bool, CreateFZQuats)
+    Q_PROPERTY(bool CreateFZQuats READ getCreateFZQuats WRITE setCreateFZQuats)
+
+    DREAM3D_FILTER_PARAMETER(QString, FZQuatsArrayName)
+    Q_PROPERTY(QString FZQuatsArrayName READ getFZQuatsArrayName WRITE setFZQuatsArrayName)
+
     virtual const QString getCompiledLibraryName();
     virtual AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters);
     virtual const QString getGroupName();
@@ -112,13 +122,22 @@ class  FindCellQuats : public AbstractFilter
   private:
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, Quats)
+    QuantizedFloatArray::WeakPointer m_CompactQuatsPtr;
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, FZQuats)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, CellEulerAngles)
+    QuantizedFloatArray::WeakPointer m_CompactCellEulerAnglesPtr;
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
 
     QVector<OrientationOps::Pointer> m_OrientationOps;
 
     void dataCheck();
 
+    /**
+     * @brief Fills the created arrays for the Cells [start, start + count) from their Euler angles
+     * @param eulers The Euler angles of those Cells
+     */
+    void findQuats(const float* eulers, int64_t start, int64_t count);
+
     FindCellQuats(const FindCellQuats&); // Copy Constructor Not Implemented
     void operator=(const FindCellQuats&); // Operator '=' Not Implemented
 
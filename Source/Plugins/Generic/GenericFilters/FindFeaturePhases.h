@@ -108,8 +108,8 @@ class  FindFeaturePhases : public AbstractFilter
     FindFeaturePhases();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
 
     void dataCheck();
@@ -112,7 +112,7 @@ class  FindSurfaceFeatures : public AbstractFilter
     void find_surfacefeatures2D();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(bool, SurfaceFeatures)
 
     void dataCheck();
@@ -134,8 +134,8 @@ class  GenerateVectorColors : public AbstractFilter
     void dataCheck();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Vectors)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, GoodVoxels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, Vectors)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, GoodVoxels)
     DEFINE_CREATED_DATAARRAY_VARIABLE(uint8_t, CellVectorColors)
 
     GenerateVectorColors(const GenerateVectorColors&); // Copy Constructor Not Implemented
@@ -15,6 +15,7 @@ START_FILTER_GROUP(${Generic_BINARY_DIR} "${_filterGroupName}" "Generic")
 set(_PublicFilters
 FindBoundaryCells
 FindBoundingBoxFeatures
+FindCellFaceMisorientations
 FindCellQuats
 FindFeatureCentroids
 FindFeaturePhases
@@ -0,0 +1,409 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/Constants.h"
+#include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
+#include "DREAM3DLib/DataContainers/DataContainerArray.h"
+#include "DREAM3DLib/DataContainers/VolumeDataContainer.h"
+#include "DREAM3DLib/DataContainers/AttributeMatrix.h"
+#include "DREAM3DLib/DataArrays/DataArray.hpp"
+#include "DREAM3DLib/Math/QuaternionMath.hpp"
+
+#include "EbsdLib/EbsdConstants.h"
+
+#include "OrientationLib/OrientationOps/OrientationOps.h"
+
+#include "Generic/GenericFilters/FindCellFaceMisorientations.h"
+#include "Reconstruction/ReconstructionFilters/EBSDSegmentFeatures.h"
+#include "Processing/ProcessingFilters/BadDataNeighborOrientationCheck.h"
+#include "Processing/ProcessingFilters/NeighborOrientationCorrelation.h"
+
+namespace FaceMisorientationsTest
+{
+  static const float NoFace = 10000.0f;
+  static const int NumOrientations = 6;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float RandomFloat()
+{
+  return static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+}
+
+// -----------------------------------------------------------------------------
+//  Builds a volume of blocks that are 3 x 2 x 3 Cells large, each with one of a
+//  few orientations plus a small perturbation per Cell. The block sizes differ
+//  along X, Y and Z, so reading a face from the wrong direction changes which
+//  Cells are similar. Phase 1 is cubic and phase 2 hexagonal; a few Cells get
+//  phase 0 or phase 3, whose crystal structure is unknown.
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateTestVolume(size_t xPoints, size_t yPoints, size_t zPoints, unsigned int seed)
+{
+  srand(seed);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+
+  VolumeDataContainer::Pointer m = VolumeDataContainer::New(DREAM3D::Defaults::VolumeDataContainerName);
+  m->setDimensions(xPoints, yPoints, zPoints);
+  m->setOrigin(0, 0, 0);
+  m->setResolution(1.0f, 1.0f, 1.0f);
+  dca->addDataContainer(m);
+
+  QVector<size_t> tDims(3, 0);
+  tDims[0] = xPoints;
+  tDims[1] = yPoints;
+  tDims[2] = zPoints;
+  AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  m->addAttributeMatrix(cellAttrMat->getName(), cellAttrMat);
+
+  QVector<size_t> eDims(1, 4);
+  AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New(eDims, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::AttributeMatrixType::CellEnsemble);
+  m->addAttributeMatrix(ensembleAttrMat->getName(), ensembleAttrMat);
+
+  size_t totalPoints = xPoints * yPoints * zPoints;
+  QVector<size_t> cDims(1, 1);
+  Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::Phases, true);
+  BoolArrayType::Pointer goodVoxels = BoolArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::GoodVoxels, true);
+  FloatArrayType::Pointer confidenceIndex = FloatArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::ConfidenceIndex, true);
+  cDims[0] = 4;
+  FloatArrayType::Pointer quats = FloatArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::Quats, true);
+  cDims[0] = 1;
+  UInt32ArrayType::Pointer crystalStructures = UInt32ArrayType::CreateArray(4, cDims, DREAM3D::EnsembleData::CrystalStructures, true);
+  crystalStructures->setValue(0, Ebsd::CrystalStructure::UnknownCrystalStructure);
+  crystalStructures->setValue(1, Ebsd::CrystalStructure::Cubic_High);
+  crystalStructures->setValue(2, Ebsd::CrystalStructure::Hexagonal_High);
+  crystalStructures->setValue(3, Ebsd::CrystalStructure::UnknownCrystalStructure);
+
+  std::vector<QuatF> blockQuats(FaceMisorientationsTest::NumOrientations);
+  for (int i = 0; i < FaceMisorientationsTest::NumOrientations; i++)
+  {
+    blockQuats[i] = QuaternionMathF::New(RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f);
+    QuaternionMathF::UnitQuaternion(blockQuats[i]);
+  }
+
+  QuatF* cellQuats = reinterpret_cast<QuatF*>(quats->getPointer(0));
+  size_t index = 0;
+  for (size_t z = 0; z < zPoints; z++)
+  {
+    for (size_t y = 0; y < yPoints; y++)
+    {
+      for (size_t x = 0; x < xPoints; x++)
+      {
+        int32_t phase = (x + y + z < (xPoints + yPoints + zPoints) / 2) ? 1 : 2;
+        if (rand() % 29 == 0) { phase = 0; }
+        else if (rand() % 31 == 0) { phase = 3; }
+        phases->setValue(index, phase);
+        goodVoxels->setValue(index, (rand() % 4 != 0));
+        confidenceIndex->setValue(index, RandomFloat());
+
+        size_t block = (x / 3 + 2 * (y / 2) + 3 * (z / 3)) % FaceMisorientationsTest::NumOrientations;
+        QuaternionMathF::Copy(blockQuats[block], cellQuats[index]);
+        cellQuats[index].x += 0.03f * (RandomFloat() - 0.5f);
+        cellQuats[index].y += 0.03f * (RandomFloat() - 0.5f);
+        cellQuats[index].z += 0.03f * (RandomFloat() - 0.5f);
+        QuaternionMathF::UnitQuaternion(cellQuats[index]);
+        index++;
+      }
+    }
+  }
+
+  cellAttrMat->addAttributeArray(phases->getName(), phases);
+  cellAttrMat->addAttributeArray(goodVoxels->getName(), goodVoxels);
+  cellAttrMat->addAttributeArray(confidenceIndex->getName(), confidenceIndex);
+  cellAttrMat->addAttributeArray(quats->getName(), quats);
+  ensembleAttrMat->addAttributeArray(crystalStructures->getName(), crystalStructures);
+
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template<typename T>
+typename DataArray<T>::Pointer GetCellArray(DataContainerArray::Pointer dca, const QString& name)
+{
+  AttributeMatrix::Pointer cellAttrMat = dca->getDataContainer(DREAM3D::Defaults::VolumeDataContainerName)->getAttributeMatrix(DREAM3D::Defaults::CellAttributeMatrixName);
+  typename DataArray<T>::Pointer array = cellAttrMat->getAttributeArrayAs<DataArray<T> >(name);
+  DREAM3D_REQUIRE_VALID_POINTER(array.get())
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RunFindCellFaceMisorientations(DataContainerArray::Pointer dca, const QString& arrayName)
+{
+  FindCellFaceMisorientations::Pointer filter = FindCellFaceMisorientations::New();
+  filter->setDataContainerArray(dca);
+  filter->setFaceMisorientationsArrayName(arrayName);
+  filter->execute();
+  DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+}
+
+// -----------------------------------------------------------------------------
+//  Every face must hold the misorientation of the two Cells that share it, or
+//  the "no face" value, which has to fail any tolerance.
+// -----------------------------------------------------------------------------
+void CheckFaceValues(size_t xPoints, size_t yPoints, size_t zPoints)
+{
+  DataContainerArray::Pointer dca = CreateTestVolume(xPoints, yPoints, zPoints, 4321);
+  RunFindCellFaceMisorientations(dca, DREAM3D::CellData::FaceMisorientations);
+
+  FloatArrayType::Pointer faces = GetCellArray<float>(dca, DREAM3D::CellData::FaceMisorientations);
+  Int32ArrayType::Pointer phases = GetCellArray<int32_t>(dca, DREAM3D::CellData::Phases);
+  FloatArrayType::Pointer quats = GetCellArray<float>(dca, DREAM3D::CellData::Quats);
+  DREAM3D_REQUIRE_EQUAL(faces->getNumberOfComponents(), 3)
+
+  QVector<OrientationOps::Pointer> ops = OrientationOps::getOrientationOpsQVector();
+  unsigned int crystalStructures[4] = { Ebsd::CrystalStructure::UnknownCrystalStructure, Ebsd::CrystalStructure::Cubic_High,
+                                        Ebsd::CrystalStructure::Hexagonal_High, Ebsd::CrystalStructure::UnknownCrystalStructure
+                                      };
+  QuatF* cellQuats = reinterpret_cast<QuatF*>(quats->getPointer(0));
+  size_t dims[3] = { xPoints, yPoints, zPoints };
+  size_t strides[3] = { 1, xPoints, xPoints * yPoints };
+  QuatF q1;
+  QuatF q2;
+  float n1, n2, n3;
+  size_t compared = 0;
+
+  size_t index = 0;
+  for (size_t z = 0; z < zPoints; z++)
+  {
+    for (size_t y = 0; y < yPoints; y++)
+    {
+      for (size_t x = 0; x < xPoints; x++)
+      {
+        size_t position[3] = { x, y, z };
+        for (int d = 0; d < 3; d++)
+        {
+          float expected = FaceMisorientationsTest::NoFace;
+          if (position[d] < dims[d] - 1)
+          {
+            size_t neighbor = index + strides[d];
+            int32_t phase = phases->getValue(index);
+            unsigned int xtal = crystalStructures[phase];
+            if (phases->getValue(neighbor) == phase && xtal < static_cast<unsigned int>(ops.size()))
+            {
+              QuaternionMathF::Copy(cellQuats[index], q1);
+              QuaternionMathF::Copy(cellQuats[neighbor], q2);
+              expected = ops[xtal]->getMisoQuatFast(q1, q2, n1, n2, n3);
+              compared++;
+            }
+          }
+          DREAM3D_REQUIRE_EQUAL(faces->getComponent(index, d), expected)
+          DREAM3D_REQUIRE(faces->getComponent(index, d) >= 0.0f)
+        }
+        index++;
+      }
+    }
+  }
+  DREAM3D_REQUIRE(compared > 0)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestFaceValues()
+{
+  CheckFaceValues(11, 9, 7);
+  CheckFaceValues(13, 10, 1);
+  CheckFaceValues(13, 1, 10);
+  CheckFaceValues(1, 13, 10);
+}
+
+// -----------------------------------------------------------------------------
+//  Segments the same volume with and without the precomputed faces. The seeds
+//  are random so the ids themselves differ; the Features must map one to one.
+// -----------------------------------------------------------------------------
+void CheckSegmentFeatures(size_t xPoints, size_t yPoints, size_t zPoints)
+{
+  Int32ArrayType::Pointer featureIds[2];
+  for (int run = 0; run < 2; run++)
+  {
+    DataContainerArray::Pointer dca = CreateTestVolume(xPoints, yPoints, zPoints, 1234);
+    if (run == 1) { RunFindCellFaceMisorientations(dca, DREAM3D::CellData::FaceMisorientations); }
+
+    EBSDSegmentFeatures::Pointer segment = EBSDSegmentFeatures::New();
+    segment->setDataContainerArray(dca);
+    segment->setUseGoodVoxels(false);
+    segment->setRandomizeFeatureIds(false);
+    segment->setUseFaceMisorientations(run == 1);
+    segment->execute();
+    DREAM3D_REQUIRE_EQUAL(segment->getErrorCondition(), 0)
+    featureIds[run] = GetCellArray<int32_t>(dca, DREAM3D::CellData::FeatureIds);
+  }
+
+  size_t totalPoints = featureIds[0]->getNumberOfTuples();
+  int32_t maxId = 0;
+  for (size_t i = 0; i < totalPoints; i++)
+  {
+    if (featureIds[0]->getValue(i) > maxId) { maxId = featureIds[0]->getValue(i); }
+    if (featureIds[1]->getValue(i) > maxId) { maxId = featureIds[1]->getValue(i); }
+  }
+  std::vector<int32_t> forward(maxId + 1, -1);
+  std::vector<int32_t> backward(maxId + 1, -1);
+  for (size_t i = 0; i < totalPoints; i++)
+  {
+    int32_t a = featureIds[0]->getValue(i);
+    int32_t b = featureIds[1]->getValue(i);
+    if (forward[a] == -1) { forward[a] = b; }
+    if (backward[b] == -1) { backward[b] = a; }
+    DREAM3D_REQUIRE_EQUAL(forward[a], b)
+    DREAM3D_REQUIRE_EQUAL(backward[b], a)
+  }
+  // The blocks have to be split into several Features, and most of them span more than one Cell
+  DREAM3D_REQUIRE(maxId > 2)
+  DREAM3D_REQUIRE(static_cast<size_t>(maxId) < totalPoints / 2)
+}
+
+// -----------------------------------------------------------------------------
+//  The flat volumes have two equal strides, which the face lookup has to tell apart.
+// -----------------------------------------------------------------------------
+void TestSegmentFeaturesFaceLookup()
+{
+  CheckSegmentFeatures(11, 9, 7);
+  CheckSegmentFeatures(13, 10, 1);
+  CheckSegmentFeatures(13, 1, 10);
+  CheckSegmentFeatures(1, 13, 10);
+  CheckSegmentFeatures(1, 1, 40);
+}
+
+// -----------------------------------------------------------------------------
+//  Runs the bad data check with and without the precomputed faces on the same volume.
+// -----------------------------------------------------------------------------
+void CheckBadDataNeighborOrientation(size_t xPoints, size_t yPoints, size_t zPoints)
+{
+  BoolArrayType::Pointer goodVoxels[2];
+  for (int run = 0; run < 2; run++)
+  {
+    DataContainerArray::Pointer dca = CreateTestVolume(xPoints, yPoints, zPoints, 5678);
+    if (run == 1) { RunFindCellFaceMisorientations(dca, DREAM3D::CellData::FaceMisorientations); }
+
+    BadDataNeighborOrientationCheck::Pointer badData = BadDataNeighborOrientationCheck::New();
+    badData->setDataContainerArray(dca);
+    badData->setNumberOfNeighbors(1);
+    badData->setUseFaceMisorientations(run == 1);
+    badData->execute();
+    DREAM3D_REQUIRE_EQUAL(badData->getErrorCondition(), 0)
+    goodVoxels[run] = GetCellArray<bool>(dca, DREAM3D::CellData::GoodVoxels);
+  }
+
+  DataContainerArray::Pointer original = CreateTestVolume(xPoints, yPoints, zPoints, 5678);
+  BoolArrayType::Pointer originalGoodVoxels = GetCellArray<bool>(original, DREAM3D::CellData::GoodVoxels);
+  size_t flipped = 0;
+  size_t totalPoints = goodVoxels[0]->getNumberOfTuples();
+  for (size_t i = 0; i < totalPoints; i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(goodVoxels[0]->getValue(i), goodVoxels[1]->getValue(i))
+    if (goodVoxels[0]->getValue(i) != originalGoodVoxels->getValue(i)) { flipped++; }
+  }
+  DREAM3D_REQUIRE(flipped > 0)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestBadDataFaceLookup()
+{
+  CheckBadDataNeighborOrientation(11, 9, 7);
+  CheckBadDataNeighborOrientation(13, 10, 1);
+  CheckBadDataNeighborOrientation(13, 1, 10);
+  CheckBadDataNeighborOrientation(1, 13, 10);
+}
+
+// -----------------------------------------------------------------------------
+//  Neighbor Orientation Correlation copies Cells into each other. Afterwards the
+//  face array has to match one computed from scratch on the cleaned up data.
+// -----------------------------------------------------------------------------
+void TestNeighborOrientationCorrelationUpdatesFaces()
+{
+  DataContainerArray::Pointer dca = CreateTestVolume(11, 9, 7, 8765);
+  RunFindCellFaceMisorientations(dca, DREAM3D::CellData::FaceMisorientations);
+  FloatArrayType::Pointer quats = GetCellArray<float>(dca, DREAM3D::CellData::Quats);
+  std::vector<float> quatsBefore(quats->getPointer(0), quats->getPointer(0) + quats->getSize());
+
+  NeighborOrientationCorrelation::Pointer correlation = NeighborOrientationCorrelation::New();
+  correlation->setDataContainerArray(dca);
+  correlation->setMinConfidence(0.2f);
+  correlation->setLevel(2);
+  correlation->execute();
+  DREAM3D_REQUIRE_EQUAL(correlation->getErrorCondition(), 0)
+
+  size_t changed = 0;
+  for (size_t i = 0; i < quatsBefore.size(); i++)
+  {
+    if (quats->getValue(i) != quatsBefore[i]) { changed++; }
+  }
+  DREAM3D_REQUIRE(changed > 0)
+
+  RunFindCellFaceMisorientations(dca, "RecomputedFaceMisorientations");
+  FloatArrayType::Pointer faces = GetCellArray<float>(dca, DREAM3D::CellData::FaceMisorientations);
+  FloatArrayType::Pointer recomputed = GetCellArray<float>(dca, "RecomputedFaceMisorientations");
+  for (size_t i = 0; i < faces->getSize(); i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(faces->getValue(i), recomputed->getValue(i))
+  }
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  // Instantiate the QCoreApplication that we need to get the current path and load plugins.
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("FindCellFaceMisorientationsTest");
+
+  int err = EXIT_SUCCESS;
+
+  DREAM3D_REGISTER_TEST( TestFaceValues() )
+  DREAM3D_REGISTER_TEST( TestSegmentFeaturesFaceLookup() )
+  DREAM3D_REGISTER_TEST( TestBadDataFaceLookup() )
+  DREAM3D_REGISTER_TEST( TestNeighborOrientationCorrelationUpdatesFaces() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
@@ -102,7 +102,7 @@ class  DxWriter : public FileWriter
     virtual int writeFile();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
 
     void dataCheck();
 
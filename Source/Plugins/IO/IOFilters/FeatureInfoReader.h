@@ -128,7 +128,7 @@ class  FeatureInfoReader : public FileReader
     void updateFeatureInstancePointers();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, CellEulerAngles)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
@@ -148,8 +148,8 @@ class GBCDTriangleDumper : public AbstractFilter
     void dataCheckVoxel();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(double, SurfaceMeshFaceAreas)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(double, SurfaceMeshFaceAreas)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(double, SurfaceMeshFaceNormals)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, FeatureEulerAngles)
 
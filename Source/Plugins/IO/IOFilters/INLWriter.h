@@ -115,11 +115,11 @@ class  INLWriter : public FileWriter
     virtual int writeFile();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, CellEulerAngles)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, CellEulerAngles)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, NumFeatures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, NumFeatures)
     StringDataArray::Pointer m_MaterialNames;
 
     void dataCheck();
@@ -107,9 +107,9 @@ class  LosAlamosFFTWriter : public FileWriter
     virtual int writeFile();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, CellEulerAngles)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, CellEulerAngles)
     //unsigned int* m_CrystalStructures;
     //StringDataArray::Pointer m_MaterialNames;
 
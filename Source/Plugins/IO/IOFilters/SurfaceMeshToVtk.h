@@ -145,7 +145,7 @@ class  SurfaceMeshToVtk : public AbstractFilter
 
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int8_t, SurfaceMeshNodeType)
 
     SurfaceMeshToVtk(const SurfaceMeshToVtk&); // Copy Constructor Not Implemented
@@ -204,7 +204,7 @@ void VisualizeGBCDPoleFigure::dataCheckSurfaceMesh()
       iDataArray->NullPointer();
       m_GBCDPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<double>, AbstractFilter>(this, getGBCDArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
       if( NULL != m_GBCDPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-      { m_GBCD = m_GBCDPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+      { m_GBCD = m_GBCDPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
     }
   }
 }
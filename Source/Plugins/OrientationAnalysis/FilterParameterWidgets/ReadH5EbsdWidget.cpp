@@ -172,6 +172,10 @@ void ReadH5EbsdWidget::setupGui()
   m_InputFile->setText( m_Filter->getInputFile() );
   m_ZStartIndex->setValue( m_Filter->getZStartIndex() );
   m_ZEndIndex->setValue( m_Filter->getZEndIndex() );
+  m_XStartIndex->setValue( m_Filter->getXStartIndex() );
+  m_XEndIndex->setValue( m_Filter->getXEndIndex() );
+  m_YStartIndex->setValue( m_Filter->getYStartIndex() );
+  m_YEndIndex->setValue( m_Filter->getYEndIndex() );
   m_UseTransformations->setChecked( m_Filter->getUseTransformations() );
   m_RefFrameZDir->setText( Ebsd::StackingOrder::Utils::getStringForEnum( m_Filter->getRefFrameZDir() )  );
   updateFileInfoWidgets();
@@ -361,6 +365,10 @@ void ReadH5EbsdWidget::filterNeedsInputParameters(AbstractFilter* filter)
   readEbsd->setInputFile(m_InputFile->text() );
   readEbsd->setZStartIndex(m_ZStartIndex->text().toLongLong(&ok));
   readEbsd->setZEndIndex(m_ZEndIndex->text().toLongLong(&ok));
+  readEbsd->setXStartIndex(m_XStartIndex->value());
+  readEbsd->setXEndIndex(m_XEndIndex->value());
+  readEbsd->setYStartIndex(m_YStartIndex->value());
+  readEbsd->setYEndIndex(m_YEndIndex->value());
   readEbsd->setUseTransformations(m_UseTransformations->isChecked() );
 
   readEbsd->setSelectedArrayNames(getSelectedArrayNames());
@@ -505,6 +513,14 @@ void ReadH5EbsdWidget::updateFileInfoWidgets()
         m_ZStartIndex->setValue(zStart);
         m_ZEndIndex->setRange(zStart, zEnd);
         m_ZEndIndex->setValue(zEnd);
+        m_XStartIndex->setRange(0, xpoints - 1);
+        m_XStartIndex->setValue(0);
+        m_XEndIndex->setRange(0, xpoints - 1);
+        m_XEndIndex->setValue(xpoints - 1);
+        m_YStartIndex->setRange(0, ypoints - 1);
+        m_YStartIndex->setValue(0);
+        m_YEndIndex->setRange(0, ypoints - 1);
+        m_YEndIndex->setValue(ypoints - 1);
 
       }
       else
@@ -140,11 +140,11 @@ class GenerateEulerColors : public AbstractFilter
     void dataCheck();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, CellEulerAngles)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, CellEulerAngles)
     DEFINE_CREATED_DATAARRAY_VARIABLE(uint8_t, CellEulerColors)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, GoodVoxels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, GoodVoxels)
 
     GenerateEulerColors(const GenerateEulerColors&); // Copy Constructor Not Implemented
     void operator=(const GenerateEulerColors&); // Operator '=' Not Implemented
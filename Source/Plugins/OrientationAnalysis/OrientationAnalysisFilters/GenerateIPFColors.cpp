@@ -35,6 +35,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "GenerateIPFColors.h"
 
+#include <vector>
+
 
 
 #ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
@@ -72,35 +74,60 @@ class GenerateIPFColorsImpl
     void convert(size_t start, size_t end) const
     {
       QVector<OrientationOps::Pointer> ops = OrientationOps::getOrientationOpsQVector();
-      double refDir[3] = {m_ReferenceDir.x, m_ReferenceDir.y, m_ReferenceDir.z};
-      double dEuler[3] = {0.0, 0.0, 0.0};
-      DREAM3D::Rgb argb = 0x00000000;
+      float refDir[3] = {m_ReferenceDir.x, m_ReferenceDir.y, m_ReferenceDir.z};
       bool missingGoodVoxels = false;
       if(NULL == m_GoodVoxels)
       {
         missingGoodVoxels = true;
       }
+
+      // The voxels are colored a block at a time. Each block is sorted by Laue class so that every class colors its
+      // voxels in one batch from contiguous Euler Angles.
+      std::vector<std::vector<size_t> > voxels(ops.size());
+      std::vector<float> eulers(k_BlockSize * 3);
+      std::vector<uint8_t> colors(k_BlockSize * 3);
       int phase = 0;
       size_t index = 0;
-      for (size_t i = start; i < end; i++)
+      for (size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
       {
-        phase = m_CellPhases[i];
-        index = i * 3;
-        m_CellIPFColors[index] = 0;
-        m_CellIPFColors[index + 1] = 0;
-        m_CellIPFColors[index + 2] = 0;
-        dEuler[0] = m_CellEulerAngles[index];
-        dEuler[1] = m_CellEulerAngles[index + 1];
-        dEuler[2] = m_CellEulerAngles[index + 2];
-
-        // Make sure we are using a valid Euler Angles with valid crystal symmetry
-        if( (missingGoodVoxels == true || m_GoodVoxels[i] == true)
-            && m_CrystalStructures[phase] < Ebsd::CrystalStructure::LaueGroupEnd )
+        size_t blockEnd = blockStart + k_BlockSize;
+        if (blockEnd > end) { blockEnd = end; }
+        for (size_t i = blockStart; i < blockEnd; i++)
+        {
+          phase = m_CellPhases[i];
+          index = i * 3;
+          m_CellIPFColors[index] = 0;
+          m_CellIPFColors[index + 1] = 0;
+          m_CellIPFColors[index + 2] = 0;
+
+          // Make sure we are using a valid Euler Angles with valid crystal symmetry
+          if( (missingGoodVoxels == true || m_GoodVoxels[i] == true)
+              && m_CrystalStructures[phase] < Ebsd::CrystalStructure::LaueGroupEnd )
+          {
+            voxels[m_CrystalStructures[phase]].push_back(i);
+          }
+        }
+
+        for (size_t xtal = 0; xtal < voxels.size(); xtal++)
         {
-          argb = ops[m_CrystalStructures[phase]]->generateIPFColor(dEuler, refDir, false);
-          m_CellIPFColors[index] = RgbColor::dRed(argb);
-          m_CellIPFColors[index + 1] = RgbColor::dGreen(argb);
-          m_CellIPFColors[index + 2] = RgbColor::dBlue(argb);
+          size_t count = voxels[xtal].size();
+          if (count == 0) { continue; }
+          for (size_t v = 0; v < count; v++)
+          {
+            index = voxels[xtal][v] * 3;
+            eulers[v * 3] = m_CellEulerAngles[index];
+            eulers[v * 3 + 1] = m_CellEulerAngles[index + 1];
+            eulers[v * 3 + 2] = m_CellEulerAngles[index + 2];
+          }
+          ops[xtal]->generateIPFColors(&(eulers.front()), refDir, 0, count, &(colors.front()));
+          for (size_t v = 0; v < count; v++)
+          {
+            index = voxels[xtal][v] * 3;
+            m_CellIPFColors[index] = colors[v * 3];
+            m_CellIPFColors[index + 1] = colors[v * 3 + 1];
+            m_CellIPFColors[index + 2] = colors[v * 3 + 2];
+          }
+          voxels[xtal].clear();
         }
       }
     }
@@ -112,6 +139,8 @@ class GenerateIPFColorsImpl
     }
 #endif
   private:
+    static const size_t k_BlockSize = 4096;
+
     FloatVec3_t  m_ReferenceDir;
     float* m_CellEulerAngles;
     int32_t* m_CellPhases;
@@ -32,6 +32,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "GenerateMisorientationColors.h"
 
+#include <vector>
+
 
 #ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
 #include <tbb/parallel_for.h>
@@ -72,47 +74,67 @@ class GenerateMisorientationColorsImpl
       QVector<OrientationOps::Pointer> ops = OrientationOps::getOrientationOpsQVector();
 
       QuatF refQuat = {m_ReferenceAxis.x * sinf(m_ReferenceAngle), m_ReferenceAxis.y * sinf(m_ReferenceAngle), m_ReferenceAxis.z * sinf(m_ReferenceAngle), cosf(m_ReferenceAngle)};
-      QuatF cellQuat = {0.0f, 0.0f, 0.0f, 1.0f};
-      DREAM3D::Rgb argb = 0x00000000;
 
       bool missingGoodVoxels = false;
       if(NULL == m_GoodVoxels)
       {
         missingGoodVoxels = true;
       }
+
+      // The voxels are colored a block at a time. Each block is sorted by Laue class so that every class colors its
+      // voxels in one batch from contiguous quaternions.
+      std::vector<std::vector<size_t> > voxels(ops.size());
+      std::vector<QuatF> quats(k_BlockSize);
+      std::vector<uint8_t> colors(k_BlockSize * 3);
       int phase = 0;
       size_t index = 0;
-      for (size_t i = start; i < end; i++)
+      for (size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
       {
-        phase = m_CellPhases[i];
-        index = i * 3;
-        m_MisorientationColor[index] = 0;
-        m_MisorientationColor[index + 1] = 0;
-        m_MisorientationColor[index + 2] = 0;
-        cellQuat = m_Quats[i];
-
-        if(m_CrystalStructures[phase] != Ebsd::CrystalStructure::Cubic_High &&
-            m_CrystalStructures[phase] != Ebsd::CrystalStructure::Hexagonal_High)
+        size_t blockEnd = blockStart + k_BlockSize;
+        if (blockEnd > end) { blockEnd = end; }
+        for (size_t i = blockStart; i < blockEnd; i++)
         {
-          uint32_t idx = m_CrystalStructures[phase];
-          if(idx == Ebsd::CrystalStructure::UnknownCrystalStructure)
-          {
-            idx = 12;
-          }
-          m_NotSupported[idx] = 1;
+          phase = m_CellPhases[i];
+          index = i * 3;
           m_MisorientationColor[index] = 0;
           m_MisorientationColor[index + 1] = 0;
           m_MisorientationColor[index + 2] = 0;
 
+          if(m_CrystalStructures[phase] != Ebsd::CrystalStructure::Cubic_High &&
+              m_CrystalStructures[phase] != Ebsd::CrystalStructure::Hexagonal_High)
+          {
+            uint32_t idx = m_CrystalStructures[phase];
+            if(idx == Ebsd::CrystalStructure::UnknownCrystalStructure)
+            {
+              idx = 12;
+            }
+            m_NotSupported[idx] = 1;
+          }
+          // Make sure we are using a valid Euler Angles with valid crystal symmetry
+          else if( (missingGoodVoxels == true || m_GoodVoxels[i] == true)
+                   && m_CrystalStructures[phase] < Ebsd::CrystalStructure::LaueGroupEnd )
+          {
+            voxels[m_CrystalStructures[phase]].push_back(i);
+          }
         }
-        // Make sure we are using a valid Euler Angles with valid crystal symmetry
-        else if( (missingGoodVoxels == true || m_GoodVoxels[i] == true)
-                 && m_CrystalStructures[phase] < Ebsd::CrystalStructure::LaueGroupEnd )
+
+        for (size_t xtal = 0; xtal < voxels.size(); xtal++)
         {
-          argb = ops[m_CrystalStructures[phase]]->generateMisorientationColor(cellQuat, refQuat);
-          m_MisorientationColor[index] = RgbColor::dRed(argb);
-          m_MisorientationColor[index + 1] = RgbColor::dGreen(argb);
-          m_MisorientationColor[index + 2] = RgbColor::dBlue(argb);
+          size_t count = voxels[xtal].size();
+          if (count == 0) { continue; }
+          for (size_t v = 0; v < count; v++)
+          {
+            quats[v] = m_Quats[voxels[xtal][v]];
+          }
+          ops[xtal]->generateMisorientationColors(&(quats.front()), &refQuat, 0, count, &(colors.front()));
+          for (size_t v = 0; v < count; v++)
+          {
+            index = voxels[xtal][v] * 3;
+            m_MisorientationColor[index] = colors[v * 3];
+            m_MisorientationColor[index + 1] = colors[v * 3 + 1];
+            m_MisorientationColor[index + 2] = colors[v * 3 + 2];
+          }
+          voxels[xtal].clear();
         }
       }
     }
@@ -124,6 +146,8 @@ class GenerateMisorientationColorsImpl
     }
 #endif
   private:
+    static const size_t k_BlockSize = 4096;
+
     FloatVec3_t  m_ReferenceAxis;
     float m_ReferenceAngle;
     QuatF* m_Quats;
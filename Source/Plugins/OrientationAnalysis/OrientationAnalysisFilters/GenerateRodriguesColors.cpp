@@ -35,6 +35,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "GenerateRodriguesColors.h"
 
+#include <vector>
+
 
 
 #include "DREAM3DLib/Math/MatrixMath.h"
@@ -149,7 +151,7 @@ void GenerateRodriguesColors::dataCheck()
   QVector<size_t> dims(1, 1);
   m_CellPhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getCellPhasesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_CellPhasesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_CellPhases = m_CellPhasesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   //typedef DataArray<unsigned int> XTalStructArrayType;
   m_CrystalStructuresPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<unsigned int>, AbstractFilter>(this, getCrystalStructuresArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_CrystalStructuresPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
@@ -158,7 +160,7 @@ void GenerateRodriguesColors::dataCheck()
   dims[0] = 3;
   m_CellEulerAnglesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getCellEulerAnglesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_CellEulerAnglesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_CellEulerAngles = m_CellEulerAnglesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_CellEulerAngles = m_CellEulerAnglesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   tempPath.update(m_CellEulerAnglesArrayPath.getDataContainerName(), m_CellEulerAnglesArrayPath.getAttributeMatrixName(), getCellRodriguesColorsArrayName() );
   m_CellRodriguesColorsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint8_t>, AbstractFilter, uint8_t>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_CellRodriguesColorsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
@@ -171,7 +173,7 @@ void GenerateRodriguesColors::dataCheck()
     dims[0] = 1;
     m_GoodVoxelsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getGoodVoxelsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
     if( NULL != m_GoodVoxelsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-    { m_GoodVoxels = m_GoodVoxelsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    { m_GoodVoxels = m_GoodVoxelsPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   }
   else
   {
@@ -228,27 +230,53 @@ void GenerateRodriguesColors::execute()
 
   int phase;
   size_t index = 0;
-  float r1, r2, r3;
-  DREAM3D::Rgb argb = 0x00000000;
 
-  // Write the IPF Coloring Cell Data
-  for (int64_t i = 0; i < totalPoints; i++)
+  // Write the Rodrigues Coloring Cell Data a block at a time. Each block is sorted by Laue class so that every class
+  // colors its voxels in one batch from contiguous Euler Angles.
+  const size_t blockSize = 4096;
+  std::vector<std::vector<size_t> > voxels(ops.size());
+  std::vector<float> eulers(blockSize * 3);
+  std::vector<uint8_t> colors(blockSize * 3);
+  for (size_t blockStart = 0; blockStart < static_cast<size_t>(totalPoints); blockStart += blockSize)
   {
-    phase = m_CellPhases[i];
-    index = i * 3;
-    m_CellRodriguesColors[index] = 0;
-    m_CellRodriguesColors[index + 1] = 0;
-    m_CellRodriguesColors[index + 2] = 0;
-
-    // Make sure we are using a valid Euler Angles with valid crystal symmetry
-    if( (missingGoodVoxels == true || m_GoodVoxels[i] == true)
-        && m_CrystalStructures[phase] < Ebsd::CrystalStructure::LaueGroupEnd )
+    size_t blockEnd = blockStart + blockSize;
+    if (blockEnd > static_cast<size_t>(totalPoints)) { blockEnd = totalPoints; }
+    for (size_t i = blockStart; i < blockEnd; i++)
+    {
+      phase = m_CellPhases[i];
+      index = i * 3;
+      m_CellRodriguesColors[index] = 0;
+      m_CellRodriguesColors[index + 1] = 0;
+      m_CellRodriguesColors[index + 2] = 0;
+
+      // Make sure we are using a valid Euler Angles with valid crystal symmetry
+      if( (missingGoodVoxels == true || m_GoodVoxels[i] == true)
+          && m_CrystalStructures[phase] < Ebsd::CrystalStructure::LaueGroupEnd )
+      {
+        voxels[m_CrystalStructures[phase]].push_back(i);
+      }
+    }
+
+    for (size_t xtal = 0; xtal < voxels.size(); xtal++)
     {
-      OrientationMath::EulertoRod(m_CellEulerAngles[index], m_CellEulerAngles[index + 1], m_CellEulerAngles[index + 2], r1, r2, r3);
-      argb = ops[m_CrystalStructures[phase]]->generateRodriguesColor(r1, r2, r3);
-      m_CellRodriguesColors[index] = RgbColor::dRed(argb);
-      m_CellRodriguesColors[index + 1] = RgbColor::dGreen(argb);
-      m_CellRodriguesColors[index + 2] = RgbColor::dBlue(argb);
+      size_t count = voxels[xtal].size();
+      if (count == 0) { continue; }
+      for (size_t v = 0; v < count; v++)
+      {
+        index = voxels[xtal][v] * 3;
+        eulers[v * 3] = m_CellEulerAngles[index];
+        eulers[v * 3 + 1] = m_CellEulerAngles[index + 1];
+        eulers[v * 3 + 2] = m_CellEulerAngles[index + 2];
+      }
+      ops[xtal]->generateRodriguesColors(&(eulers.front()), count, &(colors.front()));
+      for (size_t v = 0; v < count; v++)
+      {
+        index = voxels[xtal][v] * 3;
+        m_CellRodriguesColors[index] = colors[v * 3];
+        m_CellRodriguesColors[index + 1] = colors[v * 3 + 1];
+        m_CellRodriguesColors[index + 2] = colors[v * 3 + 2];
+      }
+      voxels[xtal].clear();
     }
   }
 
@@ -42,6 +42,13 @@
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
 
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "EbsdLib/H5EbsdVolumeInfo.h"
 #include "EbsdLib/TSL/AngFields.h"
 #include "EbsdLib/HKL/CtfFields.h"
@@ -52,9 +59,14 @@
 #include "EbsdLib/HEDM/H5MicVolumeReader.h"
 
 #include "DREAM3DLib/Common/Constants.h"
+#include "DREAM3DLib/DataArrays/QuantizedFloatArray.hpp"
 #include "DREAM3DLib/Utilities/DREAM3DRandom.h"
 #include "DREAM3DLib/Common/FilterManager.h"
 #include "DREAM3DLib/Common/IFilterFactory.hpp"
+#include "DREAM3DLib/Common/PerformanceMonitor.h"
+#include "DREAM3DLib/Math/DREAM3DMath.h"
+#include "DREAM3DLib/Math/MatrixMath.h"
+#include "OrientationLib/Math/OrientationMath.h"
 
 
 #include "OrientationAnalysis/OrientationAnalysisConstants.h"
@@ -70,6 +82,97 @@
   boost::shared_array<m_msgType> var##Array(new m_msgType[size]);\
   m_msgType* var = var##Array.get();
 
+/**
+ * @brief The ReadH5EbsdEulerImpl class interleaves the Euler angle columns of the reader into the cell
+ * Euler angles while applying the sample remap, the hexagonal offset and the Euler reference frame rotation,
+ * so that none of them needs its own pass over the volume.
+ */
+class ReadH5EbsdEulerImpl
+{
+    float* m_Euler1;
+    float* m_Euler2;
+    float* m_Euler3;
+    float* m_CellEulerAngles;
+    int32_t* m_CellPhases;
+    uint32_t* m_CrystalStructures;
+    bool m_AddHexOffset;
+    float m_RotAngle;
+    AxisAngleInput_t m_RotAxis;
+    int64_t m_Base;
+    int64_t m_Stride[3];
+    size_t m_Dims[3];
+
+  public:
+    ReadH5EbsdEulerImpl(float* f1, float* f2, float* f3, float* cellEulerAngles, int32_t* cellPhases, uint32_t* crystalStructures,
+                        bool addHexOffset, float rotAngle, AxisAngleInput_t rotAxis, int64_t base, int64_t stride[3], size_t dims[3]) :
+      m_Euler1(f1),
+      m_Euler2(f2),
+      m_Euler3(f3),
+      m_CellEulerAngles(cellEulerAngles),
+      m_CellPhases(cellPhases),
+      m_CrystalStructures(crystalStructures),
+      m_AddHexOffset(addHexOffset),
+      m_RotAngle(rotAngle),
+      m_RotAxis(rotAxis),
+      m_Base(base)
+    {
+      for (int i = 0; i < 3; i++)
+      {
+        m_Stride[i] = stride[i];
+        m_Dims[i] = dims[i];
+      }
+    }
+    virtual ~ReadH5EbsdEulerImpl() {}
+
+    void convert(size_t zStart, size_t zEnd) const
+    {
+      float rotMat[3][3];
+      float g[3][3];
+      float gNew[3][3];
+      bool rotate = (m_RotAngle > 0.0f);
+      if (rotate)
+      {
+        OrientationMath::AxisAngletoMat(m_RotAngle * DREAM3D::Constants::k_Pi / 180.0, m_RotAxis.h, m_RotAxis.k, m_RotAxis.l, rotMat);
+      }
+      float ea1 = 0, ea2 = 0, ea3 = 0;
+      for (size_t k = zStart; k < zEnd; k++)
+      {
+        for (size_t j = 0; j < m_Dims[1]; j++)
+        {
+          size_t index = (k * m_Dims[1] + j) * m_Dims[0];
+          int64_t readerIndex = m_Base + static_cast<int64_t>(j) * m_Stride[1] + static_cast<int64_t>(k) * m_Stride[2];
+          for (size_t i = 0; i < m_Dims[0]; i++)
+          {
+            ea1 = m_Euler1[readerIndex];
+            ea2 = m_Euler2[readerIndex];
+            ea3 = m_Euler3[readerIndex];
+            if(m_AddHexOffset && m_CrystalStructures[m_CellPhases[index]] == Ebsd::CrystalStructure::Hexagonal_High)
+            {ea3 = ea3 + (30.0);}
+            if (rotate)
+            {
+              OrientationMath::EulertoMat(ea1, ea2, ea3, g);
+              MatrixMath::Multiply3x3with3x3(g, rotMat, gNew);
+              MatrixMath::Normalize3x3(gNew);
+              OrientationMath::MattoEuler(gNew, ea1, ea2, ea3);
+            }
+            m_CellEulerAngles[3 * index] = ea1;
+            m_CellEulerAngles[3 * index + 1] = ea2;
+            m_CellEulerAngles[3 * index + 2] = ea3;
+            ++index;
+            readerIndex += m_Stride[0];
+          }
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -83,7 +186,12 @@ ReadH5Ebsd::ReadH5Ebsd() :
   m_InputFile(""),
   m_ZStartIndex(0),
   m_ZEndIndex(0),
+  m_XStartIndex(0),
+  m_XEndIndex(-1),
+  m_YStartIndex(0),
+  m_YEndIndex(-1),
   m_UseTransformations(true),
+  m_CompactFloatArrays(false),
   m_RefFrameZDir(Ebsd::RefFrameZDir::UnknownRefFrameZDirection),
   m_Manufacturer(Ebsd::UnknownManufacturer),
   m_CellPhasesArrayName(DREAM3D::CellData::Phases),
@@ -105,6 +213,8 @@ ReadH5Ebsd::ReadH5Ebsd() :
   m_EulerTransformation.k = 0.0f;
   m_EulerTransformation.l = 1.0f;
 
+  m_SampleRemap.Active = false;
+
   setupFilterParameters();
 }
 
@@ -126,6 +236,7 @@ void ReadH5Ebsd::setupFilterParameters()
   parameters.push_back(FilterParameter::New("Data Container Name", "DataContainerName", FilterParameterWidgetType::StringWidget, getDataContainerName(), true, ""));
   parameters.push_back(FilterParameter::New("Cell Attribute Matrix Name", "CellAttributeMatrixName", FilterParameterWidgetType::StringWidget, getCellAttributeMatrixName(), true, ""));
   parameters.push_back(FilterParameter::New("Cell Ensemble Attribute Matrix Name", "CellEnsembleAttributeMatrixName", FilterParameterWidgetType::StringWidget, getCellEnsembleAttributeMatrixName(), true, ""));
+  parameters.push_back(FilterParameter::New("Store Float Arrays As Half Precision", "CompactFloatArrays", FilterParameterWidgetType::BooleanWidget, getCompactFloatArrays(), false));
   setFilterParameters(parameters);
 }
 
@@ -141,7 +252,12 @@ void ReadH5Ebsd::readFilterParameters(AbstractFilterParametersReader* reader, in
   setRefFrameZDir( ( reader->readValue("RefFrameZDir", getRefFrameZDir() ) ) );
   setZStartIndex( reader->readValue("ZStartIndex", getZStartIndex() ) );
   setZEndIndex( reader->readValue("ZEndIndex", getZEndIndex() ) );
+  setXStartIndex( reader->readValue("XStartIndex", getXStartIndex() ) );
+  setXEndIndex( reader->readValue("XEndIndex", getXEndIndex() ) );
+  setYStartIndex( reader->readValue("YStartIndex", getYStartIndex() ) );
+  setYEndIndex( reader->readValue("YEndIndex", getYEndIndex() ) );
   setUseTransformations( reader->readValue("UseTransformations", getUseTransformations() ) );
+  setCompactFloatArrays( reader->readValue("CompactFloatArrays", getCompactFloatArrays() ) );
   setSelectedArrayNames(reader->readArraySelections("SelectedArrayNames", getSelectedArrayNames() ));
   reader->closeFilterGroup();
 }
@@ -159,7 +275,12 @@ int ReadH5Ebsd::writeFilterParameters(AbstractFilterParametersWriter* writer, in
   DREAM3D_FILTER_WRITE_PARAMETER(RefFrameZDir)
   DREAM3D_FILTER_WRITE_PARAMETER(ZStartIndex)
   DREAM3D_FILTER_WRITE_PARAMETER(ZEndIndex)
+  DREAM3D_FILTER_WRITE_PARAMETER(XStartIndex)
+  DREAM3D_FILTER_WRITE_PARAMETER(XEndIndex)
+  DREAM3D_FILTER_WRITE_PARAMETER(YStartIndex)
+  DREAM3D_FILTER_WRITE_PARAMETER(YEndIndex)
   DREAM3D_FILTER_WRITE_PARAMETER(UseTransformations)
+  DREAM3D_FILTER_WRITE_PARAMETER(CompactFloatArrays)
   writer->writeArraySelections("SelectedArrayNames", getSelectedArrayNames() );
 
   writer->closeFilterGroup();
@@ -357,11 +478,27 @@ void ReadH5Ebsd::dataCheck()
     m_Manufacturer = Ebsd::HEDM;
   }
 
+  // A negative end index means the last column or row of the volume
+  int64_t xEnd = (m_XEndIndex < 0 || m_XEndIndex >= dims[0]) ? dims[0] - 1 : m_XEndIndex;
+  int64_t yEnd = (m_YEndIndex < 0 || m_YEndIndex >= dims[1]) ? dims[1] - 1 : m_YEndIndex;
+  if (m_XStartIndex < 0 || m_XStartIndex > xEnd || m_YStartIndex < 0 || m_YStartIndex > yEnd)
+  {
+    QString ss = QObject::tr("The X/Y region of interest [%1-%2] x [%3-%4] is not inside of the volume which has %5 x %6 cells")
+                 .arg(m_XStartIndex).arg(m_XEndIndex).arg(m_YStartIndex).arg(m_YEndIndex).arg(dims[0]).arg(dims[1]);
+    setErrorCondition(-12);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
   size_t dcDims[3] = { static_cast<size_t>(dims[0]), static_cast<size_t>(dims[1]), static_cast<size_t>(dims[2]) };
   //Now Calculate our "subvolume" of slices, ie, those start and end values that the user selected from the GUI
+  dcDims[0] = xEnd - m_XStartIndex + 1;
+  dcDims[1] = yEnd - m_YStartIndex + 1;
   dcDims[2] = m_ZEndIndex - m_ZStartIndex + 1;
   m->setDimensions(dcDims);
   m->setResolution(res);
+  // The origin moves to the first cell of the region of interest, the same as in execute()
+  m->setOrigin(m_XStartIndex * res[0], m_YStartIndex * res[1], 0.0f);
 
   //Update the size fo the Cell Attribute Matrix now that the dimensions of the volume are known
   tDims.resize(3);
@@ -435,6 +572,13 @@ void ReadH5Ebsd::dataCheck()
     { m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   }
 
+  // Give the later filters the array types that execute() will produce
+  if(m_CompactFloatArrays == true)
+  {
+    compactFloatArrays(cellAttrMat, false);
+    m_CellEulerAngles = NULL;
+  }
+
   // Now create the Ensemble arrays for the XTal Structures, Material Names and LatticeConstants
   cDims[0] = 1;
   //typedef DataArray<unsigned int> XTalStructArrayType;
@@ -486,6 +630,7 @@ void ReadH5Ebsd::execute()
   int err = 0;
   setErrorCondition(err);
   QString manufacturer;
+  int64_t volumeDims[3] = { 0, 0, 0 };
   // Get the Size and Resolution of the Volume
   {
     H5EbsdVolumeInfo::Pointer volumeInfoReader = H5EbsdVolumeInfo::New();
@@ -495,6 +640,9 @@ void ReadH5Ebsd::execute()
     int64_t dims[3];
     float res[3];
     volumeInfoReader->getDimsAndResolution(dims[0], dims[1], dims[2], res[0], res[1], res[2]);
+    volumeDims[0] = dims[0];
+    volumeDims[1] = dims[1];
+    volumeDims[2] = dims[2];
 
     size_t dcDims[3] = { static_cast<size_t>(dims[0]), static_cast<size_t>(dims[1]), static_cast<size_t>(dims[2]) };
     m->setDimensions(dcDims);
@@ -558,9 +706,16 @@ void ReadH5Ebsd::execute()
   }
   ebsdReader->setSliceStart(m_ZStartIndex);
   ebsdReader->setSliceEnd(m_ZEndIndex);
+  ebsdReader->setXStartIndex(m_XStartIndex);
+  ebsdReader->setXEndIndex(m_XEndIndex);
+  ebsdReader->setYStartIndex(m_YStartIndex);
+  ebsdReader->setYEndIndex(m_YEndIndex);
   ebsdReader->readAllArrays(false);
   ebsdReader->setArraysToRead(m_SelectedArrayNames);
-  err = ebsdReader->loadData(m->getXPoints(), m->getYPoints(), m->getZPoints(), m_RefFrameZDir);
+  {
+    PerformanceMonitor::ScopedPhase phase(this, "Read Slices");
+    err = ebsdReader->loadData(volumeDims[0], volumeDims[1], m->getZPoints(), m_RefFrameZDir);
+  }
   if(err < 0)
   {
     setErrorCondition(err);
@@ -569,6 +724,20 @@ void ReadH5Ebsd::execute()
     return;
   }
 
+  // The reader only loaded the X/Y region of interest of each slice
+  int64_t roi[4] = { 0, 0, 0, 0 };
+  ebsdReader->getRegionOfInterest(volumeDims[0], volumeDims[1], roi[0], roi[1], roi[2], roi[3]);
+  m->setDimensions(static_cast<size_t>(roi[1] - roi[0] + 1), static_cast<size_t>(roi[3] - roi[2] + 1), m->getZPoints());
+  m->setOrigin(roi[0] * m->getXRes(), roi[2] * m->getYRes(), 0.0f);
+
+  // Axis aligned sample transformations are applied while the arrays are copied out of the reader
+  bool sampleTransformationDone = initSampleRemap(m);
+  if (m_SampleRemap.Active == true)
+  {
+    m->setDimensions(m_SampleRemap.Dims[0], m_SampleRemap.Dims[1], m_SampleRemap.Dims[2]);
+    m->setResolution(m_SampleRemap.Res[0], m_SampleRemap.Res[1], m_SampleRemap.Res[2]);
+  }
+
   // Copy the data from the pointers embedded in the reader object into our data container (Cell array).
   if(manufacturer.compare(Ebsd::Ang::Manufacturer) == 0)
   {
@@ -591,8 +760,16 @@ void ReadH5Ebsd::execute()
     return;
   }
 
-  if(m_UseTransformations == true)
+  if (m_SampleRemap.Active == true)
+  {
+    m->setOrigin(m_SampleRemap.Origin[0], m_SampleRemap.Origin[1], m_SampleRemap.Origin[2]);
+  }
+
+  // The Euler transformation was applied while copying the Euler angles. Only sample transformations that are
+  // not a simple remap of the cells still need the general RotateSampleRefFrame filter.
+  if(m_UseTransformations == true && sampleTransformationDone == false)
   {
+    PerformanceMonitor::ScopedPhase phase(this, "Transform Sample Reference Frame");
 
     if(m_SampleTransformation.angle > 0)
     {
@@ -659,66 +836,12 @@ void ReadH5Ebsd::execute()
         notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
       }
     }
+  }
 
-    if(m_EulerTransformation.angle > 0)
-    {
-      FloatVec3_t eulerAxis;
-      eulerAxis.x = m_EulerTransformation.h;
-      eulerAxis.y = m_EulerTransformation.k;
-      eulerAxis.z = m_EulerTransformation.l;
-
-      QString filtName = "RotateEulerRefFrame";
-      FilterManager* fm = FilterManager::Instance();
-      IFilterFactory::Pointer rotEulerFactory = fm->getFactoryForFilter(filtName);
-      if (NULL != rotEulerFactory.get() )
-      {
-        // If we get this far, the Factory is good so creating the filter should not fail unless something has
-        // horribly gone wrong in which case the system is going to come down quickly after this.
-        AbstractFilter::Pointer rot_Euler = rotEulerFactory->create();
-
-        // Connect up the Error/Warning/Progress object so the filter can report those things
-        connect(rot_Euler.get(), SIGNAL(filterGeneratedMessage(const PipelineMessage&)),
-                this, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
-        rot_Euler->setDataContainerArray(getDataContainerArray()); // AbstractFilter implements this so no problem
-        // Now set the filter parameters for the filter using QProperty System since we can not directly
-        // instantiate the filter since it resides in a plugin. These calls are SLOW. DO NOT EVER do this in a
-        // tight loop. Your filter will slow down by 10X.
-        bool propWasSet = rot_Euler->setProperty("RotationAngle", m_EulerTransformation.angle);
-        if(false == propWasSet)
-        {
-          QString ss = QObject::tr("ReadH5Ebsd Error Setting Property '%1' into filter '%2' which is a subfilter called by ReadH5Ebsd. The property was not set which could mean the property was not exposed with a Q_PROPERTY macro. Please notify the developers.").arg("RotationAngle").arg(filtName);
-          setErrorCondition(-109874);
-          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-        }
-        QVariant v;
-        v.setValue(eulerAxis);
-        propWasSet = rot_Euler->setProperty("RotationAxis", v);
-        if(false == propWasSet)
-        {
-          QString ss = QObject::tr("ReadH5Ebsd Error Setting Property '%1' into filter '%2' which is a subfilter called by ReadH5Ebsd. The property was not set which could mean the property was not exposed with a Q_PROPERTY macro. Please notify the developers.").arg("RotationAxis").arg(filtName);
-          setErrorCondition(-109873);
-          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-        }
-        DataArrayPath tempPath;
-        tempPath.update(getDataContainerName(), getCellAttributeMatrixName(), getCellEulerAnglesArrayName() );
-        v.setValue(tempPath);
-        propWasSet = rot_Euler->setProperty("CellEulerAnglesArrayPath", v);
-        if(false == propWasSet)
-        {
-          QString ss = QObject::tr("ReadH5Ebsd Error Setting Property '%1' into filter '%2' which is a subfilter called by ReadH5Ebsd. The property was not set which could mean the property was not exposed with a Q_PROPERTY macro. Please notify the developers.").arg("CellEulerAnglesArrayPath").arg(filtName);
-          setErrorCondition(-109872);
-          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-        }
-        rot_Euler->execute();
-      }
-      else
-      {
-        QString ss = QObject::tr("ReadH5Ebsd Error creating filter '%1' which is a subfilter called by ReadH5Ebsd. Filter was not created/executed. Please notify the developers.").arg(filtName);
-        setErrorCondition(-109870);
-        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-      }
-    }
-
+  // Compact the float arrays last so that the transformation filters above work on the full precision values
+  if(m_CompactFloatArrays == true)
+  {
+    compactFloatArrays(m->getAttributeMatrix(getCellAttributeMatrixName()), true);
   }
 
   // If there is an error set this to something negative and also set a message
@@ -833,15 +956,210 @@ H5EbsdVolumeReader::Pointer ReadH5Ebsd::initHEDMEbsdVolumeReader()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ReadH5Ebsd::copyTSLArrays(H5EbsdVolumeReader* ebsdReader)
+bool ReadH5Ebsd::initSampleRemap(VolumeDataContainer* m)
 {
-  float* f1 = NULL;
-  float* f2 = NULL;
-  float* f3 = NULL;
-  int* phasePtr = NULL;
+  size_t dims[3] = { m->getXPoints(), m->getYPoints(), m->getZPoints() };
+  float res[3] = { m->getXRes(), m->getYRes(), m->getZRes() };
+  float origin[3] = { 0.0f, 0.0f, 0.0f };
+  m->getOrigin(origin);
+  int64_t strides[3] = { 1, static_cast<int64_t>(dims[0]), static_cast<int64_t>(dims[0] * dims[1]) };
 
-  FloatArrayType::Pointer fArray = FloatArrayType::NullPointer();
-  Int32ArrayType::Pointer iArray = Int32ArrayType::NullPointer();
+  // Start from the identity mapping which is a straight copy of the reader arrays
+  m_SampleRemap.Active = false;
+  m_SampleRemap.Base = 0;
+  for (int i = 0; i < 3; i++)
+  {
+    m_SampleRemap.Stride[i] = strides[i];
+    m_SampleRemap.Dims[i] = dims[i];
+    m_SampleRemap.Res[i] = res[i];
+    m_SampleRemap.Origin[i] = origin[i];
+  }
+
+  if (m_UseTransformations == false || m_SampleTransformation.angle <= 0)
+  {
+    return true;
+  }
+
+  float rotMat[3][3];
+  int rot[3][3];
+  OrientationMath::AxisAngletoMat(m_SampleTransformation.angle * DREAM3D::Constants::k_Pi / 180.0, m_SampleTransformation.h, m_SampleTransformation.k, m_SampleTransformation.l, rotMat);
+  for (int i = 0; i < 3; i++)
+  {
+    for (int j = 0; j < 3; j++)
+    {
+      float r = floorf(rotMat[i][j] + 0.5f);
+      if (fabs(rotMat[i][j] - r) > 1.0E-4) { return false; }
+      rot[i][j] = static_cast<int>(r);
+    }
+  }
+  // The data is rotated slice by slice so only rotations that keep the slices in place can be remapped
+  if (rot[2][0] != 0 || rot[2][1] != 0 || (rot[2][2] != 1 && rot[2][2] != -1))
+  {
+    return false;
+  }
+  // The in plane part has to map the new X and Y axes onto different old X or Y axes
+  if ((rot[0][0] != 0) == (rot[1][0] != 0))
+  {
+    return false;
+  }
+  for (int a = 0; a < 2; a++)
+  {
+    int d = (rot[a][0] != 0) ? 0 : 1;
+    int s = rot[a][d];
+    if ((s != 1 && s != -1) || rot[a][1 - d] != 0 || rot[a][2] != 0)
+    {
+      return false;
+    }
+    m_SampleRemap.Dims[a] = dims[d];
+    m_SampleRemap.Res[a] = res[d];
+    if (s > 0)
+    {
+      m_SampleRemap.Stride[a] = strides[d];
+      m_SampleRemap.Origin[a] = origin[d];
+    }
+    else
+    {
+      m_SampleRemap.Base += static_cast<int64_t>(dims[d] - 1) * strides[d];
+      m_SampleRemap.Stride[a] = -strides[d];
+      m_SampleRemap.Origin[a] = -(origin[d] + static_cast<float>(dims[d] - 1) * res[d]);
+    }
+  }
+  if (rot[2][2] < 0)
+  {
+    m_SampleRemap.Origin[2] = -(origin[2] + static_cast<float>(dims[2] - 1) * res[2]);
+  }
+  m_SampleRemap.Active = true;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template<typename T>
+typename DataArray<T>::Pointer ReadH5Ebsd::copyColumn(H5EbsdVolumeReader* ebsdReader, const QString& columnName, const QString& arrayName)
+{
+  T* source = reinterpret_cast<T*>(ebsdReader->getPointerByName(columnName));
+  if (NULL == source)
+  {
+    return DataArray<T>::NullPointer();
+  }
+  VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(getDataContainerName());
+  AttributeMatrix::Pointer cellAttrMatrix = m->getAttributeMatrix(getCellAttributeMatrixName());
+  QVector<size_t> tDims = cellAttrMatrix->getTupleDimensions();
+  QVector<size_t> cDims(1, 1);
+  typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(tDims, cDims, arrayName);
+  T* dest = array->getPointer(0);
+
+  if (m_SampleRemap.Active == false)
+  {
+    ::memcpy(dest, source, sizeof(T) * array->getNumberOfTuples());
+  }
+  else
+  {
+    const SampleRemap_t& remap = m_SampleRemap;
+    size_t index = 0;
+    for (size_t k = 0; k < remap.Dims[2]; k++)
+    {
+      for (size_t j = 0; j < remap.Dims[1]; j++)
+      {
+        int64_t readerIndex = remap.Base + static_cast<int64_t>(j) * remap.Stride[1] + static_cast<int64_t>(k) * remap.Stride[2];
+        for (size_t i = 0; i < remap.Dims[0]; i++)
+        {
+          dest[index] = source[readerIndex];
+          ++index;
+          readerIndex += remap.Stride[0];
+        }
+      }
+    }
+  }
+  cellAttrMatrix->addAttributeArray(arrayName, array);
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5Ebsd::copyEulerAngles(float* f1, float* f2, float* f3, int32_t* cellPhases, bool addHexOffset)
+{
+  if (NULL == f1 || NULL == f2 || NULL == f3)
+  {
+    return;
+  }
+  VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(getDataContainerName());
+  AttributeMatrix::Pointer cellAttrMatrix = m->getAttributeMatrix(getCellAttributeMatrixName());
+  QVector<size_t> tDims = cellAttrMatrix->getTupleDimensions();
+  QVector<size_t> cDims(1, 3);
+  FloatArrayType::Pointer fArray = FloatArrayType::CreateArray(tDims, cDims, DREAM3D::CellData::EulerAngles);
+
+  // The Euler transformation is folded into this pass instead of running RotateEulerRefFrame afterwards
+  float rotAngle = 0.0f;
+  if (m_UseTransformations == true && m_EulerTransformation.angle > 0)
+  {
+    rotAngle = m_EulerTransformation.angle;
+  }
+  if (NULL == cellPhases || NULL == m_CrystalStructures)
+  {
+    addHexOffset = false;
+  }
+
+  ReadH5EbsdEulerImpl impl(f1, f2, f3, fArray->getPointer(0), cellPhases, m_CrystalStructures, addHexOffset,
+                           rotAngle, m_EulerTransformation, m_SampleRemap.Base, m_SampleRemap.Stride, m_SampleRemap.Dims);
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_SampleRemap.Dims[2]), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.convert(0, m_SampleRemap.Dims[2]);
+  }
+  cellAttrMatrix->addAttributeArray(DREAM3D::CellData::EulerAngles, fArray);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ReadH5Ebsd::isCompactFloatArray(const QString& arrayName)
+{
+  // Half precision keeps about 3 significant digits and overflows above 65504
+  return (arrayName.compare(getCellEulerAnglesArrayName()) == 0
+          || arrayName.compare(Ebsd::Ang::ConfidenceIndex) == 0
+          || arrayName.compare(Ebsd::Ang::Fit) == 0
+          || arrayName.compare(Ebsd::Mic::Confidence) == 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5Ebsd::compactFloatArrays(AttributeMatrix::Pointer cellAttrMat, bool convertValues)
+{
+  QList<QString> names = cellAttrMat->getAttributeArrayNames();
+  for (QList<QString>::iterator iter = names.begin(); iter != names.end(); ++iter)
+  {
+    if (isCompactFloatArray(*iter) == false) { continue; }
+    FloatArrayType::Pointer fArray = cellAttrMat->getAttributeArrayAs<FloatArrayType>(*iter);
+    if (NULL == fArray.get()) { continue; }
+    QuantizedFloatArray::Pointer compact = QuantizedFloatArray::NullPointer();
+    if (convertValues == true)
+    {
+      compact = QuantizedFloatArray::FromFloatArray(fArray.get(), QuantizedFloatArray::HalfFloat);
+    }
+    else
+    {
+      compact = QuantizedFloatArray::CreateArray(fArray->getNumberOfTuples(), fArray->getComponentDimensions(), *iter, QuantizedFloatArray::HalfFloat, false);
+    }
+    cellAttrMat->addAttributeArray(*iter, compact);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ReadH5Ebsd::copyTSLArrays(H5EbsdVolumeReader* ebsdReader)
+{
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(getDataContainerName());
 
   AttributeMatrix::Pointer cellAttrMatrix = m->getAttributeMatrix(getCellAttributeMatrixName());
@@ -851,83 +1169,47 @@ void ReadH5Ebsd::copyTSLArrays(H5EbsdVolumeReader* ebsdReader)
   tDims[2] = m->getZPoints();
   cellAttrMatrix->resizeAttributeArrays(tDims); // Resize the attribute Matrix to the proper dimensions
 
-  int64_t totalPoints = m->getTotalPoints();
-  QVector<size_t> cDims(1, 1);
   if (m_SelectedArrayNames.find(m_CellPhasesArrayName) != m_SelectedArrayNames.end() )
   {
-    phasePtr = reinterpret_cast<int*>(ebsdReader->getPointerByName(Ebsd::Ang::PhaseData));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, DREAM3D::CellData::Phases);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->addAttributeArray(DREAM3D::CellData::Phases, iArray);
+    copyColumn<int32_t>(ebsdReader, Ebsd::Ang::PhaseData, DREAM3D::CellData::Phases);
   }
 
   if (m_SelectedArrayNames.find(m_CellEulerAnglesArrayName) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Phi1));
-    f2 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Phi));
-    f3 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Phi2));
-    cDims[0] = 3;
-    fArray = FloatArrayType::CreateArray(tDims, cDims, DREAM3D::CellData::EulerAngles);
-    float* cellEulerAngles = fArray->getPointer(0);
-
-    for (int64_t i = 0; i < totalPoints; i++)
-    {
-      cellEulerAngles[3 * i] = f1[i];
-      cellEulerAngles[3 * i + 1] = f2[i];
-      cellEulerAngles[3 * i + 2] = f3[i];
-    }
-    cellAttrMatrix->addAttributeArray(DREAM3D::CellData::EulerAngles, fArray);
+    copyEulerAngles(reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Phi1)),
+                    reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Phi)),
+                    reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Phi2)),
+                    NULL, false);
   }
 
-  // Reset this back to 1 for the rest of the arrays
-  cDims[0] = 1;
-
   if (m_SelectedArrayNames.find(Ebsd::Ang::ImageQuality) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::ImageQuality));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::ImageQuality);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ang::ImageQuality, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Ang::ImageQuality, Ebsd::Ang::ImageQuality);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Ang::ConfidenceIndex) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::ConfidenceIndex));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::ConfidenceIndex);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ang::ConfidenceIndex, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Ang::ConfidenceIndex, Ebsd::Ang::ConfidenceIndex);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Ang::SEMSignal) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::SEMSignal));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::SEMSignal);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ang::SEMSignal, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Ang::SEMSignal, Ebsd::Ang::SEMSignal);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Ang::Fit) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::Fit));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::Fit);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ang::Fit, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Ang::Fit, Ebsd::Ang::Fit);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Ang::XPosition) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::XPosition));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::XPosition);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ang::XPosition, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Ang::XPosition, Ebsd::Ang::XPosition);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Ang::YPosition) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ang::YPosition));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::YPosition);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ang::YPosition, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Ang::YPosition, Ebsd::Ang::YPosition);
   }
 
 }
@@ -937,12 +1219,6 @@ void ReadH5Ebsd::copyTSLArrays(H5EbsdVolumeReader* ebsdReader)
 // -----------------------------------------------------------------------------
 void ReadH5Ebsd::copyHKLArrays(H5EbsdVolumeReader* ebsdReader)
 {
-  float* f1 = NULL;
-  float* f2 = NULL;
-  float* f3 = NULL;
-  int* phasePtr = NULL;
-
-  FloatArrayType::Pointer fArray = FloatArrayType::NullPointer();
   Int32ArrayType::Pointer iArray = Int32ArrayType::NullPointer();
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(getDataContainerName());
   AttributeMatrix::Pointer cellAttrMatrix = m->getAttributeMatrix(getCellAttributeMatrixName());
@@ -952,88 +1228,47 @@ void ReadH5Ebsd::copyHKLArrays(H5EbsdVolumeReader* ebsdReader)
   tDims[2] = m->getZPoints();
   cellAttrMatrix->resizeAttributeArrays(tDims); // Resize the attribute Matrix to the proper dimensions
 
-  int64_t totalPoints = m->getTotalPoints();
-  QVector<size_t> cDims(1, 1);
-  phasePtr = reinterpret_cast<int*>(ebsdReader->getPointerByName(Ebsd::Ctf::Phase));
-  iArray = Int32ArrayType::CreateArray(tDims, cDims, DREAM3D::CellData::Phases);
-  ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-  cellAttrMatrix->addAttributeArray(DREAM3D::CellData::Phases, iArray);
+  iArray = copyColumn<int32_t>(ebsdReader, Ebsd::Ctf::Phase, DREAM3D::CellData::Phases);
 
   if (m_SelectedArrayNames.find(m_CellEulerAnglesArrayName) != m_SelectedArrayNames.end() )
   {
-    //  radianconversion = M_PI / 180.0;
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Euler1));
-    f2 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Euler2));
-    f3 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Euler3));
-    cDims[0] = 3;
-    fArray = FloatArrayType::CreateArray(tDims, cDims, DREAM3D::CellData::EulerAngles);
-    float* cellEulerAngles = fArray->getPointer(0);
-    int* cellPhases = iArray->getPointer(0);
-
-    for (int64_t i = 0; i < totalPoints; i++)
-    {
-      cellEulerAngles[3 * i] = f1[i];
-      cellEulerAngles[3 * i + 1] = f2[i];
-      cellEulerAngles[3 * i + 2] = f3[i];
-      if(m_CrystalStructures[cellPhases[i]] == Ebsd::CrystalStructure::Hexagonal_High)
-      {cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] + (30.0);}
-    }
-    cellAttrMatrix->addAttributeArray(DREAM3D::CellData::EulerAngles, fArray);
+    copyEulerAngles(reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Euler1)),
+                    reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Euler2)),
+                    reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Euler3)),
+                    (NULL != iArray.get()) ? iArray->getPointer(0) : NULL, true);
   }
 
-  cDims[0] = 1;
   if (m_SelectedArrayNames.find(Ebsd::Ctf::Bands) != m_SelectedArrayNames.end() )
   {
-    phasePtr = reinterpret_cast<int*>(ebsdReader->getPointerByName(Ebsd::Ctf::Bands));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::Bands);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ctf::Bands, iArray);
+    copyColumn<int32_t>(ebsdReader, Ebsd::Ctf::Bands, Ebsd::Ctf::Bands);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Ctf::Error) != m_SelectedArrayNames.end() )
   {
-    phasePtr = reinterpret_cast<int*>(ebsdReader->getPointerByName(Ebsd::Ctf::Error));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::Error);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ctf::Error, iArray);
+    copyColumn<int32_t>(ebsdReader, Ebsd::Ctf::Error, Ebsd::Ctf::Error);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Ctf::MAD) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::MAD));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::MAD);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ctf::MAD, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Ctf::MAD, Ebsd::Ctf::MAD);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Ctf::BC) != m_SelectedArrayNames.end() )
   {
-    phasePtr = reinterpret_cast<int*>(ebsdReader->getPointerByName(Ebsd::Ctf::BC));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::BC);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ctf::BC, iArray);
+    copyColumn<int32_t>(ebsdReader, Ebsd::Ctf::BC, Ebsd::Ctf::BC);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Ctf::BS) != m_SelectedArrayNames.end() )
   {
-    phasePtr = reinterpret_cast<int*>(ebsdReader->getPointerByName(Ebsd::Ctf::BS));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::BS);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ctf::BS, iArray);
+    copyColumn<int32_t>(ebsdReader, Ebsd::Ctf::BS, Ebsd::Ctf::BS);
   }
   if (m_SelectedArrayNames.find(Ebsd::Ctf::X) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::X));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::X);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ctf::X, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Ctf::X, Ebsd::Ctf::X);
   }
   if (m_SelectedArrayNames.find(Ebsd::Ctf::Y) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Ctf::Y));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ctf::Y);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Ctf::Y, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Ctf::Y, Ebsd::Ctf::Y);
   }
 }
 
@@ -1044,11 +1279,7 @@ void ReadH5Ebsd::copyHEDMArrays(H5EbsdVolumeReader* ebsdReader)
 {
   float* f1 = NULL;
   float* f2 = NULL;
-  float* f3 = NULL;
-  int* phasePtr = NULL;
 
-  FloatArrayType::Pointer fArray = FloatArrayType::NullPointer();
-  Int32ArrayType::Pointer iArray = Int32ArrayType::NullPointer();
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(getDataContainerName());
   AttributeMatrix::Pointer cellAttrMatrix = m->getAttributeMatrix(getCellAttributeMatrixName());
   QVector<size_t> tDims(3, 0);
@@ -1072,54 +1303,31 @@ void ReadH5Ebsd::copyHEDMArrays(H5EbsdVolumeReader* ebsdReader)
     if(y < yMin) { yMin = y; }
   }
   m->setOrigin(xMin, yMin, 0.0);
-  QVector<size_t> cDims(1, 3);
   if (m_SelectedArrayNames.find(m_CellEulerAnglesArrayName) != m_SelectedArrayNames.end() )
   {
-    //  radianconversion = M_PI / 180.0;
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Mic::Euler1));
-    f2 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Mic::Euler2));
-    f3 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Mic::Euler3));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, DREAM3D::CellData::EulerAngles);
-    float* cellEulerAngles = fArray->getPointer(0);
-    for (int64_t i = 0; i < totalPoints; i++)
-    {
-      cellEulerAngles[3 * i] = f1[i];
-      cellEulerAngles[3 * i + 1] = f2[i];
-      cellEulerAngles[3 * i + 2] = f3[i];
-    }
-    cellAttrMatrix->addAttributeArray(DREAM3D::CellData::EulerAngles, fArray);
+    copyEulerAngles(reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Mic::Euler1)),
+                    reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Mic::Euler2)),
+                    reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Mic::Euler3)),
+                    NULL, false);
   }
-  cDims[0] = 1;
   if (m_SelectedArrayNames.find(m_CellPhasesArrayName) != m_SelectedArrayNames.end() )
   {
-    phasePtr = reinterpret_cast<int*>(ebsdReader->getPointerByName(Ebsd::Mic::Phase));
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, DREAM3D::CellData::Phases);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMatrix->addAttributeArray(DREAM3D::CellData::Phases, iArray);
+    copyColumn<int32_t>(ebsdReader, Ebsd::Mic::Phase, DREAM3D::CellData::Phases);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Mic::Confidence) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Mic::Confidence));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Mic::Confidence);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Mic::Confidence, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Mic::Confidence, Ebsd::Mic::Confidence);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Mic::X) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Mic::X));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Mic::X);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Mic::X, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Mic::X, Ebsd::Mic::X);
   }
 
   if (m_SelectedArrayNames.find(Ebsd::Mic::Y) != m_SelectedArrayNames.end() )
   {
-    f1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(Ebsd::Mic::Y));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Mic::Y);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMatrix->addAttributeArray(Ebsd::Mic::Y, fArray);
+    copyColumn<float>(ebsdReader, Ebsd::Mic::Y, Ebsd::Mic::Y);
   }
 }
 
@@ -1143,6 +1351,10 @@ AbstractFilter::Pointer ReadH5Ebsd::newFilterInstance(bool copyFilterParameters)
     filter->setInputFile(getInputFile());
     filter->setZStartIndex(getZStartIndex());
     filter->setZEndIndex(getZEndIndex());
+    filter->setXStartIndex(getXStartIndex());
+    filter->setXEndIndex(getXEndIndex());
+    filter->setYStartIndex(getYStartIndex());
+    filter->setYEndIndex(getYEndIndex());
     filter->setUseTransformations(getUseTransformations());
     filter->setSelectedArrayNames(getSelectedArrayNames());
     filter->setDataArrayNames(getDataArrayNames());
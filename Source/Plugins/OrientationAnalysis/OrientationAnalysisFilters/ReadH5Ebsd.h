@@ -95,8 +95,18 @@ class ReadH5Ebsd : public AbstractFilter
     Q_PROPERTY(int ZStartIndex READ getZStartIndex WRITE setZStartIndex)
     DREAM3D_FILTER_PARAMETER(int, ZEndIndex)
     Q_PROPERTY(int ZEndIndex READ getZEndIndex WRITE setZEndIndex)
+    DREAM3D_FILTER_PARAMETER(int, XStartIndex)
+    Q_PROPERTY(int XStartIndex READ getXStartIndex WRITE setXStartIndex)
+    DREAM3D_FILTER_PARAMETER(int, XEndIndex)
+    Q_PROPERTY(int XEndIndex READ getXEndIndex WRITE setXEndIndex)
+    DREAM3D_FILTER_PARAMETER(int, YStartIndex)
+    Q_PROPERTY(int YStartIndex READ getYStartIndex WRITE setYStartIndex)
+    DREAM3D_FILTER_PARAMETER(int, YEndIndex)
+    Q_PROPERTY(int YEndIndex READ getYEndIndex WRITE setYEndIndex)
     DREAM3D_FILTER_PARAMETER(bool, UseTransformations)
     Q_PROPERTY(bool UseTransformations READ getUseTransformations WRITE setUseTransformations)
+    DREAM3D_FILTER_PARAMETER(bool, CompactFloatArrays)
+    Q_PROPERTY(bool CompactFloatArrays READ getCompactFloatArrays WRITE setCompactFloatArrays)
 
     DREAM3D_INSTANCE_PROPERTY(QSet<QString>, SelectedArrayNames)
     Q_PROPERTY(QSet<QString> SelectedArrayNames READ getSelectedArrayNames WRITE setSelectedArrayNames)
@@ -160,6 +170,46 @@ class ReadH5Ebsd : public AbstractFilter
     void copyHKLArrays(H5EbsdVolumeReader* ebsdReader);
     void copyHEDMArrays(H5EbsdVolumeReader* ebsdReader);
 
+    /**
+     * @brief Sets up the cell index mapping used by the copy methods. If the sample transformation is a
+     * multiple of 90 degrees that keeps the slices in their planes it is turned into an index remap so that it
+     * is applied while the arrays are copied out of the reader, and the new geometry is stored for execute().
+     * @param m The data container holding the geometry of the volume as it was read
+     * @return true if the sample transformation was handled, false if the RotateSampleRefFrame filter is needed
+     */
+    bool initSampleRemap(VolumeDataContainer* m);
+
+    /**
+     * @brief Copies a single component column out of the reader into a new array of the cell attribute matrix,
+     * applying the sample remap on the way.
+     * @return The new array or a NULL pointer if the reader does not have the column
+     */
+    template<typename T>
+    typename DataArray<T>::Pointer copyColumn(H5EbsdVolumeReader* ebsdReader, const QString& columnName, const QString& arrayName);
+
+    /**
+     * @brief Interleaves the three Euler angle columns of the reader into the cell Euler angles array, applying
+     * the sample remap, the optional hexagonal offset and the Euler transformation on the way.
+     * @param cellPhases The phase of each cell, only needed with addHexOffset
+     * @param addHexOffset Whether 30 is added to the third angle of cells with Hexagonal_High phases
+     */
+    void copyEulerAngles(float* f1, float* f2, float* f3, int32_t* cellPhases, bool addHexOffset);
+
+    /**
+     * @brief Returns whether the "Store Float Arrays As Half Precision" option applies to an array. Only arrays
+     * with a small, known range (Euler angles, confidence index, fit) are stored as half precision; positions and
+     * unbounded signals such as image quality keep their full precision.
+     * @param arrayName The name of the cell array
+     */
+    bool isCompactFloatArray(const QString& arrayName);
+
+    /**
+     * @brief Replaces the float cell arrays that isCompactFloatArray() accepts with half precision arrays
+     * @param cellAttrMat The cell attribute matrix
+     * @param convertValues Whether the values are converted (execute) or only the array types are replaced (preflight)
+     */
+    void compactFloatArrays(AttributeMatrix::Pointer cellAttrMat, bool convertValues);
+
 
     /**
     * @brief This method reads the values for the phase type, crystal structure
@@ -248,6 +298,22 @@ class ReadH5Ebsd : public AbstractFilter
     int tempypoints;
     int totaltemppoints;
 
+    /**
+     * @brief Where each cell of the volume as read ends up after an axis aligned sample transformation: cell
+     * (i, j, k) of the new volume comes from cell Base + i * Stride[0] + j * Stride[1] + k * Stride[2] of the reader.
+     */
+    typedef struct
+    {
+      bool Active;
+      int64_t Base;
+      int64_t Stride[3];
+      size_t Dims[3];
+      float Res[3];
+      float Origin[3];
+    } SampleRemap_t;
+
+    SampleRemap_t m_SampleRemap;
+
     ReadH5Ebsd(const ReadH5Ebsd&); // Copy Constructor Not Implemented
     void operator=(const ReadH5Ebsd&); // Operator '=' Not Implemented
 };
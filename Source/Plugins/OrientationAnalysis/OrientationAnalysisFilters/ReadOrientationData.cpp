@@ -54,6 +54,54 @@
   boost::shared_array<m_msgType> var##Array(new m_msgType[size]);\
   m_msgType* var = var##Array.get();
 
+namespace Detail
+{
+  /**
+   * @brief Moves a column of data out of the reader into a new DataArray. The reader's memory is handed over
+   * to the DataArray when the reader allows it, otherwise the values are copied.
+   * @return The new array or a NULL pointer if the reader does not have that column
+   */
+  template<typename T>
+  typename DataArray<T>::Pointer TakeColumn(EbsdReader* reader, const QString& columnName, size_t numTuples, const QString& arrayName)
+  {
+    QVector<size_t> cDims(1, 1);
+    T* ptr = reinterpret_cast<T*>(reader->releasePointerByName(columnName));
+    if (NULL != ptr)
+    {
+      return DataArray<T>::WrapPointer(ptr, numTuples, cDims, arrayName, true);
+    }
+    ptr = reinterpret_cast<T*>(reader->getPointerByName(columnName));
+    if (NULL == ptr)
+    {
+      return DataArray<T>::NullPointer();
+    }
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(numTuples, cDims, arrayName);
+    ::memcpy(array->getPointer(0), ptr, sizeof(T) * numTuples);
+    return array;
+  }
+
+  /**
+   * @brief Adds a column of data from the reader to the attribute matrix if the reader has that column
+   */
+  template<typename T>
+  void AddColumn(EbsdReader* reader, const QString& columnName, AttributeMatrix::Pointer attrMat, size_t numTuples, const QString& arrayName)
+  {
+    typename DataArray<T>::Pointer array = TakeColumn<T>(reader, columnName, numTuples, arrayName);
+    if (NULL != array.get())
+    {
+      attrMat->addAttributeArray(arrayName, array);
+    }
+  }
+
+  /**
+   * @brief Frees the memory of a column the reader will not be asked for again
+   */
+  static void DropColumn(EbsdReader* reader, const QString& columnName)
+  {
+    free(reader->releasePointerByName(columnName));
+  }
+}
+
 
 // -----------------------------------------------------------------------------
 //
@@ -274,12 +322,12 @@ void ReadOrientationData::dataCheck()
     tempPath.update(getDataContainerName(), getCellAttributeMatrixName(), getCellEulerAnglesArrayName() );
     m_CellEulerAnglesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this,  tempPath, 0, dim); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
     if( NULL != m_CellEulerAnglesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-    { m_CellEulerAngles = m_CellEulerAnglesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    { m_CellEulerAngles = m_CellEulerAnglesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
     dim[0] = 1;
     tempPath.update(getDataContainerName(), getCellAttributeMatrixName(), getCellPhasesArrayName() );
     m_CellPhasesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this,  tempPath, 0, dim); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
     if( NULL != m_CellPhasesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-    { m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    { m_CellPhases = m_CellPhasesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
 
     //typedef DataArray<unsigned int> XTalStructArrayType;
     tempPath.update(getDataContainerName(), getCellEnsembleAttributeMatrixName(), getCrystalStructuresArrayName() );
@@ -395,8 +443,7 @@ void ReadOrientationData::readAngFile()
         phasePtr[i] = 1;
       }
     }
-    iArray = Int32ArrayType::CreateArray(tDims, cDims, DREAM3D::CellData::Phases);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
+    iArray = Detail::TakeColumn<int32_t>(&reader, Ebsd::Ang::PhaseData, totalPoints, DREAM3D::CellData::Phases);
     ebsdAttrMat->addAttributeArray(DREAM3D::CellData::Phases, iArray);
   }
 
@@ -416,36 +463,16 @@ void ReadOrientationData::readAngFile()
       cellEulerAngles[3 * i + 2] = f3[i];
     }
     ebsdAttrMat->addAttributeArray(DREAM3D::CellData::EulerAngles, fArray);
+    Detail::DropColumn(&reader, Ebsd::Ang::Phi1);
+    Detail::DropColumn(&reader, Ebsd::Ang::Phi);
+    Detail::DropColumn(&reader, Ebsd::Ang::Phi2);
   }
 
-  cDims[0] = 1;
-  {
-    f1 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ang::ImageQuality));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::ImageQuality);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->addAttributeArray(Ebsd::Ang::ImageQuality, fArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ang::ConfidenceIndex));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::ConfidenceIndex);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->addAttributeArray(Ebsd::Ang::ConfidenceIndex, fArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ang::SEMSignal));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::SEMSignal);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->addAttributeArray(Ebsd::Ang::SEMSignal, fArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ang::Fit));
-    fArray = FloatArrayType::CreateArray(tDims, cDims, Ebsd::Ang::Fit);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    ebsdAttrMat->addAttributeArray(Ebsd::Ang::Fit, fArray);
-  }
+  // The remaining columns are handed over to the DataArrays without copying them
+  Detail::AddColumn<float>(&reader, Ebsd::Ang::ImageQuality, ebsdAttrMat, totalPoints, Ebsd::Ang::ImageQuality);
+  Detail::AddColumn<float>(&reader, Ebsd::Ang::ConfidenceIndex, ebsdAttrMat, totalPoints, Ebsd::Ang::ConfidenceIndex);
+  Detail::AddColumn<float>(&reader, Ebsd::Ang::SEMSignal, ebsdAttrMat, totalPoints, Ebsd::Ang::SEMSignal);
+  Detail::AddColumn<float>(&reader, Ebsd::Ang::Fit, ebsdAttrMat, totalPoints, Ebsd::Ang::Fit);
 
 }
 
@@ -519,8 +546,7 @@ void ReadOrientationData::readCtfFile()
         phasePtr[i] = 1;
       }
     }
-    iArray = Int32ArrayType::CreateArray(totalPoints, DREAM3D::CellData::Phases);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
+    iArray = Detail::TakeColumn<int32_t>(&reader, Ebsd::Ctf::Phase, totalPoints, DREAM3D::CellData::Phases);
     cellAttrMat->addAttributeArray(DREAM3D::CellData::Phases, iArray);
   }
   {
@@ -542,42 +568,17 @@ void ReadOrientationData::readCtfFile()
       {cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] + (30.0);}
     }
     cellAttrMat->addAttributeArray(DREAM3D::CellData::EulerAngles, fArray);
+    Detail::DropColumn(&reader, Ebsd::Ctf::Euler1);
+    Detail::DropColumn(&reader, Ebsd::Ctf::Euler2);
+    Detail::DropColumn(&reader, Ebsd::Ctf::Euler3);
   }
 
-  {
-    phasePtr = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Ctf::Bands));
-    iArray = Int32ArrayType::CreateArray(totalPoints, Ebsd::Ctf::Bands);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMat->addAttributeArray(Ebsd::Ctf::Bands, iArray);
-  }
-
-  {
-    phasePtr = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Ctf::Error));
-    iArray = Int32ArrayType::CreateArray(totalPoints, Ebsd::Ctf::Error);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMat->addAttributeArray(Ebsd::Ctf::Error, iArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Ctf::MAD));
-    fArray = FloatArrayType::CreateArray(totalPoints, Ebsd::Ctf::MAD);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMat->addAttributeArray(Ebsd::Ctf::MAD, fArray);
-  }
-
-  {
-    phasePtr = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Ctf::BC));
-    iArray = Int32ArrayType::CreateArray(totalPoints, Ebsd::Ctf::BC);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMat->addAttributeArray(Ebsd::Ctf::BC, iArray);
-  }
-
-  {
-    phasePtr = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Ctf::BS));
-    iArray = Int32ArrayType::CreateArray(totalPoints, Ebsd::Ctf::BS);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMat->addAttributeArray(Ebsd::Ctf::BS, iArray);
-  }
+  // The remaining columns are handed over to the DataArrays without copying them
+  Detail::AddColumn<int32_t>(&reader, Ebsd::Ctf::Bands, cellAttrMat, totalPoints, Ebsd::Ctf::Bands);
+  Detail::AddColumn<int32_t>(&reader, Ebsd::Ctf::Error, cellAttrMat, totalPoints, Ebsd::Ctf::Error);
+  Detail::AddColumn<float>(&reader, Ebsd::Ctf::MAD, cellAttrMat, totalPoints, Ebsd::Ctf::MAD);
+  Detail::AddColumn<int32_t>(&reader, Ebsd::Ctf::BC, cellAttrMat, totalPoints, Ebsd::Ctf::BC);
+  Detail::AddColumn<int32_t>(&reader, Ebsd::Ctf::BS, cellAttrMat, totalPoints, Ebsd::Ctf::BS);
 
 }
 
@@ -647,8 +648,7 @@ void ReadOrientationData::readMicFile()
         phasePtr[i] = 1;
       }
     }
-    iArray = Int32ArrayType::CreateArray(totalPoints, DREAM3D::CellData::Phases);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
+    iArray = Detail::TakeColumn<int32_t>(&reader, Ebsd::Mic::Phase, totalPoints, DREAM3D::CellData::Phases);
     cellAttrMat->addAttributeArray(DREAM3D::CellData::Phases, iArray);
   }
 
@@ -667,22 +667,13 @@ void ReadOrientationData::readMicFile()
       cellEulerAngles[3 * i + 2] = f3[i];
     }
     cellAttrMat->addAttributeArray(DREAM3D::CellData::EulerAngles, fArray);
+    Detail::DropColumn(&reader, Ebsd::Mic::Euler1);
+    Detail::DropColumn(&reader, Ebsd::Mic::Euler2);
+    Detail::DropColumn(&reader, Ebsd::Mic::Euler3);
   }
 
-  compDims[0] = 1; // Now reset the size of the first dimension to 1
-  {
-    phasePtr = reinterpret_cast<int*>(reader.getPointerByName(Ebsd::Mic::Phase));
-    iArray = Int32ArrayType::CreateArray(totalPoints, compDims, DREAM3D::CellData::Phases);
-    ::memcpy(iArray->getPointer(0), phasePtr, sizeof(int32_t) * totalPoints);
-    cellAttrMat->addAttributeArray(DREAM3D::CellData::Phases, iArray);
-  }
-
-  {
-    f1 = reinterpret_cast<float*>(reader.getPointerByName(Ebsd::Mic::Confidence));
-    fArray = FloatArrayType::CreateArray(totalPoints, compDims, Ebsd::Mic::Confidence);
-    ::memcpy(fArray->getPointer(0), f1, sizeof(float) * totalPoints);
-    cellAttrMat->addAttributeArray(Ebsd::Mic::Confidence, fArray);
-  }
+  // The Phases were already added above so only the Confidence is left to hand over
+  Detail::AddColumn<float>(&reader, Ebsd::Mic::Confidence, cellAttrMat, totalPoints, Ebsd::Mic::Confidence);
 
 }
 
@@ -192,10 +192,10 @@ class WritePoleFigure : public AbstractFilter
     QImage paintPoleFigureOverlay(int imageWidth, int imageHeight, QString label, QImage image);
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, CellEulerAngles)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(uint32_t, CrystalStructures)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, GoodVoxels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, CellEulerAngles)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(uint32_t, CrystalStructures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, GoodVoxels)
 
     WritePoleFigure(const WritePoleFigure&); // Copy Constructor Not Implemented
     void operator=(const WritePoleFigure&); // Operator '=' Not Implemented
@@ -155,10 +155,10 @@ class WriteStatsGenOdfAngleFile : public AbstractFilter
 
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, CellEulerAngles)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, CellEulerAngles)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(uint32_t, CrystalStructures)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, GoodVoxels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, GoodVoxels)
 
     WriteStatsGenOdfAngleFile(const WriteStatsGenOdfAngleFile&); // Copy Constructor Not Implemented
     void operator=(const WriteStatsGenOdfAngleFile&); // Operator '=' Not Implemented
@@ -0,0 +1,269 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include <stdlib.h>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/Constants.h"
+#include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
+#include "DREAM3DLib/DataContainers/DataContainerArray.h"
+#include "DREAM3DLib/DataContainers/VolumeDataContainer.h"
+#include "DREAM3DLib/DataContainers/AttributeMatrix.h"
+#include "DREAM3DLib/DataArrays/DataArray.hpp"
+
+#include "EbsdLib/EbsdConstants.h"
+#include "EbsdLib/TSL/AngConstants.h"
+
+#include "OrientationAnalysis/OrientationAnalysisFilters/EbsdToH5Ebsd.h"
+#include "OrientationAnalysis/OrientationAnalysisFilters/ReadH5Ebsd.h"
+
+#include "TestFileLocations.h"
+
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RemoveTestFiles()
+{
+#if REMOVE_TEST_FILES
+  QFile::remove(UnitTest::ReadH5EbsdTest::H5EbsdFile);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//  Converts the TSL test slices into the .h5ebsd file the reader tests use
+// -----------------------------------------------------------------------------
+void CreateH5EbsdFile()
+{
+  EbsdToH5Ebsd::Pointer importer = EbsdToH5Ebsd::New();
+  importer->setOutputFile(UnitTest::ReadH5EbsdTest::H5EbsdFile);
+  importer->setInputPath(UnitTest::ReadH5EbsdTest::InputPath);
+  importer->setFilePrefix(UnitTest::ReadH5EbsdTest::FilePrefix);
+  importer->setFileSuffix("");
+  importer->setFileExtension("ang");
+  importer->setPaddingDigits(0);
+  importer->setZStartIndex(UnitTest::ReadH5EbsdTest::ZStartIndex);
+  importer->setZEndIndex(UnitTest::ReadH5EbsdTest::ZEndIndex);
+  importer->setZResolution(0.25f);
+  importer->setRefFrameZDir(Ebsd::RefFrameZDir::LowtoHigh);
+  importer->execute();
+  DREAM3D_REQUIRE(importer->getErrorCondition() >= 0)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ReadH5Ebsd::Pointer CreateReader(DataContainerArray::Pointer dca)
+{
+  QSet<QString> arrays;
+  arrays.insert(DREAM3D::CellData::Phases);
+  arrays.insert(DREAM3D::CellData::EulerAngles);
+  arrays.insert(Ebsd::Ang::ConfidenceIndex);
+
+  ReadH5Ebsd::Pointer reader = ReadH5Ebsd::New();
+  reader->setDataContainerArray(dca);
+  reader->setInputFile(UnitTest::ReadH5EbsdTest::H5EbsdFile);
+  reader->setSelectedArrayNames(arrays);
+  reader->setZStartIndex(UnitTest::ReadH5EbsdTest::ZStartIndex);
+  reader->setZEndIndex(UnitTest::ReadH5EbsdTest::ZEndIndex);
+  reader->setUseTransformations(false);
+  return reader;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VolumeDataContainer* GetVolume(DataContainerArray::Pointer dca)
+{
+  VolumeDataContainer* m = dca->getDataContainerAs<VolumeDataContainer>(DREAM3D::Defaults::VolumeDataContainerName);
+  DREAM3D_REQUIRE_VALID_POINTER(m)
+  return m;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template<typename T>
+typename DataArray<T>::Pointer GetCellArray(DataContainerArray::Pointer dca, const QString& name)
+{
+  AttributeMatrix::Pointer cellAttrMat = GetVolume(dca)->getAttributeMatrix(DREAM3D::Defaults::CellAttributeMatrixName);
+  DREAM3D_REQUIRE_VALID_POINTER(cellAttrMat.get())
+  typename DataArray<T>::Pointer array = cellAttrMat->getAttributeArrayAs<DataArray<T> >(name);
+  DREAM3D_REQUIRE_VALID_POINTER(array.get())
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RequireGeometry(VolumeDataContainer* m, size_t xPoints, size_t yPoints, size_t zPoints, float xOrigin, float yOrigin)
+{
+  DREAM3D_REQUIRE_EQUAL(m->getXPoints(), xPoints)
+  DREAM3D_REQUIRE_EQUAL(m->getYPoints(), yPoints)
+  DREAM3D_REQUIRE_EQUAL(m->getZPoints(), zPoints)
+  float origin[3] = { 0.0f, 0.0f, 0.0f };
+  m->getOrigin(origin);
+  DREAM3D_REQUIRE_EQUAL(origin[0], xOrigin)
+  DREAM3D_REQUIRE_EQUAL(origin[1], yOrigin)
+  DREAM3D_REQUIRE_EQUAL(origin[2], 0.0f)
+}
+
+// -----------------------------------------------------------------------------
+//  Reads a region of interest out of each slice and compares it with the same
+//  cells of the complete volume. Preflight has to report the same geometry as
+//  execute so that downstream filters see the cropped volume.
+// -----------------------------------------------------------------------------
+void TestRegionOfInterest()
+{
+  DataContainerArray::Pointer fullDca = DataContainerArray::New();
+  ReadH5Ebsd::Pointer fullReader = CreateReader(fullDca);
+  fullReader->execute();
+  DREAM3D_REQUIRE_EQUAL(fullReader->getErrorCondition(), 0)
+
+  VolumeDataContainer* full = GetVolume(fullDca);
+  size_t xPoints = full->getXPoints();
+  size_t yPoints = full->getYPoints();
+  size_t zPoints = full->getZPoints();
+  float res[3] = { 0.0f, 0.0f, 0.0f };
+  full->getResolution(res);
+  DREAM3D_REQUIRE(xPoints >= 4)
+  DREAM3D_REQUIRE(yPoints >= 4)
+
+  // The Y end index is left at -1 so the region runs to the last row of each slice
+  int xStart = static_cast<int>(xPoints / 4);
+  int xEnd = static_cast<int>(xPoints / 2);
+  int yStart = static_cast<int>(yPoints / 3);
+  size_t roiXPoints = xEnd - xStart + 1;
+  size_t roiYPoints = yPoints - yStart;
+
+  DataContainerArray::Pointer preflightDca = DataContainerArray::New();
+  ReadH5Ebsd::Pointer preflightReader = CreateReader(preflightDca);
+  preflightReader->setXStartIndex(xStart);
+  preflightReader->setXEndIndex(xEnd);
+  preflightReader->setYStartIndex(yStart);
+  preflightReader->preflight();
+  DREAM3D_REQUIRE_EQUAL(preflightReader->getErrorCondition(), 0)
+  RequireGeometry(GetVolume(preflightDca), roiXPoints, roiYPoints, zPoints, xStart * res[0], yStart * res[1]);
+
+  DataContainerArray::Pointer roiDca = DataContainerArray::New();
+  ReadH5Ebsd::Pointer roiReader = CreateReader(roiDca);
+  roiReader->setXStartIndex(xStart);
+  roiReader->setXEndIndex(xEnd);
+  roiReader->setYStartIndex(yStart);
+  roiReader->execute();
+  DREAM3D_REQUIRE_EQUAL(roiReader->getErrorCondition(), 0)
+  RequireGeometry(GetVolume(roiDca), roiXPoints, roiYPoints, zPoints, xStart * res[0], yStart * res[1]);
+
+  Int32ArrayType::Pointer fullPhases = GetCellArray<int32_t>(fullDca, DREAM3D::CellData::Phases);
+  Int32ArrayType::Pointer roiPhases = GetCellArray<int32_t>(roiDca, DREAM3D::CellData::Phases);
+  FloatArrayType::Pointer fullEulers = GetCellArray<float>(fullDca, DREAM3D::CellData::EulerAngles);
+  FloatArrayType::Pointer roiEulers = GetCellArray<float>(roiDca, DREAM3D::CellData::EulerAngles);
+  FloatArrayType::Pointer fullCI = GetCellArray<float>(fullDca, Ebsd::Ang::ConfidenceIndex);
+  FloatArrayType::Pointer roiCI = GetCellArray<float>(roiDca, Ebsd::Ang::ConfidenceIndex);
+  DREAM3D_REQUIRE_EQUAL(roiPhases->getNumberOfTuples(), roiXPoints * roiYPoints * zPoints)
+
+  for (size_t z = 0; z < zPoints; z++)
+  {
+    for (size_t y = 0; y < roiYPoints; y++)
+    {
+      for (size_t x = 0; x < roiXPoints; x++)
+      {
+        size_t roiIndex = (z * roiYPoints + y) * roiXPoints + x;
+        size_t fullIndex = (z * yPoints + (y + yStart)) * xPoints + (x + xStart);
+        DREAM3D_REQUIRE_EQUAL(roiPhases->getValue(roiIndex), fullPhases->getValue(fullIndex))
+        DREAM3D_REQUIRE_EQUAL(roiCI->getValue(roiIndex), fullCI->getValue(fullIndex))
+        for (int c = 0; c < 3; c++)
+        {
+          DREAM3D_REQUIRE_EQUAL(roiEulers->getComponent(roiIndex, c), fullEulers->getComponent(fullIndex, c))
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//  A region of interest that is empty or outside of the slices is rejected in preflight
+// -----------------------------------------------------------------------------
+void TestInvalidRegionOfInterest()
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  ReadH5Ebsd::Pointer reader = CreateReader(dca);
+  reader->setXStartIndex(3);
+  reader->setXEndIndex(2);
+  reader->preflight();
+  DREAM3D_REQUIRE_EQUAL(reader->getErrorCondition(), -12)
+
+  dca = DataContainerArray::New();
+  reader = CreateReader(dca);
+  reader->setYStartIndex(-1);
+  reader->preflight();
+  DREAM3D_REQUIRE_EQUAL(reader->getErrorCondition(), -12)
+
+  dca = DataContainerArray::New();
+  reader = CreateReader(dca);
+  reader->setXStartIndex(1000000);
+  reader->execute();
+  DREAM3D_REQUIRE_EQUAL(reader->getErrorCondition(), -12)
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  // Instantiate the QCoreApplication that we need to get the current path and load plugins.
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("ReadH5EbsdTest");
+
+  int err = EXIT_SUCCESS;
+
+  DREAM3D_REGISTER_TEST( CreateH5EbsdFile() )
+  DREAM3D_REGISTER_TEST( TestRegionOfInterest() )
+  DREAM3D_REGISTER_TEST( TestInvalidRegionOfInterest() )
+
+#if REMOVE_TEST_FILES
+  DREAM3D_REGISTER_TEST( RemoveTestFiles() )
+#endif
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
@@ -36,6 +36,14 @@
 
 #include "BadDataNeighborOrientationCheck.h"
 
+#include <vector>
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/Math/DREAM3DMath.h"
@@ -46,6 +54,101 @@
   boost::shared_array<m_msgType> var##Array(new m_msgType[size]);\
   m_msgType* var = var##Array.get();
 
+/**
+ * @brief The SimilarNeighborsImpl class compares each listed bad Cell with its 6 face neighbors. Bit j of the
+ * Cell's mask is set when neighbor j shares its phase and is within the misorientation tolerance, and the number of
+ * those neighbors that are already good is its starting count. Each Cell only writes its own entries.
+ */
+class SimilarNeighborsImpl
+{
+  public:
+    SimilarNeighborsImpl(const int64_t* voxels, float* quats, int32_t* phases, unsigned int* crystalStructures, bool* goodVoxels,
+                         float* faceMisorientations, QVector<OrientationOps::Pointer> ops, int64_t dims[3], float tolerance,
+                         uint8_t* similarNeighbors, int* neighborCount) :
+      m_Voxels(voxels),
+      m_Quats(quats),
+      m_CellPhases(phases),
+      m_CrystalStructures(crystalStructures),
+      m_GoodVoxels(goodVoxels),
+      m_FaceMisorientations(faceMisorientations),
+      m_OrientationOps(ops),
+      m_Tolerance(tolerance),
+      m_SimilarNeighbors(similarNeighbors),
+      m_NeighborCount(neighborCount)
+    {
+      m_Dims[0] = dims[0];
+      m_Dims[1] = dims[1];
+      m_Dims[2] = dims[2];
+    }
+    virtual ~SimilarNeighborsImpl() {}
+
+    void compare(size_t start, size_t end) const
+    {
+      QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
+      int64_t neighpoints[6] = { -m_Dims[0] * m_Dims[1], -m_Dims[0], -1, 1, m_Dims[0], m_Dims[0] * m_Dims[1] };
+      // Face j of Cell i is stored as component faceComponent[j] of either Cell i (+X/+Y/+Z) or the neighbor (-X/-Y/-Z)
+      int faceComponent[6] = { 2, 1, 0, 0, 1, 2 };
+      bool faceOfNeighbor[6] = { true, true, true, false, false, false };
+      QuatF q1;
+      QuatF q2;
+      float n1, n2, n3;
+
+      for (size_t v = start; v < end; v++)
+      {
+        int64_t i = m_Voxels[v];
+        int64_t column = i % m_Dims[0];
+        int64_t row = (i / m_Dims[0]) % m_Dims[1];
+        int64_t plane = i / (m_Dims[0] * m_Dims[1]);
+        bool good[6] = { plane > 0, row > 0, column > 0, column < m_Dims[0] - 1, row < m_Dims[1] - 1, plane < m_Dims[2] - 1 };
+        unsigned int phase1 = m_CrystalStructures[m_CellPhases[i]];
+        uint8_t mask = 0;
+        int count = 0;
+        if (m_CellPhases[i] > 0 && phase1 < static_cast<unsigned int>(m_OrientationOps.size()))
+        {
+          for (int j = 0; j < 6; j++)
+          {
+            int64_t neighbor = i + neighpoints[j];
+            if (good[j] == false || m_CellPhases[i] != m_CellPhases[neighbor]) { continue; }
+            float w = 10000.0f;
+            if (NULL != m_FaceMisorientations) { w = m_FaceMisorientations[3 * (faceOfNeighbor[j] ? neighbor : i) + faceComponent[j]]; }
+            else
+            {
+              QuaternionMathF::Copy(quats[i], q1);
+              QuaternionMathF::Copy(quats[neighbor], q2);
+              w = m_OrientationOps[phase1]->getMisoQuatFast( q1, q2, n1, n2, n3);
+            }
+            if (w < m_Tolerance)
+            {
+              mask |= static_cast<uint8_t>(1 << j);
+              if (m_GoodVoxels[neighbor] == true) { count++; }
+            }
+          }
+        }
+        m_SimilarNeighbors[i] = mask;
+        m_NeighborCount[i] = count;
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      compare(r.begin(), r.end());
+    }
+#endif
+  private:
+    const int64_t* m_Voxels;
+    float* m_Quats;
+    int32_t* m_CellPhases;
+    unsigned int* m_CrystalStructures;
+    bool* m_GoodVoxels;
+    float* m_FaceMisorientations;
+    QVector<OrientationOps::Pointer> m_OrientationOps;
+    int64_t m_Dims[3];
+    float m_Tolerance;
+    uint8_t* m_SimilarNeighbors;
+    int* m_NeighborCount;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -57,6 +160,8 @@ BadDataNeighborOrientationCheck::BadDataNeighborOrientationCheck() :
   m_CellPhasesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases),
   m_CrystalStructuresArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::EnsembleData::CrystalStructures),
   m_QuatsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Quats),
+  m_UseFaceMisorientations(false),
+  m_FaceMisorientationsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::FaceMisorientations),
   m_QuatsArrayName(DREAM3D::CellData::Quats),
   m_Quats(NULL),
   m_GoodVoxelsArrayName(DREAM3D::CellData::GoodVoxels),
@@ -64,7 +169,9 @@ BadDataNeighborOrientationCheck::BadDataNeighborOrientationCheck() :
   m_CellPhasesArrayName(DREAM3D::CellData::Phases),
   m_CellPhases(NULL),
   m_CrystalStructuresArrayName(DREAM3D::EnsembleData::CrystalStructures),
-  m_CrystalStructures(NULL)
+  m_CrystalStructures(NULL),
+  m_FaceMisorientationsArrayName(DREAM3D::CellData::FaceMisorientations),
+  m_FaceMisorientations(NULL)
 {
   m_OrientationOps = OrientationOps::getOrientationOpsQVector();
   setupFilterParameters();
@@ -91,6 +198,9 @@ void BadDataNeighborOrientationCheck::setupFilterParameters()
   parameters.push_back(FilterParameter::New("Cell Phases", "CellPhasesArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getCellPhasesArrayPath(), true, ""));
   parameters.push_back(FilterParameter::New("Crystal Structures", "CrystalStructuresArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getCrystalStructuresArrayPath(), true, ""));
   parameters.push_back(FilterParameter::New("Quats", "QuatsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getQuatsArrayPath(), true, ""));
+  QStringList linkedProps("FaceMisorientationsArrayPath");
+  parameters.push_back(LinkedBooleanFilterParameter::New("Use Precomputed Face Misorientations", "UseFaceMisorientations", getUseFaceMisorientations(), linkedProps, false));
+  parameters.push_back(FilterParameter::New("Face Misorientations", "FaceMisorientationsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getFaceMisorientationsArrayPath(), true, ""));
   setFilterParameters(parameters);
 }
 // -----------------------------------------------------------------------------
@@ -103,6 +213,8 @@ void BadDataNeighborOrientationCheck::readFilterParameters(AbstractFilterParamet
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath() ) );
   setMisorientationTolerance( reader->readValue("MisorientationTolerance", getMisorientationTolerance()) );
   setNumberOfNeighbors( reader->readValue("NumberOfNeighbors", getNumberOfNeighbors()) );
+  setUseFaceMisorientations( reader->readValue("UseFaceMisorientations", getUseFaceMisorientations()) );
+  setFaceMisorientationsArrayPath(reader->readDataArrayPath("FaceMisorientationsArrayPath", getFaceMisorientationsArrayPath() ) );
   reader->closeFilterGroup();
 }
 
@@ -118,6 +230,8 @@ int BadDataNeighborOrientationCheck::writeFilterParameters(AbstractFilterParamet
   DREAM3D_FILTER_WRITE_PARAMETER(GoodVoxelsArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(MisorientationTolerance)
   DREAM3D_FILTER_WRITE_PARAMETER(NumberOfNeighbors)
+  DREAM3D_FILTER_WRITE_PARAMETER(UseFaceMisorientations)
+  DREAM3D_FILTER_WRITE_PARAMETER(FaceMisorientationsArrayPath)
   writer->closeFilterGroup();
   return ++index; // we want to return the next index that was just written to
 }
@@ -145,6 +259,15 @@ void BadDataNeighborOrientationCheck::dataCheck()
   m_QuatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getQuatsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_QuatsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
   { m_Quats = m_QuatsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+
+  m_FaceMisorientations = NULL;
+  if (getUseFaceMisorientations() == true)
+  {
+    dims[0] = 3;
+    m_FaceMisorientationsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getFaceMisorientationsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_FaceMisorientationsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_FaceMisorientations = m_FaceMisorientationsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
 }
 
 
@@ -174,121 +297,81 @@ void BadDataNeighborOrientationCheck::execute()
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(m_GoodVoxelsArrayPath.getDataContainerName());
   int64_t totalPoints = m_GoodVoxelsPtr.lock()->getNumberOfTuples();
 
-  m_MisorientationTolerance = m_MisorientationTolerance * DREAM3D::Constants::k_Pi / 180.0;
+  float misorientationTolerance = m_MisorientationTolerance * DREAM3D::Constants::k_Pi / 180.0;
 
   size_t udims[3] = {0, 0, 0};
   m->getDimensions(udims);
-#if (CMP_SIZEOF_SIZE_T == 4)
-  typedef int32_t DimType;
-#else
-  typedef int64_t DimType;
-#endif
-  DimType dims[3] =
+  int64_t dims[3] =
   {
-    static_cast<DimType>(udims[0]),
-    static_cast<DimType>(udims[1]),
-    static_cast<DimType>(udims[2]),
+    static_cast<int64_t>(udims[0]),
+    static_cast<int64_t>(udims[1]),
+    static_cast<int64_t>(udims[2]),
   };
 
-  int good = 1;
-  int neighbor;
-  DimType column, row, plane;
-
-  int neighpoints[6];
-  neighpoints[0] = static_cast<int>(-dims[0] * dims[1]);
-  neighpoints[1] = static_cast<int>(-dims[0]);
-  neighpoints[2] = static_cast<int>(-1);
-  neighpoints[3] = static_cast<int>(1);
-  neighpoints[4] = static_cast<int>(dims[0]);
-  neighpoints[5] = static_cast<int>(dims[0] * dims[1]);
-
-  float w = 10000.0;
-  QuatF q1;
-  QuatF q2;
-  QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
-  float n1, n2, n3;
-  unsigned int phase1, phase2;
-
-  QVector<int> neighborCount(totalPoints, 0);
+  int64_t neighpoints[6];
+  neighpoints[0] = -dims[0] * dims[1];
+  neighpoints[1] = -dims[0];
+  neighpoints[2] = -1;
+  neighpoints[3] = 1;
+  neighpoints[4] = dims[0];
+  neighpoints[5] = dims[0] * dims[1];
 
+  // Only the bad Cells are ever compared, so gather them once
+  std::vector<int64_t> badVoxels;
   for (int64_t i = 0; i < totalPoints; i++)
   {
-    if(m_GoodVoxels[i] == false)
-    {
-      column = i % dims[0];
-      row = (i / dims[0]) % dims[1];
-      plane = i / (dims[0] * dims[1]);
-      for (DimType j = 0; j < 6; j++)
-      {
-        good = 1;
-        neighbor = i + neighpoints[j];
-        if (j == 0 && plane == 0) { good = 0; }
-        if (j == 5 && plane == (dims[2] - 1)) { good = 0; }
-        if (j == 1 && row == 0) { good = 0; }
-        if (j == 4 && row == (dims[1] - 1)) { good = 0; }
-        if (j == 2 && column == 0) { good = 0; }
-        if (j == 3 && column == (dims[0] - 1)) { good = 0; }
-        if (good == 1 && m_GoodVoxels[neighbor] == true)
-        {
-          phase1 = m_CrystalStructures[m_CellPhases[i]];
-          QuaternionMathF::Copy(quats[i], q1);
-
-          phase2 = m_CrystalStructures[m_CellPhases[neighbor]];
-          QuaternionMathF::Copy(quats[neighbor], q2);
+    if(m_GoodVoxels[i] == false) { badVoxels.push_back(i); }
+  }
+  if (badVoxels.empty())
+  {
+    notifyStatusMessage(getHumanLabel(), "Filling Bad Data Complete");
+    return;
+  }
 
-          if (m_CellPhases[i] == m_CellPhases[neighbor] && m_CellPhases[i] > 0) { w = m_OrientationOps[phase1]->getMisoQuat( q1, q2, n1, n2, n3); }
-          if (w < m_MisorientationTolerance)
-          {
-            neighborCount[i]++;
-          }
-        }
-      }
-    }
+  // Compare every bad Cell with its neighbors once. The similar neighbors are kept as a bit mask and reused by
+  // every level below, and the Cells are independent of each other so they are spread over the available cores.
+  std::vector<uint8_t> similarNeighbors(totalPoints, 0);
+  std::vector<int> neighborCount(totalPoints, 0);
+  SimilarNeighborsImpl similar(&(badVoxels.front()), m_Quats, m_CellPhases, m_CrystalStructures, m_GoodVoxels, m_FaceMisorientations,
+                               m_OrientationOps, dims, misorientationTolerance, &(similarNeighbors.front()), &(neighborCount.front()));
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, badVoxels.size()), similar, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    similar.compare(0, badVoxels.size());
   }
 
+  // Turning a Cell good can only raise the counts of its bad neighbors, so following the Cells that reach the
+  // current level from a worklist flips exactly the Cells that repeated sweeps over the whole volume would.
+  std::vector<int64_t> worklist;
   int currentLevel = 6;
-  int counter;
-  // int index;
   while(currentLevel > m_NumberOfNeighbors)
   {
-    counter = 1;
-    while(counter > 0)
+    worklist.clear();
+    for (size_t b = 0; b < badVoxels.size(); b++)
     {
-      counter = 0;
-      for (int64_t i = 0; i < totalPoints; i++)
+      int64_t i = badVoxels[b];
+      if(neighborCount[i] >= currentLevel && m_GoodVoxels[i] == false) { worklist.push_back(i); }
+    }
+    while (worklist.empty() == false)
+    {
+      int64_t i = worklist.back();
+      worklist.pop_back();
+      if (m_GoodVoxels[i] == true) { continue; }
+      m_GoodVoxels[i] = true;
+      for (int j = 0; j < 6; j++)
       {
-        if(neighborCount[i] >= currentLevel && m_GoodVoxels[i] == false)
+        int64_t neighbor = i + neighpoints[j];
+        if ((similarNeighbors[i] & (1 << j)) != 0 && m_GoodVoxels[neighbor] == false)
         {
-          m_GoodVoxels[i] = true;
-          counter++;
-          column = i % dims[0];
-          row = (i / dims[0]) % dims[1];
-          plane = i / (dims[0] * dims[1]);
-          for (DimType j = 0; j < 6; j++)
-          {
-            good = 1;
-            neighbor = i + neighpoints[j];
-            if (j == 0 && plane == 0) { good = 0; }
-            if (j == 5 && plane == (dims[2] - 1)) { good = 0; }
-            if (j == 1 && row == 0) { good = 0; }
-            if (j == 4 && row == (dims[1] - 1)) { good = 0; }
-            if (j == 2 && column == 0) { good = 0; }
-            if (j == 3 && column == (dims[0] - 1)) { good = 0; }
-            if (good == 1 && m_GoodVoxels[neighbor] == false)
-            {
-              phase1 = m_CrystalStructures[m_CellPhases[i]];
-              QuaternionMathF::Copy(quats[i], q1);
-
-              phase2 = m_CrystalStructures[m_CellPhases[neighbor]];
-              QuaternionMathF::Copy(quats[neighbor], q2);
-
-              if (m_CellPhases[i] == m_CellPhases[neighbor] && m_CellPhases[i] > 0) { w = m_OrientationOps[phase1]->getMisoQuat( q1, q2, n1, n2, n3); }
-              if (w < m_MisorientationTolerance)
-              {
-                neighborCount[neighbor]++;
-              }
-            }
-          }
+          neighborCount[neighbor]++;
+          if (neighborCount[neighbor] >= currentLevel) { worklist.push_back(neighbor); }
         }
       }
     }
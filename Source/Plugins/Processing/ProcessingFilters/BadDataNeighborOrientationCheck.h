@@ -86,6 +86,12 @@ class BadDataNeighborOrientationCheck : public AbstractFilter
     DREAM3D_FILTER_PARAMETER(DataArrayPath, QuatsArrayPath)
     Q_PROPERTY(DataArrayPath QuatsArrayPath READ getQuatsArrayPath WRITE setQuatsArrayPath)
 
+    DREAM3D_FILTER_PARAMETER(bool, UseFaceMisorientations)
+    Q_PROPERTY(bool UseFaceMisorientations READ getUseFaceMisorientations WRITE setUseFaceMisorientations)
+
+    DREAM3D_FILTER_PARAMETER(DataArrayPath, FaceMisorientationsArrayPath)
+    Q_PROPERTY(DataArrayPath FaceMisorientationsArrayPath READ getFaceMisorientationsArrayPath WRITE setFaceMisorientationsArrayPath)
+
     virtual const QString getCompiledLibraryName();
     virtual AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters);
     virtual const QString getGroupName();
@@ -124,6 +130,7 @@ class BadDataNeighborOrientationCheck : public AbstractFilter
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, GoodVoxels)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
+    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, FaceMisorientations)
 
     void dataCheck();
 
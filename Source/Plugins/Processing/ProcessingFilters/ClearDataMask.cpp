@@ -42,6 +42,7 @@
 #include "DREAM3DLib/Common/Constants.h"
 
 #include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "DREAM3DLib/DataArrays/BitArray.hpp"
 
 // -----------------------------------------------------------------------------
 //
@@ -108,7 +109,7 @@ void ClearDataMask::dataCheck()
   QVector<size_t> dims(1, 1);
   m_MaskPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getMaskArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_MaskPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_Mask = m_MaskPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_Mask = m_MaskPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
 }
 
 
@@ -153,16 +154,45 @@ void ClearDataMask::execute()
   }
   int numArrays = arrayList.size();
 
-  for (int64_t i = 0; i < totalPoints; i++)
+  // Scan the packed mask a word at a time, skipping words where every Cell is kept, and collect the runs of
+  // Cells to clear so each array can be cleared one contiguous range at a time
+  BitArray::Pointer maskBits = BitArray::FromBoolArray(m_MaskPtr.lock().get());
+  size_t numWords = maskBits->getNumberOfWords();
+  BitArray::WordType* words = maskBits->getWordPointer(0);
+  const BitArray::WordType allSet = ~static_cast<BitArray::WordType>(0);
+  QVector<size_t> runStarts;
+  QVector<size_t> runLengths;
+  int64_t runStart = -1;
+  for (size_t w = 0; w < numWords; w++)
   {
-    if(!m_Mask[i])
+    size_t start = w * 64;
+    size_t end = (start + 64 < static_cast<size_t>(totalPoints)) ? start + 64 : static_cast<size_t>(totalPoints);
+    if (words[w] == allSet && runStart < 0) { continue; }
+    for (size_t i = start; i < end; i++)
     {
-      for (int j = 0; j < numArrays; j++)
+      bool keep = ((words[w] >> (i - start)) & 1) != 0;
+      if (keep == false && runStart < 0) { runStart = static_cast<int64_t>(i); }
+      else if (keep == true && runStart >= 0)
       {
-        arrayList[j]->initializeTuple(i, 0);
+        runStarts.push_back(static_cast<size_t>(runStart));
+        runLengths.push_back(i - static_cast<size_t>(runStart));
+        runStart = -1;
       }
     }
   }
+  if (runStart >= 0)
+  {
+    runStarts.push_back(static_cast<size_t>(runStart));
+    runLengths.push_back(static_cast<size_t>(totalPoints - runStart));
+  }
+
+  for (int j = 0; j < numArrays; j++)
+  {
+    for (int r = 0; r < runStarts.size(); r++)
+    {
+      arrayList[j]->fillTuples(runStarts[r], runLengths[r], 0.0);
+    }
+  }
 
   notifyStatusMessage(getHumanLabel(), "Completed");
 }
@@ -103,7 +103,7 @@ class ClearDataMask : public AbstractFilter
 
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, Mask)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, Mask)
     void dataCheck();
 
     ClearDataMask(const ClearDataMask&); // Copy Constructor Not Implemented
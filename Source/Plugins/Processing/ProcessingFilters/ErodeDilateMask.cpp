@@ -40,6 +40,7 @@
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/Math/DREAM3DMath.h"
 #include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "DREAM3DLib/DataArrays/BitArray.hpp"
 
 
 #define NEW_SHARED_ARRAY(var, m_msgType, size)\
@@ -166,9 +167,6 @@ void ErodeDilateMask::execute()
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(m_MaskArrayPath.getDataContainerName());
   int64_t totalPoints = m_MaskPtr.lock()->getNumberOfTuples();
 
-  BoolArrayType::Pointer maskCopyPtr = BoolArrayType::CreateArray(totalPoints, "MaskCopy");
-  m_MaskCopy = maskCopyPtr->getPointer(0);
-
   size_t udims[3] = {0, 0, 0};
   m->getDimensions(udims);
 #if (CMP_SIZEOF_SIZE_T == 4)
@@ -183,66 +181,60 @@ void ErodeDilateMask::execute()
     static_cast<DimType>(udims[2]),
   };
 
-  int good = 1;
-  size_t count = 0;
-  int kstride, jstride;
-  int neighpoint;
-
-  int neighpoints[6];
-  neighpoints[0] = static_cast<int>(-dims[0] * dims[1]);
-  neighpoints[1] = static_cast<int>(-dims[0]);
-  neighpoints[2] = static_cast<int>(-1);
-  neighpoints[3] = static_cast<int>(1);
-  neighpoints[4] = static_cast<int>(dims[0]);
-  neighpoints[5] = static_cast<int>(dims[0] * dims[1]);
-
-  for (int iteration = 0; iteration < m_NumIterations; iteration++)
+  // The mask is packed 64 Cells to a word and every iteration is done with whole word logical operations on
+  // copies of the mask shifted by each neighbor offset. Dilating grows the true Cells; eroding is done as a
+  // dilation of the false Cells, so a Cell is cleared if any neighbor in an enabled direction is false.
+  BitArray::Pointer workPtr = BitArray::FromBoolArray(m_MaskPtr.lock().get());
+  if (m_Direction == 1) { workPtr->invert(); }
+  BitArray::Pointer resultPtr = BitArray::CreateArray(totalPoints, "Result");
+  BitArray::Pointer shiftedPtr = BitArray::CreateArray(totalPoints, "Shifted");
+
+  // Cells whose -x/+x/-y/+y neighbor is inside the volume. Shifting by a whole plane already runs off the
+  // ends of the array at the first and last planes so the z direction needs no such mask.
+  BitArray::Pointer validPtrs[4];
+  if (m_XDirOn == true || m_YDirOn == true)
   {
-    for (int k = 0; k < dims[2]; k++)
+    for (int d = 0; d < 4; d++)
+    {
+      validPtrs[d] = BitArray::CreateArray(totalPoints, "Valid");
+    }
+    int64_t count = 0;
+    for (DimType k = 0; k < dims[2]; k++)
     {
-      kstride = static_cast<int>( dims[0] * dims[1] * k );
-      for (int j = 0; j < dims[1]; j++)
+      for (DimType j = 0; j < dims[1]; j++)
       {
-        jstride = static_cast<int>( dims[0] * j );
-        for (int i = 0; i < dims[0]; i++)
+        for (DimType i = 0; i < dims[0]; i++)
         {
-          count = kstride + jstride + i;
-
-          m_MaskCopy[count] = m_Mask[count];
-          if (m_Mask[count] == false)
-          {
-            for (int l = 0; l < 6; l++)
-            {
-              good = 1;
-              neighpoint = static_cast<int>( count + neighpoints[l] );
-              if (l == 0 && (k == 0 || m_ZDirOn == false)) { good = 0; }
-              else if (l == 5 && (k == (dims[2] - 1) || m_ZDirOn == false)) { good = 0; }
-              else if (l == 1 && (j == 0 || m_YDirOn == false)) { good = 0; }
-              else if (l == 4 && (j == (dims[1] - 1) || m_YDirOn == false)) { good = 0; }
-              else if (l == 2 && (i == 0 || m_XDirOn == false)) { good = 0; }
-              else if (l == 3 && (i == (dims[0] - 1) || m_XDirOn == false)) { good = 0; }
-              if (good == 1)
-              {
-                if (m_Direction == 0 && m_Mask[neighpoint] == true)
-                {
-                  m_MaskCopy[count] = true;
-                }
-                if (m_Direction == 1 && m_Mask[neighpoint] == true)
-                {
-                  m_MaskCopy[neighpoint] = false;
-                }
-              }
-            }
-          }
+          validPtrs[0]->setValue(count, i > 0);
+          validPtrs[1]->setValue(count, i < dims[0] - 1);
+          validPtrs[2]->setValue(count, j > 0);
+          validPtrs[3]->setValue(count, j < dims[1] - 1);
+          count++;
         }
       }
     }
-    for (int64_t j = 0; j < totalPoints; j++)
+  }
+
+  int64_t offsets[6] = { -1, 1, -dims[0], dims[0], -(dims[0] * dims[1]), (dims[0] * dims[1]) };
+  bool enabled[6] = { m_XDirOn, m_XDirOn, m_YDirOn, m_YDirOn, m_ZDirOn, m_ZDirOn };
+
+  for (int iteration = 0; iteration < m_NumIterations; iteration++)
+  {
+    resultPtr->fill(false);
+    resultPtr->orWith(workPtr.get());
+    for (int l = 0; l < 6; l++)
     {
-      m_Mask[j] = m_MaskCopy[j];
+      if (enabled[l] == false) { continue; }
+      shiftedPtr->assignShifted(workPtr.get(), offsets[l]);
+      if (l < 4) { shiftedPtr->andWith(validPtrs[l].get()); }
+      resultPtr->orWith(shiftedPtr.get());
     }
+    workPtr.swap(resultPtr);
   }
 
+  if (m_Direction == 1) { workPtr->invert(); }
+  workPtr->unpackTo(m_Mask);
+
   // If there is an error set this to something negative and also set a message
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
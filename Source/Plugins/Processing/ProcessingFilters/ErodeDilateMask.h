@@ -115,7 +115,6 @@ class ErodeDilateMask : public AbstractFilter
     ErodeDilateMask();
 
   private:
-    bool* m_MaskCopy;
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, Mask)
 
     QVector<QVector<int> > voxellists;
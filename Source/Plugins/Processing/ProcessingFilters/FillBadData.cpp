@@ -342,28 +342,25 @@ void FillBadData::execute()
       }
     }
     QString attrMatName = m_FeatureIdsArrayPath.getAttributeMatrixName();
-    QList<QString> voxelArrayNames = m->getAttributeMatrix(attrMatName)->getAttributeArrayNames();
+    // Collect the copies in the order they would happen, updating the Feature Ids as we go since later
+    // decisions depend on them, and then apply the whole list to every cell array at once
+    QVector<size_t> srcIdxs;
+    QVector<size_t> destIdxs;
     for (int64_t j = 0; j < totalPoints; j++)
     {
       featurename = m_FeatureIds[j];
       neighbor = m_Neighbors[j];
       if (featurename < 0 && neighbor != -1 && m_FeatureIds[neighbor] > 0)
       {
-        if(getReplaceBadData())
-        {
-          for(QList<QString>::iterator iter = voxelArrayNames.begin(); iter != voxelArrayNames.end(); ++iter)
-          {
-            QString name = *iter;
-            IDataArray::Pointer p = m->getAttributeMatrix(attrMatName)->getAttributeArray(*iter);
-            p->copyTuple(neighbor, j);
-          }
-        }
-        else
-        {
-          m_FeatureIds[j] = m_FeatureIds[neighbor];
-        }
+        m_FeatureIds[j] = m_FeatureIds[neighbor];
+        srcIdxs.push_back(neighbor);
+        destIdxs.push_back(j);
       }
     }
+    if(getReplaceBadData())
+    {
+      m->getAttributeMatrix(attrMatName)->copyTuples(srcIdxs, destIdxs);
+    }
   }
 
   // If there is an error set this to something negative and also set a message
@@ -40,6 +40,7 @@
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/Math/DREAM3DMath.h"
 #include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "DREAM3DLib/DataArrays/BitArray.hpp"
 
 
 
@@ -165,9 +166,9 @@ void IdentifySample::execute()
   neighpoints[4] = xp;
   neighpoints[5] = (xp * yp);
   std::vector<int> currentvlist;
-  std::vector<bool> checked(totalPoints, false);
-  std::vector<bool> sample(totalPoints, false);
+  BitArray::Pointer checkedPtr = BitArray::CreateArray(totalPoints, "Checked");
   int biggestBlock = 0;
+  int64_t biggestSeed = -1;
   size_t count;
   int good;
   int neighbor;
@@ -178,7 +179,7 @@ void IdentifySample::execute()
   // are flipped to be called 'bad' voxels or 'not sample'
   for (int i = 0; i < totalPoints; i++)
   {
-    if(checked[i] == false && m_GoodVoxels[i] == true)
+    if(checkedPtr->getValue(i) == false && m_GoodVoxels[i] == true)
     {
       currentvlist.push_back(i);
       count = 0;
@@ -198,32 +199,64 @@ void IdentifySample::execute()
           if(j == 4 && row == (yp - 1)) { good = 0; }
           if(j == 2 && column == 0) { good = 0; }
           if(j == 3 && column == (xp - 1)) { good = 0; }
-          if(good == 1 && checked[neighbor] == false && m_GoodVoxels[neighbor] == true)
+          if(good == 1 && checkedPtr->getValue(neighbor) == false && m_GoodVoxels[neighbor] == true)
           {
             currentvlist.push_back(neighbor);
-            checked[neighbor] = true;
+            checkedPtr->setValue(neighbor, true);
           }
         }
         count++;
       }
+      // Only remember where the biggest block starts; its Cells are marked once all blocks have been found
       if(static_cast<int>(currentvlist.size()) >= biggestBlock)
       {
         biggestBlock = currentvlist.size();
-        sample.assign(totalPoints, false);
-        for(size_t j = 0; j < biggestBlock; j++)
-        {
-          sample[currentvlist[j]] = true;
-        }
+        biggestSeed = i;
       }
       currentvlist.clear();
     }
   }
-  for (int i = 0; i < totalPoints; i++)
+
+  // Flood the biggest block again from its seed to mark the 'sample' and then clear every GoodVoxel outside
+  // of it with whole word operations on the packed masks
+  BitArray::Pointer samplePtr = BitArray::CreateArray(totalPoints, "Sample");
+  if (biggestSeed >= 0)
   {
-    if (sample[i] == false && m_GoodVoxels[i] == true) { m_GoodVoxels[i] = false; }
+    currentvlist.push_back(static_cast<int>(biggestSeed));
+    samplePtr->setValue(biggestSeed, true);
+    count = 0;
+    while (count < currentvlist.size())
+    {
+      index = currentvlist[count];
+      column = index % xp;
+      row = (index / xp) % yp;
+      plane = index / (xp * yp);
+      for (int j = 0; j < 6; j++)
+      {
+        good = 1;
+        neighbor = static_cast<int>( index + neighpoints[j] );
+        if(j == 0 && plane == 0) { good = 0; }
+        if(j == 5 && plane == (zp - 1)) { good = 0; }
+        if(j == 1 && row == 0) { good = 0; }
+        if(j == 4 && row == (yp - 1)) { good = 0; }
+        if(j == 2 && column == 0) { good = 0; }
+        if(j == 3 && column == (xp - 1)) { good = 0; }
+        if(good == 1 && samplePtr->getValue(neighbor) == false && m_GoodVoxels[neighbor] == true)
+        {
+          currentvlist.push_back(neighbor);
+          samplePtr->setValue(neighbor, true);
+        }
+      }
+      count++;
+    }
+    currentvlist.clear();
   }
-  sample.clear();
-  checked.assign(totalPoints, false);
+  BitArray::Pointer goodVoxelsPtr = BitArray::FromBoolArray(m_GoodVoxelsPtr.lock().get());
+  goodVoxelsPtr->andWith(samplePtr.get());
+  goodVoxelsPtr->unpackTo(m_GoodVoxels);
+  samplePtr = BitArray::NullPointer();
+  goodVoxelsPtr = BitArray::NullPointer();
+  checkedPtr->fill(false);
 
 
   // In this loop we are going to 'close' all of the 'holes' inside of the region already identified as the 'sample' if the user chose to do so.
@@ -233,7 +266,7 @@ void IdentifySample::execute()
     bool touchesBoundary = false;
     for (int i = 0; i < totalPoints; i++)
     {
-      if(checked[i] == false && m_GoodVoxels[i] == false)
+      if(checkedPtr->getValue(i) == false && m_GoodVoxels[i] == false)
       {
         currentvlist.push_back(i);
         count = 0;
@@ -255,10 +288,10 @@ void IdentifySample::execute()
             if(j == 4 && row == (yp - 1)) { good = 0; }
             if(j == 2 && column == 0) { good = 0; }
             if(j == 3 && column == (xp - 1)) { good = 0; }
-            if(good == 1 && checked[neighbor] == false && m_GoodVoxels[neighbor] == false)
+            if(good == 1 && checkedPtr->getValue(neighbor) == false && m_GoodVoxels[neighbor] == false)
             {
               currentvlist.push_back(neighbor);
-              checked[neighbor] = true;
+              checkedPtr->setValue(neighbor, true);
             }
           }
           count++;
@@ -274,7 +307,7 @@ void IdentifySample::execute()
       }
     }
   }
-  checked.clear();
+  checkedPtr = BitArray::NullPointer();
 
   // If there is an error set this to something negative and also set a message
   notifyStatusMessage(getHumanLabel(), "Identifying Sample Complete");
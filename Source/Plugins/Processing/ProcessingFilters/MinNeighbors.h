@@ -120,8 +120,8 @@ class MinNeighbors : public AbstractFilter
     int32_t* m_Neighbors;
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, NumNeighbors)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, NumNeighbors)
 
     void dataCheck();
 
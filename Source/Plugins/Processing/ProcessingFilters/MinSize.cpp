@@ -136,12 +136,12 @@ void MinSize::dataCheck()
   { m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   m_NumCellsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getNumCellsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_NumCellsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_NumCells = m_NumCellsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_NumCells = m_NumCellsPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   if(m_ApplyToSinglePhase == true)
   {
     m_FeaturePhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getFeaturePhasesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
     if( NULL != m_FeaturePhasesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-    { m_FeaturePhases = m_FeaturePhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    { m_FeaturePhases = m_FeaturePhasesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   }
 }
 
@@ -302,7 +302,10 @@ void MinSize::assign_badpoints()
       }
     }
     QString attrMatName = m_FeatureIdsArrayPath.getAttributeMatrixName();
-    QList<QString> voxelArrayNames = m->getAttributeMatrix(attrMatName)->getAttributeArrayNames();
+    // Collect the copies in the order they would happen, updating the Feature Ids as we go since later
+    // decisions depend on them, and then apply the whole list to every cell array at once
+    QVector<size_t> srcIdxs;
+    QVector<size_t> destIdxs;
     for (int64_t j = 0; j < totalPoints; j++)
     {
       featurename = m_FeatureIds[j];
@@ -311,16 +314,13 @@ void MinSize::assign_badpoints()
       {
         if (featurename < 0 && m_FeatureIds[neighbor] >= 0)
         {
-
-          for(QList<QString>::iterator iter = voxelArrayNames.begin(); iter != voxelArrayNames.end(); ++iter)
-          {
-            QString name = *iter;
-            IDataArray::Pointer p = m->getAttributeMatrix(attrMatName)->getAttributeArray(*iter);
-            p->copyTuple(neighbor, j);
-          }
+          m_FeatureIds[j] = m_FeatureIds[neighbor];
+          srcIdxs.push_back(neighbor);
+          destIdxs.push_back(j);
         }
       }
     }
+    m->getAttributeMatrix(attrMatName)->copyTuples(srcIdxs, destIdxs);
   }
 }
 
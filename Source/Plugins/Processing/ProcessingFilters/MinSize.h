@@ -118,8 +118,8 @@ class MinSize : public AbstractFilter
     int32_t* m_Neighbors;
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, NumCells)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, NumCells)
 
     std::vector<std::vector<int> > voxellists;
     std::vector<int> nuclei;
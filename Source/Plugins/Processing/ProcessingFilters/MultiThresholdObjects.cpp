@@ -41,6 +41,7 @@
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/FilterParameters/AbstractFilterParametersWriter.h"
 #include "DREAM3DLib/Common/ThresholdFilterHelper.h"
+#include "DREAM3DLib/DataArrays/BitArray.hpp"
 
 
 // -----------------------------------------------------------------------------
@@ -226,11 +227,15 @@ void MultiThresholdObjects::execute()
 		}
 	}
 
-  // Prime our output array with the result of the first comparison
+  // Every comparison is evaluated into a bit packed mask so the results can be combined 64 Cells at a time
+  int64_t totalTuples = m->getAttributeMatrix(amName)->getNumTuples();
+  BitArray::Pointer resultPtr = BitArray::CreateArray(totalTuples, "RESULT");
+
+  // Prime our result with the first comparison
   {
-    ThresholdFilterHelper filter(static_cast<DREAM3D::Comparison::Enumeration>(comp_0.compOperator), comp_0.compValue, m_DestinationPtr.lock().get());
-    // Run the first threshold and store the results in our output array
-    err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comp_0.attributeArrayName).get(), m_DestinationPtr.lock().get());
+    ThresholdFilterHelper filter(static_cast<DREAM3D::Comparison::Enumeration>(comp_0.compOperator), comp_0.compValue, resultPtr.get());
+    // Run the first threshold and store the results in our result mask
+    err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comp_0.attributeArrayName).get(), resultPtr.get());
     if (err < 0)
     {
       setErrorCondition(-13001);
@@ -241,18 +246,11 @@ void MultiThresholdObjects::execute()
 
   if (m_SelectedThresholds.size() > 1)
   {
-    // Get the total number of tuples, create and initialize an array to use for these results
-    int64_t totalTuples = m->getAttributeMatrix(amName)->getNumTuples();
-    BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, "TEMP");
+    BitArray::Pointer currentArrayPtr = BitArray::CreateArray(totalTuples, "TEMP");
 
-    // Loop on the remaining Comparison objects updating our final result array as we go
+    // Loop on the remaining Comparison objects updating our result as we go
     for(size_t i = 1; i < m_SelectedThresholds.size(); ++i)
     {
-      // Initialize the array to false
-      currentArrayPtr->initializeWithZeros();
-      // Get the pointer to the front of the array. Raw Pointers = fast access = NO Bounds Checking!!!
-      bool* currentArray = currentArrayPtr->getPointer(0);
-
       ComparisonInput_t& compRef = m_SelectedThresholds[i];
 
       ThresholdFilterHelper filter(static_cast<DREAM3D::Comparison::Enumeration>(compRef.compOperator), compRef.compValue, currentArrayPtr.get());
@@ -264,16 +262,12 @@ void MultiThresholdObjects::execute()
         notifyErrorMessage(getHumanLabel(), "Error Executing threshold filter on array", getErrorCondition());
         return;
       }
-      for (int64_t p = 0; p < totalTuples; ++p)
-      {
-        if(m_Destination[p] == false || currentArray[p] == false)
-        {
-          m_Destination[p] = false;
-        }
-      }
+      resultPtr->andWith(currentArrayPtr.get());
     }
   }
 
+  resultPtr->unpackTo(m_Destination);
+
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
@@ -36,6 +36,14 @@
 
 #include "NeighborOrientationCorrelation.h"
 
+#include <vector>
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/Math/DREAM3DMath.h"
@@ -48,6 +56,116 @@
   boost::shared_array<m_msgType> var##Array(new m_msgType[size]);\
   m_msgType* var = var##Array.get();
 
+/**
+ * @brief The NeighborPairsImpl class finds, for each listed Cell, which pairs of its 6 face neighbors share a phase
+ * and are within the misorientation tolerance of each other (one bit per pair of neighbors j < k, 15 in all),
+ * and from those the neighbor it will be replaced with: the last neighbor that is similar to at least one other.
+ * Cells whose pairs are still known from an earlier level skip the comparisons. Each Cell only writes its own entries.
+ */
+class NeighborPairsImpl
+{
+  public:
+    static const uint16_t k_Unknown = 0xFFFF;
+
+    NeighborPairsImpl(const int64_t* voxels, float* quats, int32_t* phases, unsigned int* crystalStructures,
+                      QVector<OrientationOps::Pointer> ops, int64_t dims[3], float tolerance,
+                      uint16_t* similarPairs, int64_t* bestNeighbor) :
+      m_Voxels(voxels),
+      m_Quats(quats),
+      m_CellPhases(phases),
+      m_CrystalStructures(crystalStructures),
+      m_OrientationOps(ops),
+      m_Tolerance(tolerance),
+      m_SimilarPairs(similarPairs),
+      m_BestNeighbor(bestNeighbor)
+    {
+      m_Dims[0] = dims[0];
+      m_Dims[1] = dims[1];
+      m_Dims[2] = dims[2];
+    }
+    virtual ~NeighborPairsImpl() {}
+
+    void compare(size_t start, size_t end) const
+    {
+      QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
+      int64_t neighpoints[6] = { -m_Dims[0] * m_Dims[1], -m_Dims[0], -1, 1, m_Dims[0], m_Dims[0] * m_Dims[1] };
+      QuatF q1;
+      QuatF q2;
+      float n1, n2, n3;
+
+      for (size_t v = start; v < end; v++)
+      {
+        int64_t i = m_Voxels[v];
+        int64_t column = i % m_Dims[0];
+        int64_t row = (i / m_Dims[0]) % m_Dims[1];
+        int64_t plane = i / (m_Dims[0] * m_Dims[1]);
+        bool good[6] = { plane > 0, row > 0, column > 0, column < m_Dims[0] - 1, row < m_Dims[1] - 1, plane < m_Dims[2] - 1 };
+
+        uint16_t pairs = m_SimilarPairs[i];
+        if (pairs == k_Unknown)
+        {
+          pairs = 0;
+          int bit = 0;
+          for (int j = 0; j < 6; j++)
+          {
+            for (int k = j + 1; k < 6; k++, bit++)
+            {
+              if (good[j] == false || good[k] == false) { continue; }
+              int64_t neighbor = i + neighpoints[j];
+              int64_t neighbor2 = i + neighpoints[k];
+              int32_t phase = m_CellPhases[neighbor2];
+              if (phase != m_CellPhases[neighbor] || phase <= 0) { continue; }
+              unsigned int xtal = m_CrystalStructures[phase];
+              if (xtal >= static_cast<unsigned int>(m_OrientationOps.size())) { continue; }
+              QuaternionMathF::Copy(quats[neighbor2], q1);
+              QuaternionMathF::Copy(quats[neighbor], q2);
+              if (m_OrientationOps[xtal]->getMisoQuatFast( q1, q2, n1, n2, n3) < m_Tolerance)
+              {
+                pairs |= static_cast<uint16_t>(1 << bit);
+              }
+            }
+          }
+          m_SimilarPairs[i] = pairs;
+        }
+
+        int neighborSimCount[6] = { 0, 0, 0, 0, 0, 0 };
+        int bit = 0;
+        for (int j = 0; j < 6; j++)
+        {
+          for (int k = j + 1; k < 6; k++, bit++)
+          {
+            if ((pairs & (1 << bit)) != 0)
+            {
+              neighborSimCount[j]++;
+              neighborSimCount[k]++;
+            }
+          }
+        }
+        for (int j = 0; j < 6; j++)
+        {
+          if (good[j] == true && neighborSimCount[j] > 0) { m_BestNeighbor[i] = i + neighpoints[j]; }
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      compare(r.begin(), r.end());
+    }
+#endif
+  private:
+    const int64_t* m_Voxels;
+    float* m_Quats;
+    int32_t* m_CellPhases;
+    unsigned int* m_CrystalStructures;
+    QVector<OrientationOps::Pointer> m_OrientationOps;
+    int64_t m_Dims[3];
+    float m_Tolerance;
+    uint16_t* m_SimilarPairs;
+    int64_t* m_BestNeighbor;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -179,172 +297,117 @@ void NeighborOrientationCorrelation::execute()
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(m_ConfidenceIndexArrayPath.getDataContainerName());
   int64_t totalPoints = m_ConfidenceIndexPtr.lock()->getNumberOfTuples();
 
-  m_MisorientationTolerance = m_MisorientationTolerance * DREAM3D::Constants::k_Pi / 180.0;
+  float misorientationTolerance = m_MisorientationTolerance * DREAM3D::Constants::k_Pi / 180.0;
 
   size_t udims[3] = {0, 0, 0};
   m->getDimensions(udims);
-#if (CMP_SIZEOF_SIZE_T == 4)
-  typedef int32_t DimType;
-#else
-  typedef int64_t DimType;
-#endif
-  DimType dims[3] =
+  int64_t dims[3] =
   {
-    static_cast<DimType>(udims[0]),
-    static_cast<DimType>(udims[1]),
-    static_cast<DimType>(udims[2]),
+    static_cast<int64_t>(udims[0]),
+    static_cast<int64_t>(udims[1]),
+    static_cast<int64_t>(udims[2]),
   };
 
-  size_t count = 1;
-  int best;
-  int good = 1;
-  int good2 = 1;
-  int neighbor;
-  int neighbor2;
-  DimType column, row, plane;
-
-  int neighpoints[6];
-  neighpoints[0] = static_cast<int>(-dims[0] * dims[1]);
-  neighpoints[1] = static_cast<int>(-dims[0]);
-  neighpoints[2] = static_cast<int>(-1);
-  neighpoints[3] = static_cast<int>(1);
-  neighpoints[4] = static_cast<int>(dims[0]);
-  neighpoints[5] = static_cast<int>(dims[0] * dims[1]);
-
-  float w = 10000.0;
-  QuatF q1;
-  QuatF q2;
-  float n1, n2, n3;
-  unsigned int phase1, phase2;
-
-  QVector<int> neighborDiffCount(totalPoints, 0);
-  QVector<int> neighborSimCount(6, 0);
-  QVector<int> bestNeighbor(totalPoints, -1);
-  QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
+  int64_t neighpoints[6];
+  neighpoints[0] = -dims[0] * dims[1];
+  neighpoints[1] = -dims[0];
+  neighpoints[2] = -1;
+  neighpoints[3] = 1;
+  neighpoints[4] = dims[0];
+  neighpoints[5] = dims[0] * dims[1];
+
+  // The similar pairs of neighbors of a Cell only change when one of those neighbors is overwritten, so they are
+  // kept between levels and only recomputed around the Cells that were copied into
+  std::vector<uint16_t> similarPairs(totalPoints, NeighborPairsImpl::k_Unknown);
+  std::vector<int64_t> bestNeighbor(totalPoints, -1);
+  std::vector<int64_t> worklist;
+  QVector<size_t> sources;
+  QVector<size_t> destinations;
+
+  QString attrMatName = m_ConfidenceIndexArrayPath.getAttributeMatrixName();
+  AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(attrMatName);
+  QList<QString> voxelArrayNames = cellAttrMat->getAttributeArrayNames();
+
+  // A precomputed Face Misorientations array is copied along with the other Cell arrays, which leaves the faces of
+  // the overwritten Cells stale, so those faces are computed again after every copy
+  FloatArrayType::Pointer faceMisorientations = cellAttrMat->getAttributeArrayAs<FloatArrayType>(DREAM3D::CellData::FaceMisorientations);
+  if (NULL != faceMisorientations.get() && faceMisorientations->getNumberOfComponents() != 3) { faceMisorientations.reset(); }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
 
   int startLevel = 6;
   for(int currentLevel = startLevel; currentLevel > m_Level; currentLevel--)
   {
     if(getCancel()) { break; }
 
-    DimType progIncrement = totalPoints / 100;
-    DimType prog = 1;
-    int progressInt = 0;
+    QString ss = QObject::tr("|| Level %1 of %2: Processing Data").arg(startLevel - currentLevel).arg(startLevel - m_Level);
+    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
+
+    worklist.clear();
     for (int64_t i = 0; i < totalPoints; i++)
     {
+      if(m_ConfidenceIndex[i] < m_MinConfidence) { worklist.push_back(i); }
+    }
 
-      if (i > prog)
+    // Every low confidence Cell picks its replacement from the data as it was at the start of the level and writes
+    // only its own entries, so the Cells are independent of each other
+    if (worklist.empty() == false)
+    {
+      NeighborPairsImpl pairs(&(worklist.front()), m_Quats, m_CellPhases, m_CrystalStructures, m_OrientationOps, dims,
+                              misorientationTolerance, &(similarPairs.front()), &(bestNeighbor.front()));
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+      if (doParallel == true)
       {
-        progressInt = ((float)i / totalPoints) * 100.0;
-        QString ss = QObject::tr("|| Level %1 of %2: Processing Data %3%").arg(startLevel - currentLevel).arg(startLevel - m_Level).arg(progressInt);
-        notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-        prog = prog + progIncrement;
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, worklist.size()), pairs, tbb::auto_partitioner());
       }
-
-      if(m_ConfidenceIndex[i] < m_MinConfidence)
+      else
+#endif
       {
-        count = 0;
-        column = i % dims[0];
-        row = (i / dims[0]) % dims[1];
-        plane = i / (dims[0] * dims[1]);
-        for (DimType j = 0; j < 6; j++)
-        {
-          good = 1;
-          neighbor = i + neighpoints[j];
-          if (j == 0 && plane == 0) { good = 0; }
-          if (j == 5 && plane == (dims[2] - 1)) { good = 0; }
-          if (j == 1 && row == 0) { good = 0; }
-          if (j == 4 && row == (dims[1] - 1)) { good = 0; }
-          if (j == 2 && column == 0) { good = 0; }
-          if (j == 3 && column == (dims[0] - 1)) { good = 0; }
-          if (good == 1)
-          {
-            phase1 = m_CrystalStructures[m_CellPhases[i]];
-            QuaternionMathF::Copy(quats[i], q1);
-
-            phase2 = m_CrystalStructures[m_CellPhases[neighbor]];
-            QuaternionMathF::Copy(quats[neighbor], q2);
-
-            if (m_CellPhases[i] == m_CellPhases[neighbor] && m_CellPhases[i] > 0) { w = m_OrientationOps[phase1]->getMisoQuat( q1, q2, n1, n2, n3); }
-            if (w > m_MisorientationTolerance)
-            {
-              neighborDiffCount[i]++;
-            }
-            for (DimType k = j + 1; k < 6; k++)
-            {
-              good2 = 1;
-              neighbor2 = i + neighpoints[k];
-              if (k == 0 && plane == 0) { good2 = 0; }
-              if (k == 5 && plane == (dims[2] - 1)) { good2 = 0; }
-              if (k == 1 && row == 0) { good2 = 0; }
-              if (k == 4 && row == (dims[1] - 1)) { good2 = 0; }
-              if (k == 2 && column == 0) { good2 = 0; }
-              if (k == 3 && column == (dims[0] - 1)) { good2 = 0; }
-              if (good2 == 1)
-              {
-                phase1 = m_CrystalStructures[m_CellPhases[neighbor2]];
-                QuaternionMathF::Copy(quats[neighbor2], q1);
-
-                phase2 = m_CrystalStructures[m_CellPhases[neighbor]];
-                QuaternionMathF::Copy(quats[neighbor], q2);
-                if (m_CellPhases[neighbor2] == m_CellPhases[neighbor] && m_CellPhases[neighbor2] > 0) { w = m_OrientationOps[phase1]->getMisoQuat( q1, q2, n1, n2, n3); }
-                if (w < m_MisorientationTolerance)
-                {
-                  neighborSimCount[j]++;
-                  neighborSimCount[k]++;
-                }
-              }
-            }
-          }
-        }
-        for (DimType j = 0; j < 6; j++)
-        {
-          best = 0;
-          good = 1;
-          neighbor = i + neighpoints[j];
-          if (j == 0 && plane == 0) { good = 0; }
-          if (j == 5 && plane == (dims[2] - 1)) { good = 0; }
-          if (j == 1 && row == 0) { good = 0; }
-          if (j == 4 && row == (dims[1] - 1)) { good = 0; }
-          if (j == 2 && column == 0) { good = 0; }
-          if (j == 3 && column == (dims[0] - 1)) { good = 0; }
-          if (good == 1)
-          {
-            if(neighborSimCount[j] > best)
-            {
-              best = neighborSimCount[j];
-              bestNeighbor[i] = neighbor;
-            }
-            neighborSimCount[j] = 0;
-          }
-        }
+        pairs.compare(0, worklist.size());
       }
     }
-    QString attrMatName = m_ConfidenceIndexArrayPath.getAttributeMatrixName();
-    QList<QString> voxelArrayNames = m->getAttributeMatrix(attrMatName)->getAttributeArrayNames();
 
     if(getCancel()) { break; }
 
-    progIncrement = totalPoints / 100;
-    prog = 1;
-    progressInt = 0;
+    ss = QObject::tr("|| Level %1 of %2: Copying Data").arg(startLevel - currentLevel).arg(startLevel - m_Level);
+    notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
+
+    // Copy in increasing Cell order, exactly like copying one Cell at a time, so a Cell whose replacement was
+    // itself replaced earlier in the pass reads the new values
+    sources.clear();
+    destinations.clear();
     for (int64_t i = 0; i < totalPoints; i++)
     {
-      if (i > prog)
+      if (bestNeighbor[i] != -1)
       {
-        progressInt = ((float)i / totalPoints) * 100.0;
-        QString ss = QObject::tr("|| Level %1 of %2: Copying Data %3%").arg(startLevel - currentLevel).arg(startLevel - m_Level).arg(progressInt);
-        notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-        prog = prog + progIncrement;
+        sources.push_back(static_cast<size_t>(bestNeighbor[i]));
+        destinations.push_back(static_cast<size_t>(i));
       }
-      neighbor = bestNeighbor[i];
-      if (neighbor != -1)
+    }
+    for(QList<QString>::iterator iter = voxelArrayNames.begin(); iter != voxelArrayNames.end(); ++iter)
+    {
+      IDataArray::Pointer p = cellAttrMat->getAttributeArray(*iter);
+      p->copyTuples(sources, destinations);
+    }
+    if (NULL != faceMisorientations.get() && destinations.empty() == false)
+    {
+      updateFaceMisorientations(faceMisorientations->getPointer(0), destinations, dims);
+    }
+
+    // Forget the pairs around every Cell that was just overwritten
+    for (int d = 0; d < destinations.size(); d++)
+    {
+      int64_t i = static_cast<int64_t>(destinations[d]);
+      int64_t column = i % dims[0];
+      int64_t row = (i / dims[0]) % dims[1];
+      int64_t plane = i / (dims[0] * dims[1]);
+      bool good[6] = { plane > 0, row > 0, column > 0, column < dims[0] - 1, row < dims[1] - 1, plane < dims[2] - 1 };
+      for (int j = 0; j < 6; j++)
       {
-        for(QList<QString>::iterator iter = voxelArrayNames.begin(); iter != voxelArrayNames.end(); ++iter)
-        {
-          IDataArray::Pointer p = m->getAttributeMatrix(attrMatName)->getAttributeArray(*iter);
-          p->copyTuple(neighbor, i);
-        }
+        if (good[j] == true) { similarPairs[i + neighpoints[j]] = NeighborPairsImpl::k_Unknown; }
       }
     }
     currentLevel = currentLevel - 1;
@@ -354,6 +417,46 @@ void NeighborOrientationCorrelation::execute()
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void NeighborOrientationCorrelation::updateFaceMisorientations(float* faceMisorientations, const QVector<size_t>& cells, int64_t dims[3])
+{
+  QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
+  int64_t neighpoints[6] = { -dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1] };
+  // Face j of Cell i is stored as component faceComponent[j] of either Cell i (+X/+Y/+Z) or the neighbor (-X/-Y/-Z)
+  int faceComponent[6] = { 2, 1, 0, 0, 1, 2 };
+  bool faceOfNeighbor[6] = { true, true, true, false, false, false };
+  QuatF q1;
+  QuatF q2;
+  float n1, n2, n3;
+
+  for (int c = 0; c < cells.size(); c++)
+  {
+    int64_t i = static_cast<int64_t>(cells[c]);
+    int64_t column = i % dims[0];
+    int64_t row = (i / dims[0]) % dims[1];
+    int64_t plane = i / (dims[0] * dims[1]);
+    bool good[6] = { plane > 0, row > 0, column > 0, column < dims[0] - 1, row < dims[1] - 1, plane < dims[2] - 1 };
+    int32_t phase = m_CellPhases[i];
+    unsigned int xtal = m_CrystalStructures[phase];
+    for (int j = 0; j < 6; j++)
+    {
+      if (good[j] == false) { continue; }
+      int64_t neighbor = i + neighpoints[j];
+      // Same rule as Find Cell Face Misorientations: only Cells of the same phase with a known crystal structure
+      float w = 10000.0f;
+      if (m_CellPhases[neighbor] == phase && xtal < static_cast<unsigned int>(m_OrientationOps.size()))
+      {
+        QuaternionMathF::Copy(quats[faceOfNeighbor[j] ? neighbor : i], q1);
+        QuaternionMathF::Copy(quats[faceOfNeighbor[j] ? i : neighbor], q2);
+        w = m_OrientationOps[xtal]->getMisoQuatFast(q1, q2, n1, n2, n3);
+      }
+      faceMisorientations[3 * (faceOfNeighbor[j] ? neighbor : i) + faceComponent[j]] = w;
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -125,6 +125,14 @@ class NeighborOrientationCorrelation : public AbstractFilter
 
     void dataCheck();
 
+    /**
+     * @brief updateFaceMisorientations Computes the 6 faces of every listed Cell again after its data was overwritten
+     * @param faceMisorientations The +X/+Y/+Z face misorientations of every Cell
+     * @param cells The Cells that were copied into
+     * @param dims The dimensions of the volume
+     */
+    void updateFaceMisorientations(float* faceMisorientations, const QVector<size_t>& cells, int64_t dims[3]);
+
     NeighborOrientationCorrelation(const NeighborOrientationCorrelation&); // Copy Constructor Not Implemented
     void operator=(const NeighborOrientationCorrelation&); // Operator '=' Not Implemented
 };
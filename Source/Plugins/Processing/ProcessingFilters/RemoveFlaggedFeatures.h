@@ -109,7 +109,7 @@ class RemoveFlaggedFeatures : public AbstractFilter
     int32_t* m_Neighbors;
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, FlaggedFeatures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, FlaggedFeatures)
 
     virtual QVector<bool> remove_flaggedfeatures();
     virtual void assign_badpoints();
@@ -35,6 +35,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "RotateEulerRefFrame.h"
 
+#include <algorithm>
+
 #ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
@@ -47,6 +49,7 @@
 #include "OrientationLib/OrientationOps/OrientationOps.h"
 #include "DREAM3DLib/Math/MatrixMath.h"
 #include "OrientationLib/Math/OrientationMath.h"
+#include "OrientationLib/Math/OrientationArrayMath.h"
 
 
 class RotateEulerRefFrameImpl
@@ -67,22 +70,23 @@ class RotateEulerRefFrameImpl
       float rotMat[3][3];
 
       OrientationMath::AxisAngletoMat(angle, axis.x, axis.y, axis.z, rotMat);
-      float ea1 = 0, ea2 = 0, ea3 = 0;
-      float ea1new = 0, ea2new = 0, ea3new = 0;
-      float g[3][3];
+      // Convert a block of Euler angles to matrices, rotate them all, then convert the block back in place
+      const size_t blockSize = 1024;
+      float mats[9 * blockSize];
       float gNew[3][3];
-      for (size_t i = start; i < end; i++)
+      for (size_t i = start; i < end; i += blockSize)
       {
-        ea1 = m_CellEulerAngles[3 * i + 0];
-        ea2 = m_CellEulerAngles[3 * i + 1];
-        ea3 = m_CellEulerAngles[3 * i + 2];
-        OrientationMath::EulertoMat(ea1, ea2, ea3, g);
-        MatrixMath::Multiply3x3with3x3(g, rotMat, gNew);
-        MatrixMath::Normalize3x3(gNew);
-        OrientationMath::MattoEuler(gNew, ea1new, ea2new, ea3new);
-        m_CellEulerAngles[3 * i + 0] = ea1new;
-        m_CellEulerAngles[3 * i + 1] = ea2new;
-        m_CellEulerAngles[3 * i + 2] = ea3new;
+        size_t count = std::min(end - i, blockSize);
+        float* eulers = m_CellEulerAngles + 3 * i;
+        OrientationArrayMath::EulertoMat(eulers, mats, count);
+        for (size_t j = 0; j < count; j++)
+        {
+          float (*g)[3] = reinterpret_cast<float(*)[3]>(mats + 9 * j);
+          MatrixMath::Multiply3x3with3x3(g, rotMat, gNew);
+          MatrixMath::Normalize3x3(gNew);
+          MatrixMath::Copy3x3(gNew, g);
+        }
+        OrientationArrayMath::MattoEuler(mats, eulers, count);
       }
     }
 
@@ -0,0 +1,560 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/Constants.h"
+#include "DREAM3DLib/Math/DREAM3DMath.h"
+#include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
+#include "DREAM3DLib/DataContainers/DataContainerArray.h"
+#include "DREAM3DLib/DataContainers/VolumeDataContainer.h"
+#include "DREAM3DLib/DataContainers/AttributeMatrix.h"
+#include "DREAM3DLib/DataArrays/DataArray.hpp"
+#include "DREAM3DLib/Math/QuaternionMath.hpp"
+
+#include "EbsdLib/EbsdConstants.h"
+
+#include "OrientationLib/OrientationOps/OrientationOps.h"
+
+#include "Processing/ProcessingFilters/NeighborOrientationCorrelation.h"
+#include "Processing/ProcessingFilters/BadDataNeighborOrientationCheck.h"
+
+namespace NeighborCleanupTest
+{
+  static const float MinConfidence = 0.1f;
+  static const float Tolerance = 5.0f;
+  static const int NumOrientations = 5;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float RandomFloat()
+{
+  return static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+}
+
+// -----------------------------------------------------------------------------
+//  Creates an empty volume with a cubic phase 1, a hexagonal phase 2 and a phase 3
+//  whose crystal structure is unknown.
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateEmptyVolume(size_t xPoints, size_t yPoints, size_t zPoints)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+
+  VolumeDataContainer::Pointer m = VolumeDataContainer::New(DREAM3D::Defaults::VolumeDataContainerName);
+  m->setDimensions(xPoints, yPoints, zPoints);
+  m->setOrigin(0, 0, 0);
+  m->setResolution(1.0f, 1.0f, 1.0f);
+  dca->addDataContainer(m);
+
+  QVector<size_t> tDims(3, 0);
+  tDims[0] = xPoints;
+  tDims[1] = yPoints;
+  tDims[2] = zPoints;
+  AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  m->addAttributeMatrix(cellAttrMat->getName(), cellAttrMat);
+
+  QVector<size_t> eDims(1, 4);
+  AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New(eDims, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::AttributeMatrixType::CellEnsemble);
+  m->addAttributeMatrix(ensembleAttrMat->getName(), ensembleAttrMat);
+
+  size_t totalPoints = xPoints * yPoints * zPoints;
+  QVector<size_t> cDims(1, 1);
+  Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::Phases, true);
+  phases->initializeWithValue(1);
+  BoolArrayType::Pointer goodVoxels = BoolArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::GoodVoxels, true);
+  goodVoxels->initializeWithValue(true);
+  FloatArrayType::Pointer confidenceIndex = FloatArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::ConfidenceIndex, true);
+  confidenceIndex->initializeWithValue(1.0f);
+  cDims[0] = 4;
+  FloatArrayType::Pointer quats = FloatArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::Quats, true);
+  QuatF* cellQuats = reinterpret_cast<QuatF*>(quats->getPointer(0));
+  for (size_t i = 0; i < totalPoints; i++)
+  {
+    QuaternionMathF::Identity(cellQuats[i]);
+  }
+  cDims[0] = 1;
+  UInt32ArrayType::Pointer crystalStructures = UInt32ArrayType::CreateArray(4, cDims, DREAM3D::EnsembleData::CrystalStructures, true);
+  crystalStructures->setValue(0, Ebsd::CrystalStructure::UnknownCrystalStructure);
+  crystalStructures->setValue(1, Ebsd::CrystalStructure::Cubic_High);
+  crystalStructures->setValue(2, Ebsd::CrystalStructure::Hexagonal_High);
+  crystalStructures->setValue(3, Ebsd::CrystalStructure::UnknownCrystalStructure);
+
+  cellAttrMat->addAttributeArray(phases->getName(), phases);
+  cellAttrMat->addAttributeArray(goodVoxels->getName(), goodVoxels);
+  cellAttrMat->addAttributeArray(confidenceIndex->getName(), confidenceIndex);
+  cellAttrMat->addAttributeArray(quats->getName(), quats);
+  ensembleAttrMat->addAttributeArray(crystalStructures->getName(), crystalStructures);
+
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template<typename T>
+typename DataArray<T>::Pointer GetArray(DataContainerArray::Pointer dca, const QString& attrMatName, const QString& name)
+{
+  AttributeMatrix::Pointer attrMat = dca->getDataContainer(DREAM3D::Defaults::VolumeDataContainerName)->getAttributeMatrix(attrMatName);
+  typename DataArray<T>::Pointer array = attrMat->getAttributeArrayAs<DataArray<T> >(name);
+  DREAM3D_REQUIRE_VALID_POINTER(array.get())
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//  Fills a volume with blocks of a few orientations. A quarter of the Cells are
+//  noise: a random orientation, a low confidence index and marked bad. The two
+//  phases meet along a diagonal and a few Cells get phase 0 or phase 3.
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateNoisyVolume(size_t xPoints, size_t yPoints, size_t zPoints, unsigned int seed)
+{
+  srand(seed);
+  DataContainerArray::Pointer dca = CreateEmptyVolume(xPoints, yPoints, zPoints);
+  Int32ArrayType::Pointer phases = GetArray<int32_t>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases);
+  BoolArrayType::Pointer goodVoxels = GetArray<bool>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::GoodVoxels);
+  FloatArrayType::Pointer confidenceIndex = GetArray<float>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::ConfidenceIndex);
+  FloatArrayType::Pointer quats = GetArray<float>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Quats);
+  QuatF* cellQuats = reinterpret_cast<QuatF*>(quats->getPointer(0));
+
+  std::vector<QuatF> blockQuats(NeighborCleanupTest::NumOrientations);
+  for (int i = 0; i < NeighborCleanupTest::NumOrientations; i++)
+  {
+    blockQuats[i] = QuaternionMathF::New(RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f);
+    QuaternionMathF::UnitQuaternion(blockQuats[i]);
+  }
+
+  size_t index = 0;
+  for (size_t z = 0; z < zPoints; z++)
+  {
+    for (size_t y = 0; y < yPoints; y++)
+    {
+      for (size_t x = 0; x < xPoints; x++)
+      {
+        int32_t phase = (x + y + z < (xPoints + yPoints + zPoints) / 2) ? 1 : 2;
+        if (rand() % 37 == 0) { phase = 0; }
+        else if (rand() % 41 == 0) { phase = 3; }
+        phases->setValue(index, phase);
+
+        if (rand() % 4 == 0)
+        {
+          cellQuats[index] = QuaternionMathF::New(RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f);
+          confidenceIndex->setValue(index, 0.09f * RandomFloat());
+          goodVoxels->setValue(index, false);
+        }
+        else
+        {
+          size_t block = (x / 4 + 2 * (y / 3) + 3 * (z / 2)) % NeighborCleanupTest::NumOrientations;
+          QuaternionMathF::Copy(blockQuats[block], cellQuats[index]);
+          cellQuats[index].x += 0.02f * (RandomFloat() - 0.5f);
+          cellQuats[index].y += 0.02f * (RandomFloat() - 0.5f);
+          cellQuats[index].z += 0.02f * (RandomFloat() - 0.5f);
+          confidenceIndex->setValue(index, 0.1f + 0.9f * RandomFloat());
+          goodVoxels->setValue(index, true);
+        }
+        QuaternionMathF::UnitQuaternion(cellQuats[index]);
+        index++;
+      }
+    }
+  }
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//  Port of the serial loops Neighbor Orientation Correlation used before it
+//  processed worklists: every level sweeps the whole volume, compares all pairs
+//  of neighbors of each low confidence Cell and then copies one Cell at a time.
+//  Pairs in different phases, or in a phase without a known crystal structure,
+//  are not similar.
+// -----------------------------------------------------------------------------
+void SerialNeighborOrientationCorrelation(DataContainerArray::Pointer dca, int level)
+{
+  VolumeDataContainer* m = dca->getDataContainerAs<VolumeDataContainer>(DREAM3D::Defaults::VolumeDataContainerName);
+  AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(DREAM3D::Defaults::CellAttributeMatrixName);
+  QList<QString> voxelArrayNames = cellAttrMat->getAttributeArrayNames();
+  float* confidenceIndex = GetArray<float>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::ConfidenceIndex)->getPointer(0);
+  int32_t* phases = GetArray<int32_t>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases)->getPointer(0);
+  QuatF* quats = reinterpret_cast<QuatF*>(GetArray<float>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Quats)->getPointer(0));
+  unsigned int* crystalStructures = GetArray<unsigned int>(dca, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::EnsembleData::CrystalStructures)->getPointer(0);
+  QVector<OrientationOps::Pointer> ops = OrientationOps::getOrientationOpsQVector();
+
+  float tolerance = NeighborCleanupTest::Tolerance * DREAM3D::Constants::k_Pi / 180.0;
+  size_t udims[3] = { 0, 0, 0 };
+  m->getDimensions(udims);
+  int64_t dims[3] = { static_cast<int64_t>(udims[0]), static_cast<int64_t>(udims[1]), static_cast<int64_t>(udims[2]) };
+  int64_t totalPoints = dims[0] * dims[1] * dims[2];
+  int64_t neighpoints[6] = { -dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1] };
+
+  std::vector<int64_t> bestNeighbor(totalPoints, -1);
+  int neighborSimCount[6] = { 0, 0, 0, 0, 0, 0 };
+  QuatF q1;
+  QuatF q2;
+  float n1, n2, n3;
+
+  for (int currentLevel = 6; currentLevel > level; currentLevel--)
+  {
+    for (int64_t i = 0; i < totalPoints; i++)
+    {
+      if (confidenceIndex[i] >= NeighborCleanupTest::MinConfidence) { continue; }
+      int64_t column = i % dims[0];
+      int64_t row = (i / dims[0]) % dims[1];
+      int64_t plane = i / (dims[0] * dims[1]);
+      bool good[6] = { plane > 0, row > 0, column > 0, column < dims[0] - 1, row < dims[1] - 1, plane < dims[2] - 1 };
+      for (int j = 0; j < 6; j++)
+      {
+        if (good[j] == false) { continue; }
+        int64_t neighbor = i + neighpoints[j];
+        for (int k = j + 1; k < 6; k++)
+        {
+          if (good[k] == false) { continue; }
+          int64_t neighbor2 = i + neighpoints[k];
+          float w = 10000.0f;
+          unsigned int xtal = crystalStructures[phases[neighbor2]];
+          if (phases[neighbor2] == phases[neighbor] && phases[neighbor2] > 0 && xtal < static_cast<unsigned int>(ops.size()))
+          {
+            QuaternionMathF::Copy(quats[neighbor2], q1);
+            QuaternionMathF::Copy(quats[neighbor], q2);
+            w = ops[xtal]->getMisoQuatFast(q1, q2, n1, n2, n3);
+          }
+          if (w < tolerance)
+          {
+            neighborSimCount[j]++;
+            neighborSimCount[k]++;
+          }
+        }
+      }
+      for (int j = 0; j < 6; j++)
+      {
+        if (good[j] == true && neighborSimCount[j] > 0) { bestNeighbor[i] = i + neighpoints[j]; }
+        neighborSimCount[j] = 0;
+      }
+    }
+
+    for (int64_t i = 0; i < totalPoints; i++)
+    {
+      if (bestNeighbor[i] == -1) { continue; }
+      for (QList<QString>::iterator iter = voxelArrayNames.begin(); iter != voxelArrayNames.end(); ++iter)
+      {
+        cellAttrMat->getAttributeArray(*iter)->copyTuple(bestNeighbor[i], i);
+      }
+    }
+    currentLevel = currentLevel - 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//  Port of the serial loops Bad Data Neighbor Orientation Check used before it
+//  processed worklists: count the similar good neighbors of every bad Cell, then
+//  sweep the volume on each level until no more Cells turn good.
+// -----------------------------------------------------------------------------
+void SerialBadDataNeighborOrientationCheck(DataContainerArray::Pointer dca, int numberOfNeighbors)
+{
+  VolumeDataContainer* m = dca->getDataContainerAs<VolumeDataContainer>(DREAM3D::Defaults::VolumeDataContainerName);
+  bool* goodVoxels = GetArray<bool>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::GoodVoxels)->getPointer(0);
+  int32_t* phases = GetArray<int32_t>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases)->getPointer(0);
+  QuatF* quats = reinterpret_cast<QuatF*>(GetArray<float>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Quats)->getPointer(0));
+  unsigned int* crystalStructures = GetArray<unsigned int>(dca, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::EnsembleData::CrystalStructures)->getPointer(0);
+  QVector<OrientationOps::Pointer> ops = OrientationOps::getOrientationOpsQVector();
+
+  float tolerance = NeighborCleanupTest::Tolerance * DREAM3D::Constants::k_Pi / 180.0;
+  size_t udims[3] = { 0, 0, 0 };
+  m->getDimensions(udims);
+  int64_t dims[3] = { static_cast<int64_t>(udims[0]), static_cast<int64_t>(udims[1]), static_cast<int64_t>(udims[2]) };
+  int64_t totalPoints = dims[0] * dims[1] * dims[2];
+  int64_t neighpoints[6] = { -dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1] };
+
+  QuatF q1;
+  QuatF q2;
+  float n1, n2, n3;
+  std::vector<int> neighborCount(totalPoints, 0);
+
+  for (int64_t i = 0; i < totalPoints; i++)
+  {
+    if (goodVoxels[i] == true) { continue; }
+    int64_t column = i % dims[0];
+    int64_t row = (i / dims[0]) % dims[1];
+    int64_t plane = i / (dims[0] * dims[1]);
+    bool good[6] = { plane > 0, row > 0, column > 0, column < dims[0] - 1, row < dims[1] - 1, plane < dims[2] - 1 };
+    for (int j = 0; j < 6; j++)
+    {
+      int64_t neighbor = i + neighpoints[j];
+      if (good[j] == false || goodVoxels[neighbor] == false) { continue; }
+      float w = 10000.0f;
+      unsigned int xtal = crystalStructures[phases[i]];
+      if (phases[i] == phases[neighbor] && phases[i] > 0 && xtal < static_cast<unsigned int>(ops.size()))
+      {
+        QuaternionMathF::Copy(quats[i], q1);
+        QuaternionMathF::Copy(quats[neighbor], q2);
+        w = ops[xtal]->getMisoQuatFast(q1, q2, n1, n2, n3);
+      }
+      if (w < tolerance) { neighborCount[i]++; }
+    }
+  }
+
+  for (int currentLevel = 6; currentLevel > numberOfNeighbors; currentLevel--)
+  {
+    int counter = 1;
+    while (counter > 0)
+    {
+      counter = 0;
+      for (int64_t i = 0; i < totalPoints; i++)
+      {
+        if (neighborCount[i] < currentLevel || goodVoxels[i] == true) { continue; }
+        goodVoxels[i] = true;
+        counter++;
+        int64_t column = i % dims[0];
+        int64_t row = (i / dims[0]) % dims[1];
+        int64_t plane = i / (dims[0] * dims[1]);
+        bool good[6] = { plane > 0, row > 0, column > 0, column < dims[0] - 1, row < dims[1] - 1, plane < dims[2] - 1 };
+        for (int j = 0; j < 6; j++)
+        {
+          int64_t neighbor = i + neighpoints[j];
+          if (good[j] == false || goodVoxels[neighbor] == true) { continue; }
+          float w = 10000.0f;
+          unsigned int xtal = crystalStructures[phases[i]];
+          if (phases[i] == phases[neighbor] && phases[i] > 0 && xtal < static_cast<unsigned int>(ops.size()))
+          {
+            QuaternionMathF::Copy(quats[i], q1);
+            QuaternionMathF::Copy(quats[neighbor], q2);
+            w = ops[xtal]->getMisoQuatFast(q1, q2, n1, n2, n3);
+          }
+          if (w < tolerance) { neighborCount[neighbor]++; }
+        }
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template<typename T>
+size_t RequireSameCells(DataContainerArray::Pointer expected, DataContainerArray::Pointer actual, DataContainerArray::Pointer original, const QString& name)
+{
+  typename DataArray<T>::Pointer expectedArray = GetArray<T>(expected, DREAM3D::Defaults::CellAttributeMatrixName, name);
+  typename DataArray<T>::Pointer actualArray = GetArray<T>(actual, DREAM3D::Defaults::CellAttributeMatrixName, name);
+  typename DataArray<T>::Pointer originalArray = GetArray<T>(original, DREAM3D::Defaults::CellAttributeMatrixName, name);
+  DREAM3D_REQUIRE_EQUAL(expectedArray->getSize(), actualArray->getSize())
+  size_t changed = 0;
+  for (size_t i = 0; i < expectedArray->getSize(); i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(expectedArray->getValue(i), actualArray->getValue(i))
+    if (expectedArray->getValue(i) != originalArray->getValue(i)) { changed++; }
+  }
+  return changed;
+}
+
+// -----------------------------------------------------------------------------
+//  The filter has to copy exactly the tuples the serial loops copy, on every level.
+// -----------------------------------------------------------------------------
+void CheckNeighborOrientationCorrelation(size_t xPoints, size_t yPoints, size_t zPoints)
+{
+  DataContainerArray::Pointer original = CreateNoisyVolume(xPoints, yPoints, zPoints, 2468);
+  for (int level = 5; level >= 0; level--)
+  {
+    DataContainerArray::Pointer expected = CreateNoisyVolume(xPoints, yPoints, zPoints, 2468);
+    SerialNeighborOrientationCorrelation(expected, level);
+
+    DataContainerArray::Pointer actual = CreateNoisyVolume(xPoints, yPoints, zPoints, 2468);
+    NeighborOrientationCorrelation::Pointer filter = NeighborOrientationCorrelation::New();
+    filter->setDataContainerArray(actual);
+    filter->setMinConfidence(NeighborCleanupTest::MinConfidence);
+    filter->setMisorientationTolerance(NeighborCleanupTest::Tolerance);
+    filter->setLevel(level);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    size_t changed = RequireSameCells<float>(expected, actual, original, DREAM3D::CellData::Quats);
+    RequireSameCells<float>(expected, actual, original, DREAM3D::CellData::ConfidenceIndex);
+    RequireSameCells<int32_t>(expected, actual, original, DREAM3D::CellData::Phases);
+    RequireSameCells<bool>(expected, actual, original, DREAM3D::CellData::GoodVoxels);
+    DREAM3D_REQUIRE(changed > 0)
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestNeighborOrientationCorrelationMatchesSerialLoops()
+{
+  CheckNeighborOrientationCorrelation(17, 13, 9);
+  CheckNeighborOrientationCorrelation(23, 19, 1);
+}
+
+// -----------------------------------------------------------------------------
+//  The filter has to turn exactly the Cells good that the serial loops do, for
+//  every required number of neighbors.
+// -----------------------------------------------------------------------------
+void CheckBadDataNeighborOrientationCheck(size_t xPoints, size_t yPoints, size_t zPoints)
+{
+  DataContainerArray::Pointer original = CreateNoisyVolume(xPoints, yPoints, zPoints, 1357);
+  size_t previous = 0;
+  for (int numberOfNeighbors = 6; numberOfNeighbors >= 0; numberOfNeighbors--)
+  {
+    DataContainerArray::Pointer expected = CreateNoisyVolume(xPoints, yPoints, zPoints, 1357);
+    SerialBadDataNeighborOrientationCheck(expected, numberOfNeighbors);
+
+    DataContainerArray::Pointer actual = CreateNoisyVolume(xPoints, yPoints, zPoints, 1357);
+    BadDataNeighborOrientationCheck::Pointer filter = BadDataNeighborOrientationCheck::New();
+    filter->setDataContainerArray(actual);
+    filter->setMisorientationTolerance(NeighborCleanupTest::Tolerance);
+    filter->setNumberOfNeighbors(numberOfNeighbors);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    size_t flipped = RequireSameCells<bool>(expected, actual, original, DREAM3D::CellData::GoodVoxels);
+    // Requiring fewer neighbors can only turn more Cells good
+    DREAM3D_REQUIRE(flipped >= previous)
+    previous = flipped;
+  }
+  DREAM3D_REQUIRE(previous > 0)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestBadDataNeighborOrientationCheckMatchesSerialLoops()
+{
+  CheckBadDataNeighborOrientationCheck(17, 13, 9);
+  CheckBadDataNeighborOrientationCheck(23, 19, 1);
+}
+
+// -----------------------------------------------------------------------------
+//  The bad center Cell of a 3x3x3 block has 3 face neighbors in its own phase and
+//  3 in the other phase, alternating, all with the same orientation. Only the 3 in
+//  its own phase count, so the Cell turns good once 3 neighbors are enough.
+// -----------------------------------------------------------------------------
+void TestBadDataMixedPhases()
+{
+  const int32_t neighborPhases[6] = { 1, 2, 1, 2, 1, 2 };
+  for (int numberOfNeighbors = 5; numberOfNeighbors >= 1; numberOfNeighbors--)
+  {
+    DataContainerArray::Pointer dca = CreateEmptyVolume(3, 3, 3);
+    BoolArrayType::Pointer goodVoxels = GetArray<bool>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::GoodVoxels);
+    Int32ArrayType::Pointer phases = GetArray<int32_t>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases);
+    const int64_t center = 13;
+    const int64_t neighbors[6] = { center - 9, center - 3, center - 1, center + 1, center + 3, center + 9 };
+    goodVoxels->setValue(center, false);
+    for (int j = 0; j < 6; j++)
+    {
+      phases->setValue(neighbors[j], neighborPhases[j]);
+    }
+
+    BadDataNeighborOrientationCheck::Pointer filter = BadDataNeighborOrientationCheck::New();
+    filter->setDataContainerArray(dca);
+    filter->setMisorientationTolerance(NeighborCleanupTest::Tolerance);
+    filter->setNumberOfNeighbors(numberOfNeighbors);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    DREAM3D_REQUIRE_EQUAL(goodVoxels->getValue(center), (numberOfNeighbors < 3))
+  }
+}
+
+// -----------------------------------------------------------------------------
+//  The low confidence center Cell of a 3x3x3 block has two matching face neighbors
+//  in its own phase (-Z and -Y) and four in the other phase whose orientations are
+//  20 degrees apart. Only the -Y neighbor is the last one that is similar to
+//  another, so its tuple is copied into the center and nothing else changes.
+// -----------------------------------------------------------------------------
+void TestNeighborOrientationCorrelationMixedPhases()
+{
+  DataContainerArray::Pointer dca = CreateEmptyVolume(3, 3, 3);
+  FloatArrayType::Pointer confidenceIndex = GetArray<float>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::ConfidenceIndex);
+  Int32ArrayType::Pointer phases = GetArray<int32_t>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases);
+  FloatArrayType::Pointer quats = GetArray<float>(dca, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Quats);
+  QuatF* cellQuats = reinterpret_cast<QuatF*>(quats->getPointer(0));
+
+  const int64_t center = 13;
+  const int64_t neighbors[6] = { center - 9, center - 3, center - 1, center + 1, center + 3, center + 9 };
+  confidenceIndex->setValue(center, 0.0f);
+  confidenceIndex->setValue(neighbors[1], 0.75f);
+  cellQuats[center] = QuaternionMathF::New(0.0f, 0.0f, 1.0f, 0.0f);
+  for (int j = 2; j < 6; j++)
+  {
+    float angle = 20.0f * (j - 1) * DREAM3D::Constants::k_Pi / 180.0f;
+    cellQuats[neighbors[j]] = QuaternionMathF::New(sinf(0.5f * angle), 0.0f, 0.0f, cosf(0.5f * angle));
+    phases->setValue(neighbors[j], 2);
+  }
+  std::vector<float> quatsBefore(quats->getPointer(0), quats->getPointer(0) + quats->getSize());
+
+  NeighborOrientationCorrelation::Pointer filter = NeighborOrientationCorrelation::New();
+  filter->setDataContainerArray(dca);
+  filter->setMinConfidence(NeighborCleanupTest::MinConfidence);
+  filter->setMisorientationTolerance(NeighborCleanupTest::Tolerance);
+  filter->setLevel(5);
+  filter->execute();
+  DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+  for (int64_t i = 0; i < 27; i++)
+  {
+    int64_t source = (i == center) ? neighbors[1] : i;
+    for (int c = 0; c < 4; c++)
+    {
+      DREAM3D_REQUIRE_EQUAL(quats->getComponent(i, c), quatsBefore[4 * source + c])
+    }
+  }
+  DREAM3D_REQUIRE_EQUAL(confidenceIndex->getValue(center), 0.75f)
+  DREAM3D_REQUIRE_EQUAL(phases->getValue(center), 1)
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  // Instantiate the QCoreApplication that we need to get the current path and load plugins.
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("NeighborOrientationCleanupTest");
+
+  int err = EXIT_SUCCESS;
+
+  DREAM3D_REGISTER_TEST( TestNeighborOrientationCorrelationMatchesSerialLoops() )
+  DREAM3D_REGISTER_TEST( TestBadDataNeighborOrientationCheckMatchesSerialLoops() )
+  DREAM3D_REGISTER_TEST( TestBadDataMixedPhases() )
+  DREAM3D_REGISTER_TEST( TestNeighborOrientationCorrelationMixedPhases() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
@@ -233,7 +233,10 @@ void AlignSections::execute()
     }
   }
 
-  QList<QString> voxelArrayNames = m->getAttributeMatrix(getCellAttributeMatrixName())->getAttributeArrayNames();
+  AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
+  QVector<size_t> srcIdxs;
+  QVector<size_t> destIdxs;
+  QVector<size_t> clearIdxs;
   DimType progIncrement = dims[2] / 100;
   DimType prog = 1;
   int progressInt = 0;
@@ -252,7 +255,13 @@ void AlignSections::execute()
     {
       return;
     }
+    if(xshifts[i] == 0 && yshifts[i] == 0) { continue; }
     slice = static_cast<int>( (dims[2] - 1) - i );
+    // The walk order reads every source before it is overwritten and never reads a cleared cell again, so the
+    // copies can be applied in order followed by the clears
+    srcIdxs.clear();
+    destIdxs.clear();
+    clearIdxs.clear();
     for (DimType l = 0; l < dims[1]; l++)
     {
       for (DimType n = 0; n < dims[0]; n++)
@@ -266,25 +275,17 @@ void AlignSections::execute()
         if((yspot + yshifts[i]) >= 0 && (yspot + yshifts[i]) <= dims[1] - 1 && (xspot + xshifts[i]) >= 0
             && (xspot + xshifts[i]) <= dims[0] - 1)
         {
-          for(QList<QString>::iterator iter = voxelArrayNames.begin(); iter != voxelArrayNames.end(); ++iter)
-          {
-            QString name = *iter;
-            IDataArray::Pointer p = m->getAttributeMatrix(getCellAttributeMatrixName())->getAttributeArray(*iter);
-            p->copyTuple(currentPosition, newPosition);
-          }
+          srcIdxs.push_back(currentPosition);
+          destIdxs.push_back(newPosition);
         }
-        if((yspot + yshifts[i]) < 0 || (yspot + yshifts[i]) > dims[1] - 1 || (xspot + xshifts[i]) < 0
-            || (xspot + xshifts[i]) > dims[0] - 1)
+        else
         {
-          for(QList<QString>::iterator iter = voxelArrayNames.begin(); iter != voxelArrayNames.end(); ++iter)
-          {
-            QString name = *iter;
-            IDataArray::Pointer p = m->getAttributeMatrix(getCellAttributeMatrixName())->getAttributeArray(*iter);
-            p->initializeTuple(newPosition, 0.0);
-          }
+          clearIdxs.push_back(newPosition);
         }
       }
     }
+    cellAttrMat->copyTuples(srcIdxs, destIdxs);
+    cellAttrMat->fillTuples(clearIdxs, 0.0);
   }
 
   // If there is an error set this to something negative and also set a message
@@ -98,7 +98,7 @@ class AlignSectionsFeatureCentroid : public AlignSections
     virtual void readFilterParameters(AbstractFilterParametersReader* reader, int index);
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, GoodVoxels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, GoodVoxels)
 
     void dataCheck();
 
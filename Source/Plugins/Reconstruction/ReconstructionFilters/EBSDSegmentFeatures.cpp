@@ -68,6 +68,8 @@ EBSDSegmentFeatures::EBSDSegmentFeatures() :
   m_CellPhasesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases),
   m_CrystalStructuresArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::EnsembleData::CrystalStructures),
   m_QuatsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Quats),
+  m_UseFaceMisorientations(false),
+  m_FaceMisorientationsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::FaceMisorientations),
   m_FeatureIdsArrayName(DREAM3D::CellData::FeatureIds),
   m_ActiveArrayName(DREAM3D::FeatureData::Active),
   m_FeatureIds(NULL),
@@ -79,7 +81,9 @@ EBSDSegmentFeatures::EBSDSegmentFeatures() :
   m_GoodVoxels(NULL),
   m_Active(NULL),
   m_CrystalStructuresArrayName(DREAM3D::EnsembleData::CrystalStructures),
-  m_CrystalStructures(NULL)
+  m_CrystalStructures(NULL),
+  m_FaceMisorientationsArrayName(DREAM3D::CellData::FaceMisorientations),
+  m_FaceMisorientations(NULL)
 {
   m_OrientationOps = OrientationOps::getOrientationOpsQVector();
 
@@ -109,6 +113,9 @@ void EBSDSegmentFeatures::setupFilterParameters()
   QStringList linkedProps("GoodVoxelsArrayPath");
   parameters.push_back(LinkedBooleanFilterParameter::New("Use GoodVoxels Array", "UseGoodVoxels", getUseGoodVoxels(), linkedProps, false));
   parameters.push_back(FilterParameter::New("GoodVoxels", "GoodVoxelsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getGoodVoxelsArrayPath(), false, ""));
+  QStringList faceLinkedProps("FaceMisorientationsArrayPath");
+  parameters.push_back(LinkedBooleanFilterParameter::New("Use Precomputed Face Misorientations", "UseFaceMisorientations", getUseFaceMisorientations(), faceLinkedProps, false));
+  parameters.push_back(FilterParameter::New("Face Misorientations", "FaceMisorientationsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getFaceMisorientationsArrayPath(), false, ""));
 
   parameters.push_back(FilterParameter::New("Created Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
   parameters.push_back(FilterParameter::New("FeatureIds", "FeatureIdsArrayName", FilterParameterWidgetType::StringWidget, getFeatureIdsArrayName(), true, ""));
@@ -131,6 +138,8 @@ void EBSDSegmentFeatures::readFilterParameters(AbstractFilterParametersReader* r
   setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath() ) );
   setGoodVoxelsArrayPath(reader->readDataArrayPath("GoodVoxelsArrayPath", getGoodVoxelsArrayPath() ) );
   setUseGoodVoxels(reader->readValue("UseGoodVoxels", getUseGoodVoxels() ) );
+  setUseFaceMisorientations(reader->readValue("UseFaceMisorientations", getUseFaceMisorientations() ) );
+  setFaceMisorientationsArrayPath(reader->readDataArrayPath("FaceMisorientationsArrayPath", getFaceMisorientationsArrayPath() ) );
   setMisorientationTolerance( reader->readValue("MisorientationTolerance", getMisorientationTolerance()) );
   reader->closeFilterGroup();
 }
@@ -149,6 +158,8 @@ int EBSDSegmentFeatures::writeFilterParameters(AbstractFilterParametersWriter* w
   DREAM3D_FILTER_WRITE_PARAMETER(CellPhasesArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(GoodVoxelsArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(UseGoodVoxels)
+  DREAM3D_FILTER_WRITE_PARAMETER(UseFaceMisorientations)
+  DREAM3D_FILTER_WRITE_PARAMETER(FaceMisorientationsArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(MisorientationTolerance)
   writer->closeFilterGroup();
   return ++index; // we want to return the next index that was just written to
@@ -187,11 +198,11 @@ void EBSDSegmentFeatures::dataCheck()
   {
     m_GoodVoxelsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getGoodVoxelsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
     if( NULL != m_GoodVoxelsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-    { m_GoodVoxels = m_GoodVoxelsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    { m_GoodVoxels = m_GoodVoxelsPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   }
   m_CellPhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getCellPhasesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_CellPhasesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_CellPhases = m_CellPhasesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
 
   tempPath.update(getDataContainerName(), m_QuatsArrayPath.getAttributeMatrixName(), getFeatureIdsArrayName() );
   m_FeatureIdsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this,  tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
@@ -211,6 +222,15 @@ void EBSDSegmentFeatures::dataCheck()
   m_QuatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getQuatsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_QuatsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
   { m_Quats = m_QuatsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+
+  m_FaceMisorientations = NULL;
+  if(m_UseFaceMisorientations == true)
+  {
+    dims[0] = 3;
+    m_FaceMisorientationsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getFaceMisorientationsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_FaceMisorientationsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_FaceMisorientations = m_FaceMisorientationsPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -247,6 +267,11 @@ void EBSDSegmentFeatures::execute()
 
   //Convert user defined tolerance to radians.
   misoTolerance = m_MisorientationTolerance * DREAM3D::Constants::k_Pi / 180.0f;
+  size_t udims[3] = { 0, 0, 0 };
+  m->getDimensions(udims);
+  m_FaceStrides[0] = 1;
+  m_FaceStrides[1] = static_cast<int64_t>(udims[0]);
+  m_FaceStrides[2] = static_cast<int64_t>(udims[0] * udims[1]);
   for(int64_t i = 0; i < totalPoints; i++)
   {
     m_FeatureIds[i] = 0;
@@ -386,7 +411,14 @@ bool EBSDSegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neig
 
     if (m_CellPhases[referencepoint] == m_CellPhases[neighborpoint])
     {
-      w = m_OrientationOps[phase1]->getMisoQuat( q1, q2, n1, n2, n3);
+      if (NULL != m_FaceMisorientations)
+      {
+        w = getFaceMisorientation(referencepoint, neighborpoint);
+      }
+      else
+      {
+        w = m_OrientationOps[phase1]->getMisoQuatFast( q1, q2, n1, n2, n3);
+      }
     }
     if (w < misoTolerance)
     {
@@ -398,6 +430,21 @@ bool EBSDSegmentFeatures::determineGrouping(int64_t referencepoint, int64_t neig
   return group;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float EBSDSegmentFeatures::getFaceMisorientation(int64_t referencepoint, int64_t neighborpoint)
+{
+  // The face is stored on whichever of the two Cells has the lower index. The Z stride is tested first so that
+  // flat volumes, where two of the strides are equal, still pick the only direction that can have a neighbor.
+  int64_t owner = (neighborpoint > referencepoint) ? referencepoint : neighborpoint;
+  int64_t stride = (neighborpoint > referencepoint) ? (neighborpoint - referencepoint) : (referencepoint - neighborpoint);
+  int component = 0;
+  if (stride == m_FaceStrides[2]) { component = 2; }
+  else if (stride == m_FaceStrides[1]) { component = 1; }
+  return m_FaceMisorientations[3 * owner + component];
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -98,6 +98,12 @@ class EBSDSegmentFeatures : public SegmentFeatures
     DREAM3D_FILTER_PARAMETER(DataArrayPath, QuatsArrayPath)
     Q_PROPERTY(DataArrayPath QuatsArrayPath READ getQuatsArrayPath WRITE setQuatsArrayPath)
 
+    DREAM3D_FILTER_PARAMETER(bool, UseFaceMisorientations)
+    Q_PROPERTY(bool UseFaceMisorientations READ getUseFaceMisorientations WRITE setUseFaceMisorientations)
+
+    DREAM3D_FILTER_PARAMETER(DataArrayPath, FaceMisorientationsArrayPath)
+    Q_PROPERTY(DataArrayPath FaceMisorientationsArrayPath READ getFaceMisorientationsArrayPath WRITE setFaceMisorientationsArrayPath)
+
     DREAM3D_FILTER_PARAMETER(QString, FeatureIdsArrayName)
     Q_PROPERTY(QString FeatureIdsArrayName READ getFeatureIdsArrayName WRITE setFeatureIdsArrayName)
 
@@ -142,11 +148,12 @@ class EBSDSegmentFeatures : public SegmentFeatures
 
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Quats)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, GoodVoxels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, GoodVoxels)
     DEFINE_CREATED_DATAARRAY_VARIABLE(bool, Active)
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, FaceMisorientations)
 
     ///Boost Random Number generator stuff. We use the boost::shared_ptr to ensure the pointers are cleaned up when the
     ///filter is deleted
@@ -156,6 +163,15 @@ class EBSDSegmentFeatures : public SegmentFeatures
     size_t                       m_TotalRandomNumbersGenerated;
 
     float misoTolerance;
+    int64_t m_FaceStrides[3];
+
+    /**
+     * @brief getFaceMisorientation Looks up the precomputed misorientation across the face shared by two neighboring Cells
+     * @param referencepoint
+     * @param neighborpoint
+     * @return
+     */
+    float getFaceMisorientation(int64_t referencepoint, int64_t neighborpoint);
 
     /**
      * @brief randomizeGrainIds
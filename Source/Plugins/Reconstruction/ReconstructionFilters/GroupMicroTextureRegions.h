@@ -170,12 +170,12 @@ class GroupMicroTextureRegions : public GroupFeatures
     void initializeVoxelSeedGenerator(const size_t rangeMin, const size_t rangeMax);
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, CellParentIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FeatureParentIds)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AvgQuats)
     DEFINE_CREATED_DATAARRAY_VARIABLE(bool, Active)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Volumes)
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
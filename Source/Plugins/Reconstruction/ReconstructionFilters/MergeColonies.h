@@ -143,14 +143,14 @@ class MergeColonies : public GroupFeatures
     void identify_globAlpha();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, CellParentIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FeatureParentIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, GlobAlpha)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AvgQuats)
     DEFINE_CREATED_DATAARRAY_VARIABLE(bool, Active)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
 
@@ -138,7 +138,7 @@ class ScalarSegmentFeatures : public SegmentFeatures
     IDataArray::Pointer m_InputData;
 
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, GoodVoxels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, GoodVoxels)
     DEFINE_CREATED_DATAARRAY_VARIABLE(bool, Active)
 
     boost::shared_ptr<CompareFunctor> m_Compare;
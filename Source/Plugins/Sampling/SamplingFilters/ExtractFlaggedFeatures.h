@@ -108,8 +108,8 @@ class ExtractFlaggedFeatures : public AbstractFilter
     Int32ArrayType::Pointer boundsPtr;
     int32_t* m_FeatureBounds;
 
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, FlaggedFeatures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, FlaggedFeatures)
 
     virtual void find_feature_bounds();
 
@@ -184,6 +184,10 @@ void NearestPointFuseRegularGrids::execute()
     refAttrMat->addAttributeArray(p->getName(), data);
   }
 
+  // Find the sampling grid point for every reference grid point first, then move each array in one pass
+  size_t numSampleTuples = sampleAttrMat->getNumTuples();
+  QVector<size_t> sampleIdxs;
+  QVector<size_t> refIdxs;
   bool outside  = false;
   for (int i = 0; i < refDims[2]; i++)
   {
@@ -203,29 +207,30 @@ void NearestPointFuseRegularGrids::execute()
         if(col < 0 || col > sampleDims[0] ||  row < 0 || row > sampleDims[1] ||  plane < 0 || plane > sampleDims[2]) outside = true;
         sampleIndex = (plane * sampleDims[0] * sampleDims[1]) + (row * sampleDims[0]) + col;
         refIndex = planeComp + rowComp + k;
-        if(outside == false)
+        if(outside == false && sampleIndex < numSampleTuples)
         {
-          for (QList<QString>::iterator iter = voxelArrayNames.begin(); iter != voxelArrayNames.end(); ++iter)
-          {
-            QString name = *iter;
-            IDataArray::Pointer p = sampleAttrMat->getAttributeArray(*iter);
-            // Make a copy of the 'p' array that has the same name. When placed into
-            // the data container this will over write the current array with
-            // the same name. At least in theory
-            IDataArray::Pointer data = refAttrMat->getAttributeArray(*iter);
-            void* source = NULL;
-            void* destination = NULL;
-            int nComp = data->getNumberOfComponents();
-
-            source = p->getVoidPointer((nComp * sampleIndex));
-            destination = data->getVoidPointer((nComp * refIndex));
-            ::memcpy(destination, source, p->getTypeSize() * nComp);
-          }
+          sampleIdxs.push_back(sampleIndex);
+          refIdxs.push_back(refIndex);
         }
       }
     }
   }
 
+  size_t numCopies = static_cast<size_t>(sampleIdxs.size());
+  for (QList<QString>::iterator iter = voxelArrayNames.begin(); iter != voxelArrayNames.end(); ++iter)
+  {
+    IDataArray::Pointer p = sampleAttrMat->getAttributeArray(*iter);
+    IDataArray::Pointer data = refAttrMat->getAttributeArray(*iter);
+    if(numCopies == 0 || p->getSize() == 0 || data->getSize() == 0) { continue; }
+    size_t tupleBytes = p->getTypeSize() * data->getNumberOfComponents();
+    uint8_t* source = reinterpret_cast<uint8_t*>(p->getVoidPointer(0));
+    uint8_t* destination = reinterpret_cast<uint8_t*>(data->getVoidPointer(0));
+    for (size_t i = 0; i < numCopies; i++)
+    {
+      ::memcpy(destination + (refIdxs[i] * tupleBytes), source + (sampleIdxs[i] * tupleBytes), tupleBytes);
+    }
+  }
+
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
@@ -117,7 +117,7 @@ class OrientationBinModeFilter : public AbstractFilter
 
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
 
     void dataCheck();
     void updateCellInstancePointers();
@@ -114,7 +114,7 @@ class SampleSurfaceMesh : public AbstractFilter
     virtual void assign_points(Int32ArrayType::Pointer iArray);
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
 
     SampleSurfaceMesh(const SampleSurfaceMesh&); // Copy Constructor Not Implemented
     void operator=(const SampleSurfaceMesh&); // Operator '=' Not Implemented
@@ -116,7 +116,7 @@ signals:
     void dataCheck();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, VectorData)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, VectorData)
 
     DoubleArrayType::Pointer m_LambertProj;
 
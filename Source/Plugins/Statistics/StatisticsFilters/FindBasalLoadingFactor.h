@@ -122,7 +122,7 @@ class FindBasalLoadingFactor : public AbstractFilter
     QVector<OrientationOps::Pointer> m_OrientationOps;
 
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, BasalLoadingFactor)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AvgQuats)
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
@@ -114,8 +114,8 @@ class FindBoundaryCellFractions : public AbstractFilter
     void find_surface_voxel_fractions();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int8_t, BoundaryCells)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int8_t, BoundaryCells)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, BoundaryCellFractions)
 
     void dataCheck();
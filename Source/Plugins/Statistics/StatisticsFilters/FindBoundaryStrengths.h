@@ -149,11 +149,11 @@ class FindBoundaryStrengths : public AbstractFilter
     HexagonalOps::Pointer m_HexOps;
     OrthoRhombicOps::Pointer m_OrthoOps;
 
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AvgQuats)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
 
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, SurfaceMeshF1s)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, SurfaceMeshF1spts)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, SurfaceMeshF7s)
@@ -117,7 +117,7 @@ void FindDirectionalModuli::dataCheck()
   //check feature phases
   m_FeaturePhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getFeaturePhasesArrayPath(), dims);
   if( NULL != m_FeaturePhasesPtr.lock().get() )
-  { m_FeaturePhases = m_FeaturePhasesPtr.lock()->getPointer(0); }
+  { m_FeaturePhases = m_FeaturePhasesPtr.lock()->getConstPointer(0); }
 
   //check crystal structures
   m_CrystalStructuresPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<unsigned int>, AbstractFilter>(this, getCrystalStructuresArrayPath(), dims);
@@ -135,7 +135,7 @@ void FindDirectionalModuli::dataCheck()
   QVector<size_t> complianceDims(2, 6);
   m_CrystalCompliancesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getCrystalCompliancesArrayPath(), complianceDims);
   if( NULL != m_CrystalCompliancesPtr.lock().get() )
-  { m_CrystalCompliances = m_CrystalCompliancesPtr.lock()->getPointer(0); }
+  { m_CrystalCompliances = m_CrystalCompliancesPtr.lock()->getConstPointer(0); }
 
   //make sure the direction isn't undefined
   if(0 == m_LoadingDirection.x && 0 == m_LoadingDirection.y && 0 == m_LoadingDirection.z)
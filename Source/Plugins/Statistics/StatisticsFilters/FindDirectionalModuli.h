@@ -105,11 +105,11 @@ class FindDirectionalModuli : public AbstractFilter
     OrthoRhombicOps::Pointer m_OrthoOps;
 
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, DirectionalModuli)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AvgQuats)
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, CrystalCompliances)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, CrystalCompliances)
 
     void dataCheck();
 
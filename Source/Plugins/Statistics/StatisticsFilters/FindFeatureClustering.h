@@ -144,12 +144,12 @@ class FindFeatureClustering : public AbstractFilter
     void find_clustering();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Centroids)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, EquivalentDiameters)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, Centroids)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, EquivalentDiameters)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, NewEnsembleArray)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, MaxMinArray)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, BiasedFeatures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, BiasedFeatures)
     NeighborList<float>::WeakPointer m_ClusteringList;
 
     std::vector<float> m_RandomCentroids;
@@ -138,10 +138,10 @@ class FindFeatureReferenceCAxisMisorientations : public AbstractFilter
     HexagonalOps::Pointer m_HexOps;
     OrthoRhombicOps::Pointer m_OrthoOps;
 
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Quats)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AvgCAxes)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, AvgCAxes)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, FeatureReferenceCAxisMisorientations)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, FeatureAvgCAxisMisorientations)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, FeatureStdevCAxisMisorientations)
@@ -0,0 +1,794 @@
+/* ============================================================================
+ * Copyright (c) 2011 Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2011 Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FindFeatureStatisticsSinglePass.h"
+
+#include <vector>
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "DREAM3DLib/Math/DREAM3DMath.h"
+#include "DREAM3DLib/Common/Constants.h"
+#include "DREAM3DLib/Math/QuaternionMath.hpp"
+#include "OrientationLib/Math/OrientationMath.h"
+
+#include "Statistics/StatisticsConstants.h"
+#include "Statistics/StatisticsFilters/FindShapes.h"
+
+/**
+ * @brief The FeatureStatisticsSums class holds the raw per-Feature sums that all of the requested
+ * statistics are derived from. Every sum is an integer: the centroid and second moment sums are
+ * voxel indices and the orientation sums are 32.32 fixed point. Adding up the sums of any partition
+ * of the rows is therefore exact, and the final values do not depend on how TBB split the rows or
+ * in which order the per thread sums are combined.
+ */
+class FeatureStatisticsSums
+{
+  public:
+    FeatureStatisticsSums() {}
+    virtual ~FeatureStatisticsSums() {}
+
+    void allocate(size_t numFeatures, bool doCentroids, bool doMoments, bool doQuats)
+    {
+      m_Counts.assign(numFeatures, 0);
+      if (doCentroids == true) { m_Sums.assign(numFeatures * 3, 0); }
+      if (doMoments == true) { m_SecondSums.assign(numFeatures * 6, 0); }
+      if (doQuats == true)
+      {
+        m_QuatCounts.assign(numFeatures, 0);
+        m_QuatSums.assign(numFeatures * 4, 0);
+        m_FirstQuatIndex.assign(numFeatures, -1);
+      }
+    }
+
+    /**
+     * @brief addMoments Adds the counts and the geometric sums of another set of rows. The first
+     * voxel of each Feature is the one with the lowest index, so it is also independent of the order.
+     */
+    void addMoments(const FeatureStatisticsSums& rhs)
+    {
+      for (size_t i = 0; i < m_Counts.size(); i++)
+      {
+        m_Counts[i] += rhs.m_Counts[i];
+      }
+      for (size_t i = 0; i < m_Sums.size(); i++)
+      {
+        m_Sums[i] += rhs.m_Sums[i];
+      }
+      for (size_t i = 0; i < m_SecondSums.size(); i++)
+      {
+        m_SecondSums[i] += rhs.m_SecondSums[i];
+      }
+      for (size_t i = 0; i < m_QuatCounts.size(); i++)
+      {
+        m_QuatCounts[i] += rhs.m_QuatCounts[i];
+        if (rhs.m_FirstQuatIndex[i] >= 0 && (m_FirstQuatIndex[i] < 0 || rhs.m_FirstQuatIndex[i] < m_FirstQuatIndex[i]))
+        {
+          m_FirstQuatIndex[i] = rhs.m_FirstQuatIndex[i];
+        }
+      }
+    }
+
+    /**
+     * @brief addOrientations Adds the fixed point orientation sums of another set of rows
+     */
+    void addOrientations(const FeatureStatisticsSums& rhs)
+    {
+      for (size_t i = 0; i < m_QuatSums.size(); i++)
+      {
+        m_QuatSums[i] += rhs.m_QuatSums[i];
+      }
+    }
+
+    std::vector<int64_t> m_Counts;
+    std::vector<int64_t> m_Sums;
+    std::vector<int64_t> m_SecondSums;
+    std::vector<int64_t> m_QuatCounts;
+    std::vector<int64_t> m_QuatSums;
+    std::vector<int64_t> m_FirstQuatIndex;
+};
+
+/**
+ * @brief The FeatureStatisticsAccumulator class sweeps a range of rows (z * yPoints + y) of the
+ * FeatureIds and adds the voxels into a FeatureStatisticsSums. It holds no per-Feature state of its
+ * own, so one instance is shared by all of the threads and each thread adds into its own sums.
+ *
+ * The orientations are summed in a second sweep once the first voxel of every Feature is known:
+ * each voxel is rotated onto the symmetric equivalent closest to that first voxel, instead of onto
+ * the running average as FindAvgOrientations does. The reference is the same for every thread,
+ * which is what makes the sums independent of the order. For Features whose spread is well below
+ * the misorientation between symmetric equivalents both references select the same equivalents.
+ */
+class FeatureStatisticsAccumulator
+{
+  public:
+    FeatureStatisticsAccumulator(int32_t* featureIds, size_t xPoints, size_t yPoints,
+                                 bool doCentroids, bool doMoments,
+                                 int32_t* cellPhases, float* quats, unsigned int* crystalStructures,
+                                 QVector<OrientationOps::Pointer> orientationOps) :
+      m_FeatureIds(featureIds),
+      m_XPoints(xPoints),
+      m_YPoints(yPoints),
+      m_DoCentroids(doCentroids || doMoments),
+      m_DoMoments(doMoments),
+      m_CellPhases(cellPhases),
+      m_Quats(quats),
+      m_CrystalStructures(crystalStructures),
+      m_OrientationOps(orientationOps)
+    {
+    }
+
+    virtual ~FeatureStatisticsAccumulator() {}
+
+    /**
+     * @brief accumulateMoments Adds the voxel counts, the centroid and second moment sums and the
+     * first orientation voxel of each Feature for the rows [rowStart, rowEnd)
+     */
+    void accumulateMoments(size_t rowStart, size_t rowEnd, FeatureStatisticsSums& sums) const
+    {
+      for (size_t row = rowStart; row < rowEnd; row++)
+      {
+        int64_t j = static_cast<int64_t>(row % m_YPoints);
+        int64_t i = static_cast<int64_t>(row / m_YPoints);
+        size_t rowStride = row * m_XPoints;
+        for (size_t kk = 0; kk < m_XPoints; kk++)
+        {
+          size_t index = rowStride + kk;
+          int32_t gnum = m_FeatureIds[index];
+          sums.m_Counts[gnum]++;
+          if (m_DoCentroids == true)
+          {
+            int64_t k = static_cast<int64_t>(kk);
+            sums.m_Sums[3 * gnum + 0] += k;
+            sums.m_Sums[3 * gnum + 1] += j;
+            sums.m_Sums[3 * gnum + 2] += i;
+            if (m_DoMoments == true)
+            {
+              sums.m_SecondSums[6 * gnum + 0] += k * k;
+              sums.m_SecondSums[6 * gnum + 1] += j * j;
+              sums.m_SecondSums[6 * gnum + 2] += i * i;
+              sums.m_SecondSums[6 * gnum + 3] += k * j;
+              sums.m_SecondSums[6 * gnum + 4] += j * i;
+              sums.m_SecondSums[6 * gnum + 5] += k * i;
+            }
+          }
+          if (NULL != m_Quats && gnum > 0 && m_CellPhases[index] > 0)
+          {
+            sums.m_QuatCounts[gnum]++;
+            // Rows are visited in increasing order, so the first voxel seen is the lowest index
+            if (sums.m_FirstQuatIndex[gnum] < 0) { sums.m_FirstQuatIndex[gnum] = static_cast<int64_t>(index); }
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief findReferenceQuats Stores, for every Feature, the orientation of its first voxel moved
+     * to the symmetric equivalent closest to the identity. This is the same orientation the serial
+     * FindAvgOrientations starts its running average with.
+     */
+    void findReferenceQuats(const FeatureStatisticsSums& sums)
+    {
+      size_t numFeatures = sums.m_FirstQuatIndex.size();
+      m_ReferenceQuats.resize(numFeatures);
+      QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
+      QuatF identity;
+      for (size_t i = 0; i < numFeatures; i++)
+      {
+        QuaternionMathF::Identity(m_ReferenceQuats[i]);
+        int64_t index = sums.m_FirstQuatIndex[i];
+        if (index < 0) { continue; }
+        QuaternionMathF::Identity(identity);
+        QuaternionMathF::Copy(quats[index], m_ReferenceQuats[i]);
+        m_OrientationOps[m_CrystalStructures[m_CellPhases[index]]]->getNearestQuat(identity, m_ReferenceQuats[i]);
+      }
+    }
+
+    /**
+     * @brief accumulateOrientations Adds the orientations of the rows [rowStart, rowEnd), each one
+     * rotated onto the symmetric equivalent closest to the reference orientation of its Feature.
+     * findReferenceQuats() must have been called first.
+     */
+    void accumulateOrientations(size_t rowStart, size_t rowEnd, FeatureStatisticsSums& sums) const
+    {
+      QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
+      QuatF voxquat;
+      QuatF refquat;
+      size_t indexEnd = rowEnd * m_XPoints;
+      for (size_t index = rowStart * m_XPoints; index < indexEnd; index++)
+      {
+        int32_t gnum = m_FeatureIds[index];
+        if (gnum <= 0 || m_CellPhases[index] <= 0) { continue; }
+        QuaternionMathF::Copy(quats[index], voxquat);
+        QuaternionMathF::Copy(m_ReferenceQuats[gnum], refquat);
+        m_OrientationOps[m_CrystalStructures[m_CellPhases[index]]]->getNearestQuat(refquat, voxquat);
+        sums.m_QuatSums[4 * gnum + 0] += ToFixedPoint(voxquat.x);
+        sums.m_QuatSums[4 * gnum + 1] += ToFixedPoint(voxquat.y);
+        sums.m_QuatSums[4 * gnum + 2] += ToFixedPoint(voxquat.z);
+        sums.m_QuatSums[4 * gnum + 3] += ToFixedPoint(voxquat.w);
+      }
+    }
+
+    /**
+     * @brief FixedPointScale The scale of the 32.32 fixed point orientation sums. Quaternion
+     * components are bounded by 1, so a Feature can hold up to 2^31 voxels without overflow.
+     */
+    static double FixedPointScale() { return 4294967296.0; }
+
+    static int64_t ToFixedPoint(float value)
+    {
+      double scaled = static_cast<double>(value) * FixedPointScale();
+      return static_cast<int64_t>( (scaled < 0.0) ? (scaled - 0.5) : (scaled + 0.5) );
+    }
+
+  private:
+    int32_t* m_FeatureIds;
+    size_t m_XPoints;
+    size_t m_YPoints;
+    bool m_DoCentroids;
+    bool m_DoMoments;
+    int32_t* m_CellPhases;
+    float* m_Quats;
+    unsigned int* m_CrystalStructures;
+    QVector<OrientationOps::Pointer> m_OrientationOps;
+    std::vector<QuatF> m_ReferenceQuats;
+};
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+typedef tbb::enumerable_thread_specific<FeatureStatisticsSums> ThreadFeatureStatisticsSums;
+
+/**
+ * @brief The FeatureStatisticsImpl class is the parallel_for body. Each thread adds its rows into
+ * its own FeatureStatisticsSums, which is copied from a zeroed exemplar the first time that thread
+ * runs, so the per-Feature storage is allocated once per thread rather than once per split range.
+ */
+class FeatureStatisticsImpl
+{
+  public:
+    FeatureStatisticsImpl(const FeatureStatisticsAccumulator* accumulator, ThreadFeatureStatisticsSums* threadSums, bool orientations) :
+      m_Accumulator(accumulator),
+      m_ThreadSums(threadSums),
+      m_Orientations(orientations)
+    {}
+    virtual ~FeatureStatisticsImpl() {}
+
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      FeatureStatisticsSums& sums = m_ThreadSums->local();
+      if (m_Orientations == true) { m_Accumulator->accumulateOrientations(r.begin(), r.end(), sums); }
+      else { m_Accumulator->accumulateMoments(r.begin(), r.end(), sums); }
+    }
+
+  private:
+    const FeatureStatisticsAccumulator* m_Accumulator;
+    ThreadFeatureStatisticsSums* m_ThreadSums;
+    bool m_Orientations;
+};
+#endif
+
+/**
+ * @brief sweepRows Runs one sweep of the accumulator over all of the rows and adds the result into
+ * sums. In parallel each thread fills its own copy of the (zeroed) sums, and the copies are added in
+ * at the end; every sum is an integer, so the combine order does not change the result.
+ */
+static void sweepRows(const FeatureStatisticsAccumulator& stats, size_t numRows, bool orientations, FeatureStatisticsSums& sums)
+{
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
+  {
+    FeatureStatisticsSums exemplar;
+    exemplar.allocate(sums.m_Counts.size(), sums.m_Sums.empty() == false, sums.m_SecondSums.empty() == false, sums.m_QuatSums.empty() == false);
+    ThreadFeatureStatisticsSums threadSums(exemplar);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numRows), FeatureStatisticsImpl(&stats, &threadSums, orientations), tbb::auto_partitioner());
+    for (ThreadFeatureStatisticsSums::const_iterator iter = threadSums.begin(); iter != threadSums.end(); ++iter)
+    {
+      if (orientations == true) { sums.addOrientations(*iter); }
+      else { sums.addMoments(*iter); }
+    }
+  }
+  else
+#endif
+  {
+    if (orientations == true) { stats.accumulateOrientations(0, numRows, sums); }
+    else { stats.accumulateMoments(0, numRows, sums); }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FindFeatureStatisticsSinglePass::FindFeatureStatisticsSinglePass() :
+  AbstractFilter(),
+  m_CellFeatureAttributeMatrixName(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, ""),
+  m_FeatureIdsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::FeatureIds),
+  m_ComputeSizes(true),
+  m_ComputeCentroids(true),
+  m_ComputeShapes(true),
+  m_ComputeAvgOrientations(false),
+  m_CellPhasesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Phases),
+  m_QuatsArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::Quats),
+  m_CrystalStructuresArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::EnsembleData::CrystalStructures),
+  m_VolumesArrayName(DREAM3D::FeatureData::Volumes),
+  m_EquivalentDiametersArrayName(DREAM3D::FeatureData::EquivalentDiameters),
+  m_NumCellsArrayName(DREAM3D::FeatureData::NumCells),
+  m_CentroidsArrayName(DREAM3D::FeatureData::Centroids),
+  m_Omega3sArrayName(DREAM3D::FeatureData::Omega3s),
+  m_AxisLengthsArrayName(DREAM3D::FeatureData::AxisLengths),
+  m_AxisEulerAnglesArrayName(DREAM3D::FeatureData::AxisEulerAngles),
+  m_AspectRatiosArrayName(DREAM3D::FeatureData::AspectRatios),
+  m_AvgQuatsArrayName(DREAM3D::FeatureData::AvgQuats),
+  m_AvgEulerAnglesArrayName(DREAM3D::FeatureData::AvgEulerAngles),
+  m_FeatureIdsArrayName(DREAM3D::CellData::FeatureIds),
+  m_FeatureIds(NULL),
+  m_CellPhasesArrayName(DREAM3D::CellData::Phases),
+  m_CellPhases(NULL),
+  m_QuatsArrayName(DREAM3D::CellData::Quats),
+  m_Quats(NULL),
+  m_CrystalStructuresArrayName(DREAM3D::EnsembleData::CrystalStructures),
+  m_CrystalStructures(NULL),
+  m_Volumes(NULL),
+  m_EquivalentDiameters(NULL),
+  m_NumCells(NULL),
+  m_Centroids(NULL),
+  m_Omega3s(NULL),
+  m_AxisLengths(NULL),
+  m_AxisEulerAngles(NULL),
+  m_AspectRatios(NULL),
+  m_AvgQuats(NULL),
+  m_AvgEulerAngles(NULL)
+{
+  m_OrientationOps = OrientationOps::getOrientationOpsQVector();
+  setupFilterParameters();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FindFeatureStatisticsSinglePass::~FindFeatureStatisticsSinglePass()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindFeatureStatisticsSinglePass::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+  QStringList linkedProps;
+  linkedProps << "VolumesArrayName" << "EquivalentDiametersArrayName" << "NumCellsArrayName";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Find Sizes", "ComputeSizes", getComputeSizes(), linkedProps, false));
+  linkedProps.clear();
+  linkedProps << "CentroidsArrayName";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Find Centroids", "ComputeCentroids", getComputeCentroids(), linkedProps, false));
+  linkedProps.clear();
+  linkedProps << "Omega3sArrayName" << "AxisLengthsArrayName" << "AxisEulerAnglesArrayName" << "AspectRatiosArrayName";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Find Shapes", "ComputeShapes", getComputeShapes(), linkedProps, false));
+  linkedProps.clear();
+  linkedProps << "CellPhasesArrayPath" << "QuatsArrayPath" << "CrystalStructuresArrayPath" << "AvgQuatsArrayName" << "AvgEulerAnglesArrayName";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Find Average Orientations", "ComputeAvgOrientations", getComputeAvgOrientations(), linkedProps, false));
+  parameters.push_back(FilterParameter::New("Required Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
+  parameters.push_back(FilterParameter::New("FeatureIds", "FeatureIdsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getFeatureIdsArrayPath(), true, ""));
+  parameters.push_back(FilterParameter::New("Phases", "CellPhasesArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getCellPhasesArrayPath(), true, ""));
+  parameters.push_back(FilterParameter::New("Quats", "QuatsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getQuatsArrayPath(), true, ""));
+  parameters.push_back(FilterParameter::New("Crystal Structures", "CrystalStructuresArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getCrystalStructuresArrayPath(), true, ""));
+  parameters.push_back(FilterParameter::New("Cell Feature Attribute Matrix Name", "CellFeatureAttributeMatrixName", FilterParameterWidgetType::AttributeMatrixSelectionWidget, getCellFeatureAttributeMatrixName(), true, ""));
+  parameters.push_back(FilterParameter::New("Created Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
+  parameters.push_back(FilterParameter::New("Volumes", "VolumesArrayName", FilterParameterWidgetType::StringWidget, getVolumesArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("EquivalentDiameters", "EquivalentDiametersArrayName", FilterParameterWidgetType::StringWidget, getEquivalentDiametersArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("NumCells", "NumCellsArrayName", FilterParameterWidgetType::StringWidget, getNumCellsArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("Centroids", "CentroidsArrayName", FilterParameterWidgetType::StringWidget, getCentroidsArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("Omega3s", "Omega3sArrayName", FilterParameterWidgetType::StringWidget, getOmega3sArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("AxisLengths", "AxisLengthsArrayName", FilterParameterWidgetType::StringWidget, getAxisLengthsArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("AxisEulerAngles", "AxisEulerAnglesArrayName", FilterParameterWidgetType::StringWidget, getAxisEulerAnglesArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("AspectRatios", "AspectRatiosArrayName", FilterParameterWidgetType::StringWidget, getAspectRatiosArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("Average Quats", "AvgQuatsArrayName", FilterParameterWidgetType::StringWidget, getAvgQuatsArrayName(), true, ""));
+  parameters.push_back(FilterParameter::New("Average Euler Angles", "AvgEulerAnglesArrayName", FilterParameterWidgetType::StringWidget, getAvgEulerAnglesArrayName(), true, ""));
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindFeatureStatisticsSinglePass::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setCellFeatureAttributeMatrixName(reader->readDataArrayPath("CellFeatureAttributeMatrixName", getCellFeatureAttributeMatrixName()));
+  setFeatureIdsArrayPath(reader->readDataArrayPath("FeatureIdsArrayPath", getFeatureIdsArrayPath() ) );
+  setComputeSizes( reader->readValue("ComputeSizes", getComputeSizes()) );
+  setComputeCentroids( reader->readValue("ComputeCentroids", getComputeCentroids()) );
+  setComputeShapes( reader->readValue("ComputeShapes", getComputeShapes()) );
+  setComputeAvgOrientations( reader->readValue("ComputeAvgOrientations", getComputeAvgOrientations()) );
+  setCellPhasesArrayPath(reader->readDataArrayPath("CellPhasesArrayPath", getCellPhasesArrayPath() ) );
+  setQuatsArrayPath(reader->readDataArrayPath("QuatsArrayPath", getQuatsArrayPath() ) );
+  setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath() ) );
+  setVolumesArrayName(reader->readString("VolumesArrayName", getVolumesArrayName() ) );
+  setEquivalentDiametersArrayName(reader->readString("EquivalentDiametersArrayName", getEquivalentDiametersArrayName() ) );
+  setNumCellsArrayName(reader->readString("NumCellsArrayName", getNumCellsArrayName() ) );
+  setCentroidsArrayName(reader->readString("CentroidsArrayName", getCentroidsArrayName() ) );
+  setOmega3sArrayName(reader->readString("Omega3sArrayName", getOmega3sArrayName() ) );
+  setAxisLengthsArrayName(reader->readString("AxisLengthsArrayName", getAxisLengthsArrayName() ) );
+  setAxisEulerAnglesArrayName(reader->readString("AxisEulerAnglesArrayName", getAxisEulerAnglesArrayName() ) );
+  setAspectRatiosArrayName(reader->readString("AspectRatiosArrayName", getAspectRatiosArrayName() ) );
+  setAvgQuatsArrayName(reader->readString("AvgQuatsArrayName", getAvgQuatsArrayName() ) );
+  setAvgEulerAnglesArrayName(reader->readString("AvgEulerAnglesArrayName", getAvgEulerAnglesArrayName() ) );
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int FindFeatureStatisticsSinglePass::writeFilterParameters(AbstractFilterParametersWriter* writer, int index)
+{
+  writer->openFilterGroup(this, index);
+  DREAM3D_FILTER_WRITE_PARAMETER(CellFeatureAttributeMatrixName)
+  DREAM3D_FILTER_WRITE_PARAMETER(FeatureIdsArrayPath)
+  DREAM3D_FILTER_WRITE_PARAMETER(ComputeSizes)
+  DREAM3D_FILTER_WRITE_PARAMETER(ComputeCentroids)
+  DREAM3D_FILTER_WRITE_PARAMETER(ComputeShapes)
+  DREAM3D_FILTER_WRITE_PARAMETER(ComputeAvgOrientations)
+  DREAM3D_FILTER_WRITE_PARAMETER(CellPhasesArrayPath)
+  DREAM3D_FILTER_WRITE_PARAMETER(QuatsArrayPath)
+  DREAM3D_FILTER_WRITE_PARAMETER(CrystalStructuresArrayPath)
+  DREAM3D_FILTER_WRITE_PARAMETER(VolumesArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(EquivalentDiametersArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(NumCellsArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(CentroidsArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(Omega3sArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(AxisLengthsArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(AxisEulerAnglesArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(AspectRatiosArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(AvgQuatsArrayName)
+  DREAM3D_FILTER_WRITE_PARAMETER(AvgEulerAnglesArrayName)
+  writer->closeFilterGroup();
+  return ++index; // we want to return the next index that was just written to
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindFeatureStatisticsSinglePass::dataCheck()
+{
+  DataArrayPath tempPath;
+  setErrorCondition(0);
+
+  if (m_ComputeSizes == false && m_ComputeCentroids == false && m_ComputeShapes == false && m_ComputeAvgOrientations == false)
+  {
+    QString ss = QObject::tr("At least one of the Feature statistics must be selected");
+    setErrorCondition(-11000);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  VolumeDataContainer* m = getDataContainerArray()->getPrereqDataContainer<VolumeDataContainer, AbstractFilter>(this, getFeatureIdsArrayPath().getDataContainerName());
+  if(getErrorCondition() < 0 || NULL == m) { return; }
+
+  if (m_ComputeShapes == true && (m->getXPoints() == 1 || m->getYPoints() == 1 || m->getZPoints() == 1))
+  {
+    QString ss = QObject::tr("The single pass shape calculation requires a 3D volume. Use the 'Find Feature Shapes' filter for 2D data");
+    setErrorCondition(-11001);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  QVector<size_t> dims(1, 1);
+  m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getFeatureIdsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+  if( NULL != m_FeatureIdsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+  { m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+
+  QString dcName = getCellFeatureAttributeMatrixName().getDataContainerName();
+  QString amName = getCellFeatureAttributeMatrixName().getAttributeMatrixName();
+
+  if (m_ComputeSizes == true || m_ComputeShapes == true)
+  {
+    tempPath.update(dcName, amName, getVolumesArrayName() );
+    m_VolumesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_VolumesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_Volumes = m_VolumesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
+  if (m_ComputeSizes == true)
+  {
+    tempPath.update(dcName, amName, getEquivalentDiametersArrayName() );
+    m_EquivalentDiametersPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_EquivalentDiametersPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_EquivalentDiameters = m_EquivalentDiametersPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    tempPath.update(dcName, amName, getNumCellsArrayName() );
+    m_NumCellsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter, int32_t>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_NumCellsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_NumCells = m_NumCellsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
+  if (m_ComputeCentroids == true)
+  {
+    dims[0] = 3;
+    tempPath.update(dcName, amName, getCentroidsArrayName() );
+    m_CentroidsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_CentroidsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_Centroids = m_CentroidsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
+  if (m_ComputeShapes == true)
+  {
+    dims[0] = 1;
+    tempPath.update(dcName, amName, getOmega3sArrayName() );
+    m_Omega3sPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_Omega3sPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_Omega3s = m_Omega3sPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    dims[0] = 3;
+    tempPath.update(dcName, amName, getAxisLengthsArrayName() );
+    m_AxisLengthsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_AxisLengthsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_AxisLengths = m_AxisLengthsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    tempPath.update(dcName, amName, getAxisEulerAnglesArrayName() );
+    m_AxisEulerAnglesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_AxisEulerAnglesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_AxisEulerAngles = m_AxisEulerAnglesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    dims[0] = 2;
+    tempPath.update(dcName, amName, getAspectRatiosArrayName() );
+    m_AspectRatiosPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_AspectRatiosPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_AspectRatios = m_AspectRatiosPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
+  if (m_ComputeAvgOrientations == true)
+  {
+    dims[0] = 1;
+    m_CellPhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getCellPhasesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_CellPhasesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    m_CrystalStructuresPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<unsigned int>, AbstractFilter>(this, getCrystalStructuresArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_CrystalStructuresPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_CrystalStructures = m_CrystalStructuresPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    dims[0] = 4;
+    m_QuatsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getQuatsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_QuatsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_Quats = m_QuatsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    tempPath.update(dcName, amName, getAvgQuatsArrayName() );
+    m_AvgQuatsPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_AvgQuatsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_AvgQuats = m_AvgQuatsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    dims[0] = 3;
+    tempPath.update(dcName, amName, getAvgEulerAnglesArrayName() );
+    m_AvgEulerAnglesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if( NULL != m_AvgEulerAnglesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
+    { m_AvgEulerAngles = m_AvgEulerAnglesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindFeatureStatisticsSinglePass::preflight()
+{
+  setInPreflight(true);
+  emit preflightAboutToExecute();
+  emit updateFilterParameters(this);
+  dataCheck();
+  emit preflightExecuted();
+  setInPreflight(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindFeatureStatisticsSinglePass::execute()
+{
+  setErrorCondition(0);
+  dataCheck();
+  if(getErrorCondition() < 0) { return; }
+
+  VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(m_FeatureIdsArrayPath.getDataContainerName());
+  size_t xPoints = m->getXPoints();
+  size_t yPoints = m->getYPoints();
+  size_t zPoints = m->getZPoints();
+  float xRes = m->getXRes();
+  float yRes = m->getYRes();
+  float zRes = m->getZRes();
+  bool is2D = (xPoints == 1 || yPoints == 1 || zPoints == 1);
+
+  size_t numfeatures = getDataContainerArray()->getAttributeMatrix(getCellFeatureAttributeMatrixName())->getNumTuples();
+  size_t numRows = yPoints * zPoints;
+
+  float* quats = (m_ComputeAvgOrientations == true) ? m_Quats : NULL;
+  FeatureStatisticsAccumulator stats(m_FeatureIds, xPoints, yPoints, m_ComputeCentroids, m_ComputeShapes,
+                                     m_CellPhases, quats, m_CrystalStructures, m_OrientationOps);
+  FeatureStatisticsSums sums;
+  sums.allocate(numfeatures, m_ComputeCentroids || m_ComputeShapes, m_ComputeShapes, m_ComputeAvgOrientations);
+
+  sweepRows(stats, numRows, false, sums);
+  if (m_ComputeAvgOrientations == true)
+  {
+    stats.findReferenceQuats(sums);
+    sweepRows(stats, numRows, true, sums);
+  }
+
+  if (getCancel() == true) { return; }
+
+  if (m_ComputeSizes == true || m_ComputeShapes == true)
+  {
+    float res_scalar = xRes * yRes * zRes;
+    if (is2D == true)
+    {
+      if(xPoints == 1) { res_scalar = yRes * zRes; }
+      else if(yPoints == 1) { res_scalar = xRes * zRes; }
+      else if(zPoints == 1) { res_scalar = xRes * yRes; }
+    }
+    float vol_term = static_cast<double>( (4.0 / 3.0) * DREAM3D::Constants::k_Pi );
+    for (size_t i = 1; i < numfeatures; i++)
+    {
+      m_Volumes[i] = static_cast<float>(sums.m_Counts[i]) * res_scalar;
+      if (m_ComputeSizes == false) { continue; }
+      m_NumCells[i] = static_cast<int32_t>( sums.m_Counts[i] );
+      if (is2D == true)
+      {
+        float radsquared = m_Volumes[i] / DREAM3D::Constants::k_Pi;
+        m_EquivalentDiameters[i] = (2 * sqrt(radsquared));
+      }
+      else
+      {
+        float radcubed = m_Volumes[i] / vol_term;
+        m_EquivalentDiameters[i] = 2.0f * powf(radcubed, 0.3333333333f);
+      }
+    }
+  }
+
+  if (m_ComputeCentroids == true)
+  {
+    for (size_t i = 1; i < numfeatures; i++)
+    {
+      if (sums.m_Counts[i] == 0) { continue; }
+      double count = static_cast<double>(sums.m_Counts[i]);
+      m_Centroids[3 * i + 0] = static_cast<float>(sums.m_Sums[3 * i + 0] / count * xRes);
+      m_Centroids[3 * i + 1] = static_cast<float>(sums.m_Sums[3 * i + 1] / count * yRes);
+      m_Centroids[3 * i + 2] = static_cast<float>(sums.m_Sums[3 * i + 2] / count * zRes);
+    }
+  }
+
+  if (m_ComputeShapes == true)
+  {
+    // Same scaling as FindShapes so the moments stay "small"
+    double scaleFactor = 1.0 / xRes;
+    if(yRes > xRes && yRes > zRes) { scaleFactor = 1.0 / yRes; }
+    if(zRes > xRes && zRes > yRes) { scaleFactor = 1.0 / zRes; }
+    double modRes[3] = { xRes * scaleFactor, yRes * scaleFactor, zRes * scaleFactor };
+
+    // FindShapes splits every voxel into 8 sub-voxels offset by a quarter voxel; summed over the 8
+    // sub-voxels the cross terms cancel, which leaves 8 times the central moment of the voxel
+    // centers plus a constant per voxel.
+    double h2[3] = { (modRes[0] / 4.0) * (modRes[0] / 4.0), (modRes[1] / 4.0) * (modRes[1] / 4.0), (modRes[2] / 4.0) * (modRes[2] / 4.0) };
+    double konst1 = (modRes[0] / 2.0f) * (modRes[1] / 2.0f) * (modRes[2] / 2.0f);
+    double konst3 = modRes[0] * modRes[1] * modRes[2];
+    double moments[6];
+    double eigenvals[3];
+    for (size_t i = 1; i < numfeatures; i++)
+    {
+      double n = static_cast<double>(sums.m_Counts[i]);
+      for (int c = 0; c < 6; c++) { moments[c] = 0.0; }
+      if (n > 0)
+      {
+        const int64_t* s = &(sums.m_Sums[3 * i]);
+        const int64_t* ss = &(sums.m_SecondSums[6 * i]);
+        double cxx = (ss[0] - static_cast<double>(s[0]) * s[0] / n) * modRes[0] * modRes[0];
+        double cyy = (ss[1] - static_cast<double>(s[1]) * s[1] / n) * modRes[1] * modRes[1];
+        double czz = (ss[2] - static_cast<double>(s[2]) * s[2] / n) * modRes[2] * modRes[2];
+        double cxy = (ss[3] - static_cast<double>(s[0]) * s[1] / n) * modRes[0] * modRes[1];
+        double cyz = (ss[4] - static_cast<double>(s[1]) * s[2] / n) * modRes[1] * modRes[2];
+        double cxz = (ss[5] - static_cast<double>(s[0]) * s[2] / n) * modRes[0] * modRes[2];
+        moments[0] = (8.0 * (cyy + czz) + 8.0 * n * (h2[1] + h2[2])) * konst1;
+        moments[1] = (8.0 * (cxx + czz) + 8.0 * n * (h2[0] + h2[2])) * konst1;
+        moments[2] = (8.0 * (cxx + cyy) + 8.0 * n * (h2[0] + h2[1])) * konst1;
+        moments[3] = -8.0 * cxy * konst1;
+        moments[4] = -8.0 * cyz * konst1;
+        moments[5] = -8.0 * cxz * konst1;
+      }
+      m_Omega3s[i] = FindShapes::CalculateOmega3(moments, n * konst3);
+      FindShapes::CalculateAxes(moments, scaleFactor, eigenvals, m_AxisLengths + 3 * i, m_AspectRatios + 2 * i);
+      FindShapes::CalculateAxisEulers(moments, eigenvals, m_AxisEulerAngles + 3 * i);
+    }
+  }
+
+  if (m_ComputeAvgOrientations == true)
+  {
+    QuatF* avgQuats = reinterpret_cast<QuatF*>(m_AvgQuats);
+    float ea1, ea2, ea3;
+    for (size_t i = 1; i < numfeatures; i++)
+    {
+      if(sums.m_QuatCounts[i] == 0)
+      {
+        QuaternionMathF::Identity(avgQuats[i]);
+      }
+      else
+      {
+        double scale = FeatureStatisticsAccumulator::FixedPointScale() * static_cast<double>(sums.m_QuatCounts[i]);
+        avgQuats[i].x = static_cast<float>(sums.m_QuatSums[4 * i + 0] / scale);
+        avgQuats[i].y = static_cast<float>(sums.m_QuatSums[4 * i + 1] / scale);
+        avgQuats[i].z = static_cast<float>(sums.m_QuatSums[4 * i + 2] / scale);
+        avgQuats[i].w = static_cast<float>(sums.m_QuatSums[4 * i + 3] / scale);
+      }
+      QuaternionMathF::UnitQuaternion(avgQuats[i]);
+      OrientationMath::QuattoEuler(avgQuats[i], ea1, ea2, ea3);
+      m_AvgEulerAngles[3 * i] = ea1;
+      m_AvgEulerAngles[3 * i + 1] = ea2;
+      m_AvgEulerAngles[3 * i + 2] = ea3;
+    }
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer FindFeatureStatisticsSinglePass::newFilterInstance(bool copyFilterParameters)
+{
+  FindFeatureStatisticsSinglePass::Pointer filter = FindFeatureStatisticsSinglePass::New();
+  if(true == copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FindFeatureStatisticsSinglePass::getCompiledLibraryName()
+{ return Statistics::StatisticsBaseName; }
+
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FindFeatureStatisticsSinglePass::getGroupName()
+{ return DREAM3D::FilterGroups::StatisticsFilters; }
+
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FindFeatureStatisticsSinglePass::getSubGroupName()
+{ return DREAM3D::FilterSubGroups::MorphologicalFilters; }
+
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString FindFeatureStatisticsSinglePass::getHumanLabel()
+{ return "Find Feature Statistics (Single Pass)"; }
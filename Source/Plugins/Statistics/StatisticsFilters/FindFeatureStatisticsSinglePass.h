@@ -0,0 +1,188 @@
+/* ============================================================================
+ * Copyright (c) 2011 Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2011 Dr. Michael A. Groeber (US Air Force Research Laboratories)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _FindFeatureStatisticsSinglePass_H_
+#define _FindFeatureStatisticsSinglePass_H_
+
+#include <QtCore/QString>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/DREAM3DSetGetMacros.h"
+#include "DREAM3DLib/Common/AbstractFilter.h"
+#include "DREAM3DLib/DataArrays/IDataArray.h"
+#include "DREAM3DLib/DataContainers/VolumeDataContainer.h"
+
+#include "OrientationLib/OrientationOps/OrientationOps.h"
+
+/**
+ * @class FindFeatureStatisticsSinglePass FindFeatureStatisticsSinglePass.h Statistics/StatisticsFilters/FindFeatureStatisticsSinglePass.h
+ * @brief Computes any combination of the per-Feature sizes, centroids, shapes and average orientations
+ * in a single (parallel) sweep over the FeatureIds instead of running FindSizes, FindFeatureCentroids,
+ * FindShapes and FindAvgOrientations one after the other. The created arrays are the same as the
+ * ones created by the individual filters. The average orientations take a second sweep, and each Cell
+ * is matched to the first Cell of its Feature rather than to the running average, which keeps the
+ * result independent of the threading; see the filter documentation.
+ * @author
+ * @date
+ * @version 1.0
+ */
+class FindFeatureStatisticsSinglePass : public AbstractFilter
+{
+    Q_OBJECT /* Need this for Qt's signals and slots mechanism to work */
+  public:
+    DREAM3D_SHARED_POINTERS(FindFeatureStatisticsSinglePass)
+    DREAM3D_STATIC_NEW_MACRO(FindFeatureStatisticsSinglePass)
+    DREAM3D_TYPE_MACRO_SUPER(FindFeatureStatisticsSinglePass, AbstractFilter)
+
+    virtual ~FindFeatureStatisticsSinglePass();
+
+    DREAM3D_FILTER_PARAMETER(DataArrayPath, CellFeatureAttributeMatrixName)
+    Q_PROPERTY(DataArrayPath CellFeatureAttributeMatrixName READ getCellFeatureAttributeMatrixName WRITE setCellFeatureAttributeMatrixName)
+
+    DREAM3D_FILTER_PARAMETER(DataArrayPath, FeatureIdsArrayPath)
+    Q_PROPERTY(DataArrayPath FeatureIdsArrayPath READ getFeatureIdsArrayPath WRITE setFeatureIdsArrayPath)
+
+    DREAM3D_FILTER_PARAMETER(bool, ComputeSizes)
+    Q_PROPERTY(bool ComputeSizes READ getComputeSizes WRITE setComputeSizes)
+
+    DREAM3D_FILTER_PARAMETER(bool, ComputeCentroids)
+    Q_PROPERTY(bool ComputeCentroids READ getComputeCentroids WRITE setComputeCentroids)
+
+    DREAM3D_FILTER_PARAMETER(bool, ComputeShapes)
+    Q_PROPERTY(bool ComputeShapes READ getComputeShapes WRITE setComputeShapes)
+
+    DREAM3D_FILTER_PARAMETER(bool, ComputeAvgOrientations)
+    Q_PROPERTY(bool ComputeAvgOrientations READ getComputeAvgOrientations WRITE setComputeAvgOrientations)
+
+    DREAM3D_FILTER_PARAMETER(DataArrayPath, CellPhasesArrayPath)
+    Q_PROPERTY(DataArrayPath CellPhasesArrayPath READ getCellPhasesArrayPath WRITE setCellPhasesArrayPath)
+
+    DREAM3D_FILTER_PARAMETER(DataArrayPath, QuatsArrayPath)
+    Q_PROPERTY(DataArrayPath QuatsArrayPath READ getQuatsArrayPath WRITE setQuatsArrayPath)
+
+    DREAM3D_FILTER_PARAMETER(DataArrayPath, CrystalStructuresArrayPath)
+    Q_PROPERTY(DataArrayPath CrystalStructuresArrayPath READ getCrystalStructuresArrayPath WRITE setCrystalStructuresArrayPath)
+
+    DREAM3D_FILTER_PARAMETER(QString, VolumesArrayName)
+    Q_PROPERTY(QString VolumesArrayName READ getVolumesArrayName WRITE setVolumesArrayName)
+
+    DREAM3D_FILTER_PARAMETER(QString, EquivalentDiametersArrayName)
+    Q_PROPERTY(QString EquivalentDiametersArrayName READ getEquivalentDiametersArrayName WRITE setEquivalentDiametersArrayName)
+
+    DREAM3D_FILTER_PARAMETER(QString, NumCellsArrayName)
+    Q_PROPERTY(QString NumCellsArrayName READ getNumCellsArrayName WRITE setNumCellsArrayName)
+
+    DREAM3D_FILTER_PARAMETER(QString, CentroidsArrayName)
+    Q_PROPERTY(QString CentroidsArrayName READ getCentroidsArrayName WRITE setCentroidsArrayName)
+
+    DREAM3D_FILTER_PARAMETER(QString, Omega3sArrayName)
+    Q_PROPERTY(QString Omega3sArrayName READ getOmega3sArrayName WRITE setOmega3sArrayName)
+
+    DREAM3D_FILTER_PARAMETER(QString, AxisLengthsArrayName)
+    Q_PROPERTY(QString AxisLengthsArrayName READ getAxisLengthsArrayName WRITE setAxisLengthsArrayName)
+
+    DREAM3D_FILTER_PARAMETER(QString, AxisEulerAnglesArrayName)
+    Q_PROPERTY(QString AxisEulerAnglesArrayName READ getAxisEulerAnglesArrayName WRITE setAxisEulerAnglesArrayName)
+
+    DREAM3D_FILTER_PARAMETER(QString, AspectRatiosArrayName)
+    Q_PROPERTY(QString AspectRatiosArrayName READ getAspectRatiosArrayName WRITE setAspectRatiosArrayName)
+
+    DREAM3D_FILTER_PARAMETER(QString, AvgQuatsArrayName)
+    Q_PROPERTY(QString AvgQuatsArrayName READ getAvgQuatsArrayName WRITE setAvgQuatsArrayName)
+
+    DREAM3D_FILTER_PARAMETER(QString, AvgEulerAnglesArrayName)
+    Q_PROPERTY(QString AvgEulerAnglesArrayName READ getAvgEulerAnglesArrayName WRITE setAvgEulerAnglesArrayName)
+
+    virtual const QString getCompiledLibraryName();
+    virtual AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters);
+    virtual const QString getGroupName();
+    virtual const QString getSubGroupName();
+    virtual const QString getHumanLabel();
+
+    /**
+    * @brief This method will instantiate all the end user settable options/parameters
+    * for this filter
+    */
+    virtual void setupFilterParameters();
+
+    /**
+     * @brief Reimplemented from @see AbstractFilter class
+     */
+    virtual int writeFilterParameters(AbstractFilterParametersWriter* writer, int index);
+
+    /**
+    * @brief This method will read the options from a file
+    * @param reader The reader that is used to read the options from a file
+    */
+    virtual void readFilterParameters(AbstractFilterParametersReader* reader, int index);
+
+    virtual void execute();
+    virtual void preflight();
+
+  signals:
+    void updateFilterParameters(AbstractFilter* filter);
+    void parametersChanged();
+    void preflightAboutToExecute();
+    void preflightExecuted();
+
+  protected:
+    FindFeatureStatisticsSinglePass();
+
+  private:
+    QVector<OrientationOps::Pointer> m_OrientationOps;
+
+    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Quats)
+    DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, Volumes)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, EquivalentDiameters)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, NumCells)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, Centroids)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, Omega3s)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, AxisLengths)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, AxisEulerAngles)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, AspectRatios)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, AvgQuats)
+    DEFINE_CREATED_DATAARRAY_VARIABLE(float, AvgEulerAngles)
+
+    void dataCheck();
+
+    FindFeatureStatisticsSinglePass(const FindFeatureStatisticsSinglePass&); // Copy Constructor Not Implemented
+    void operator=(const FindFeatureStatisticsSinglePass&); // Operator '=' Not Implemented
+};
+
+#endif /* _FindFeatureStatisticsSinglePass_H_ */
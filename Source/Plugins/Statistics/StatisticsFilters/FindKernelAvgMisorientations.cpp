@@ -36,9 +36,127 @@
 
 #include "FindKernelAvgMisorientations.h"
 
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "DREAM3DLib/Math/DREAM3DMath.h"
 #include "DREAM3DLib/Common/Constants.h"
 
+/**
+ * @brief The FindKernelAvgMisorientationsImpl class accumulates the kernel misorientation sums for a set of
+ * slabs of rows (plane * yPoints + row). The misorientation between two Cells is the same from either side,
+ * so only the offsets in the "forward" half of the kernel are evaluated and each result is added to both Cells.
+ * The forward reach of a slab is at most one slab thickness, so slab i only writes into slabs i and i + 1;
+ * running all the even slabs in parallel and then all the odd slabs keeps the writes from overlapping.
+ */
+class FindKernelAvgMisorientationsImpl
+{
+  public:
+    FindKernelAvgMisorientationsImpl(int32_t* featureIds, int32_t* cellPhases, QuatF* quats, unsigned int* crystalStructures,
+                                     QVector<OrientationOps::Pointer> orientationOps, const std::vector<int64_t>& offsets,
+                                     int64_t xPoints, int64_t yPoints, int64_t zPoints, size_t slabThickness, size_t parity,
+                                     float* misoSums, int32_t* misoCounts) :
+      m_FeatureIds(featureIds),
+      m_CellPhases(cellPhases),
+      m_Quats(quats),
+      m_CrystalStructures(crystalStructures),
+      m_OrientationOps(orientationOps),
+      m_Offsets(offsets),
+      m_XPoints(xPoints),
+      m_YPoints(yPoints),
+      m_ZPoints(zPoints),
+      m_SlabThickness(slabThickness),
+      m_Parity(parity),
+      m_MisoSums(misoSums),
+      m_MisoCounts(misoCounts)
+    {}
+    virtual ~FindKernelAvgMisorientationsImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      int64_t totalRows = m_YPoints * m_ZPoints;
+      size_t numOffsets = m_Offsets.size() / 3;
+      float n1, n2, n3;
+      float w = 0.0f;
+      for (size_t slab = start; slab < end; slab++)
+      {
+        int64_t rowStart = static_cast<int64_t>((2 * slab + m_Parity) * m_SlabThickness);
+        int64_t rowEnd = rowStart + static_cast<int64_t>(m_SlabThickness);
+        if (rowEnd > totalRows) { rowEnd = totalRows; }
+        for (int64_t r = rowStart; r < rowEnd; r++)
+        {
+          int64_t row = r % m_YPoints;
+          int64_t plane = r / m_YPoints;
+          for (int64_t col = 0; col < m_XPoints; col++)
+          {
+            int64_t point = r * m_XPoints + col;
+            int32_t feature = m_FeatureIds[point];
+            if (feature <= 0) { continue; }
+            bool pointGood = (m_CellPhases[point] > 0);
+            if (pointGood == true)
+            {
+              // The center Cell is part of its own kernel
+              w = m_OrientationOps[m_CrystalStructures[m_CellPhases[point]]]->getMisoQuatFast(m_Quats[point], m_Quats[point], n1, n2, n3);
+              m_MisoSums[point] += w * (180.0f / DREAM3D::Constants::k_Pi);
+              m_MisoCounts[point]++;
+            }
+            for (size_t o = 0; o < numOffsets; o++)
+            {
+              int64_t l = m_Offsets[3 * o + 0];
+              int64_t k = m_Offsets[3 * o + 1];
+              int64_t j = m_Offsets[3 * o + 2];
+              if (plane + j > m_ZPoints - 1) { continue; }
+              if (row + k < 0 || row + k > m_YPoints - 1) { continue; }
+              if (col + l < 0 || col + l > m_XPoints - 1) { continue; }
+              int64_t neighbor = point + (j * m_XPoints * m_YPoints) + (k * m_XPoints) + l;
+              if (m_FeatureIds[neighbor] != feature) { continue; }
+              bool neighborGood = (m_CellPhases[neighbor] > 0);
+              if (pointGood == false && neighborGood == false) { continue; }
+              int32_t phase = (pointGood == true) ? m_CellPhases[point] : m_CellPhases[neighbor];
+              w = m_OrientationOps[m_CrystalStructures[phase]]->getMisoQuatFast(m_Quats[point], m_Quats[neighbor], n1, n2, n3);
+              w = w * (180.0f / DREAM3D::Constants::k_Pi);
+              if (pointGood == true)
+              {
+                m_MisoSums[point] += w;
+                m_MisoCounts[point]++;
+              }
+              if (neighborGood == true)
+              {
+                m_MisoSums[neighbor] += w;
+                m_MisoCounts[neighbor]++;
+              }
+            }
+          }
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+  private:
+    int32_t* m_FeatureIds;
+    int32_t* m_CellPhases;
+    QuatF* m_Quats;
+    unsigned int* m_CrystalStructures;
+    QVector<OrientationOps::Pointer> m_OrientationOps;
+    const std::vector<int64_t>& m_Offsets;
+    int64_t m_XPoints;
+    int64_t m_YPoints;
+    int64_t m_ZPoints;
+    size_t m_SlabThickness;
+    size_t m_Parity;
+    float* m_MisoSums;
+    int32_t* m_MisoCounts;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -179,88 +297,74 @@ void FindKernelAvgMisorientations::execute()
 
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(m_FeatureIdsArrayPath.getDataContainerName());
 
-  QuatF q1;
-  QuatF q2;
   QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
+  int64_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
+  int64_t xPoints = static_cast<int64_t>(m->getXPoints());
+  int64_t yPoints = static_cast<int64_t>(m->getYPoints());
+  int64_t zPoints = static_cast<int64_t>(m->getZPoints());
+  int64_t totalRows = yPoints * zPoints;
 
-  int numVoxel; // number of voxels in the feature...
-  int good = 0;
-
-  float w, totalmisorientation;
-  float n1, n2, n3;
-  unsigned int phase1 = Ebsd::CrystalStructure::UnknownCrystalStructure;
-  unsigned int phase2 = Ebsd::CrystalStructure::UnknownCrystalStructure;
-  size_t udims[3] = {0, 0, 0};
-  m->getDimensions(udims);
-#if (CMP_SIZEOF_SIZE_T == 4)
-  typedef int32_t DimType;
-#else
-  typedef int64_t DimType;
-#endif
-  DimType xPoints = static_cast<DimType>(udims[0]);
-  DimType yPoints = static_cast<DimType>(udims[1]);
-  DimType zPoints = static_cast<DimType>(udims[2]);
-  DimType point;
-  size_t neighbor = 0;
-//  int m_KernelSize = 1;
-  DimType jStride;
-  DimType kStride;
-  for (DimType col = 0; col < xPoints; col++)
+  // Offsets (x, y, z) of the forward half of the kernel; the backward half is covered by the
+  // neighbor that sees this Cell in its own forward half
+  std::vector<int64_t> offsets;
+  for (int j = 0; j < m_KernelSize.z + 1; j++)
   {
-    for (DimType row = 0; row < yPoints; row++)
+    for (int k = -m_KernelSize.y; k < m_KernelSize.y + 1; k++)
     {
-      for (DimType plane = 0; plane < zPoints; plane++)
+      for (int l = -m_KernelSize.x; l < m_KernelSize.x + 1; l++)
       {
-        point = (plane * xPoints * yPoints) + (row * xPoints) + col;
-        if (m_FeatureIds[point] > 0 && m_CellPhases[point] > 0)
-        {
-          totalmisorientation = 0.0;
-          numVoxel = 0;
-          QuaternionMathF::Copy(quats[point], q1);
-          phase1 = m_CrystalStructures[m_CellPhases[point]];
-          for (int j = -m_KernelSize.z; j < m_KernelSize.z + 1; j++)
-          {
-            jStride = j * xPoints * yPoints;
-            for (int k = -m_KernelSize.y; k < m_KernelSize.y + 1; k++)
-            {
-              kStride = k * xPoints;
-              for (int l = -m_KernelSize.x; l < m_KernelSize.z + 1; l++)
-              {
-                good = 1;
-                neighbor = point + (jStride) + (kStride) + (l);
-                if(plane + j < 0) { good = 0; }
-                else if(plane + j > zPoints - 1) { good = 0; }
-                else if(row + k < 0) { good = 0; }
-                else if(row + k > yPoints - 1) { good = 0; }
-                else if(col + l < 0) { good = 0; }
-                else if(col + l > xPoints - 1) { good = 0; }
-                if(good == 1 && m_FeatureIds[point] == m_FeatureIds[neighbor])
-                {
-                  w = 10000.0;
-                  QuaternionMathF::Copy(quats[neighbor], q2);
-                  phase2 = m_CrystalStructures[m_CellPhases[neighbor]];
-                  w = m_OrientationOps[phase1]->getMisoQuat( q1, q2, n1, n2, n3);
-                  w = w * (180.0f / DREAM3D::Constants::k_Pi);
-                  totalmisorientation = totalmisorientation + w;
-                  numVoxel++;
-                }
-              }
-            }
-          }
-          m_KernelAverageMisorientations[point] = totalmisorientation / (float)numVoxel;
-          if(numVoxel == 0)
-          {
-            m_KernelAverageMisorientations[point] = 0;
-          }
-        }
-        if (m_FeatureIds[point] == 0 || m_CellPhases[point] == 0)
-        {
-          m_KernelAverageMisorientations[point] = 0;
-        }
+        if (j == 0 && (k < 0 || (k == 0 && l <= 0))) { continue; }
+        offsets.push_back(l);
+        offsets.push_back(k);
+        offsets.push_back(j);
       }
     }
   }
 
+  // A slab must be at least as thick as the forward reach of the kernel in rows
+  size_t slabThickness = static_cast<size_t>(m_KernelSize.z * yPoints + m_KernelSize.y);
+  if (slabThickness < 1) { slabThickness = 1; }
+  size_t numSlabs = static_cast<size_t>((totalRows + slabThickness - 1) / slabThickness);
+
+  m_KernelAverageMisorientationsPtr.lock()->initializeWithZeros();
+  std::vector<int32_t> misoCounts(totalPoints, 0);
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  for (size_t parity = 0; parity < 2; parity++)
+  {
+    size_t numPasses = (numSlabs + 1 - parity) / 2;
+    FindKernelAvgMisorientationsImpl kernel(m_FeatureIds, m_CellPhases, quats, m_CrystalStructures, m_OrientationOps, offsets,
+                                            xPoints, yPoints, zPoints, slabThickness, parity,
+                                            m_KernelAverageMisorientations, &(misoCounts.front()));
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    if (doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numPasses), kernel, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      kernel.convert(0, numPasses);
+    }
+    if (getCancel() == true) { return; }
+  }
+
+  for (int64_t point = 0; point < totalPoints; point++)
+  {
+    if (misoCounts[point] == 0 || m_FeatureIds[point] == 0 || m_CellPhases[point] == 0)
+    {
+      m_KernelAverageMisorientations[point] = 0;
+    }
+    else
+    {
+      m_KernelAverageMisorientations[point] = m_KernelAverageMisorientations[point] / (float)misoCounts[point];
+    }
+  }
+
   notifyStatusMessage(getHumanLabel(), "FindKernelAvgMisorientations Completed");
 }
 
@@ -122,7 +122,7 @@ class FindLargestCrossSections : public AbstractFilter
     void find_crosssections();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, LargestCrossSections)
 
     void dataCheck();
@@ -152,11 +152,11 @@ class FindLocalAverageCAxisMisalignments : public AbstractFilter
     FindLocalAverageCAxisMisalignments();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellParentIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureParentIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellParentIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureParentIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, NumFeaturesPerParent)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AvgCAxisMisalignments)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, AvgCAxisMisalignments)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, LocalCAxisMisalignments)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, UnbiasedLocalCAxisMisalignments)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
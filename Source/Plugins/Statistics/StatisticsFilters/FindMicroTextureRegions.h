@@ -117,7 +117,7 @@ class FindMicroTextureRegions : public AbstractFilter
   private:
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, MicroTextureRegionNumCells)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, MicroTextureRegionFractionOccupied)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
 
     void dataCheck();
 
@@ -37,13 +37,137 @@
 #include "FindNeighbors.h"
 
 #include <sstream>
-
-#include <QtCore/QDateTime>
+#include <algorithm>
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "DREAM3DLib/Common/Constants.h"
 
 #include "StatisticsConstants.h"
 
+/**
+ * @brief The FindNeighborsImpl class sweeps a range of rows (plane * yPoints + row) of the FeatureIds and
+ * records one (feature, neighbor) pair for every face that a Cell shares with a Cell of a different Feature.
+ * The pairs are packed into a single 64 bit key (feature in the high word) so that sorting the keys groups
+ * the faces by Feature and then by neighbor. Each body owns its pair buffer and the buffers are concatenated
+ * in join(), so the sweep itself never writes to memory shared with another thread other than the
+ * per-Cell BoundaryCells value.
+ */
+class FindNeighborsImpl
+{
+  public:
+    FindNeighborsImpl(int32_t* featureIds, int8_t* boundaryCells, bool storeSurfaceFeatures, size_t xPoints, size_t yPoints, size_t zPoints) :
+      m_FeatureIds(featureIds),
+      m_BoundaryCells(boundaryCells),
+      m_StoreSurfaceFeatures(storeSurfaceFeatures),
+      m_XPoints(xPoints),
+      m_YPoints(yPoints),
+      m_ZPoints(zPoints)
+    {}
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    FindNeighborsImpl(FindNeighborsImpl& other, tbb::split) :
+      m_FeatureIds(other.m_FeatureIds),
+      m_BoundaryCells(other.m_BoundaryCells),
+      m_StoreSurfaceFeatures(other.m_StoreSurfaceFeatures),
+      m_XPoints(other.m_XPoints),
+      m_YPoints(other.m_YPoints),
+      m_ZPoints(other.m_ZPoints)
+    {}
+#endif
+
+    virtual ~FindNeighborsImpl() {}
+
+    static uint64_t packPair(int32_t feature, int32_t neighbor)
+    {
+      return (static_cast<uint64_t>(feature) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(neighbor));
+    }
+
+    void findPairs(size_t rowStart, size_t rowEnd)
+    {
+      int64_t neighpoints[6];
+      neighpoints[0] = -static_cast<int64_t>(m_XPoints * m_YPoints);
+      neighpoints[1] = -static_cast<int64_t>(m_XPoints);
+      neighpoints[2] = -1;
+      neighpoints[3] = 1;
+      neighpoints[4] = static_cast<int64_t>(m_XPoints);
+      neighpoints[5] = static_cast<int64_t>(m_XPoints * m_YPoints);
+
+      int8_t onsurf = 0;
+      int32_t feature = 0;
+      int32_t neighFeature = 0;
+      bool good = false;
+      for (size_t r = rowStart; r < rowEnd; r++)
+      {
+        size_t row = r % m_YPoints;
+        size_t plane = r / m_YPoints;
+        int64_t rowStride = static_cast<int64_t>(r * m_XPoints);
+        bool surfaceRow = (row == 0 || row == (m_YPoints - 1) || ((plane == 0 || plane == (m_ZPoints - 1)) && m_ZPoints != 1));
+        for (size_t column = 0; column < m_XPoints; column++)
+        {
+          int64_t j = rowStride + static_cast<int64_t>(column);
+          onsurf = 0;
+          feature = m_FeatureIds[j];
+          if(feature > 0)
+          {
+            if(m_StoreSurfaceFeatures == true && (surfaceRow == true || column == 0 || column == (m_XPoints - 1)))
+            {
+              if(m_SurfaceFeatures.empty() == true || m_SurfaceFeatures.back() != feature) { m_SurfaceFeatures.push_back(feature); }
+            }
+            for (int k = 0; k < 6; k++)
+            {
+              good = true;
+              if(k == 0 && plane == 0) { good = false; }
+              if(k == 5 && plane == (m_ZPoints - 1)) { good = false; }
+              if(k == 1 && row == 0) { good = false; }
+              if(k == 4 && row == (m_YPoints - 1)) { good = false; }
+              if(k == 2 && column == 0) { good = false; }
+              if(k == 3 && column == (m_XPoints - 1)) { good = false; }
+              if(good == false) { continue; }
+              neighFeature = m_FeatureIds[j + neighpoints[k]];
+              if(neighFeature != feature && neighFeature > 0)
+              {
+                onsurf++;
+                m_Pairs.push_back(packPair(feature, neighFeature));
+              }
+            }
+          }
+          if(NULL != m_BoundaryCells) { m_BoundaryCells[j] = onsurf; }
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      findPairs(r.begin(), r.end());
+    }
+#endif
+
+    void join(const FindNeighborsImpl& rhs)
+    {
+      m_Pairs.insert(m_Pairs.end(), rhs.m_Pairs.begin(), rhs.m_Pairs.end());
+      m_SurfaceFeatures.insert(m_SurfaceFeatures.end(), rhs.m_SurfaceFeatures.begin(), rhs.m_SurfaceFeatures.end());
+    }
+
+    std::vector<uint64_t> m_Pairs;
+    std::vector<int32_t> m_SurfaceFeatures;
+
+  private:
+    int32_t* m_FeatureIds;
+    int8_t* m_BoundaryCells;
+    bool m_StoreSurfaceFeatures;
+    size_t m_XPoints;
+    size_t m_YPoints;
+    size_t m_ZPoints;
+};
+
 
 // -----------------------------------------------------------------------------
 //
@@ -216,171 +340,83 @@ void FindNeighbors::execute()
   if(getErrorCondition() < 0) { return; }
 
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(m_FeatureIdsArrayPath.getDataContainerName());
-  int64_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
   size_t totalFeatures = m_NumNeighborsPtr.lock()->getNumberOfTuples();
 
-  size_t udims[3] = {0, 0, 0};
-  m->getDimensions(udims);
-#if (CMP_SIZEOF_SIZE_T == 4)
-  typedef int32_t DimType;
-#else
-  typedef int64_t DimType;
-#endif
-  DimType dims[3] =
-  {
-    static_cast<DimType>(udims[0]),
-    static_cast<DimType>(udims[1]),
-    static_cast<DimType>(udims[2]),
-  };
-
-  DimType neighpoints[6];
-  neighpoints[0] = -dims[0] * dims[1];
-  neighpoints[1] = -dims[0];
-  neighpoints[2] = -1;
-  neighpoints[3] = 1;
-  neighpoints[4] = dims[0];
-  neighpoints[5] = dims[0] * dims[1];
-
-  float column, row, plane;
-  int feature;
-  size_t nnum;
-  int onsurf = 0;
-  int good = 0;
-  int neighbor = 0;
-
-  std::vector<std::vector<int> > neighborlist;
-  std::vector<std::vector<float> > neighborsurfacearealist;
-
-  int nListSize = 100;
-  neighborlist.resize(totalFeatures);
-  neighborsurfacearealist.resize(totalFeatures);
-
-  uint64_t millis = QDateTime::currentMSecsSinceEpoch();
-  uint64_t currentMillis = millis;
-  //  uint64_t startMillis = millis;
-  //  uint64_t estimatedTime = 0;
-  //  float timeDiff = 0.0f;
-
-  for (int i = 1; i < totalFeatures; i++)
-  {
-    currentMillis = QDateTime::currentMSecsSinceEpoch();
-    if (currentMillis - millis > 1000)
-    {
-      QString ss = QObject::tr("Finding Neighbors - Initializing Neighbor Lists - %1 Percent Complete").arg((static_cast<float>(i) / totalFeatures) * 100);
-      notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-      millis = QDateTime::currentMSecsSinceEpoch();
-    }
-
-    if(getCancel() == true) { break; }
+  size_t xPoints = m->getXPoints();
+  size_t yPoints = m->getYPoints();
+  size_t zPoints = m->getZPoints();
 
+  for (size_t i = 1; i < totalFeatures; i++)
+  {
     m_NumNeighbors[i] = 0;
-    neighborlist[i].resize(nListSize);
-    neighborsurfacearealist[i].assign(nListSize, -1.0f);
     if(m_StoreSurfaceFeatures == true) { m_SurfaceFeatures[i] = false; }
-
   }
 
-  for (int64_t j = 0; j < totalPoints; j++)
-  {
-    currentMillis = QDateTime::currentMSecsSinceEpoch();
-    if (currentMillis - millis > 1000)
-    {
-      QString ss = QObject::tr("Finding Neighbors - Determining Neighbor Lists - %1 Percent Complete").arg((static_cast<float>(j) / totalPoints) * 100);
-      notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-      millis = QDateTime::currentMSecsSinceEpoch();
-    }
-    if(getCancel() == true) { break; }
+  notifyStatusMessage(getMessagePrefix(), getHumanLabel(), "Finding Neighbors - Determining Neighbor Lists");
 
-    onsurf = 0;
-    feature = m_FeatureIds[j];
-    if(feature > 0)
-    {
-      column = static_cast<float>( j % m->getXPoints() );
-      row = static_cast<float>( (j / m->getXPoints()) % m->getYPoints() );
-      plane = static_cast<float>( j / (m->getXPoints() * m->getYPoints()) );
-      if(m_StoreSurfaceFeatures == true)
-      {
-        if((column == 0 || column == (m->getXPoints() - 1) || row == 0 || row == (m->getYPoints() - 1) || plane == 0 || plane == (m->getZPoints() - 1)) && m->getZPoints() != 1)
-        {
-          m_SurfaceFeatures[feature] = true;
-        }
-        if((column == 0 || column == (m->getXPoints() - 1) || row == 0 || row == (m->getYPoints() - 1)) && m->getZPoints() == 1)
-        {
-          m_SurfaceFeatures[feature] = true;
-        }
-      }
-      for (int k = 0; k < 6; k++)
-      {
-        good = 1;
-        neighbor = static_cast<int>( j + neighpoints[k] );
-        if(k == 0 && plane == 0) { good = 0; }
-        if(k == 5 && plane == (m->getZPoints() - 1)) { good = 0; }
-        if(k == 1 && row == 0) { good = 0; }
-        if(k == 4 && row == (m->getYPoints() - 1)) { good = 0; }
-        if(k == 2 && column == 0) { good = 0; }
-        if(k == 3 && column == (m->getXPoints() - 1)) { good = 0; }
-        if(good == 1 && m_FeatureIds[neighbor] != feature && m_FeatureIds[neighbor] > 0)
-        {
-          onsurf++;
-          nnum = m_NumNeighbors[feature];
-          neighborlist[feature].push_back(m_FeatureIds[neighbor]);
-          nnum++;
-          m_NumNeighbors[feature] = static_cast<int32_t>(nnum);
-        }
-      }
-    }
-    if(m_StoreBoundaryCells == true) { m_BoundaryCells[j] = onsurf; }
-  }
+  int8_t* boundaryCells = (m_StoreBoundaryCells == true) ? m_BoundaryCells : NULL;
+  FindNeighborsImpl finder(m_FeatureIds, boundaryCells, m_StoreSurfaceFeatures, xPoints, yPoints, zPoints);
 
-  // We do this to create new set of NeighborList objects
-  for (size_t i = 1; i < totalFeatures; i++)
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
   {
-    currentMillis = QDateTime::currentMSecsSinceEpoch();
-    if (currentMillis - millis > 1000)
-    {
-      QString ss = QObject::tr("Finding Neighbors - Calculating Surface Areas - %1 Percent Complete").arg(((float)i / totalFeatures) * 100);
-      notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-      millis = QDateTime::currentMSecsSinceEpoch();
-    }
-    if(getCancel() == true) { break; }
-
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, yPoints * zPoints), finder, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    finder.findPairs(0, yPoints * zPoints);
+  }
 
-    QMap<int, int> neighToCount;
-    int numneighs = static_cast<int>( neighborlist[i].size() );
+  if(getCancel() == true) { return; }
 
-    // this increments the voxel counts for each feature
-    for (int j = 0; j < numneighs; j++)
-    {
-      neighToCount[neighborlist[i][j]]++;
-    }
+  for (size_t i = 0; i < finder.m_SurfaceFeatures.size(); i++)
+  {
+    m_SurfaceFeatures[finder.m_SurfaceFeatures[i]] = true;
+  }
 
-    QMap<int, int>::Iterator neighiter = neighToCount.find(0);
-    neighToCount.erase(neighiter);
-    neighiter = neighToCount.find(-1);
-    neighToCount.erase(neighiter);
-    //Resize the features neighbor list to zero
-    neighborlist[i].resize(0);
-    neighborsurfacearealist[i].resize(0);
+  notifyStatusMessage(getMessagePrefix(), getHumanLabel(), "Finding Neighbors - Calculating Surface Areas");
 
-    for (QMap<int, int>::iterator iter = neighToCount.begin(); iter != neighToCount.end(); ++iter)
-    {
-      int neigh = iter.key(); // get the neighbor feature
-      int number = iter.value(); // get the number of voxels
-      float area = number * m->getXRes() * m->getYRes();
+  // Sorting the packed (feature, neighbor) keys puts all the faces of a Feature next to each other
+  // with the neighbors in ascending order; each run of equal keys is one neighbor and its face count
+  std::vector<uint64_t>& pairs = finder.m_Pairs;
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  if (doParallel == true)
+  {
+    tbb::parallel_sort(pairs.begin(), pairs.end());
+  }
+  else
+#endif
+  {
+    std::sort(pairs.begin(), pairs.end());
+  }
 
-      // Push the neighbor feature id back onto the list so we stay synced up
-      neighborlist[i].push_back(neigh);
-      neighborsurfacearealist[i].push_back(area);
-    }
-    m_NumNeighbors[i] = int32_t( neighborlist[i].size() );
+  if(getCancel() == true) { return; }
 
+  float faceArea = m->getXRes() * m->getYRes();
+  size_t numPairs = pairs.size();
+  size_t p = 0;
+  for (size_t i = 1; i < totalFeatures; i++)
+  {
     // Set the vector for each list into the NeighborList Object
     NeighborList<int>::SharedVectorType sharedNeiLst(new std::vector<int>);
-    sharedNeiLst->assign(neighborlist[i].begin(), neighborlist[i].end());
-    m_NeighborList.lock()->setList(static_cast<int>(i), sharedNeiLst);
-
     NeighborList<float>::SharedVectorType sharedSAL(new std::vector<float>);
-    sharedSAL->assign(neighborsurfacearealist[i].begin(), neighborsurfacearealist[i].end());
+    while (p < numPairs && static_cast<size_t>(pairs[p] >> 32) == i)
+    {
+      uint64_t key = pairs[p];
+      size_t number = 0;
+      while (p < numPairs && pairs[p] == key)
+      {
+        number++;
+        p++;
+      }
+      sharedNeiLst->push_back(static_cast<int>(key & 0xFFFFFFFFULL));
+      sharedSAL->push_back(number * faceArea);
+    }
+    m_NumNeighbors[i] = int32_t( sharedNeiLst->size() );
+    m_NeighborList.lock()->setList(static_cast<int>(i), sharedNeiLst);
     m_SharedSurfaceAreaList.lock()->setList(static_cast<int>(i), sharedSAL);
   }
 
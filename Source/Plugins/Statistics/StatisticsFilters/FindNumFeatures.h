@@ -106,7 +106,7 @@ class FindNumFeatures : public AbstractFilter
     FindNumFeatures();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, NumFeatures)
 
     void dataCheck();
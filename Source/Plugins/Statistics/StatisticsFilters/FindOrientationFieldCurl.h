@@ -119,7 +119,7 @@ class FindOrientationFieldCurl : public AbstractFilter
   private:
     QVector<OrientationOps::Pointer> m_OrientationOps;
 
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, DislocationTensors)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Quats)
 
@@ -162,7 +162,7 @@ class FindSchmids : public AbstractFilter
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, Phis)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, Lambdas)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, Poles)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AvgQuats)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, SlipSystems)
 
@@ -145,7 +145,7 @@ void FindShapes::dataCheck()
   QVector<size_t> dims(1, 1);
   m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getFeatureIdsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_FeatureIdsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_FeatureIds = m_FeatureIdsPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   tempPath.update(getCellFeatureAttributeMatrixName().getDataContainerName(), getCellFeatureAttributeMatrixName().getAttributeMatrixName(), getOmega3sArrayName() );
   m_Omega3sPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_Omega3sPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
@@ -161,7 +161,7 @@ void FindShapes::dataCheck()
   { m_AxisLengths = m_AxisLengthsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   m_CentroidsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this, getCentroidsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_CentroidsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_Centroids = m_CentroidsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_Centroids = m_CentroidsPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   tempPath.update(getCellFeatureAttributeMatrixName().getDataContainerName(), getCellFeatureAttributeMatrixName().getAttributeMatrixName(), getAxisEulerAnglesArrayName() );
   m_AxisEulerAnglesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this, tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_AxisEulerAnglesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
@@ -223,12 +223,6 @@ void FindShapes::find_moments()
 {
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(m_FeatureIdsArrayPath.getDataContainerName());
 
-  float u200 = 0;
-  float u020 = 0;
-  float u002 = 0;
-  float u110 = 0;
-  float u011 = 0;
-  float u101 = 0;
   float xx, yy, zz, xy, xz, yz;
   size_t numfeatures = m_CentroidsPtr.lock()->getNumberOfTuples();
   m_FeatureMoments->resize(numfeatures * 6);
@@ -332,13 +326,12 @@ void FindShapes::find_moments()
       }
     }
   }
-  double sphere = (2000.0f * DREAM3D::Constants::k_Pi * DREAM3D::Constants::k_Pi) / 9.0f;
   //constant for moments because voxels are broken into smaller voxels
   double konst1 =  (modXRes / 2.0f) * (modYRes / 2.0f) * (modZRes / 2.0f);
   //constant for volumes because voxels are counted as one
   double konst2 =  (xRes) * (yRes) * (zRes);
   double konst3 =  (modXRes) * (modYRes) * (modZRes);
-  double o3, vol5, omega3;
+  double vol5;
   for (size_t i = 1; i < numfeatures; i++)
   {
     //calculating the modified volume for the omega3 value
@@ -350,19 +343,7 @@ void FindShapes::find_moments()
     featuremoments[i * 6 + 3] = -featuremoments[i * 6 + 3] * konst1;
     featuremoments[i * 6 + 4] = -featuremoments[i * 6 + 4] * konst1;
     featuremoments[i * 6 + 5] = -featuremoments[i * 6 + 5] * konst1;
-    u200 = (featuremoments[i * 6 + 1] + featuremoments[i * 6 + 2] - featuremoments[i * 6 + 0]) / 2.0f;
-    u020 = (featuremoments[i * 6 + 0] + featuremoments[i * 6 + 2] - featuremoments[i * 6 + 1]) / 2.0f;
-    u002 = (featuremoments[i * 6 + 0] + featuremoments[i * 6 + 1] - featuremoments[i * 6 + 2]) / 2.0f;
-    u110 = -featuremoments[i * 6 + 3];
-    u011 = -featuremoments[i * 6 + 4];
-    u101 = -featuremoments[i * 6 + 5];
-    o3 = (u200 * u020 * u002) + (2.0f * u110 * u101 * u011) - (u200 * u011 * u011) - (u020 * u101 * u101) - (u002 * u110 * u110);
-    vol5 = powf(vol5, 5);
-    omega3 = vol5 / o3;
-    omega3 = omega3 / sphere;
-    if (omega3 > 1) { omega3 = 1; }
-    if(vol5 == 0) { omega3 = 0; }
-    m_Omega3s[i] = omega3;
+    m_Omega3s[i] = CalculateOmega3(featuremoments + i * 6, vol5);
   }
 }
 void FindShapes::find_moments2D()
@@ -452,15 +433,6 @@ void FindShapes::find_moments2D()
 // -----------------------------------------------------------------------------
 void FindShapes::find_axes()
 {
-  double I1, I2, I3;
-  double Ixx, Iyy, Izz, Ixy, Ixz, Iyz;
-  double a, b, c, d, f, g, h;
-  double rsquare, r, theta;
-  double A, B, C;
-  double r1, r2, r3;
-  float bovera, covera;
-  double value;
-
   size_t numfeatures = m_CentroidsPtr.lock()->getNumberOfTuples();
 
   m_FeatureMoments->resize(numfeatures * 6);
@@ -471,70 +443,7 @@ void FindShapes::find_axes()
 
   for (size_t i = 1; i < numfeatures; i++)
   {
-    Ixx = featuremoments[i * 6 + 0];
-    Iyy = featuremoments[i * 6 + 1];
-    Izz = featuremoments[i * 6 + 2];
-
-    Ixy = featuremoments[i * 6 + 3];
-    Iyz = featuremoments[i * 6 + 4];
-    Ixz = featuremoments[i * 6 + 5];
-
-    a = 1;
-    b = (-Ixx - Iyy - Izz);
-    c = ((Ixx * Izz) + (Ixx * Iyy) + (Iyy * Izz) - (Ixz * Ixz) - (Ixy * Ixy) - (Iyz * Iyz));
-    d = 0.0;
-    d = ((Ixz * Iyy * Ixz) + (Ixy * Izz * Ixy) + (Iyz * Ixx * Iyz) - (Ixx * Iyy * Izz) - (Ixy * Iyz * Ixz) - (Ixy * Iyz * Ixz));
-    // f and g are the p and q values when reducing the cubic equation to t^3 + pt + q = 0
-    f = ((3.0f * c / a) - ((b / a) * (b / a))) / 3.0f;
-    g = ((2.0f * (b / a) * (b / a) * (b / a)) - (9.0f * b * c / (a * a)) + (27.0f * (d / a))) / 27.0f;
-    h = (g * g / 4.0f) + (f * f * f / 27.0f);
-    rsquare = (g * g / 4) - h;
-    r = sqrt(rsquare);
-    if(rsquare < 0) { r = 0; }
-    theta = 0;
-    if (r == 0)
-    {
-      theta = 0;
-    }
-    if (r != 0)
-    {
-      value = -g / (2.0f * r);
-      if(value > 1) { value = 1.0f; }
-      if(value < -1) { value = -1.0f; }
-      theta = acos(value);
-    }
-    float const1 = powf(r, 0.33333333333f);
-    float const2 = cosf(theta / 3.0f);
-    float const3 = b / (3.0f * a);
-    float const4 = 1.7320508f * sinf(theta / 3.0f);
-
-    r1 = 2 * const1 * const2 - (const3);
-    r2 = -const1 * (const2 - (const4)) - const3;
-    r3 = -const1 * (const2 + (const4)) - const3;
-    featureeigenvals[3 * i] = r1;
-    featureeigenvals[3 * i + 1] = r2;
-    featureeigenvals[3 * i + 2] = r3;
-
-    I1 = (15.0f * r1) / (4.0f * DREAM3D::Constants::k_Pi);
-    I2 = (15.0f * r2) / (4.0f * DREAM3D::Constants::k_Pi);
-    I3 = (15.0f * r3) / (4.0f * DREAM3D::Constants::k_Pi);
-    A = (I1 + I2 - I3) / 2.0f;
-    B = (I1 + I3 - I2) / 2.0f;
-    C = (I2 + I3 - I1) / 2.0f;
-    a = (A * A * A * A) / (B * C);
-    a = powf(a, 0.1f);
-    b = B / A;
-    b = sqrt(b) * a;
-    c = A / (a * a * a * b);
-
-    m_AxisLengths[3 * i] = a / scaleFactor;
-    m_AxisLengths[3 * i + 1] = b / scaleFactor;
-    m_AxisLengths[3 * i + 2] = c / scaleFactor;
-    bovera = b / a;
-    covera = c / a;
-    if(A == 0 || B == 0 || C == 0) { bovera = 0, covera = 0; }
-    m_AspectRatios[2 * i] = bovera;
-    m_AspectRatios[2 * i + 1] = covera;
+    CalculateAxes(featuremoments + i * 6, scaleFactor, featureeigenvals + i * 3, m_AxisLengths + i * 3, m_AspectRatios + i * 2);
   }
 }
 
@@ -575,153 +484,9 @@ void FindShapes::find_axes2D()
 void FindShapes::find_axiseulers()
 {
   size_t numfeatures = m_CentroidsPtr.lock()->getNumberOfTuples();
-  float ea1 = 0, ea2 = 0, ea3 = 0;
   for (size_t i = 1; i < numfeatures; i++)
   {
-    float Ixx = featuremoments[i * 6 + 0];
-    float Iyy = featuremoments[i * 6 + 1];
-    float Izz = featuremoments[i * 6 + 2];
-    float Ixy = -featuremoments[i * 6 + 3];
-    float Iyz = -featuremoments[i * 6 + 4];
-    float Ixz = -featuremoments[i * 6 + 5];
-    float radius1 = featureeigenvals[3 * i];
-    float radius2 = featureeigenvals[3 * i + 1];
-    float radius3 = featureeigenvals[3 * i + 2];
-
-
-    float e[3][1];
-    float vect[3][3];
-    e[0][0] = radius1;
-    e[1][0] = radius2;
-    e[2][0] = radius3;
-    float uber[3][3];
-    float bmat[3][1];
-    bmat[0][0] = 0.0000001f;
-    bmat[1][0] = 0.0000001f;
-    bmat[2][0] = 0.0000001f;
-
-    for (int j = 0; j < 3; j++)
-    {
-      uber[0][0] = Ixx - e[j][0];
-      uber[0][1] = Ixy;
-      uber[0][2] = Ixz;
-      uber[1][0] = Ixy;
-      uber[1][1] = Iyy - e[j][0];
-      uber[1][2] = Iyz;
-      uber[2][0] = Ixz;
-      uber[2][1] = Iyz;
-      uber[2][2] = Izz - e[j][0];
-      float** uberelim;
-      float** uberbelim;
-      uberelim = new float *[3];
-      uberbelim = new float *[3];
-      for (int d = 0; d < 3; d++)
-      {
-        uberelim[d] = new float[3];
-        uberbelim[d] = new float[1];
-      }
-      int elimcount = 0;
-      int elimcount1 = 0;
-      float q = 0;
-      float sum = 0;
-      float c = 0;
-      for (int a = 0; a < 3; a++)
-      {
-        elimcount1 = 0;
-        for (int b = 0; b < 3; b++)
-        {
-          uberelim[elimcount][elimcount1] = uber[a][b];
-          elimcount1++;
-        }
-        uberbelim[elimcount][0] = bmat[a][0];
-        elimcount++;
-      }
-      for (int k = 0; k < elimcount - 1; k++)
-      {
-        for (int l = k + 1; l < elimcount; l++)
-        {
-          c = uberelim[l][k] / uberelim[k][k];
-          for (int r = k + 1; r < elimcount; r++)
-          {
-            uberelim[l][r] = uberelim[l][r] - c * uberelim[k][r];
-          }
-          uberbelim[l][0] = uberbelim[l][0] - c * uberbelim[k][0];
-        }
-      }
-      uberbelim[elimcount - 1][0] = uberbelim[elimcount - 1][0] / uberelim[elimcount - 1][elimcount - 1];
-      for (int l = 1; l < elimcount; l++)
-      {
-        int r = (elimcount - 1) - l;
-        sum = 0;
-        for (int n = r + 1; n < elimcount; n++)
-        {
-          sum = sum + (uberelim[r][n] * uberbelim[n][0]);
-        }
-        uberbelim[r][0] = (uberbelim[r][0] - sum) / uberelim[r][r];
-      }
-      for (int p = 0; p < elimcount; p++)
-      {
-        q = uberbelim[p][0];
-        vect[j][p] = q;
-      }
-      for (int d = 0; d < 3; d++)
-      {
-        delete uberelim[d];
-        delete uberbelim[d];
-      }
-      delete uberelim;
-      delete uberbelim;
-    }
-
-    float n1x = vect[0][0];
-    float n1y = vect[0][1];
-    float n1z = vect[0][2];
-    float n2x = vect[1][0];
-    float n2y = vect[1][1];
-    float n2z = vect[1][2];
-    float n3x = vect[2][0];
-    float n3y = vect[2][1];
-    float n3z = vect[2][2];
-    float norm1 = sqrt(((n1x * n1x) + (n1y * n1y) + (n1z * n1z)));
-    float norm2 = sqrt(((n2x * n2x) + (n2y * n2y) + (n2z * n2z)));
-    float norm3 = sqrt(((n3x * n3x) + (n3y * n3y) + (n3z * n3z)));
-    n1x = n1x / norm1;
-    n1y = n1y / norm1;
-    n1z = n1z / norm1;
-    n2x = n2x / norm2;
-    n2y = n2y / norm2;
-    n2z = n2z / norm2;
-    n3x = n3x / norm3;
-    n3y = n3y / norm3;
-    n3z = n3z / norm3;
-
-    if(n1z > 1.0) { n1z = 1.0; }
-    if(n1z < -1.0) { n1z = -1.0; }
-    ea2 = acos(n1z);
-    if (ea2 == 0.0)
-    {
-      ea1 = 0.0;
-      ea3 = acos(n2y);
-    }
-    else
-    {
-      float cosine3 = (n2z / sinf(ea2));
-      float sine3 = (n3z / sinf(ea2));
-      float cosine1 = (-n1y / sinf(ea2));
-      float sine1 = (n1x / sinf(ea2));
-      if (cosine3 > 1.0) { cosine3 = 1.0; }
-      if (cosine3 < -1.0) { cosine3 = -1.0; }
-      if (cosine1 > 1.0) { cosine1 = 1.0; }
-      if (cosine1 < -1.0) { cosine1 = -1.0; }
-      ea3 = acos(cosine3);
-      ea1 = acos(cosine1);
-      if (sine3 < 0) { ea3 = (2 * DREAM3D::Constants::k_Pi) - ea3; }
-      if (sine1 < 0) { ea1 = (2 * DREAM3D::Constants::k_Pi) - ea1; }
-
-    }
-    m_AxisEulerAngles[3 * i] = ea1;
-    m_AxisEulerAngles[3 * i + 1] = ea2;
-    m_AxisEulerAngles[3 * i + 2] = ea3;
+    CalculateAxisEulers(featuremoments + i * 6, featureeigenvals + i * 3, m_AxisEulerAngles + i * 3);
   }
 }
 
@@ -756,6 +521,259 @@ void FindShapes::find_axiseulers2D()
 }
 
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float FindShapes::CalculateOmega3(const double* moments, double vol5)
+{
+  double sphere = (2000.0f * DREAM3D::Constants::k_Pi * DREAM3D::Constants::k_Pi) / 9.0f;
+  float u200 = (moments[1] + moments[2] - moments[0]) / 2.0f;
+  float u020 = (moments[0] + moments[2] - moments[1]) / 2.0f;
+  float u002 = (moments[0] + moments[1] - moments[2]) / 2.0f;
+  float u110 = -moments[3];
+  float u011 = -moments[4];
+  float u101 = -moments[5];
+  double o3 = (u200 * u020 * u002) + (2.0f * u110 * u101 * u011) - (u200 * u011 * u011) - (u020 * u101 * u101) - (u002 * u110 * u110);
+  vol5 = powf(vol5, 5);
+  double omega3 = vol5 / o3;
+  omega3 = omega3 / sphere;
+  if (omega3 > 1) { omega3 = 1; }
+  if(vol5 == 0) { omega3 = 0; }
+  return omega3;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindShapes::CalculateAxes(const double* moments, double scaleFactor, double* eigenvals, float* axisLengths, float* aspectRatios)
+{
+  double I1, I2, I3;
+  double Ixx, Iyy, Izz, Ixy, Ixz, Iyz;
+  double a, b, c, d, f, g, h;
+  double rsquare, r, theta;
+  double A, B, C;
+  double r1, r2, r3;
+  float bovera, covera;
+  double value;
+
+  Ixx = moments[0];
+  Iyy = moments[1];
+  Izz = moments[2];
+
+  Ixy = moments[3];
+  Iyz = moments[4];
+  Ixz = moments[5];
+
+  a = 1;
+  b = (-Ixx - Iyy - Izz);
+  c = ((Ixx * Izz) + (Ixx * Iyy) + (Iyy * Izz) - (Ixz * Ixz) - (Ixy * Ixy) - (Iyz * Iyz));
+  d = 0.0;
+  d = ((Ixz * Iyy * Ixz) + (Ixy * Izz * Ixy) + (Iyz * Ixx * Iyz) - (Ixx * Iyy * Izz) - (Ixy * Iyz * Ixz) - (Ixy * Iyz * Ixz));
+  // f and g are the p and q values when reducing the cubic equation to t^3 + pt + q = 0
+  f = ((3.0f * c / a) - ((b / a) * (b / a))) / 3.0f;
+  g = ((2.0f * (b / a) * (b / a) * (b / a)) - (9.0f * b * c / (a * a)) + (27.0f * (d / a))) / 27.0f;
+  h = (g * g / 4.0f) + (f * f * f / 27.0f);
+  rsquare = (g * g / 4) - h;
+  r = sqrt(rsquare);
+  if(rsquare < 0) { r = 0; }
+  theta = 0;
+  if (r == 0)
+  {
+    theta = 0;
+  }
+  if (r != 0)
+  {
+    value = -g / (2.0f * r);
+    if(value > 1) { value = 1.0f; }
+    if(value < -1) { value = -1.0f; }
+    theta = acos(value);
+  }
+  float const1 = powf(r, 0.33333333333f);
+  float const2 = cosf(theta / 3.0f);
+  float const3 = b / (3.0f * a);
+  float const4 = 1.7320508f * sinf(theta / 3.0f);
+
+  r1 = 2 * const1 * const2 - (const3);
+  r2 = -const1 * (const2 - (const4)) - const3;
+  r3 = -const1 * (const2 + (const4)) - const3;
+  eigenvals[0] = r1;
+  eigenvals[1] = r2;
+  eigenvals[2] = r3;
+
+  I1 = (15.0f * r1) / (4.0f * DREAM3D::Constants::k_Pi);
+  I2 = (15.0f * r2) / (4.0f * DREAM3D::Constants::k_Pi);
+  I3 = (15.0f * r3) / (4.0f * DREAM3D::Constants::k_Pi);
+  A = (I1 + I2 - I3) / 2.0f;
+  B = (I1 + I3 - I2) / 2.0f;
+  C = (I2 + I3 - I1) / 2.0f;
+  a = (A * A * A * A) / (B * C);
+  a = powf(a, 0.1f);
+  b = B / A;
+  b = sqrt(b) * a;
+  c = A / (a * a * a * b);
+
+  axisLengths[0] = a / scaleFactor;
+  axisLengths[1] = b / scaleFactor;
+  axisLengths[2] = c / scaleFactor;
+  bovera = b / a;
+  covera = c / a;
+  if(A == 0 || B == 0 || C == 0) { bovera = 0, covera = 0; }
+  aspectRatios[0] = bovera;
+  aspectRatios[1] = covera;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FindShapes::CalculateAxisEulers(const double* moments, const double* eigenvals, float* axisEulers)
+{
+  float ea1 = 0, ea2 = 0, ea3 = 0;
+  float Ixx = moments[0];
+  float Iyy = moments[1];
+  float Izz = moments[2];
+  float Ixy = -moments[3];
+  float Iyz = -moments[4];
+  float Ixz = -moments[5];
+  float radius1 = eigenvals[0];
+  float radius2 = eigenvals[1];
+  float radius3 = eigenvals[2];
+
+
+  float e[3][1];
+  float vect[3][3];
+  e[0][0] = radius1;
+  e[1][0] = radius2;
+  e[2][0] = radius3;
+  float uber[3][3];
+  float bmat[3][1];
+  bmat[0][0] = 0.0000001f;
+  bmat[1][0] = 0.0000001f;
+  bmat[2][0] = 0.0000001f;
+
+  for (int j = 0; j < 3; j++)
+  {
+    uber[0][0] = Ixx - e[j][0];
+    uber[0][1] = Ixy;
+    uber[0][2] = Ixz;
+    uber[1][0] = Ixy;
+    uber[1][1] = Iyy - e[j][0];
+    uber[1][2] = Iyz;
+    uber[2][0] = Ixz;
+    uber[2][1] = Iyz;
+    uber[2][2] = Izz - e[j][0];
+    float** uberelim;
+    float** uberbelim;
+    uberelim = new float *[3];
+    uberbelim = new float *[3];
+    for (int d = 0; d < 3; d++)
+    {
+      uberelim[d] = new float[3];
+      uberbelim[d] = new float[1];
+    }
+    int elimcount = 0;
+    int elimcount1 = 0;
+    float q = 0;
+    float sum = 0;
+    float c = 0;
+    for (int a = 0; a < 3; a++)
+    {
+      elimcount1 = 0;
+      for (int b = 0; b < 3; b++)
+      {
+        uberelim[elimcount][elimcount1] = uber[a][b];
+        elimcount1++;
+      }
+      uberbelim[elimcount][0] = bmat[a][0];
+      elimcount++;
+    }
+    for (int k = 0; k < elimcount - 1; k++)
+    {
+      for (int l = k + 1; l < elimcount; l++)
+      {
+        c = uberelim[l][k] / uberelim[k][k];
+        for (int r = k + 1; r < elimcount; r++)
+        {
+          uberelim[l][r] = uberelim[l][r] - c * uberelim[k][r];
+        }
+        uberbelim[l][0] = uberbelim[l][0] - c * uberbelim[k][0];
+      }
+    }
+    uberbelim[elimcount - 1][0] = uberbelim[elimcount - 1][0] / uberelim[elimcount - 1][elimcount - 1];
+    for (int l = 1; l < elimcount; l++)
+    {
+      int r = (elimcount - 1) - l;
+      sum = 0;
+      for (int n = r + 1; n < elimcount; n++)
+      {
+        sum = sum + (uberelim[r][n] * uberbelim[n][0]);
+      }
+      uberbelim[r][0] = (uberbelim[r][0] - sum) / uberelim[r][r];
+    }
+    for (int p = 0; p < elimcount; p++)
+    {
+      q = uberbelim[p][0];
+      vect[j][p] = q;
+    }
+    for (int d = 0; d < 3; d++)
+    {
+      delete uberelim[d];
+      delete uberbelim[d];
+    }
+    delete uberelim;
+    delete uberbelim;
+  }
+
+  float n1x = vect[0][0];
+  float n1y = vect[0][1];
+  float n1z = vect[0][2];
+  float n2x = vect[1][0];
+  float n2y = vect[1][1];
+  float n2z = vect[1][2];
+  float n3x = vect[2][0];
+  float n3y = vect[2][1];
+  float n3z = vect[2][2];
+  float norm1 = sqrt(((n1x * n1x) + (n1y * n1y) + (n1z * n1z)));
+  float norm2 = sqrt(((n2x * n2x) + (n2y * n2y) + (n2z * n2z)));
+  float norm3 = sqrt(((n3x * n3x) + (n3y * n3y) + (n3z * n3z)));
+  n1x = n1x / norm1;
+  n1y = n1y / norm1;
+  n1z = n1z / norm1;
+  n2x = n2x / norm2;
+  n2y = n2y / norm2;
+  n2z = n2z / norm2;
+  n3x = n3x / norm3;
+  n3y = n3y / norm3;
+  n3z = n3z / norm3;
+
+  if(n1z > 1.0) { n1z = 1.0; }
+  if(n1z < -1.0) { n1z = -1.0; }
+  ea2 = acos(n1z);
+  if (ea2 == 0.0)
+  {
+    ea1 = 0.0;
+    ea3 = acos(n2y);
+  }
+  else
+  {
+    float cosine3 = (n2z / sinf(ea2));
+    float sine3 = (n3z / sinf(ea2));
+    float cosine1 = (-n1y / sinf(ea2));
+    float sine1 = (n1x / sinf(ea2));
+    if (cosine3 > 1.0) { cosine3 = 1.0; }
+    if (cosine3 < -1.0) { cosine3 = -1.0; }
+    if (cosine1 > 1.0) { cosine1 = 1.0; }
+    if (cosine1 < -1.0) { cosine1 = -1.0; }
+    ea3 = acos(cosine3);
+    ea1 = acos(cosine1);
+    if (sine3 < 0) { ea3 = (2 * DREAM3D::Constants::k_Pi) - ea3; }
+    if (sine1 < 0) { ea1 = (2 * DREAM3D::Constants::k_Pi) - ea1; }
+
+  }
+  axisEulers[0] = ea1;
+  axisEulers[1] = ea2;
+  axisEulers[2] = ea3;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
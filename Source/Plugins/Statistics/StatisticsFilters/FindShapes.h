@@ -119,6 +119,32 @@ class FindShapes : public AbstractFilter
     virtual void execute();
     virtual void preflight();
 
+    /**
+     * @brief Computes the Omega3 value of a single Feature from its scaled second moments
+     * @param moments The 6 scaled second moments (Ixx, Iyy, Izz, Ixy, Iyz, Ixz) of the Feature
+     * @param vol5 The volume of the Feature in the scaled resolution units
+     * @return The Omega3 value clamped to [0, 1]
+     */
+    static float CalculateOmega3(const double* moments, double vol5);
+
+    /**
+     * @brief Computes the principal moments, axis lengths and aspect ratios of a single Feature
+     * @param moments The 6 scaled second moments (Ixx, Iyy, Izz, Ixy, Iyz, Ixz) of the Feature
+     * @param scaleFactor The factor that was applied to the resolution when the moments were computed
+     * @param eigenvals Output: 3 eigenvalues of the moment of inertia tensor
+     * @param axisLengths Output: 3 axis lengths
+     * @param aspectRatios Output: 2 aspect ratios (b/a, c/a)
+     */
+    static void CalculateAxes(const double* moments, double scaleFactor, double* eigenvals, float* axisLengths, float* aspectRatios);
+
+    /**
+     * @brief Computes the Euler angles of the principal axes of a single Feature
+     * @param moments The 6 scaled second moments (Ixx, Iyy, Izz, Ixy, Iyz, Ixz) of the Feature
+     * @param eigenvals The 3 eigenvalues produced by CalculateAxes()
+     * @param axisEulers Output: 3 Euler angles
+     */
+    static void CalculateAxisEulers(const double* moments, const double* eigenvals, float* axisEulers);
+
 
   signals:
     void updateFilterParameters(AbstractFilter* filter);
@@ -140,9 +166,9 @@ class FindShapes : public AbstractFilter
     float find_zcoord(size_t index);
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, AxisEulerAngles)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Centroids)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, Centroids)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, AxisLengths)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, Omega3s)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, Volumes)
@@ -105,7 +105,7 @@ class FindVolFractions : public AbstractFilter
     FindVolFractions();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, VolFractions)
 
     void dataCheck();
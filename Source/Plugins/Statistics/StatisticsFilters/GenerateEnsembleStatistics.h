@@ -254,18 +254,18 @@ class GenerateEnsembleStatistics : public AbstractFilter
     OrthoRhombicOps::Pointer m_OrthoOps;
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AvgQuats)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, FeatureEulerAngles)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Volumes)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, BiasedFeatures)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, SurfaceFeatures)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AxisEulerAngles)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, FeatureEulerAngles)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, Volumes)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, BiasedFeatures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, SurfaceFeatures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, AxisEulerAngles)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, RadialDistFunc)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, MaxMinRadialDistFunc)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, Omega3s)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, AspectRatios)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, EquivalentDiameters)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, Neighborhoods)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, Omega3s)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, AspectRatios)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(float, EquivalentDiameters)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, Neighborhoods)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
     DEFINE_CREATED_DATAARRAY_VARIABLE(uint32_t, PhaseTypes)
 
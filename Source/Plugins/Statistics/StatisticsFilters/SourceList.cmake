@@ -20,6 +20,7 @@ set(_PublicFilters
   FindCAxisLocations
   FindDirectionalModuli
   FindEuclideanDistMap
+  FindFeatureStatisticsSinglePass
   FindFeatureClustering
   FindFeatureHistogram
   FindFeatureNeighborCAxisMisalignments
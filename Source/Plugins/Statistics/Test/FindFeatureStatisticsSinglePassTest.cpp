@@ -0,0 +1,346 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include <limits>
+#include <vector>
+
+#include <QtCore/QCoreApplication>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/Constants.h"
+#include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
+#include "DREAM3DLib/DataContainers/DataContainerArray.h"
+#include "DREAM3DLib/DataContainers/VolumeDataContainer.h"
+#include "DREAM3DLib/DataContainers/AttributeMatrix.h"
+#include "DREAM3DLib/DataArrays/DataArray.hpp"
+#include "DREAM3DLib/Math/QuaternionMath.hpp"
+
+#include "EbsdLib/EbsdConstants.h"
+
+#include "OrientationLib/OrientationOps/OrientationOps.h"
+
+#include "Statistics/StatisticsFilters/FindFeatureStatisticsSinglePass.h"
+#include "Statistics/StatisticsFilters/FindShapes.h"
+#include "Statistics/StatisticsFilters/FindAvgOrientations.h"
+#include "Statistics/StatisticsFilters/FindSizes.h"
+#include "Generic/GenericFilters/FindFeatureCentroids.h"
+
+namespace SinglePassTest
+{
+  static const size_t XPoints = 31;
+  static const size_t YPoints = 26;
+  static const size_t ZPoints = 19;
+  static const size_t NumSeeds = 14;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float RandomFloat()
+{
+  return static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+}
+
+// -----------------------------------------------------------------------------
+//  Builds a volume of Voronoi Features with one cubic phase. Every Cell gets the
+//  orientation of its Feature with a small perturbation, multiplied by a random
+//  cubic symmetry operator so that the average orientation has to pick equivalents.
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer CreateTestVolume(size_t xPoints, size_t yPoints, size_t zPoints)
+{
+  srand(1234);
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+
+  VolumeDataContainer::Pointer m = VolumeDataContainer::New(DREAM3D::Defaults::VolumeDataContainerName);
+  m->setDimensions(xPoints, yPoints, zPoints);
+  m->setOrigin(0, 0, 0);
+  m->setResolution(0.5f, 0.4f, 0.75f);
+  dca->addDataContainer(m);
+
+  QVector<size_t> tDims(3, 0);
+  tDims[0] = xPoints;
+  tDims[1] = yPoints;
+  tDims[2] = zPoints;
+  AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tDims, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::AttributeMatrixType::Cell);
+  m->addAttributeMatrix(cellAttrMat->getName(), cellAttrMat);
+
+  size_t numFeatures = SinglePassTest::NumSeeds + 1;
+  QVector<size_t> fDims(1, numFeatures);
+  AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(fDims, DREAM3D::Defaults::CellFeatureAttributeMatrixName, DREAM3D::AttributeMatrixType::CellFeature);
+  m->addAttributeMatrix(featureAttrMat->getName(), featureAttrMat);
+
+  QVector<size_t> eDims(1, 2);
+  AttributeMatrix::Pointer ensembleAttrMat = AttributeMatrix::New(eDims, DREAM3D::Defaults::CellEnsembleAttributeMatrixName, DREAM3D::AttributeMatrixType::CellEnsemble);
+  m->addAttributeMatrix(ensembleAttrMat->getName(), ensembleAttrMat);
+
+  size_t totalPoints = xPoints * yPoints * zPoints;
+  QVector<size_t> cDims(1, 1);
+  Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::FeatureIds, true);
+  Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::Phases, true);
+  cDims[0] = 4;
+  FloatArrayType::Pointer quats = FloatArrayType::CreateArray(totalPoints, cDims, DREAM3D::CellData::Quats, true);
+  cDims[0] = 1;
+  UInt32ArrayType::Pointer crystalStructures = UInt32ArrayType::CreateArray(2, cDims, DREAM3D::EnsembleData::CrystalStructures, true);
+  crystalStructures->setValue(0, Ebsd::CrystalStructure::UnknownCrystalStructure);
+  crystalStructures->setValue(1, Ebsd::CrystalStructure::Cubic_High);
+
+  // Seeds and orientations of the Features
+  std::vector<float> seeds(3 * numFeatures, 0.0f);
+  std::vector<QuatF> featureQuats(numFeatures);
+  for (size_t i = 1; i < numFeatures; i++)
+  {
+    seeds[3 * i + 0] = RandomFloat() * xPoints;
+    seeds[3 * i + 1] = RandomFloat() * yPoints;
+    seeds[3 * i + 2] = RandomFloat() * zPoints;
+    featureQuats[i] = QuaternionMathF::New(RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f, RandomFloat() - 0.5f);
+    QuaternionMathF::UnitQuaternion(featureQuats[i]);
+  }
+
+  OrientationOps::Pointer cubicOps = OrientationOps::getOrientationOpsQVector()[Ebsd::CrystalStructure::Cubic_High];
+  int numSymOps = cubicOps->getNumSymOps();
+  QuatF* cellQuats = reinterpret_cast<QuatF*>(quats->getPointer(0));
+  QuatF perturbed;
+  QuatF symOp;
+  size_t index = 0;
+  for (size_t z = 0; z < zPoints; z++)
+  {
+    for (size_t y = 0; y < yPoints; y++)
+    {
+      for (size_t x = 0; x < xPoints; x++)
+      {
+        int32_t closest = 1;
+        float closestDist = std::numeric_limits<float>::max();
+        for (size_t i = 1; i < numFeatures; i++)
+        {
+          float dx = seeds[3 * i + 0] - x;
+          float dy = seeds[3 * i + 1] - y;
+          float dz = seeds[3 * i + 2] - z;
+          float dist = dx * dx + dy * dy + dz * dz;
+          if (dist < closestDist)
+          {
+            closestDist = dist;
+            closest = static_cast<int32_t>(i);
+          }
+        }
+        featureIds->setValue(index, closest);
+        // Leave a few Cells without a phase; they must not contribute to the orientations
+        phases->setValue(index, (index % 17 == 0) ? 0 : 1);
+
+        QuaternionMathF::Copy(featureQuats[closest], perturbed);
+        perturbed.x += 0.02f * (RandomFloat() - 0.5f);
+        perturbed.y += 0.02f * (RandomFloat() - 0.5f);
+        perturbed.z += 0.02f * (RandomFloat() - 0.5f);
+        QuaternionMathF::UnitQuaternion(perturbed);
+        cubicOps->getQuatSymOp(rand() % numSymOps, symOp);
+        QuaternionMathF::Multiply(perturbed, symOp, cellQuats[index]);
+        if (rand() % 2 == 0) { QuaternionMathF::Negate(cellQuats[index]); }
+        index++;
+      }
+    }
+  }
+
+  cellAttrMat->addAttributeArray(featureIds->getName(), featureIds);
+  cellAttrMat->addAttributeArray(phases->getName(), phases);
+  cellAttrMat->addAttributeArray(quats->getName(), quats);
+  ensembleAttrMat->addAttributeArray(crystalStructures->getName(), crystalStructures);
+
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FloatArrayType::Pointer GetFeatureArray(DataContainerArray::Pointer dca, const QString& name)
+{
+  AttributeMatrix::Pointer featureAttrMat = dca->getDataContainer(DREAM3D::Defaults::VolumeDataContainerName)->getAttributeMatrix(DREAM3D::Defaults::CellFeatureAttributeMatrixName);
+  FloatArrayType::Pointer array = featureAttrMat->getAttributeArrayAs<FloatArrayType>(name);
+  DREAM3D_REQUIRE_VALID_POINTER(array.get())
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RequireRelativeClose(float expected, float value, float tolerance)
+{
+  float diff = fabsf(expected - value);
+  float scale = fabsf(expected) > 1.0f ? fabsf(expected) : 1.0f;
+  DREAM3D_REQUIRE(diff <= tolerance * scale)
+}
+
+// -----------------------------------------------------------------------------
+//  Runs the single pass filter, FindSizes, FindFeatureCentroids, FindShapes (with
+//  the single pass centroids) and FindAvgOrientations on the same volume and
+//  compares the results.
+// -----------------------------------------------------------------------------
+void TestSinglePassMatchesIndividualFilters()
+{
+  DataContainerArray::Pointer dca = CreateTestVolume(SinglePassTest::XPoints, SinglePassTest::YPoints, SinglePassTest::ZPoints);
+
+  FindFeatureStatisticsSinglePass::Pointer singlePass = FindFeatureStatisticsSinglePass::New();
+  singlePass->setDataContainerArray(dca);
+  singlePass->setComputeSizes(true);
+  singlePass->setComputeCentroids(true);
+  singlePass->setComputeShapes(true);
+  singlePass->setComputeAvgOrientations(true);
+  singlePass->execute();
+  DREAM3D_REQUIRE_EQUAL(singlePass->getErrorCondition(), 0)
+
+  FindSizes::Pointer findSizes = FindSizes::New();
+  findSizes->setDataContainerArray(dca);
+  findSizes->setVolumesArrayName("SerialVolumes");
+  findSizes->setEquivalentDiametersArrayName("SerialEquivalentDiameters");
+  findSizes->setNumCellsArrayName("SerialNumCells");
+  findSizes->execute();
+  DREAM3D_REQUIRE_EQUAL(findSizes->getErrorCondition(), 0)
+
+  FindFeatureCentroids::Pointer findCentroids = FindFeatureCentroids::New();
+  findCentroids->setDataContainerArray(dca);
+  findCentroids->setCentroidsArrayName("SerialCentroids");
+  findCentroids->execute();
+  DREAM3D_REQUIRE_EQUAL(findCentroids->getErrorCondition(), 0)
+
+  FindShapes::Pointer findShapes = FindShapes::New();
+  findShapes->setDataContainerArray(dca);
+  findShapes->setOmega3sArrayName("ShapesOmega3s");
+  findShapes->setVolumesArrayName("ShapesVolumes");
+  findShapes->setAxisLengthsArrayName("ShapesAxisLengths");
+  findShapes->setAxisEulerAnglesArrayName("ShapesAxisEulerAngles");
+  findShapes->setAspectRatiosArrayName("ShapesAspectRatios");
+  findShapes->execute();
+  DREAM3D_REQUIRE_EQUAL(findShapes->getErrorCondition(), 0)
+
+  FindAvgOrientations::Pointer findAvgOrientations = FindAvgOrientations::New();
+  findAvgOrientations->setDataContainerArray(dca);
+  findAvgOrientations->setAvgQuatsArrayPath(DataArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, "SerialAvgQuats"));
+  findAvgOrientations->setAvgEulerAnglesArrayPath(DataArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellFeatureAttributeMatrixName, "SerialAvgEulerAngles"));
+  findAvgOrientations->execute();
+  DREAM3D_REQUIRE_EQUAL(findAvgOrientations->getErrorCondition(), 0)
+
+  FloatArrayType::Pointer volumes = GetFeatureArray(dca, DREAM3D::FeatureData::Volumes);
+  FloatArrayType::Pointer serialVolumes = GetFeatureArray(dca, "SerialVolumes");
+  FloatArrayType::Pointer eqDiameters = GetFeatureArray(dca, DREAM3D::FeatureData::EquivalentDiameters);
+  FloatArrayType::Pointer serialEqDiameters = GetFeatureArray(dca, "SerialEquivalentDiameters");
+  FloatArrayType::Pointer centroids = GetFeatureArray(dca, DREAM3D::FeatureData::Centroids);
+  FloatArrayType::Pointer serialCentroids = GetFeatureArray(dca, "SerialCentroids");
+  FloatArrayType::Pointer shapesVolumes = GetFeatureArray(dca, "ShapesVolumes");
+  FloatArrayType::Pointer omega3s = GetFeatureArray(dca, DREAM3D::FeatureData::Omega3s);
+  FloatArrayType::Pointer shapesOmega3s = GetFeatureArray(dca, "ShapesOmega3s");
+  FloatArrayType::Pointer axisLengths = GetFeatureArray(dca, DREAM3D::FeatureData::AxisLengths);
+  FloatArrayType::Pointer shapesAxisLengths = GetFeatureArray(dca, "ShapesAxisLengths");
+  FloatArrayType::Pointer aspectRatios = GetFeatureArray(dca, DREAM3D::FeatureData::AspectRatios);
+  FloatArrayType::Pointer shapesAspectRatios = GetFeatureArray(dca, "ShapesAspectRatios");
+  FloatArrayType::Pointer avgQuats = GetFeatureArray(dca, DREAM3D::FeatureData::AvgQuats);
+  FloatArrayType::Pointer serialAvgQuats = GetFeatureArray(dca, "SerialAvgQuats");
+
+  AttributeMatrix::Pointer featureAttrMat = dca->getDataContainer(DREAM3D::Defaults::VolumeDataContainerName)->getAttributeMatrix(DREAM3D::Defaults::CellFeatureAttributeMatrixName);
+  Int32ArrayType::Pointer numCells = featureAttrMat->getAttributeArrayAs<Int32ArrayType>(DREAM3D::FeatureData::NumCells);
+  Int32ArrayType::Pointer serialNumCells = featureAttrMat->getAttributeArrayAs<Int32ArrayType>("SerialNumCells");
+  DREAM3D_REQUIRE_VALID_POINTER(numCells.get())
+  DREAM3D_REQUIRE_VALID_POINTER(serialNumCells.get())
+
+  size_t numFeatures = volumes->getNumberOfTuples();
+  DREAM3D_REQUIRE_EQUAL(numFeatures, SinglePassTest::NumSeeds + 1)
+  for (size_t i = 1; i < numFeatures; i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(numCells->getValue(i), serialNumCells->getValue(i))
+    RequireRelativeClose(serialVolumes->getValue(i), volumes->getValue(i), 1.0e-4f);
+    RequireRelativeClose(serialEqDiameters->getValue(i), eqDiameters->getValue(i), 1.0e-4f);
+    for (int c = 0; c < 3; c++)
+    {
+      RequireRelativeClose(serialCentroids->getComponent(i, c), centroids->getComponent(i, c), 1.0e-4f);
+    }
+    RequireRelativeClose(shapesVolumes->getValue(i), volumes->getValue(i), 1.0e-4f);
+    RequireRelativeClose(shapesOmega3s->getValue(i), omega3s->getValue(i), 1.0e-3f);
+    for (int c = 0; c < 3; c++)
+    {
+      RequireRelativeClose(shapesAxisLengths->getComponent(i, c), axisLengths->getComponent(i, c), 1.0e-3f);
+    }
+    for (int c = 0; c < 2; c++)
+    {
+      RequireRelativeClose(shapesAspectRatios->getComponent(i, c), aspectRatios->getComponent(i, c), 1.0e-3f);
+    }
+
+    // q and -q are the same orientation
+    float dot = 0.0f;
+    for (int c = 0; c < 4; c++)
+    {
+      dot += avgQuats->getComponent(i, c) * serialAvgQuats->getComponent(i, c);
+    }
+    DREAM3D_REQUIRE(fabsf(dot) > 0.99999f)
+  }
+}
+
+// -----------------------------------------------------------------------------
+//  The shape calculation needs a 3D volume and preflight has to report that.
+// -----------------------------------------------------------------------------
+void TestShapesRequire3DInPreflight()
+{
+  DataContainerArray::Pointer dca = CreateTestVolume(SinglePassTest::XPoints, SinglePassTest::YPoints, 1);
+
+  FindFeatureStatisticsSinglePass::Pointer singlePass = FindFeatureStatisticsSinglePass::New();
+  singlePass->setDataContainerArray(dca);
+  singlePass->setComputeShapes(true);
+  singlePass->preflight();
+  DREAM3D_REQUIRE_EQUAL(singlePass->getErrorCondition(), -11001)
+
+  singlePass->setComputeShapes(false);
+  singlePass->preflight();
+  DREAM3D_REQUIRE_EQUAL(singlePass->getErrorCondition(), 0)
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  // Instantiate the QCoreApplication that we need to get the current path and load plugins.
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("FindFeatureStatisticsSinglePassTest");
+
+  int err = EXIT_SUCCESS;
+
+  DREAM3D_REGISTER_TEST( TestSinglePassMatchesIndividualFilters() )
+  DREAM3D_REGISTER_TEST( TestShapesRequire3DInPreflight() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
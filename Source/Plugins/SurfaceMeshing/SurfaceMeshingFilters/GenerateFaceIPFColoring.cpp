@@ -35,6 +35,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "GenerateFaceIPFColoring.h"
 
+#include <vector>
+
 #ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
@@ -72,6 +74,8 @@ class CalculateFaceIPFColorsImpl
     uint8_t* m_Colors;
     unsigned int* m_CrystalStructures;
 
+    static const size_t k_BlockSize = 4096;
+
   public:
     CalculateFaceIPFColorsImpl(int32_t* labels, int32_t* phases, double* normals, float* eulers, uint8_t* colors, unsigned int* crystalStructures) :
       m_Labels(labels),
@@ -90,90 +94,85 @@ class CalculateFaceIPFColorsImpl
      */
     void generate(size_t start, size_t end) const
     {
+      QVector<OrientationOps::Pointer> ops = OrientationOps::getOrientationOpsQVector();
 
-      // Create 1 of every type of Ops class. This condenses the code below
-      QVector<OrientationOps::Pointer> ops;
-      ops.push_back(HexagonalOps::New());
-      ops.push_back(CubicOps::New());
-      ops.push_back(HexagonalLowOps::New());
-      ops.push_back(CubicLowOps::New());
-      ops.push_back(TriclinicOps::New());
-      ops.push_back(MonoclinicOps::New());
-      ops.push_back(OrthoRhombicOps::New());
-      ops.push_back(TetragonalLowOps::New());
-      ops.push_back(TetragonalOps::New());
-      ops.push_back(TrigonalLowOps::New());
-      ops.push_back(TrigonalOps::New());
-
-      double refDir[3] = {0.0, 0.0, 0.0};
-      double dEuler[3] = {0.0, 0.0, 0.0};
-      DREAM3D::Rgb argb = 0x00000000;
+      // The faces are colored a block at a time. Each side of each face is sorted by the Laue class of its feature so
+      // that every class colors its sides in one batch from contiguous Euler Angles and Reference Directions.
+      std::vector<std::vector<size_t> > targets(ops.size());
+      std::vector<std::vector<float> > eulers(ops.size());
+      std::vector<std::vector<float> > refDirs(ops.size());
+      std::vector<uint8_t> colors;
 
       int feature1, feature2, phase1, phase2;
-      for (size_t i = start; i < end; i++)
+      for (size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
       {
-        feature1 = m_Labels[2 * i];
-        feature2 = m_Labels[2 * i + 1];
-        if(feature1 > 0) { phase1 = m_Phases[feature1]; }
-        else { phase1 = 0; }
+        size_t blockEnd = blockStart + k_BlockSize;
+        if (blockEnd > end) { blockEnd = end; }
+        for (size_t i = blockStart; i < blockEnd; i++)
+        {
+          feature1 = m_Labels[2 * i];
+          feature2 = m_Labels[2 * i + 1];
+          if(feature1 > 0) { phase1 = m_Phases[feature1]; }
+          else { phase1 = 0; }
 
-        if(feature2 > 0) { phase2 = m_Phases[feature2]; }
-        else { phase2 = 0; }
+          if(feature2 > 0) { phase2 = m_Phases[feature2]; }
+          else { phase2 = 0; }
 
-        if(phase1 > 0 )
-        {
-          // Make sure we are using a valid Euler Angles with valid crystal symmetry
-          if( m_CrystalStructures[phase1] < Ebsd::CrystalStructure::LaueGroupEnd )
-          {
-            dEuler[0] = m_Eulers[3 * feature1 + 0];
-            dEuler[1] = m_Eulers[3 * feature1 + 1];
-            dEuler[2] = m_Eulers[3 * feature1 + 2];
-            refDir[0] = m_Normals[3 * i + 0];
-            refDir[1] = m_Normals[3 * i + 1];
-            refDir[2] = m_Normals[3 * i + 2];
-
-            argb = ops[m_CrystalStructures[phase1]]->generateIPFColor(dEuler, refDir, false);
-            m_Colors[6 * i] = RgbColor::dRed(argb);
-            m_Colors[6 * i + 1] = RgbColor::dGreen(argb);
-            m_Colors[6 * i + 2] = RgbColor::dBlue(argb);
-          }
-        }
-        else // Phase 1 was Zero so assign a black color
-        {
           m_Colors[6 * i + 0] = 0;
           m_Colors[6 * i + 1] = 0;
           m_Colors[6 * i + 2] = 0;
-        }
-
+          m_Colors[6 * i + 3] = 0;
+          m_Colors[6 * i + 4] = 0;
+          m_Colors[6 * i + 5] = 0;
 
-        // Now compute for Phase 2
-        if(phase2 > 0)
-        {
           // Make sure we are using a valid Euler Angles with valid crystal symmetry
-          if( m_CrystalStructures[phase1] < Ebsd::CrystalStructure::LaueGroupEnd )
+          if(phase1 > 0 && m_CrystalStructures[phase1] < Ebsd::CrystalStructure::LaueGroupEnd)
+          {
+            addSide(targets, eulers, refDirs, m_CrystalStructures[phase1], 6 * i, feature1, i, 1.0f);
+          }
+          // Now compute for Phase 2, which looks at the face from the other side
+          if(phase2 > 0 && m_CrystalStructures[phase2] < Ebsd::CrystalStructure::LaueGroupEnd)
           {
-            dEuler[0] = m_Eulers[3 * feature2 + 0];
-            dEuler[1] = m_Eulers[3 * feature2 + 1];
-            dEuler[2] = m_Eulers[3 * feature2 + 2];
-            refDir[0] = -m_Normals[3 * i + 0];
-            refDir[1] = -m_Normals[3 * i + 1];
-            refDir[2] = -m_Normals[3 * i + 2];
-
-            argb = ops[m_CrystalStructures[phase1]]->generateIPFColor(dEuler, refDir, false);
-            m_Colors[6 * i + 3] = RgbColor::dRed(argb);
-            m_Colors[6 * i + 4] = RgbColor::dGreen(argb);
-            m_Colors[6 * i + 5] = RgbColor::dBlue(argb);
+            addSide(targets, eulers, refDirs, m_CrystalStructures[phase2], 6 * i + 3, feature2, i, -1.0f);
           }
         }
-        else
+
+        for (size_t xtal = 0; xtal < targets.size(); xtal++)
         {
-          m_Colors[6 * i + 3] = 0;
-          m_Colors[6 * i + 4] = 0;
-          m_Colors[6 * i + 5] = 0;
+          size_t count = targets[xtal].size();
+          if (count == 0) { continue; }
+          colors.resize(count * 3);
+          ops[xtal]->generateIPFColors(&(eulers[xtal].front()), &(refDirs[xtal].front()), 3, count, &(colors.front()));
+          for (size_t v = 0; v < count; v++)
+          {
+            m_Colors[targets[xtal][v]] = colors[v * 3];
+            m_Colors[targets[xtal][v] + 1] = colors[v * 3 + 1];
+            m_Colors[targets[xtal][v] + 2] = colors[v * 3 + 2];
+          }
+          targets[xtal].clear();
+          eulers[xtal].clear();
+          refDirs[xtal].clear();
         }
       }
     }
 
+    /**
+     * @brief addSide Queues one side of a face to be colored with the orientation of the feature on that side
+     * @param target The index of the first of the 3 color values of the side
+     * @param sign 1 if the face normal points away from the feature, -1 if it points into the feature
+     */
+    void addSide(std::vector<std::vector<size_t> >& targets, std::vector<std::vector<float> >& eulers, std::vector<std::vector<float> >& refDirs,
+                 unsigned int xtal, size_t target, int feature, size_t face, float sign) const
+    {
+      targets[xtal].push_back(target);
+      eulers[xtal].push_back(m_Eulers[3 * feature + 0]);
+      eulers[xtal].push_back(m_Eulers[3 * feature + 1]);
+      eulers[xtal].push_back(m_Eulers[3 * feature + 2]);
+      refDirs[xtal].push_back(sign * m_Normals[3 * face + 0]);
+      refDirs[xtal].push_back(sign * m_Normals[3 * face + 1]);
+      refDirs[xtal].push_back(sign * m_Normals[3 * face + 2]);
+    }
+
 #ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
     /**
      * @brief operator () This is called from the TBB stye of code
@@ -35,6 +35,8 @@
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include "GenerateFaceSchuhMisorientationColoring.h"
 
+#include <vector>
+
 #ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
@@ -70,6 +72,8 @@ class CalculateFaceSchuhMisorientationColorsImpl
     unsigned int* m_CrystalStructures;
     QVector<OrientationOps::Pointer> m_OrientationOps;
 
+    static const size_t k_BlockSize = 4096;
+
   public:
     CalculateFaceSchuhMisorientationColorsImpl(int32_t* labels, int32_t* phases, float* quats, uint8_t* colors, unsigned int* crystalStructures) :
       m_Labels(labels),
@@ -90,41 +94,54 @@ class CalculateFaceSchuhMisorientationColorsImpl
     void generate(size_t start, size_t end) const
     {
       QVector<OrientationOps::Pointer> ops = OrientationOps::getOrientationOpsQVector();
-      DREAM3D::Rgb argb = 0x00000000;
+
+      // The faces are colored a block at a time so the cubic faces of each block are colored in one batch
+      std::vector<size_t> faces;
+      std::vector<QuatF> q1s;
+      std::vector<QuatF> q2s;
+      std::vector<uint8_t> colors;
 
       int grain1, grain2, phase1, phase2;
-      QuatF q1;
-      QuatF q2;
       QuatF* quats = reinterpret_cast<QuatF*>(m_Quats);
 
-      for (size_t i = start; i < end; i++)
+      for (size_t blockStart = start; blockStart < end; blockStart += k_BlockSize)
       {
-        grain1 = m_Labels[2 * i];
-        grain2 = m_Labels[2 * i + 1];
-        if(grain1 > 0) { phase1 = m_Phases[grain1]; }
-        else { phase1 = 0; }
-        if(grain2 > 0) { phase2 = m_Phases[grain2]; }
-        else { phase2 = 0; }
-
-        m_Colors[3 * i + 0] = 0;
-        m_Colors[3 * i + 1] = 0;
-        m_Colors[3 * i + 2] = 0;
-
-        if(phase1 > 0)
+        size_t blockEnd = blockStart + k_BlockSize;
+        if (blockEnd > end) { blockEnd = end; }
+        for (size_t i = blockStart; i < blockEnd; i++)
         {
-          if(phase1 == phase2)
+          grain1 = m_Labels[2 * i];
+          grain2 = m_Labels[2 * i + 1];
+          if(grain1 > 0) { phase1 = m_Phases[grain1]; }
+          else { phase1 = 0; }
+          if(grain2 > 0) { phase2 = m_Phases[grain2]; }
+          else { phase2 = 0; }
+
+          m_Colors[3 * i + 0] = 0;
+          m_Colors[3 * i + 1] = 0;
+          m_Colors[3 * i + 2] = 0;
+
+          if(phase1 > 0 && phase1 == phase2 && m_CrystalStructures[phase1] == Ebsd::CrystalStructure::Cubic_High)
           {
-            if(m_CrystalStructures[phase1] == Ebsd::CrystalStructure::Cubic_High)
-            {
-              QuaternionMathF::Copy(quats[grain1], q1);
-              QuaternionMathF::Copy(quats[grain2], q2);
-              argb = ops[m_CrystalStructures[phase1]]->generateMisorientationColor(q1, q2);
-              m_Colors[3 * i] = RgbColor::dRed(argb);
-              m_Colors[3 * i + 1] = RgbColor::dGreen(argb);
-              m_Colors[3 * i + 2] = RgbColor::dBlue(argb);
-            }
+            faces.push_back(i);
+            q1s.push_back(quats[grain1]);
+            q2s.push_back(quats[grain2]);
           }
         }
+
+        size_t count = faces.size();
+        if (count == 0) { continue; }
+        colors.resize(count * 3);
+        ops[Ebsd::CrystalStructure::Cubic_High]->generateMisorientationColors(&(q1s.front()), &(q2s.front()), 1, count, &(colors.front()));
+        for (size_t v = 0; v < count; v++)
+        {
+          m_Colors[3 * faces[v]] = colors[v * 3];
+          m_Colors[3 * faces[v] + 1] = colors[v * 3 + 1];
+          m_Colors[3 * faces[v] + 2] = colors[v * 3 + 2];
+        }
+        faces.clear();
+        q1s.clear();
+        q2s.clear();
       }
     }
 
@@ -116,8 +116,8 @@ class QuickSurfaceMesh : public AbstractFilter
     QuickSurfaceMesh();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FaceLabels)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int8_t, NodeTypes)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FacePhases)
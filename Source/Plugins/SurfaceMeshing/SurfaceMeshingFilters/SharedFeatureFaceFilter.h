@@ -141,7 +141,7 @@ class SharedFeatureFaceFilter : public SurfaceMeshFilter
     void dataCheck();
 
   private:
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFaceLabels)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, SurfaceMeshFeatureFaceIds)
 
     SharedFeatureFaceFilter(const SharedFeatureFaceFilter&); // Copy Constructor Not Implemented
@@ -135,6 +135,25 @@ float CubeOctohedronOps::radcur1(QMap<ArgName, float> args)
 //
 // -----------------------------------------------------------------------------
 float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3comp)
+{
+  return InsideShape(axis1comp, axis2comp, axis3comp, Gvalue);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CubeOctohedronOps::insideRow(const float* axis1comp, const float* axis2comp, const float* axis3comp, float* inside, size_t count, float shapeParameter)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    inside[i] = InsideShape(axis1comp[i], axis2comp[i], axis3comp[i], shapeParameter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float CubeOctohedronOps::InsideShape(float axis1comp, float axis2comp, float axis3comp, float gvalue)
 {
   float inside = 0;
   inside = 1 - fabs(axis1comp);
@@ -151,29 +170,29 @@ float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3com
   axis3comp = static_cast<float>( axis3comp + 1.0 );
 
   //Above -1,-1,1 plane check
-  float plane1comp = ((-axis1comp) + (-axis2comp) + (axis3comp) - ((-0.5f * Gvalue) + (-0.5f * Gvalue) + 2.0f));
-  plane1comp = plane1comp / ((-1) + (-1) + (1) - ((-0.5f * Gvalue) + (-0.5f * Gvalue) + 2.0f));
+  float plane1comp = ((-axis1comp) + (-axis2comp) + (axis3comp) - ((-0.5f * gvalue) + (-0.5f * gvalue) + 2.0f));
+  plane1comp = plane1comp / ((-1) + (-1) + (1) - ((-0.5f * gvalue) + (-0.5f * gvalue) + 2.0f));
 
-  float plane2comp = ((axis1comp) + (-axis2comp) + (axis3comp) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue) + 2.0f));
-  plane2comp = plane2comp / ((1) + (-1) + (1) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue) + 2.0f));
+  float plane2comp = ((axis1comp) + (-axis2comp) + (axis3comp) - ((2.0f - (0.5f * gvalue)) + (-0.5f * gvalue) + 2.0f));
+  plane2comp = plane2comp / ((1) + (-1) + (1) - ((2.0f - (0.5f * gvalue)) + (-0.5f * gvalue) + 2.0f));
 
-  float plane3comp = ((axis1comp) + (axis2comp) + (axis3comp) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5f * Gvalue)) + 2.0f));
-  plane3comp = plane3comp / ((1) + (1) + (1) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5f * Gvalue)) + 2.0f));
+  float plane3comp = ((axis1comp) + (axis2comp) + (axis3comp) - ((2.0f - (0.5f * gvalue)) + (2.0f - (0.5f * gvalue)) + 2.0f));
+  plane3comp = plane3comp / ((1) + (1) + (1) - ((2.0f - (0.5f * gvalue)) + (2.0f - (0.5f * gvalue)) + 2.0f));
 
-  float plane4comp = static_cast<float>( ((-axis1comp) + (axis2comp) + (axis3comp) - ((-0.5f * Gvalue) + (2.0f - (0.5 * Gvalue)) + 2.0f)) );
-  plane4comp = plane4comp / ((-1) + (1) + (1) - ((-0.5f * Gvalue) + (2.0f - (0.5f * Gvalue)) + 2.0f));
+  float plane4comp = static_cast<float>( ((-axis1comp) + (axis2comp) + (axis3comp) - ((-0.5f * gvalue) + (2.0f - (0.5 * gvalue)) + 2.0f)) );
+  plane4comp = plane4comp / ((-1) + (1) + (1) - ((-0.5f * gvalue) + (2.0f - (0.5f * gvalue)) + 2.0f));
 
-  float plane5comp = ((-axis1comp) + (-axis2comp) + (-axis3comp) - ((-0.5f * Gvalue) + (-0.5f * Gvalue)));
-  plane5comp = plane5comp / ((-1) + (-1) + (-1) - ((-0.5f * Gvalue) + (-0.5f * Gvalue)));
+  float plane5comp = ((-axis1comp) + (-axis2comp) + (-axis3comp) - ((-0.5f * gvalue) + (-0.5f * gvalue)));
+  plane5comp = plane5comp / ((-1) + (-1) + (-1) - ((-0.5f * gvalue) + (-0.5f * gvalue)));
 
-  float plane6comp = ((axis1comp) + (-axis2comp) + (-axis3comp) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue)));
-  plane6comp = plane6comp / ((1) + (-1) + (-1) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue)));
+  float plane6comp = ((axis1comp) + (-axis2comp) + (-axis3comp) - ((2.0f - (0.5f * gvalue)) + (-0.5f * gvalue)));
+  plane6comp = plane6comp / ((1) + (-1) + (-1) - ((2.0f - (0.5f * gvalue)) + (-0.5f * gvalue)));
 
-  float plane7comp = ((axis1comp) + (axis2comp) + (-axis3comp) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5f * Gvalue))));
-  plane7comp = static_cast<float>( plane7comp / ((1) + (1) + (-1) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5 * Gvalue)))) );
+  float plane7comp = ((axis1comp) + (axis2comp) + (-axis3comp) - ((2.0f - (0.5f * gvalue)) + (2.0f - (0.5f * gvalue))));
+  plane7comp = static_cast<float>( plane7comp / ((1) + (1) + (-1) - ((2.0f - (0.5f * gvalue)) + (2.0f - (0.5 * gvalue)))) );
 
-  float plane8comp = ((-axis1comp) + (axis2comp) + (-axis3comp) - ((-0.5f * Gvalue) + (2.0f - (0.5f * Gvalue))));
-  plane8comp = plane8comp / ((-1) + (1) + (-1) - ((-0.5f * Gvalue) + (2 - (0.5f * Gvalue))));
+  float plane8comp = ((-axis1comp) + (axis2comp) + (-axis3comp) - ((-0.5f * gvalue) + (2.0f - (0.5f * gvalue))));
+  plane8comp = plane8comp / ((-1) + (1) + (-1) - ((-0.5f * gvalue) + (2 - (0.5f * gvalue))));
 
   if(plane1comp < inside)
   {
@@ -57,6 +57,8 @@ class CubeOctohedronOps : public ShapeOps
     virtual float radcur1(QMap<ArgName, float> args);
 
     virtual float inside(float axis1comp, float axis2comp, float axis3comp);
+    virtual float getShapeParameter() { return Gvalue; }
+    virtual void insideRow(const float* axis1comp, const float* axis2comp, const float* axis3comp, float* inside, size_t count, float shapeParameter);
     virtual void init() { Gvalue = 0.0f; }
 
   protected:
@@ -64,6 +66,8 @@ class CubeOctohedronOps : public ShapeOps
   private:
     float Gvalue;
 
+    static float InsideShape(float axis1comp, float axis2comp, float axis3comp, float gvalue);
+
     CubeOctohedronOps(const CubeOctohedronOps&); // Copy Constructor Not Implemented
     void operator=(const CubeOctohedronOps&); // Operator '=' Not Implemented
 };
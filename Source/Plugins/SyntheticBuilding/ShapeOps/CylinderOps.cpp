@@ -86,3 +86,15 @@ float CylinderOps::inside(float axis1comp, float axis2comp, float axis3comp)
   }
   return inside;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderOps::insideRow(const float* axis1comp, const float* axis2comp, const float* axis3comp, float* inside, size_t count, float shapeParameter)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    float value = 1.0f - (axis2comp[i] * axis2comp[i]) - (axis3comp[i] * axis3comp[i]);
+    inside[i] = (fabs(axis1comp[i]) <= 1.0f) ? value : -1.0f;
+  }
+}
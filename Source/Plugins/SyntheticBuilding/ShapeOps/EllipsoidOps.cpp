@@ -90,3 +90,14 @@ float EllipsoidOps::inside(float axis1comp, float axis2comp, float axis3comp)
   inside = 1.0f - axis1comp - axis2comp - axis3comp;
   return inside;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EllipsoidOps::insideRow(const float* axis1comp, const float* axis2comp, const float* axis3comp, float* inside, size_t count, float shapeParameter)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    inside[i] = 1.0f - (axis1comp[i] * axis1comp[i]) - (axis2comp[i] * axis2comp[i]) - (axis3comp[i] * axis3comp[i]);
+  }
+}
@@ -54,6 +54,7 @@ class EllipsoidOps : public ShapeOps
 
     virtual float radcur1(QMap<ArgName, float> args);
     virtual float inside(float axis1comp, float axis2comp, float axis3comp);
+    virtual void insideRow(const float* axis1comp, const float* axis2comp, const float* axis3comp, float* inside, size_t count, float shapeParameter);
     virtual void init() {  }
 
   protected:
@@ -0,0 +1,165 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FeatureRasterizer.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FeatureRasterizer::FeatureRasterizer(size_t dims[3], float res[3])
+{
+  for (int a = 0; a < 3; a++)
+  {
+    m_Dims[a] = static_cast<int64_t>(dims[a]);
+    m_Res[a] = res[a];
+    m_NumTiles[a] = static_cast<size_t>((m_Dims[a] + k_TileSize - 1) / k_TileSize);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FeatureRasterizer::~FeatureRasterizer()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FeatureRasterizer::addFeature(int64_t feature, const float center[3], const float radCur[3], float ga[3][3],
+                                   const int64_t bboxMin[3], const int64_t bboxMax[3], ShapeOps* shapeOps, float shapeParameter)
+{
+  Feature_t f;
+  f.feature = feature;
+  for (int i = 0; i < 3; i++)
+  {
+    f.center[i] = center[i];
+    f.invRadCur[i] = 1.0f / radCur[i];
+    f.bboxMin[i] = bboxMin[i];
+    f.bboxMax[i] = bboxMax[i];
+    for (int j = 0; j < 3; j++)
+    {
+      f.gaT[i][j] = ga[j][i];
+    }
+  }
+  f.shapeOps = shapeOps;
+  f.shapeParameter = shapeParameter;
+  m_Features.push_back(f);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t FeatureRasterizer::getNumberOfTiles() const
+{
+  return m_NumTiles[0] * m_NumTiles[1] * m_NumTiles[2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FeatureRasterizer::tilesTouched(int axis, int64_t bboxMin, int64_t bboxMax, std::vector<size_t>& tiles) const
+{
+  tiles.clear();
+  if (bboxMax < bboxMin) { return; }
+  int64_t dim = m_Dims[axis];
+  size_t numTiles = m_NumTiles[axis];
+  if (bboxMax - bboxMin + 1 >= dim)
+  {
+    for (size_t t = 0; t < numTiles; t++) { tiles.push_back(t); }
+    return;
+  }
+  int64_t lo = ((bboxMin % dim) + dim) % dim;
+  int64_t hi = ((bboxMax % dim) + dim) % dim;
+  size_t loTile = static_cast<size_t>(lo / k_TileSize);
+  size_t hiTile = static_cast<size_t>(hi / k_TileSize);
+  if (lo <= hi)
+  {
+    for (size_t t = loTile; t <= hiTile; t++) { tiles.push_back(t); }
+  }
+  else if (hiTile >= loTile)
+  {
+    // The wrapped box starts and ends in the same tile
+    for (size_t t = 0; t < numTiles; t++) { tiles.push_back(t); }
+  }
+  else
+  {
+    for (size_t t = 0; t <= hiTile; t++) { tiles.push_back(t); }
+    for (size_t t = loTile; t < numTiles; t++) { tiles.push_back(t); }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FeatureRasterizer::binFeatures()
+{
+  size_t numTiles = getNumberOfTiles();
+  m_TileOffsets.assign(numTiles + 1, 0);
+  std::vector<size_t> tiles[3];
+
+  // First count the features of every tile, then fill the lists in feature order
+  for (int pass = 0; pass < 2; pass++)
+  {
+    std::vector<size_t> fill;
+    if (pass == 1)
+    {
+      for (size_t t = 0; t < numTiles; t++) { m_TileOffsets[t + 1] = m_TileOffsets[t + 1] + m_TileOffsets[t]; }
+      m_TileFeatures.resize(m_TileOffsets[numTiles]);
+      fill.assign(m_TileOffsets.begin(), m_TileOffsets.end() - 1);
+    }
+    for (size_t i = 0; i < m_Features.size(); i++)
+    {
+      const Feature_t& f = m_Features[i];
+      for (int a = 0; a < 3; a++)
+      {
+        tilesTouched(a, f.bboxMin[a], f.bboxMax[a], tiles[a]);
+      }
+      for (size_t z = 0; z < tiles[2].size(); z++)
+      {
+        for (size_t y = 0; y < tiles[1].size(); y++)
+        {
+          for (size_t x = 0; x < tiles[0].size(); x++)
+          {
+            size_t tile = (tiles[2][z] * m_NumTiles[1] + tiles[1][y]) * m_NumTiles[0] + tiles[0][x];
+            if (pass == 0) { m_TileOffsets[tile + 1]++; }
+            else { m_TileFeatures[fill[tile]++] = i; }
+          }
+        }
+      }
+    }
+  }
+}
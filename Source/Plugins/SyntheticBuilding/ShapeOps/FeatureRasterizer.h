@@ -0,0 +1,196 @@
+/* ============================================================================
+ * Copyright (c) 2010, Michael A. Jackson (BlueQuartz Software)
+ * Copyright (c) 2010, Dr. Michael A. Groeber (US Air Force Research Laboratories
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Groeber, Michael A. Jackson, the US Air Force,
+ * BlueQuartz Software nor the names of its contributors may be used to endorse
+ * or promote products derived from this software without specific prior written
+ * permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *  This code was written under United States Air Force Contract number
+ *                           FA8650-07-D-5800
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _FEATURERASTERIZER_H_
+#define _FEATURERASTERIZER_H_
+
+#include <vector>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+
+#include "ShapeOps.h"
+
+/**
+ * @brief The FeatureRasterizer class places shaped features (anything a ShapeOps describes) on a voxel grid.
+ * The grid is cut into cubic tiles and every feature is listed in each tile its bounding box touches. A tile
+ * only writes its own voxels and visits its features in the order they were added, so tiles can be filled
+ * concurrently and still give the same result as placing the features one after another.
+ */
+class FeatureRasterizer
+{
+  public:
+    FeatureRasterizer(size_t dims[3], float res[3]);
+    virtual ~FeatureRasterizer();
+
+    static const int64_t k_TileSize = 32;
+
+    /**
+     * @brief addFeature Adds a feature. The bounding box is given in voxel coordinates and may reach one grid
+     * length past either side of the grid, in which case the voxels wrap around (periodic boundaries).
+     * @param feature Feature Id handed back to the rule
+     * @param center Centroid of the feature
+     * @param radCur Semi axis lengths
+     * @param ga Orientation matrix of the feature axes
+     * @param bboxMin Smallest voxel coordinates covered
+     * @param bboxMax Largest voxel coordinates covered
+     * @param shapeOps Shape function of the feature
+     * @param shapeParameter Shape parameter from shapeOps->getShapeParameter() right after its radcur1 call
+     */
+    void addFeature(int64_t feature, const float center[3], const float radCur[3], float ga[3][3],
+                    const int64_t bboxMin[3], const int64_t bboxMax[3], ShapeOps* shapeOps, float shapeParameter);
+
+    /**
+     * @brief binFeatures Builds the per tile feature lists. Must be called after the last addFeature.
+     */
+    void binFeatures();
+
+    size_t getNumberOfTiles() const;
+
+    /**
+     * @brief rasterizeTile Evaluates every feature of a tile on the voxels of the tile and calls
+     * rule.assign(feature, voxelIndex, inside) for each voxel with inside >= 0. A voxel covered by more than one
+     * periodic image of the same feature is reported once per image.
+     */
+    template<typename Rule>
+    void rasterizeTile(size_t tile, const Rule& rule) const
+    {
+      int64_t tileStart[3];
+      int64_t tileEnd[3];
+      size_t t = tile;
+      for (int a = 0; a < 3; a++)
+      {
+        tileStart[a] = static_cast<int64_t>(t % m_NumTiles[a]) * k_TileSize;
+        tileEnd[a] = tileStart[a] + k_TileSize;
+        if (tileEnd[a] > m_Dims[a]) { tileEnd[a] = m_Dims[a]; }
+        t = t / m_NumTiles[a];
+      }
+
+      float axis1comp[k_TileSize];
+      float axis2comp[k_TileSize];
+      float axis3comp[k_TileSize];
+      float inside[k_TileSize];
+      int64_t spanStart[3][3];
+      int64_t spanEnd[3][3];
+      int64_t spanShift[3][3];
+      int numSpans[3];
+      int64_t dim0_dim1 = m_Dims[0] * m_Dims[1];
+
+      for (size_t k = m_TileOffsets[tile]; k < m_TileOffsets[tile + 1]; k++)
+      {
+        const Feature_t& f = m_Features[m_TileFeatures[k]];
+        // The parts of the (possibly wrapped) bounding box that land in this tile
+        for (int a = 0; a < 3; a++)
+        {
+          numSpans[a] = 0;
+          for (int64_t image = -1; image <= 1; image++)
+          {
+            int64_t shift = image * m_Dims[a];
+            int64_t start = (f.bboxMin[a] > tileStart[a] + shift) ? f.bboxMin[a] : tileStart[a] + shift;
+            int64_t end = (f.bboxMax[a] < tileEnd[a] - 1 + shift) ? f.bboxMax[a] : tileEnd[a] - 1 + shift;
+            if (start <= end)
+            {
+              spanStart[a][numSpans[a]] = start;
+              spanEnd[a][numSpans[a]] = end;
+              spanShift[a][numSpans[a]] = shift;
+              numSpans[a]++;
+            }
+          }
+        }
+
+        for (int sz = 0; sz < numSpans[2]; sz++)
+        {
+          for (int64_t iter3 = spanStart[2][sz]; iter3 <= spanEnd[2][sz]; iter3++)
+          {
+            int64_t plane = iter3 - spanShift[2][sz];
+            float z = float(iter3) * m_Res[2] - f.center[2];
+            for (int sy = 0; sy < numSpans[1]; sy++)
+            {
+              for (int64_t iter2 = spanStart[1][sy]; iter2 <= spanEnd[1][sy]; iter2++)
+              {
+                int64_t row = iter2 - spanShift[1][sy];
+                float y = float(iter2) * m_Res[1] - f.center[1];
+                for (int sx = 0; sx < numSpans[0]; sx++)
+                {
+                  int64_t xStart = spanStart[0][sx];
+                  size_t count = static_cast<size_t>(spanEnd[0][sx] - xStart + 1);
+                  for (size_t i = 0; i < count; i++)
+                  {
+                    float x = float(xStart + static_cast<int64_t>(i)) * m_Res[0] - f.center[0];
+                    axis1comp[i] = (f.gaT[0][0] * x + f.gaT[0][1] * y + f.gaT[0][2] * z) * f.invRadCur[0];
+                    axis2comp[i] = (f.gaT[1][0] * x + f.gaT[1][1] * y + f.gaT[1][2] * z) * f.invRadCur[1];
+                    axis3comp[i] = (f.gaT[2][0] * x + f.gaT[2][1] * y + f.gaT[2][2] * z) * f.invRadCur[2];
+                  }
+                  f.shapeOps->insideRow(axis1comp, axis2comp, axis3comp, inside, count, f.shapeParameter);
+                  size_t index = static_cast<size_t>((plane * dim0_dim1) + (row * m_Dims[0]) + (xStart - spanShift[0][sx]));
+                  for (size_t i = 0; i < count; i++)
+                  {
+                    if (inside[i] >= 0) { rule.assign(f.feature, index + i, inside[i]); }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+
+  private:
+    typedef struct
+    {
+      int64_t feature;
+      float center[3];
+      float invRadCur[3];
+      float gaT[3][3];
+      int64_t bboxMin[3];
+      int64_t bboxMax[3];
+      ShapeOps* shapeOps;
+      float shapeParameter;
+    } Feature_t;
+
+    int64_t m_Dims[3];
+    float m_Res[3];
+    size_t m_NumTiles[3];
+    std::vector<Feature_t> m_Features;
+    std::vector<size_t> m_TileOffsets;
+    std::vector<size_t> m_TileFeatures;
+
+    void tilesTouched(int axis, int64_t bboxMin, int64_t bboxMax, std::vector<size_t>& tiles) const;
+
+    FeatureRasterizer(const FeatureRasterizer&); // Copy Constructor Not Implemented
+    void operator=(const FeatureRasterizer&); // Operator '=' Not Implemented
+};
+
+#endif /* _FEATURERASTERIZER_H_ */
@@ -74,3 +74,14 @@ float ShapeOps::inside(float axis1comp, float axis2comp, float axis3comp)
   return -1.0;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ShapeOps::insideRow(const float* axis1comp, const float* axis2comp, const float* axis3comp, float* inside, size_t count, float shapeParameter)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    inside[i] = -1.0f;
+  }
+}
+
@@ -68,6 +68,19 @@ class ShapeOps
 
     virtual float inside(float axis1comp, float axis2comp, float axis3comp);
 
+    /**
+     * @brief getShapeParameter Returns the shape parameter picked by the last call to radcur1, or 0 for
+     * shapes that do not have one.
+     */
+    virtual float getShapeParameter() { return 0.0f; }
+
+    /**
+     * @brief insideRow Evaluates the shape function for 'count' points at once. The shape parameter is passed
+     * in rather than taken from the last radcur1 call, so threads working on different features can share one
+     * ShapeOps object.
+     */
+    virtual void insideRow(const float* axis1comp, const float* axis2comp, const float* axis3comp, float* inside, size_t count, float shapeParameter);
+
     virtual void init() {}
 
   protected:
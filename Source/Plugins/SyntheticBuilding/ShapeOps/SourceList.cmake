@@ -15,6 +15,7 @@ set(ShapeOps_HDRS
   ${SyntheticBuilding_SOURCE_DIR}/ShapeOps/CylinderOps.h
   ${SyntheticBuilding_SOURCE_DIR}/ShapeOps/EllipsoidOps.h
   ${SyntheticBuilding_SOURCE_DIR}/ShapeOps/SuperEllipsoidOps.h
+  ${SyntheticBuilding_SOURCE_DIR}/ShapeOps/FeatureRasterizer.h
 )
 set(ShapeOps_SRCS
   ${SyntheticBuilding_SOURCE_DIR}/ShapeOps/ShapeOps.cpp
@@ -22,6 +23,7 @@ set(ShapeOps_SRCS
   ${SyntheticBuilding_SOURCE_DIR}/ShapeOps/CylinderOps.cpp
   ${SyntheticBuilding_SOURCE_DIR}/ShapeOps/EllipsoidOps.cpp
   ${SyntheticBuilding_SOURCE_DIR}/ShapeOps/SuperEllipsoidOps.cpp
+  ${SyntheticBuilding_SOURCE_DIR}/ShapeOps/FeatureRasterizer.cpp
 )
 cmp_IDE_SOURCE_PROPERTIES( "${PLUGIN_NAME}/ShapeOps" "${ShapeOps_HDRS}" "${ShapeOps_SRCS}" "0")
 if( ${PROJECT_INSTALL_HEADERS} EQUAL 1 )
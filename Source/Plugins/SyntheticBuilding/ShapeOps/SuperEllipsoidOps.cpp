@@ -151,3 +151,14 @@ float SuperEllipsoidOps::inside(float axis1comp, float axis2comp, float axis3com
   inside = 1.0f - axis1comp - axis2comp - axis3comp;
   return inside;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SuperEllipsoidOps::insideRow(const float* axis1comp, const float* axis2comp, const float* axis3comp, float* inside, size_t count, float shapeParameter)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    inside[i] = 1.0f - powf(fabs(axis1comp[i]), shapeParameter) - powf(fabs(axis2comp[i]), shapeParameter) - powf(fabs(axis3comp[i]), shapeParameter);
+  }
+}
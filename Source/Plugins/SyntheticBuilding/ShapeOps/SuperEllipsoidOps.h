@@ -55,6 +55,8 @@ class SuperEllipsoidOps : public ShapeOps
     virtual float radcur1(QMap<ArgName, float> args);
 
     virtual float inside(float axis1comp, float axis2comp, float axis3comp);
+    virtual float getShapeParameter() { return Nvalue; }
+    virtual void insideRow(const float* axis1comp, const float* axis2comp, const float* axis3comp, float* inside, size_t count, float shapeParameter);
     virtual void init() { Nvalue = 0.0f; }
 
   protected:
@@ -41,7 +41,7 @@
 
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/Math/DREAM3DMath.h"
-#include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "DREAM3DLib/Utilities/DREAM3DCounterRandom.h"
 
 
 // -----------------------------------------------------------------------------
@@ -54,6 +54,8 @@ AddBadData::AddBadData() :
   m_PoissonVolFraction(0.0f),
   m_BoundaryNoise(false),
   m_BoundaryVolFraction(0.0f),
+  m_UseFixedSeed(false),
+  m_Seed(0),
   m_GBEuclideanDistancesArrayName(DREAM3D::CellData::GBEuclideanDistances),
   m_GBEuclideanDistances(NULL)
 {
@@ -79,6 +81,10 @@ void AddBadData::setupFilterParameters()
   linkedProps << "BoundaryVolFraction";
   parameters.push_back(LinkedBooleanFilterParameter::New("Add Boundary Noise", "BoundaryNoise", getBoundaryNoise(), linkedProps, false));
   parameters.push_back(FilterParameter::New("Volume Fraction of Boundary Noise", "BoundaryVolFraction", FilterParameterWidgetType::DoubleWidget, getBoundaryVolFraction(), false));
+  linkedProps.clear();
+  linkedProps << "Seed";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Use Fixed Random Seed", "UseFixedSeed", getUseFixedSeed(), linkedProps, false));
+  parameters.push_back(FilterParameter::New("Random Seed", "Seed", FilterParameterWidgetType::IntWidget, getSeed(), false, ""));
 
   parameters.push_back(FilterParameter::New("Required Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
   parameters.push_back(FilterParameter::New("GBEuclideanDistances", "GBEuclideanDistancesArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getGBEuclideanDistancesArrayPath(), true, ""));
@@ -93,6 +99,8 @@ void AddBadData::readFilterParameters(AbstractFilterParametersReader* reader, in
   setPoissonVolFraction( reader->readValue("PoissonVolFraction", getPoissonVolFraction()) );
   setBoundaryNoise( reader->readValue("BoundaryNoise", getBoundaryNoise()) );
   setBoundaryVolFraction( reader->readValue("BoundaryVolFraction", getBoundaryVolFraction()) );
+  setUseFixedSeed( reader->readValue("UseFixedSeed", getUseFixedSeed()) );
+  setSeed( reader->readValue("Seed", getSeed()) );
   reader->closeFilterGroup();
 }
 
@@ -107,6 +115,8 @@ int AddBadData::writeFilterParameters(AbstractFilterParametersWriter* writer, in
   DREAM3D_FILTER_WRITE_PARAMETER(PoissonVolFraction)
   DREAM3D_FILTER_WRITE_PARAMETER(BoundaryNoise)
   DREAM3D_FILTER_WRITE_PARAMETER(BoundaryVolFraction)
+  DREAM3D_FILTER_WRITE_PARAMETER(UseFixedSeed)
+  DREAM3D_FILTER_WRITE_PARAMETER(Seed)
   writer->closeFilterGroup();
   return ++index; // we want to return the next index that was just written to
 }
@@ -145,7 +155,6 @@ void AddBadData::execute()
 {
   int err = 0;
   setErrorCondition(err);
-  DREAM3D_RANDOMNG_NEW()
 
   dataCheck();
   if(getErrorCondition() < 0) { return; }
@@ -162,7 +171,9 @@ void AddBadData::execute()
 void  AddBadData::add_noise()
 {
   notifyStatusMessage(getHumanLabel(), "Adding Noise");
-  DREAM3D_RANDOMNG_NEW()
+
+  uint64_t seed = static_cast<uint64_t>(static_cast<uint32_t>(m_Seed));
+  if (m_UseFixedSeed == false) { seed = DREAM3DCounterRandom::GenerateSeed(); }
 
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(getGBEuclideanDistancesArrayPath().getDataContainerName());
 
@@ -173,6 +184,8 @@ void  AddBadData::add_noise()
   int64_t totalPoints = m->getTotalPoints();
   for (size_t i = 0; i < static_cast<size_t>(totalPoints); ++i)
   {
+    // Each Cell has its own stream so a Cell's outcome does not depend on the Cells before it
+    DREAM3DCounterRandom rg(seed, i);
     if(m_BoundaryNoise == true && m_GBEuclideanDistances[i] < 1)
     {
       random = static_cast<float>( rg.genrand_res53() );
@@ -87,6 +87,12 @@ class AddBadData : public AbstractFilter
     DREAM3D_FILTER_PARAMETER(float, BoundaryVolFraction)
     Q_PROPERTY(float BoundaryVolFraction READ getBoundaryVolFraction WRITE setBoundaryVolFraction)
 
+    DREAM3D_FILTER_PARAMETER(bool, UseFixedSeed)
+    Q_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+
+    DREAM3D_FILTER_PARAMETER(int, Seed)
+    Q_PROPERTY(int Seed READ getSeed WRITE setSeed)
+
     virtual void setupFilterParameters();
     virtual int writeFilterParameters(AbstractFilterParametersWriter* writer, int index);
 
@@ -38,14 +38,74 @@
 
 #include <map>
 
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/Math/DREAM3DMath.h"
 #include "OrientationLib/Math/OrientationMath.h"
-#include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "DREAM3DLib/Utilities/DREAM3DCounterRandom.h"
 #include "OrientationLib/OrientationOps/OrientationOps.h"
 #include "DREAM3DLib/Math/MatrixMath.h"
 
+/**
+ * @brief The AddOrientationNoiseImpl class rotates the Euler angles of a range of Cells. Every Cell draws
+ * its rotation from its own substream (the Cell index) of a counter based generator, so the result only
+ * depends on the seed and not on how the Cells are split across threads.
+ */
+class AddOrientationNoiseImpl
+{
+  public:
+    AddOrientationNoiseImpl(float* eulers, float magnitude, uint64_t seed) :
+      m_CellEulerAngles(eulers),
+      m_Magnitude(magnitude),
+      m_Seed(seed)
+    {}
+    virtual ~AddOrientationNoiseImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      float g[3][3];
+      float newg[3][3];
+      float rot[3][3];
+      float w, n1, n2, n3;
+      for (size_t i = start; i < end; i++)
+      {
+        DREAM3DCounterRandom rg(m_Seed, i);
+        float ea1 = m_CellEulerAngles[3 * i + 0];
+        float ea2 = m_CellEulerAngles[3 * i + 1];
+        float ea3 = m_CellEulerAngles[3 * i + 2];
+        OrientationMath::EulertoMat(ea1, ea2, ea3, g);
+        n1 = static_cast<float>( rg.genrand_res53() );
+        n2 = static_cast<float>( rg.genrand_res53() );
+        n3 = static_cast<float>( rg.genrand_res53() );
+        w = static_cast<float>( rg.genrand_res53() );
+        w = 2.0 * (w - 0.5);
+        w = (m_Magnitude * w);
+        OrientationMath::AxisAngletoMat(w, n1, n2, n3, rot);
+        MatrixMath::Multiply3x3with3x3(g, rot, newg);
+        OrientationMath::MattoEuler(newg, ea1, ea2, ea3);
+        m_CellEulerAngles[3 * i + 0] = ea1;
+        m_CellEulerAngles[3 * i + 1] = ea2;
+        m_CellEulerAngles[3 * i + 2] = ea3;
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+  private:
+    float* m_CellEulerAngles;
+    float m_Magnitude;
+    uint64_t m_Seed;
+};
 
 
 // -----------------------------------------------------------------------------
@@ -54,6 +114,8 @@
 AddOrientationNoise::AddOrientationNoise() :
   AbstractFilter(),
   m_Magnitude(1.0f),
+  m_UseFixedSeed(false),
+  m_Seed(0),
   m_CellEulerAnglesArrayPath(DREAM3D::Defaults::VolumeDataContainerName, DREAM3D::Defaults::CellAttributeMatrixName, DREAM3D::CellData::EulerAngles),
   m_CellEulerAnglesArrayName(DREAM3D::CellData::EulerAngles),
   m_CellEulerAngles(NULL)
@@ -74,6 +136,9 @@ void AddOrientationNoise::setupFilterParameters()
 {
   FilterParameterVector parameters;
   parameters.push_back(FilterParameter::New("Magnitude of Orientation Noise", "Magnitude", FilterParameterWidgetType::DoubleWidget, getMagnitude(), false, "Degrees"));
+  QStringList linkedProps("Seed");
+  parameters.push_back(LinkedBooleanFilterParameter::New("Use Fixed Random Seed", "UseFixedSeed", getUseFixedSeed(), linkedProps, false));
+  parameters.push_back(FilterParameter::New("Random Seed", "Seed", FilterParameterWidgetType::IntWidget, getSeed(), false, ""));
   parameters.push_back(FilterParameter::New("Required Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
   parameters.push_back(FilterParameter::New("Cell Euler Angles", "CellEulerAnglesArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getCellEulerAnglesArrayPath(), true, ""));
   setFilterParameters(parameters);
@@ -86,6 +151,8 @@ void AddOrientationNoise::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setCellEulerAnglesArrayPath(reader->readDataArrayPath("CellEulerAnglesArrayPath", getCellEulerAnglesArrayPath() ) );
   setMagnitude( reader->readValue("Magnitude", getMagnitude()) );
+  setUseFixedSeed( reader->readValue("UseFixedSeed", getUseFixedSeed()) );
+  setSeed( reader->readValue("Seed", getSeed()) );
   reader->closeFilterGroup();
 }
 
@@ -97,6 +164,8 @@ int AddOrientationNoise::writeFilterParameters(AbstractFilterParametersWriter* w
   writer->openFilterGroup(this, index);
   DREAM3D_FILTER_WRITE_PARAMETER(CellEulerAnglesArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(Magnitude)
+  DREAM3D_FILTER_WRITE_PARAMETER(UseFixedSeed)
+  DREAM3D_FILTER_WRITE_PARAMETER(Seed)
   writer->closeFilterGroup();
   return ++index; // we want to return the next index that was just written to
 }
@@ -135,7 +204,6 @@ void AddOrientationNoise::execute()
 {
   int err = 0;
   setErrorCondition(err);
-  DREAM3D_RANDOMNG_NEW()
 
   dataCheck();
   if(getErrorCondition() < 0) { return; }
@@ -154,34 +222,27 @@ void AddOrientationNoise::execute()
 void  AddOrientationNoise::add_orientation_noise()
 {
   notifyStatusMessage(getHumanLabel(), "Adding Orientation Noise");
-  DREAM3D_RANDOMNG_NEW()
 
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(getCellEulerAnglesArrayPath().getDataContainerName());
 
-  //float ea1, ea2, ea3;
-  float g[3][3];
-  float newg[3][3];
-  float rot[3][3];
-  float w, n1, n2, n3;
-  int64_t totalPoints = m->getTotalPoints();
-  for (size_t i = 0; i < static_cast<size_t>(totalPoints); ++i)
+  uint64_t seed = static_cast<uint64_t>(static_cast<uint32_t>(m_Seed));
+  if (m_UseFixedSeed == false) { seed = DREAM3DCounterRandom::GenerateSeed(); }
+
+  size_t totalPoints = static_cast<size_t>(m->getTotalPoints());
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints),
+                      AddOrientationNoiseImpl(m_CellEulerAngles, m_Magnitude, seed), tbb::auto_partitioner());
+  }
+  else
+#endif
   {
-    float ea1 = m_CellEulerAngles[3 * i + 0];
-    float ea2 = m_CellEulerAngles[3 * i + 1];
-    float ea3 = m_CellEulerAngles[3 * i + 2];
-    OrientationMath::EulertoMat(ea1, ea2, ea3, g);
-    n1 = static_cast<float>( rg.genrand_res53() );
-    n2 = static_cast<float>( rg.genrand_res53() );
-    n3 = static_cast<float>( rg.genrand_res53() );
-    w = static_cast<float>( rg.genrand_res53() );
-    w = 2.0 * (w - 0.5);
-    w = (m_Magnitude * w);
-    OrientationMath::AxisAngletoMat(w, n1, n2, n3, rot);
-    MatrixMath::Multiply3x3with3x3(g, rot, newg);
-    OrientationMath::MattoEuler(newg, ea1, ea2, ea3);
-    m_CellEulerAngles[3 * i + 0] = ea1;
-    m_CellEulerAngles[3 * i + 1] = ea2;
-    m_CellEulerAngles[3 * i + 2] = ea3;
+    AddOrientationNoiseImpl serial(m_CellEulerAngles, m_Magnitude, seed);
+    serial.convert(0, totalPoints);
   }
 }
 
@@ -70,6 +70,12 @@ class AddOrientationNoise : public AbstractFilter
     DREAM3D_FILTER_PARAMETER(float, Magnitude)
     Q_PROPERTY(float Magnitude READ getMagnitude WRITE setMagnitude)
 
+    DREAM3D_FILTER_PARAMETER(bool, UseFixedSeed)
+    Q_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+
+    DREAM3D_FILTER_PARAMETER(int, Seed)
+    Q_PROPERTY(int Seed READ getSeed WRITE setSeed)
+
     DREAM3D_FILTER_PARAMETER(DataArrayPath, CellEulerAnglesArrayPath)
     Q_PROPERTY(DataArrayPath CellEulerAnglesArrayPath READ getCellEulerAnglesArrayPath WRITE setCellEulerAnglesArrayPath)
 
@@ -144,7 +144,7 @@ class EstablishMatrixPhase : public AbstractFilter
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, CellPhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, NumFeatures)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(uint32_t, PhaseTypes)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(uint32_t, PhaseTypes)
     StatsDataArray::WeakPointer m_StatsDataArray;
 
     void dataCheck();
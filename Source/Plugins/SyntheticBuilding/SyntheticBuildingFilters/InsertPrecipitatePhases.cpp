@@ -37,6 +37,13 @@
 
 #include "InsertPrecipitatePhases.h"
 
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include <QtCore/QFileInfo>
 #include <QtCore/QFile>
 #include <QtCore/QDir>
@@ -50,9 +57,57 @@
 #include "SyntheticBuilding/ShapeOps/CylinderOps.h"
 #include "SyntheticBuilding/ShapeOps/EllipsoidOps.h"
 #include "SyntheticBuilding/ShapeOps/SuperEllipsoidOps.h"
+#include "SyntheticBuilding/ShapeOps/FeatureRasterizer.h"
 #include "DREAM3DLib/StatsData/PrecipitateStatsData.h"
 #include "DREAM3DLib/Math/RadialDistributionFunction.h"
 
+/**
+ * @brief The InsertPrecipitatesImpl class stamps the precipitates of a range of tiles of a FeatureRasterizer into
+ * the Feature Ids. A voxel covered by more than one precipitate is marked -2 and left for the gap filling step.
+ */
+class InsertPrecipitatesImpl
+{
+  public:
+    InsertPrecipitatesImpl(const FeatureRasterizer& rasterizer, int32_t* featureIds, int firstPrecipitateFeature) :
+      m_Rasterizer(rasterizer),
+      m_FeatureIds(featureIds),
+      m_FirstPrecipitateFeature(firstPrecipitateFeature)
+    {}
+    virtual ~InsertPrecipitatesImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      for (size_t tile = start; tile < end; tile++)
+      {
+        m_Rasterizer.rasterizeTile(tile, *this);
+      }
+    }
+
+    void assign(int64_t feature, size_t index, float inside) const
+    {
+      if (m_FeatureIds[index] > m_FirstPrecipitateFeature)
+      {
+        m_FeatureIds[index] = -2;
+      }
+      if (m_FeatureIds[index] < m_FirstPrecipitateFeature && m_FeatureIds[index] != -2)
+      {
+        m_FeatureIds[index] = static_cast<int32_t>(feature);
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const FeatureRasterizer& m_Rasterizer;
+    int32_t* m_FeatureIds;
+    int m_FirstPrecipitateFeature;
+};
+
 
 
 // -----------------------------------------------------------------------------
@@ -245,7 +300,7 @@ void InsertPrecipitatePhases::dataCheck()
   QVector<size_t> dims(1, 1);
   m_PhaseTypesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<unsigned int>, AbstractFilter>(this, getInputPhaseTypesArrayPath(), dims);
   if( NULL != m_PhaseTypesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_PhaseTypes = m_PhaseTypesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_PhaseTypes = m_PhaseTypesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
 
   m_ShapeTypesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<unsigned int>, AbstractFilter>(this, getInputShapeTypesArrayPath(), dims);
   if( NULL != m_ShapeTypesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
@@ -268,7 +323,7 @@ void InsertPrecipitatePhases::dataCheck()
   { m_CellPhases = m_CellPhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   m_BoundaryCellsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int8_t>, AbstractFilter>(this, getBoundaryCellsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_BoundaryCellsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_BoundaryCells = m_BoundaryCellsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_BoundaryCells = m_BoundaryCellsPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
 
 
   //Feature Data
@@ -563,9 +618,12 @@ void  InsertPrecipitatePhases::place_precipitates(Int32ArrayType::Pointer exclus
   }
 
 
-  //This is the set that we are going to keep updated with the points that are not in an exclusion zone
-  std::map<size_t, size_t> availablePoints;
-  std::map<size_t, size_t> availablePointsInv;
+  //This is the set that we are going to keep updated with the points that are not in an exclusion zone.
+  //availablePointsInv packs the available points into its first availablePointsCount entries and
+  //availablePoints holds the position of each point in that packed list, so points are added and
+  //removed in constant time by swapping with the last packed entry
+  std::vector<size_t> availablePoints;
+  std::vector<size_t> availablePointsInv;
 
   // Get a pointer to the Feature Owners that was just initialized in the initialize_packinggrid() method
   int32_t* exclusionZones = exclusionZonesPtr->getPointer(0);
@@ -681,6 +739,8 @@ void  InsertPrecipitatePhases::place_precipitates(Int32ArrayType::Pointer exclus
 
   //determine initial set of available points
   availablePointsCount = 0;
+  availablePoints.assign(m_TotalPoints, 0);
+  availablePointsInv.assign(m_TotalPoints, 0);
   for(size_t i = 0; i < m_TotalPoints; i++)
   {
     if(exclusionZones[i] == 0)
@@ -1295,7 +1355,7 @@ void InsertPrecipitatePhases::update_exclusionZones(int gadd, int gremove, Int32
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void InsertPrecipitatePhases::update_availablepoints(std::map<size_t, size_t>& availablePoints, std::map<size_t, size_t>& availablePointsInv)
+void InsertPrecipitatePhases::update_availablepoints(std::vector<size_t>& availablePoints, std::vector<size_t>& availablePointsInv)
 {
   size_t removeSize = pointsToRemove.size();
   size_t addSize = pointsToAdd.size();
@@ -1769,7 +1829,6 @@ void InsertPrecipitatePhases::assign_voxels()
 
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(m_FeatureIdsArrayPath.getDataContainerName());
 
-  int index;
   size_t udims[3] = {0, 0, 0};
   m->getDimensions(udims);
 #if (CMP_SIZEOF_SIZE_T == 4)
@@ -1789,13 +1848,9 @@ void InsertPrecipitatePhases::assign_voxels()
   float yRes = m->getYRes();
   float zRes = m->getZRes();
 
-//  int oldname;
+  float res[3] = { xRes, yRes, zRes };
   size_t column, row, plane;
-  float inside;
   float xc, yc, zc;
-  float coordsRotated[3];
-  //float dist;
-  float coords[3];
   DimType xmin, xmax, ymin, ymax, zmin, zmax;
   int64_t numFeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
   gsizes.resize(numFeatures);
@@ -1804,6 +1859,9 @@ void InsertPrecipitatePhases::assign_voxels()
   {
     gsizes[i] = 0;
   }
+
+  // The shape and bounding box of every precipitate are collected first; the voxels are then filled tile by tile
+  FeatureRasterizer rasterizer(udims, res);
   for (int64_t i = m_FirstPrecipitateFeature; i < numFeatures; i++)
   {
     float volcur = m_Volumes[i];
@@ -1837,7 +1895,6 @@ void InsertPrecipitatePhases::assign_voxels()
     float PHI = m_AxisEulerAngles[3 * i + 1];
     float phi2 = m_AxisEulerAngles[3 * i + 2];
     float ga[3][3];
-    float gaT[3][3];
     OrientationMath::EulertoMat(phi1, PHI, phi2, ga);
     column = static_cast<size_t>( (xc - (xRes / 2.0f)) / xRes );
     row = static_cast<size_t>( (yc - (yRes / 2.0f)) / yRes );
@@ -1866,57 +1923,28 @@ void InsertPrecipitatePhases::assign_voxels()
       if (zmin < 0) { zmin = 0; }
       if (zmax > dims[2] - 1) { zmax = dims[2] - 1; }
     }
-    for (DimType iter1 = xmin; iter1 < xmax + 1; iter1++)
-    {
-      for (DimType iter2 = ymin; iter2 < ymax + 1; iter2++)
-      {
-        for (DimType iter3 = zmin; iter3 < zmax + 1; iter3++)
-        {
-          column = iter1;
-          row = iter2;
-          plane = iter3;
-          if (iter1 < 0) { column = iter1 + dims[0]; }
-          if (iter1 > dims[0] - 1) { column = iter1 - dims[0]; }
-          if (iter2 < 0) { row = iter2 + dims[1]; }
-          if (iter2 > dims[1] - 1) { row = iter2 - dims[1]; }
-          if (iter3 < 0) { plane = iter3 + dims[2]; }
-          if (iter3 > dims[2] - 1) { plane = iter3 - dims[2]; }
-          index = (plane * dims[0] * dims[1]) + (row * dims[0]) + column;
-          inside = -1;
-          coords[0] = float(column) * xRes;
-          coords[1] = float(row) * yRes;
-          coords[2] = float(plane) * zRes;
-          if (iter1 < 0) { coords[0] = coords[0] - m_SizeX; }
-          if (iter1 > dims[0] - 1) { coords[0] = coords[0] + m_SizeX; }
-          if (iter2 < 0) { coords[1] = coords[1] - m_SizeY; }
-          if (iter2 > dims[1] - 1) { coords[1] = coords[1] + m_SizeY; }
-          if (iter3 < 0) { coords[2] = coords[2] - m_SizeZ; }
-          if (iter3 > dims[2] - 1) { coords[2] = coords[2] + m_SizeZ; }
-          coords[0] = coords[0] - xc;
-          coords[1] = coords[1] - yc;
-          coords[2] = coords[2] - zc;
-          MatrixMath::Transpose3x3(ga, gaT);
-          MatrixMath::Multiply3x3with3x1(gaT, coords, coordsRotated);
-          float axis1comp = coordsRotated[0] / radcur1;
-          float axis2comp = coordsRotated[1] / radcur2;
-          float axis3comp = coordsRotated[2] / radcur3;
-          inside = m_ShapeOps[shapeclass]->inside(axis1comp, axis2comp, axis3comp);
-          if (inside >= 0)
-          {
-            int currentpoint = index;
-            if (m_FeatureIds[currentpoint] > m_FirstPrecipitateFeature)
-            {
-              //oldname = m_FeatureIds[currentpoint];
-              m_FeatureIds[currentpoint] = -2;
-            }
-            if (m_FeatureIds[currentpoint] < m_FirstPrecipitateFeature && m_FeatureIds[currentpoint] != -2)
-            {
-              m_FeatureIds[currentpoint] = static_cast<int32_t>(i);
-            }
-          }
-        }
-      }
-    }
+    float radCur[3] = { radcur1, radcur2, radcur3 };
+    float xx[3] = { xc, yc, zc };
+    int64_t bboxMin[3] = { xmin, ymin, zmin };
+    int64_t bboxMax[3] = { xmax, ymax, zmax };
+    ShapeOps* shapeOps = m_ShapeOps[shapeclass];
+    rasterizer.addFeature(i, xx, radCur, ga, bboxMin, bboxMax, shapeOps, shapeOps->getShapeParameter());
+  }
+
+  rasterizer.binFeatures();
+  size_t numTiles = rasterizer.getNumberOfTiles();
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numTiles), InsertPrecipitatesImpl(rasterizer, m_FeatureIds, m_FirstPrecipitateFeature), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    InsertPrecipitatesImpl serial(rasterizer, m_FeatureIds, m_FirstPrecipitateFeature);
+    serial.convert(0, numTiles);
   }
 
   QVector<bool> activeObjects(numFeatures, false);
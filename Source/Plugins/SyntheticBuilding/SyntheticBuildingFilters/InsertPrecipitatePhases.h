@@ -192,7 +192,7 @@ class InsertPrecipitatePhases : public AbstractFilter
 
     float check_sizedisterror(Precip* precip);
     void update_exclusionZones(int gadd, int gremove, Int32ArrayType::Pointer exlusionZonesPtr);
-    void update_availablepoints(std::map<size_t, size_t>& availablePoints, std::map<size_t, size_t>& availablePointsInv);
+    void update_availablepoints(std::vector<size_t>& availablePoints, std::vector<size_t>& availablePointsInv);
     void determine_currentRDF(size_t featureNum, int add, bool double_count);
     void determine_randomRDF(size_t gnum, int add, bool double_count, int largeNumber);
     std::vector<float> normalizeRDF(std::vector<float> rdf, int num_bins, float stepsize, float rdfmin, size_t numPPTfeatures, float volume);
@@ -239,7 +239,7 @@ class InsertPrecipitatePhases : public AbstractFilter
 
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, CellPhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int8_t, BoundaryCells)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int8_t, BoundaryCells)
 
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, AxisEulerAngles)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, Centroids)
@@ -251,7 +251,7 @@ class InsertPrecipitatePhases : public AbstractFilter
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, NumCells)
     NeighborList<float>::WeakPointer m_ClusteringList;
 
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(uint32_t, PhaseTypes)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(uint32_t, PhaseTypes)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(uint32_t, ShapeTypes)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, NumFeatures)
     StatsDataArray::WeakPointer m_StatsDataArray;
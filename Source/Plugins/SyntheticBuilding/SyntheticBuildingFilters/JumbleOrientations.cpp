@@ -36,14 +36,10 @@
 
 #include "JumbleOrientations.h"
 
-#include <boost/random/mersenne_twister.hpp>
-#include <boost/random/uniform_int.hpp>
-#include <boost/random/variate_generator.hpp>
-
 #include "DREAM3DLib/Math/DREAM3DMath.h"
 #include "OrientationLib/OrientationOps/OrientationOps.h"
 #include "DREAM3DLib/Common/Constants.h"
-#include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "DREAM3DLib/Utilities/DREAM3DCounterRandom.h"
 #include "OrientationLib/Math/OrientationMath.h"
 
 // -----------------------------------------------------------------------------
@@ -63,7 +59,9 @@ JumbleOrientations::JumbleOrientations() :
   m_FeaturePhasesArrayName(DREAM3D::FeatureData::Phases),
   m_FeaturePhases(NULL),
   m_FeatureEulerAngles(NULL),
-  m_AvgQuats(NULL)
+  m_AvgQuats(NULL),
+  m_UseFixedSeed(false),
+  m_Seed(0)
 {
   setupFilterParameters();
 }
@@ -80,6 +78,9 @@ JumbleOrientations::~JumbleOrientations()
 void JumbleOrientations::setupFilterParameters()
 {
   FilterParameterVector parameters;
+  QStringList linkedProps("Seed");
+  parameters.push_back(LinkedBooleanFilterParameter::New("Use Fixed Random Seed", "UseFixedSeed", getUseFixedSeed(), linkedProps, false));
+  parameters.push_back(FilterParameter::New("Random Seed", "Seed", FilterParameterWidgetType::IntWidget, getSeed(), false, ""));
   parameters.push_back(FilterParameter::New("Required Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
   parameters.push_back(FilterParameter::New("FeatureIds", "FeatureIdsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getFeatureIdsArrayPath(), true, ""));
   parameters.push_back(FilterParameter::New("FeatureEulerAngles", "FeatureEulerAnglesArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getFeatureEulerAnglesArrayPath(), true, ""));
@@ -100,6 +101,8 @@ void JumbleOrientations::readFilterParameters(AbstractFilterParametersReader* re
   setFeaturePhasesArrayPath(reader->readDataArrayPath("FeaturePhasesArrayPath", getFeaturePhasesArrayPath() ) );
   setCellEulerAnglesArrayName(reader->readString("CellEulerAnglesArrayName", getCellEulerAnglesArrayName() ) );
   setFeatureIdsArrayPath(reader->readDataArrayPath("FeatureIdsArrayPath", getFeatureIdsArrayPath() ) );
+  setUseFixedSeed( reader->readValue("UseFixedSeed", getUseFixedSeed()) );
+  setSeed( reader->readValue("Seed", getSeed()) );
   reader->closeFilterGroup();
 }
 
@@ -114,6 +117,8 @@ int JumbleOrientations::writeFilterParameters(AbstractFilterParametersWriter* wr
   DREAM3D_FILTER_WRITE_PARAMETER(FeaturePhasesArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(CellEulerAnglesArrayName)
   DREAM3D_FILTER_WRITE_PARAMETER(FeatureIdsArrayPath)
+  DREAM3D_FILTER_WRITE_PARAMETER(UseFixedSeed)
+  DREAM3D_FILTER_WRITE_PARAMETER(Seed)
   writer->closeFilterGroup();
   return ++index; // we want to return the next index that was just written to
 }
@@ -130,7 +135,7 @@ void JumbleOrientations::dataCheck()
   // Cell Data
   m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this, getFeatureIdsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_FeatureIdsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_FeatureIds = m_FeatureIdsPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   dims[0] = 3;
   tempPath.update(getFeatureIdsArrayPath().getDataContainerName(), getFeatureIdsArrayPath().getAttributeMatrixName(), getCellEulerAnglesArrayName() );
   m_CellEulerAnglesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this,  tempPath, 0.0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
@@ -141,7 +146,7 @@ void JumbleOrientations::dataCheck()
   dims[0] = 1;
   m_FeaturePhasesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this,  getFeaturePhasesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_FeaturePhasesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_FeaturePhases = m_FeaturePhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_FeaturePhases = m_FeaturePhasesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   dims[0] = 3;
   m_FeatureEulerAnglesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<float>, AbstractFilter>(this,  getFeatureEulerAnglesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_FeatureEulerAnglesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
@@ -180,18 +185,12 @@ void JumbleOrientations::execute()
   int64_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
   int64_t totalFeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
 
-  // Generate all the numbers up front
+  // Random Feature ids are drawn uniformly from [1, totalFeatures - 1]
   const int rangeMin = 1;
   const int rangeMax = totalFeatures - 1;
-  typedef boost::uniform_int<int> NumberDistribution;
-  typedef boost::mt19937 RandomNumberGenerator;
-  typedef boost::variate_generator < RandomNumberGenerator&,
-          NumberDistribution > Generator;
-
-  NumberDistribution distribution(rangeMin, rangeMax);
-  RandomNumberGenerator generator;
-  Generator numberGenerator(generator, distribution);
-  generator.seed(static_cast<boost::uint32_t>( QDateTime::currentMSecsSinceEpoch() )); // seed with the current time
+  uint64_t seed = static_cast<uint64_t>(static_cast<uint32_t>(m_Seed));
+  if (m_UseFixedSeed == false) { seed = DREAM3DCounterRandom::GenerateSeed(); }
+  DREAM3DCounterRandom rg(seed, 0);
 
   int r;
   float temp1, temp2, temp3;
@@ -202,7 +201,7 @@ void JumbleOrientations::execute()
     while(good == false)
     {
       good = true;
-      r = numberGenerator(); // Random remaining position.
+      r = rangeMin + static_cast<int>(rg.genrand_res53() * (rangeMax - rangeMin + 1)); // Random remaining position.
       if (r >= totalFeatures) { good = false; }
       if (m_FeaturePhases[i] != m_FeaturePhases[r]) { good = false; }
     }
@@ -85,6 +85,12 @@ class JumbleOrientations : public AbstractFilter
     DREAM3D_FILTER_PARAMETER(QString, AvgQuatsArrayName)
     Q_PROPERTY(QString AvgQuatsArrayName READ getAvgQuatsArrayName WRITE setAvgQuatsArrayName)
 
+    DREAM3D_FILTER_PARAMETER(bool, UseFixedSeed)
+    Q_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+
+    DREAM3D_FILTER_PARAMETER(int, Seed)
+    Q_PROPERTY(int Seed READ getSeed WRITE setSeed)
+
     virtual const QString getCompiledLibraryName();
     virtual AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters);
     virtual const QString getGroupName();
@@ -119,11 +125,11 @@ class JumbleOrientations : public AbstractFilter
 
   private:
     // Cell Data
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, CellEulerAngles)
 
     // Feature Data
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(float, FeatureEulerAngles)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, AvgQuats)
 
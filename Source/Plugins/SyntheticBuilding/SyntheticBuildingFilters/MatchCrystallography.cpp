@@ -36,8 +36,17 @@
 
 #include "MatchCrystallography.h"
 
+#include <vector>
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "DREAM3DLib/Common/Constants.h"
-#include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "DREAM3DLib/Utilities/DREAM3DCounterRandom.h"
 #include "DREAM3DLib/Common/Texture.hpp"
 #include "DREAM3DLib/StatsData/PrimaryStatsData.h"
 #include "DREAM3DLib/StatsData/PrecipitateStatsData.h"
@@ -49,6 +58,145 @@
 
 using namespace DREAM3D;
 
+/**
+ * @brief The MatchCrystallographyTrial_t struct holds one proposed move. A swap gives feature1 the new
+ * orientation (eulers, quat) drawn from ODF bin 'choose'; a switch exchanges the orientations of feature1
+ * and feature2. odfBin1/odfBin2 are the current ODF bins of the features and mdfBins the MDF bins the
+ * evaluation read, so a stale evaluation can be detected.
+ */
+typedef struct
+{
+  bool switchOrientations;
+  size_t feature1;
+  size_t feature2;
+  int choose;
+  float eulers[3];
+  QuatF quat;
+  int odfBin1;
+  int odfBin2;
+  float odfChange;
+  float mdfChange;
+  std::vector<int> mdfBins;
+} MatchCrystallographyTrial_t;
+
+/**
+ * @brief The MatchCrystallographyImpl class computes the change in the ODF and MDF errors of a range of
+ * trial moves. It only reads the current orientations and distributions, so the trials of one batch
+ * can be evaluated concurrently.
+ */
+class MatchCrystallographyImpl
+{
+  public:
+    MatchCrystallographyImpl(MatchCrystallographyTrial_t* trials, OrientationOps* ops, NeighborList<int>& neighborList,
+                             NeighborList<float>& sharedSurfaceAreaList, const QVector<QVector<float> >& misorientationLists,
+                             QuatF* avgQuats, int32_t* featurePhases, int ensem, float* volumes,
+                             float* actualOdf, float* simOdf, float* actualMdf, float* simMdf,
+                             float unbiasedVolume, float totalSurfaceArea) :
+      m_Trials(trials),
+      m_OrientationOps(ops),
+      m_NeighborList(neighborList),
+      m_SharedSurfaceAreaList(sharedSurfaceAreaList),
+      m_MisorientationLists(misorientationLists),
+      m_AvgQuats(avgQuats),
+      m_FeaturePhases(featurePhases),
+      m_Ensem(ensem),
+      m_Volumes(volumes),
+      m_ActualOdf(actualOdf),
+      m_SimOdf(simOdf),
+      m_ActualMdf(actualMdf),
+      m_SimMdf(simMdf),
+      m_UnbiasedVolume(unbiasedVolume),
+      m_TotalSurfaceArea(totalSurfaceArea)
+    {}
+    virtual ~MatchCrystallographyImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      for (size_t i = start; i < end; i++)
+      {
+        MatchCrystallographyTrial_t& trial = m_Trials[i];
+        trial.mdfChange = 0.0f;
+        trial.mdfBins.clear();
+        float vol1 = m_Volumes[trial.feature1] / m_UnbiasedVolume;
+        if(trial.switchOrientations == false)
+        {
+          trial.odfChange = odfChange(trial.choose, vol1) + odfChange(trial.odfBin1, -vol1);
+          addMdfChange(trial, trial.feature1, trial.feature1, trial.quat);
+        }
+        else
+        {
+          float vol2 = m_Volumes[trial.feature2] / m_UnbiasedVolume;
+          trial.odfChange = odfChange(trial.odfBin1, vol2 - vol1) + odfChange(trial.odfBin2, vol1 - vol2);
+          addMdfChange(trial, trial.feature1, trial.feature2, m_AvgQuats[trial.feature2]);
+          addMdfChange(trial, trial.feature2, trial.feature1, m_AvgQuats[trial.feature1]);
+        }
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    MatchCrystallographyTrial_t* m_Trials;
+    OrientationOps* m_OrientationOps;
+    NeighborList<int>& m_NeighborList;
+    NeighborList<float>& m_SharedSurfaceAreaList;
+    const QVector<QVector<float> >& m_MisorientationLists;
+    QuatF* m_AvgQuats;
+    int32_t* m_FeaturePhases;
+    int m_Ensem;
+    float* m_Volumes;
+    float* m_ActualOdf;
+    float* m_SimOdf;
+    float* m_ActualMdf;
+    float* m_SimMdf;
+    float m_UnbiasedVolume;
+    float m_TotalSurfaceArea;
+
+    float odfChange(int bin, float change) const
+    {
+      float current = m_ActualOdf[bin] - m_SimOdf[bin];
+      float moved = m_ActualOdf[bin] - (m_SimOdf[bin] + change);
+      return (current * current) - (moved * moved);
+    }
+
+    float mdfChange(int bin, float change) const
+    {
+      float current = m_ActualMdf[bin] - m_SimMdf[bin];
+      float moved = m_ActualMdf[bin] - (m_SimMdf[bin] + change);
+      return (current * current) - (moved * moved);
+    }
+
+    // Adds the MDF change of giving 'feature' the orientation q1, skipping its boundary with 'partner'
+    void addMdfChange(MatchCrystallographyTrial_t& trial, size_t feature, size_t partner, QuatF q1) const
+    {
+      float w = 0.0f;
+      float n1 = 0.0f, n2 = 0.0f, n3 = 0.0f;
+      float r1 = 0.0f, r2 = 0.0f, r3 = 0.0f;
+      const QVector<float>& misorientations = m_MisorientationLists[feature];
+      std::vector<int>& neighbors = m_NeighborList[feature];
+      std::vector<float>& areas = m_SharedSurfaceAreaList[feature];
+      for (size_t j = 0; j < neighbors.size(); j++)
+      {
+        size_t neighbor = neighbors[j];
+        if(neighbor == partner || m_FeaturePhases[neighbor] != m_Ensem) { continue; }
+        QuatF q2 = m_AvgQuats[neighbor];
+        int curmisobin = m_OrientationOps->getMisoBin(misorientations[3 * j], misorientations[3 * j + 1], misorientations[3 * j + 2]);
+        w = m_OrientationOps->getMisoQuat(q1, q2, n1, n2, n3);
+        OrientationMath::AxisAngletoRod(w, n1, n2, n3, r1, r2, r3);
+        int newmisobin = m_OrientationOps->getMisoBin(r1, r2, r3);
+        float area = areas[j] / m_TotalSurfaceArea;
+        trial.mdfChange = trial.mdfChange + mdfChange(curmisobin, -area) + mdfChange(newmisobin, area);
+        trial.mdfBins.push_back(curmisobin);
+        trial.mdfBins.push_back(newmisobin);
+      }
+    }
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -70,6 +218,8 @@ MatchCrystallography::MatchCrystallography() :
   m_FeatureEulerAnglesArrayName(DREAM3D::FeatureData::EulerAngles),
   m_AvgQuatsArrayName(DREAM3D::FeatureData::AvgQuats),
   m_MaxIterations(1),
+  m_UseFixedSeed(false),
+  m_Seed(0),
   m_FeatureIdsArrayName(DREAM3D::CellData::FeatureIds),
   m_FeatureIds(NULL),
   m_CellEulerAngles(NULL),
@@ -85,7 +235,8 @@ MatchCrystallography::MatchCrystallography() :
   m_PhaseTypesArrayName(DREAM3D::EnsembleData::PhaseTypes),
   m_PhaseTypes(NULL),
   m_NumFeaturesArrayName(DREAM3D::EnsembleData::NumFeatures),
-  m_NumFeatures(NULL)
+  m_NumFeatures(NULL),
+  m_GlobalSeed(0)
 {
   m_OrientationOps = OrientationOps::getOrientationOpsQVector();
   setupFilterParameters();
@@ -104,6 +255,9 @@ void MatchCrystallography::setupFilterParameters()
 {
   FilterParameterVector parameters;
   parameters.push_back(FilterParameter::New("Maximum Number of Iterations (Swaps)", "MaxIterations", FilterParameterWidgetType::IntWidget, getMaxIterations(), false));
+  QStringList linkedProps("Seed");
+  parameters.push_back(LinkedBooleanFilterParameter::New("Use Fixed Random Seed", "UseFixedSeed", getUseFixedSeed(), linkedProps, false));
+  parameters.push_back(FilterParameter::New("Random Seed", "Seed", FilterParameterWidgetType::IntWidget, getSeed(), false, ""));
   parameters.push_back(FilterParameter::New("Required Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
   parameters.push_back(FilterParameter::New("Statistics", "InputStatsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getInputStatsArrayPath(), true, ""));
   parameters.push_back(FilterParameter::New("Crystal Structures Array", "CrystalStructuresArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getCrystalStructuresArrayPath(), true, ""));
@@ -128,6 +282,8 @@ void MatchCrystallography::readFilterParameters(AbstractFilterParametersReader*
 {
   reader->openFilterGroup(this, index);
   setMaxIterations( reader->readValue("MaxIterations", getMaxIterations()) );
+  setUseFixedSeed( reader->readValue("UseFixedSeed", getUseFixedSeed()) );
+  setSeed( reader->readValue("Seed", getSeed()) );
   setInputStatsArrayPath(reader->readDataArrayPath("InputStatsArrayPath", getInputStatsArrayPath() ) );
   setCrystalStructuresArrayPath(reader->readDataArrayPath("CrystalStructuresArrayPath", getCrystalStructuresArrayPath() ) );
   setPhaseTypesArrayPath(reader->readDataArrayPath("PhaseTypesArrayPath", getPhaseTypesArrayPath() ) );
@@ -151,6 +307,8 @@ int MatchCrystallography::writeFilterParameters(AbstractFilterParametersWriter*
 {
   writer->openFilterGroup(this, index);
   DREAM3D_FILTER_WRITE_PARAMETER(MaxIterations)
+  DREAM3D_FILTER_WRITE_PARAMETER(UseFixedSeed)
+  DREAM3D_FILTER_WRITE_PARAMETER(Seed)
   DREAM3D_FILTER_WRITE_PARAMETER(InputStatsArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(CrystalStructuresArrayPath)
   DREAM3D_FILTER_WRITE_PARAMETER(PhaseTypesArrayPath)
@@ -181,7 +339,7 @@ void MatchCrystallography::dataCheck()
   // Cell Data
   m_FeatureIdsPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this,  getFeatureIdsArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_FeatureIdsPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_FeatureIds = m_FeatureIdsPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_FeatureIds = m_FeatureIdsPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   dims[0] = 3;
   tempPath.update(getFeatureIdsArrayPath().getDataContainerName(), getFeatureIdsArrayPath().getAttributeMatrixName(), getCellEulerAnglesArrayName());
   m_CellEulerAnglesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<FloatArrayType, AbstractFilter>(this, tempPath, 0, dims);
@@ -195,7 +353,7 @@ void MatchCrystallography::dataCheck()
   { m_FeaturePhases = m_FeaturePhasesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   m_SurfaceFeaturesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this,  getSurfaceFeaturesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_SurfaceFeaturesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_SurfaceFeatures = m_SurfaceFeaturesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_SurfaceFeatures = m_SurfaceFeaturesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   tempPath.update(getFeaturePhasesArrayPath().getDataContainerName(), getFeaturePhasesArrayPath().getAttributeMatrixName(), getVolumesArrayName());
   m_VolumesPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<float>, AbstractFilter, float>(this,  tempPath, 0, dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_VolumesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
@@ -218,7 +376,7 @@ void MatchCrystallography::dataCheck()
 // Ensemble Data
   m_NumFeaturesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<int32_t>, AbstractFilter>(this,  getNumFeaturesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_NumFeaturesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_NumFeatures = m_NumFeaturesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_NumFeatures = m_NumFeaturesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
 
   m_StatsDataArray = getDataContainerArray()->getPrereqArrayFromPath<StatsDataArray, AbstractFilter>(this, getInputStatsArrayPath(), dims);
   if(m_StatsDataArray.lock() == NULL)
@@ -237,7 +395,7 @@ void MatchCrystallography::dataCheck()
 
   m_PhaseTypesPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<unsigned int>, AbstractFilter>(this,  getPhaseTypesArrayPath(), dims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if( NULL != m_PhaseTypesPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-  { m_PhaseTypes = m_PhaseTypesPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+  { m_PhaseTypes = m_PhaseTypesPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
 }
 
 // -----------------------------------------------------------------------------
@@ -266,6 +424,9 @@ void MatchCrystallography::execute()
 
   int64_t totalEnsembles = m_CrystalStructuresPtr.lock()->getNumberOfTuples();
 
+  m_GlobalSeed = static_cast<uint64_t>(static_cast<uint32_t>(m_Seed));
+  if (m_UseFixedSeed == false) { m_GlobalSeed = DREAM3DCounterRandom::GenerateSeed(); }
+
   QString ss;
   ss = QObject::tr("Determining Volumes");
   notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
@@ -329,6 +490,7 @@ void MatchCrystallography::initializeArrays(int ensem)
     return;
   }
 
+  m_OdfSampler.initialize(actualodf->getPointer(0), actualodf->getSize());
   simodf = FloatArrayType::CreateArray(actualodf->getSize(), DREAM3D::StringConstants::ODF);
   simmdf = FloatArrayType::CreateArray(actualmdf->getSize(), DREAM3D::StringConstants::MisorientationBins);
   for (size_t j = 0; j < simodf->getSize(); j++)
@@ -413,8 +575,6 @@ void MatchCrystallography::determine_boundary_areas()
 // -----------------------------------------------------------------------------
 void MatchCrystallography::assign_eulers(int ensem)
 {
-  DREAM3D_RANDOMNG_NEW()
-
   int numbins = 0;
   float synea1 = 0, synea2 = 0, synea3 = 0;
   QuatF q;
@@ -429,6 +589,8 @@ void MatchCrystallography::assign_eulers(int ensem)
     phase = m_FeaturePhases[i];
     if(phase == ensem)
     {
+      // Stream i belongs to Feature i; the swapping streams of matchCrystallography() come after the Features
+      DREAM3DCounterRandom rg(m_GlobalSeed, i);
       random = static_cast<float>( rg.genrand_res53() );
 
       if( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructures[phase] ) { numbins = CubicOps::k_OdfSize; };
@@ -437,7 +599,7 @@ void MatchCrystallography::assign_eulers(int ensem)
       choose = pick_euler(random, numbins);
 
       m_OrientationOps[m_CrystalStructures[ensem]]->determineEulerAngles(choose, synea1, synea2, synea3);
-      m_OrientationOps[m_CrystalStructures[ensem]]->randomizeEulerAngles(synea1, synea2, synea3);
+      randomize_eulers(rg, m_CrystalStructures[ensem], synea1, synea2, synea3);
       m_FeatureEulerAngles[3 * i] = synea1;
       m_FeatureEulerAngles[3 * i + 1] = synea2;
       m_FeatureEulerAngles[3 * i + 2] = synea3;
@@ -456,45 +618,74 @@ void MatchCrystallography::assign_eulers(int ensem)
 // -----------------------------------------------------------------------------
 int MatchCrystallography::pick_euler(float random, int numbins)
 {
-  int choose = 0;
-  float totaldensity = 0;
+  int choose = m_OdfSampler.pick(random);
+  if (choose >= numbins) { choose = 0; }
+  return choose;
+}
+
+// -----------------------------------------------------------------------------
+// Same as OrientationOps::randomizeEulerAngles but the symmetry operator is drawn from rg instead of a
+// generator seeded from the clock, so a fixed seed reproduces the orientations
+// -----------------------------------------------------------------------------
+void MatchCrystallography::randomize_eulers(DREAM3DCounterRandom& rg, unsigned int sym, float& ea1, float& ea2, float& ea3)
+{
+  int numSymOps = m_OrientationOps[sym]->getNumSymOps();
+  int symOp = static_cast<int>(rg.genrand_res53() * numSymOps);
+  QuatF q;
+  QuatF qs;
+  QuatF qc;
+  OrientationMath::EulertoQuat(ea1, ea2, ea3, q);
+  m_OrientationOps[sym]->getQuatSymOp(symOp, qs);
+  QuaternionMathF::Multiply(q, qs, qc);
+  OrientationMath::QuattoEuler(qc, ea1, ea2, ea3);
+}
 
-  for (int j = 0; j < numbins; j++)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t MatchCrystallography::select_feature(DREAM3DCounterRandom& rg, int ensem, size_t exclude)
+{
+  size_t totalFeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
+  size_t feature = static_cast<size_t>(rg.genrand_res53() * totalFeatures);
+  for (size_t counter = 0; counter < totalFeatures; counter++)
   {
-    float density = actualodf->getValue(j);
-    float td1 = totaldensity;
-    totaldensity = totaldensity + density;
-    if (random < totaldensity && random >= td1) { choose = static_cast<int> (j); break; }
+    if(feature >= totalFeatures) { feature = 0; }
+    if(m_SurfaceFeatures[feature] == false && m_FeaturePhases[feature] == ensem && feature != exclude)
+    {
+      return feature;
+    }
+    feature++;
   }
-  return choose;
+  return totalFeatures;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void MatchCrystallography::MC_LoopBody1(int feature, int ensem, int j, float neighsurfarea, unsigned int sym, QuatF& q1, QuatF& q2)
+bool MatchCrystallography::claim_neighborhoods(size_t feature1, size_t feature2, size_t stamp, std::vector<size_t>& featureStamps)
 {
-  float w;
-  float n1, n2, n3;
-  float r1, r2, r3;
-  float curmiso1, curmiso2, curmiso3;
-  size_t curmisobin, newmisobin;
+  NeighborList<int>& neighborlist = *(m_NeighborList.lock());
 
-  curmiso1 = m_MisorientationLists[feature][3 * j];
-  curmiso2 = m_MisorientationLists[feature][3 * j + 1];
-  curmiso3 = m_MisorientationLists[feature][3 * j + 2];
-  curmisobin = m_OrientationOps[sym]->getMisoBin(curmiso1, curmiso2, curmiso3);
-  w = m_OrientationOps[sym]->getMisoQuat(q1, q2, n1, n2, n3);
-  OrientationMath::AxisAngletoRod(w, n1, n2, n3, r1, r2, r3);
-  newmisobin = m_OrientationOps[sym]->getMisoBin(n1, n2, n3);
-  mdfchange = mdfchange
-              + (((actualmdf->getValue(curmisobin) - simmdf->getValue(curmisobin)) * (actualmdf->getValue(curmisobin) - simmdf->getValue(curmisobin)))
-                 - ((actualmdf->getValue(curmisobin) - (simmdf->getValue(curmisobin) - (neighsurfarea / m_TotalSurfaceArea[ensem])))
-                    * (actualmdf->getValue(curmisobin) - (simmdf->getValue(curmisobin) - (neighsurfarea / m_TotalSurfaceArea[ensem])))));
-  mdfchange = mdfchange
-              + (((actualmdf->getValue(newmisobin) - simmdf->getValue(newmisobin)) * (actualmdf->getValue(newmisobin) - simmdf->getValue(newmisobin)))
-                 - ((actualmdf->getValue(newmisobin) - (simmdf->getValue(newmisobin) + (neighsurfarea / m_TotalSurfaceArea[ensem])))
-                    * (actualmdf->getValue(newmisobin) - (simmdf->getValue(newmisobin) + (neighsurfarea / m_TotalSurfaceArea[ensem])))));
+  size_t features[2] = { feature1, feature2 };
+  for (int i = 0; i < 2; i++)
+  {
+    if(featureStamps[features[i]] == stamp) { return false; }
+    std::vector<int>& neighbors = neighborlist[features[i]];
+    for (size_t j = 0; j < neighbors.size(); j++)
+    {
+      if(featureStamps[neighbors[j]] == stamp) { return false; }
+    }
+  }
+  for (int i = 0; i < 2; i++)
+  {
+    featureStamps[features[i]] = stamp;
+    std::vector<int>& neighbors = neighborlist[features[i]];
+    for (size_t j = 0; j < neighbors.size(); j++)
+    {
+      featureStamps[neighbors[j]] = stamp;
+    }
+  }
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -502,12 +693,13 @@ void MatchCrystallography::MC_LoopBody1(int feature, int ensem, int j, float nei
 // -----------------------------------------------------------------------------
 void MatchCrystallography::MC_LoopBody2(int feature, int ensem, int j, float neighsurfarea, unsigned int sym, QuatF& q1, QuatF& q2)
 {
+  NeighborList<int>& neighborlist = *(m_NeighborList.lock());
+
   float w;
   float n1, n2, n3;
   float r1, r2, r3;
   float curmiso1, curmiso2, curmiso3;
   size_t curmisobin, newmisobin;
-  float miso1 = 0.0f, miso2 = 0.0f, miso3 = 0.0f;
 
   curmiso1 = m_MisorientationLists[feature][3 * j];
   curmiso2 = m_MisorientationLists[feature][3 * j + 1];
@@ -515,10 +707,23 @@ void MatchCrystallography::MC_LoopBody2(int feature, int ensem, int j, float nei
   curmisobin = m_OrientationOps[sym]->getMisoBin(curmiso1, curmiso2, curmiso3);
   w = m_OrientationOps[sym]->getMisoQuat(q1, q2, n1, n2, n3);
   OrientationMath::AxisAngletoRod(w, n1, n2, n3, r1, r2, r3);
-  newmisobin = m_OrientationOps[sym]->getMisoBin(n1, n2, n3);
-  m_MisorientationLists[feature][3 * j] = miso1;
-  m_MisorientationLists[feature][3 * j + 1] = miso2;
-  m_MisorientationLists[feature][3 * j + 2] = miso3;
+  newmisobin = m_OrientationOps[sym]->getMisoBin(r1, r2, r3);
+  m_MisorientationLists[feature][3 * j] = r1;
+  m_MisorientationLists[feature][3 * j + 1] = r2;
+  m_MisorientationLists[feature][3 * j + 2] = r3;
+
+  // Keep the neighbor's entry for this boundary in step so its own trials start from the right bin
+  int neighbor = neighborlist[feature][j];
+  std::vector<int>& neighbors = neighborlist[neighbor];
+  for (size_t k = 0; k < neighbors.size(); k++)
+  {
+    if(neighbors[k] == feature && m_MisorientationLists[neighbor].size() >= static_cast<int>(3 * k + 3))
+    {
+      m_MisorientationLists[neighbor][3 * k] = r1;
+      m_MisorientationLists[neighbor][3 * k + 1] = r2;
+      m_MisorientationLists[neighbor][3 * k + 2] = r3;
+    }
+  }
   simmdf->setValue(curmisobin, (simmdf->getValue(curmisobin) - (neighsurfarea / m_TotalSurfaceArea[ensem])));
   simmdf->setValue(newmisobin, (simmdf->getValue(newmisobin) + (neighsurfarea / m_TotalSurfaceArea[ensem])));
 }
@@ -536,276 +741,203 @@ void MatchCrystallography::matchCrystallography(int ensem)
   NeighborList<float>& neighborsurfacearealist = *(m_SharedSurfaceAreaList.lock() );
   size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
   size_t totalFeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
+  unsigned int sym = m_CrystalStructures[ensem];
 
-  DREAM3D_RANDOMNG_NEW()
+  DREAM3DCounterRandom rg(m_GlobalSeed, totalFeatures + ensem);
   int numbins = 0;
   int iterations = 0, badtrycount = 0;
   float random = 0;
-  size_t counter = 0;
 
-  QuatF q1;
-  QuatF q2;
   QuatF* avgQuats = reinterpret_cast<QuatF*>(m_AvgQuats);
 
-  float ea1 = 0, ea2 = 0, ea3 = 0;
   float r1 = 0, r2 = 0, r3 = 0;
-  float g1ea1 = 0, g1ea2 = 0, g1ea3 = 0, g2ea1 = 0, g2ea2 = 0, g2ea3 = 0;
-  int g1odfbin = 0, g2odfbin = 0;
-  //float totaldensity = 0;
   float deltaerror = 0;
   float currentodferror = 0, currentmdferror = 0;
-  size_t selectedfeature1 = 0, selectedfeature2 = 0;
   iterations = 0;
   badtrycount = 0;
   if( Ebsd::CrystalStructure::Cubic_High == m_CrystalStructures[ensem]) { numbins = 18 * 18 * 18; }
   if( Ebsd::CrystalStructure::Hexagonal_High == m_CrystalStructures[ensem]) { numbins = 36 * 36 * 12; }
+
+  float* actualOdfPtr = actualodf->getPointer(0);
+  float* simOdfPtr = simodf->getPointer(0);
+  float* actualMdfPtr = actualmdf->getPointer(0);
+  float* simMdfPtr = simmdf->getPointer(0);
+  size_t numMdfBins = simmdf->getSize();
+
+  // Trial moves are drawn in batches in which no two moves share a feature or a neighbor, so the
+  // change in the ODF and MDF errors of every move in a batch can be computed concurrently. The moves
+  // are then accepted or rejected in the order they were drawn; a move that reads an ODF or MDF bin
+  // written by an earlier accepted move of the same batch is re-evaluated first.
+  const size_t batchSize = 256;
+  std::vector<MatchCrystallographyTrial_t> trials(batchSize);
+  std::vector<size_t> featureStamps(totalFeatures, 0);
+  std::vector<size_t> odfStamps(simodf->getSize(), 0);
+  std::vector<size_t> mdfStamps(numMdfBins, 0);
+  size_t batch = 0;
+
+  MatchCrystallographyImpl serial(&(trials[0]), m_OrientationOps[sym].get(), neighborlist, neighborsurfacearealist, m_MisorientationLists,
+                                  avgQuats, m_FeaturePhases, ensem, m_Volumes, actualOdfPtr, simOdfPtr, actualMdfPtr, simMdfPtr,
+                                  unbiasedvol[ensem], m_TotalSurfaceArea[ensem]);
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
   while (badtrycount < (m_MaxIterations / 10) && iterations < m_MaxIterations)
   {
     QString ss = QObject::tr("Matching Crystallography - Swapping/Switching Orientations - %1% Complete").arg(((float)iterations / float(1000 * totalFeatures)) * 100);
     //      notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
+    batch++;
     currentodferror = 0;
     currentmdferror = 0;
-    float* actualOdfPtr = actualodf->getPointer(0);
-    float* simOdfPtr = simodf->getPointer(0);
     float delta = 0.0f;
     for (int i = 0; i < numbins; i++)
     {
       delta = actualOdfPtr[i] - simOdfPtr[i];
       currentodferror = currentodferror + (delta * delta);
     }
-    for (int i = 0; i < (numbins); i++)
+    for (size_t i = 0; i < numMdfBins; i++)
     {
-      currentmdferror = currentmdferror + ((actualmdf->getValue(i) - simmdf->getValue(i)) * (actualmdf->getValue(i) - simmdf->getValue(i)));
+      delta = actualMdfPtr[i] - simMdfPtr[i];
+      currentmdferror = currentmdferror + (delta * delta);
     }
-    iterations++;
-    badtrycount++;
-    random = static_cast<float>( rg.genrand_res53() );
 
-    if(random < 0.5) // SwapOutOrientation
+    bool noFeatures = false;
+    size_t numTrials = 0;
+    size_t maxTrials = batchSize;
+    if(static_cast<size_t>(m_MaxIterations - iterations) < maxTrials) { maxTrials = m_MaxIterations - iterations; }
+    for (size_t attempt = 0; attempt < 2 * batchSize && numTrials < maxTrials; attempt++)
     {
-      counter = 0;
-      selectedfeature1 = int(rg.genrand_res53() * totalFeatures);
-      while ((m_SurfaceFeatures[selectedfeature1] == true || m_FeaturePhases[selectedfeature1] != static_cast<int32_t>(ensem)) && counter < totalFeatures)
+      MatchCrystallographyTrial_t& trial = trials[numTrials];
+      random = static_cast<float>( rg.genrand_res53() );
+      trial.switchOrientations = (random >= 0.5);
+      trial.feature1 = select_feature(rg, ensem, totalFeatures);
+      trial.feature2 = trial.feature1;
+      if(trial.feature1 < totalFeatures && trial.switchOrientations == true)
       {
-        if(selectedfeature1 >= totalFeatures) { selectedfeature1 = selectedfeature1 - totalFeatures; }
-        selectedfeature1++;
-        counter++;
+        trial.feature2 = select_feature(rg, ensem, trial.feature1);
       }
-      if(counter == totalFeatures)
+      if(trial.feature1 == totalFeatures || trial.feature2 == totalFeatures)
       {
-        badtrycount = 10 * m_NumFeatures[ensem];
+        noFeatures = true;
+        break;
       }
-      else
+      if(claim_neighborhoods(trial.feature1, trial.feature2, batch, featureStamps) == false) { continue; }
+
+      float* eulers1 = m_FeatureEulerAngles + 3 * trial.feature1;
+      OrientationMath::EulertoRod(eulers1[0], eulers1[1], eulers1[2], r1, r2, r3);
+      trial.odfBin1 = m_OrientationOps[sym]->getOdfBin(r1, r2, r3);
+      if(trial.switchOrientations == false)
       {
-        ea1 = m_FeatureEulerAngles[3 * selectedfeature1];
-        ea2 = m_FeatureEulerAngles[3 * selectedfeature1 + 1];
-        ea3 = m_FeatureEulerAngles[3 * selectedfeature1 + 2];
-        OrientationMath::EulertoRod( ea1, ea2, ea3, r1, r2, r3);
-        g1odfbin = m_OrientationOps[m_CrystalStructures[ensem]]->getOdfBin(r1, r2, r3);
         random = static_cast<float>( rg.genrand_res53() );
-        int choose = 0;
-
-        choose = pick_euler(random, numbins);
-
-        m_OrientationOps[m_CrystalStructures[ensem]]->determineEulerAngles(choose, g1ea1, g1ea2, g1ea3);
-        m_OrientationOps[m_CrystalStructures[ensem]]->randomizeEulerAngles(g1ea1, g1ea2, g1ea3);
-        OrientationMath::EulertoQuat(g1ea1, g1ea2, g1ea3, q1);
-
-        odfchange = ((actualodf->getValue(choose) - simodf->getValue(choose)) * (actualodf->getValue(choose) - simodf->getValue(choose)))
-                    - ((actualodf->getValue(choose) - (simodf->getValue(choose) + (m_Volumes[selectedfeature1] / unbiasedvol[ensem])))
-                       * (actualodf->getValue(choose) - (simodf->getValue(choose) + (m_Volumes[selectedfeature1] / unbiasedvol[ensem]))));
-        odfchange = odfchange
-                    + (((actualodf->getValue(g1odfbin) - simodf->getValue(g1odfbin)) * (actualodf->getValue(g1odfbin) - simodf->getValue(g1odfbin)))
-                       - ((actualodf->getValue(g1odfbin) - (simodf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / unbiasedvol[ensem])))
-                          * (actualodf->getValue(g1odfbin) - (simodf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / unbiasedvol[ensem])))));
-
-        mdfchange = 0;
-        size_t size = 0;
-        if(neighborlist[selectedfeature1].size() != 0) { size = neighborlist[selectedfeature1].size(); }
-        for (size_t j = 0; j < size; j++)
-        {
-          int neighbor = neighborlist[selectedfeature1][j];
-          ea1 = m_FeatureEulerAngles[3 * neighbor];
-          ea2 = m_FeatureEulerAngles[3 * neighbor + 1];
-          ea3 = m_FeatureEulerAngles[3 * neighbor + 2];
-          OrientationMath::EulertoQuat(ea1, ea2, ea3, q2);
-          float neighsurfarea = neighborsurfacearealist[selectedfeature1][j];
-          MC_LoopBody1(selectedfeature1, ensem, j, neighsurfarea, m_CrystalStructures[ensem], q1, q2);
-        }
+        trial.choose = pick_euler(random, numbins);
+        m_OrientationOps[sym]->determineEulerAngles(trial.choose, trial.eulers[0], trial.eulers[1], trial.eulers[2]);
+        randomize_eulers(rg, sym, trial.eulers[0], trial.eulers[1], trial.eulers[2]);
+        OrientationMath::EulertoQuat(trial.eulers[0], trial.eulers[1], trial.eulers[2], trial.quat);
+      }
+      else
+      {
+        float* eulers2 = m_FeatureEulerAngles + 3 * trial.feature2;
+        OrientationMath::EulertoRod(eulers2[0], eulers2[1], eulers2[2], r1, r2, r3);
+        trial.odfBin2 = m_OrientationOps[sym]->getOdfBin(r1, r2, r3);
+      }
+      numTrials++;
+    }
 
-        deltaerror = (odfchange / currentodferror) + (mdfchange / currentmdferror);
-        if(deltaerror > 0)
-        {
-          badtrycount = 0;
-          m_FeatureEulerAngles[3 * selectedfeature1] = g1ea1;
-          m_FeatureEulerAngles[3 * selectedfeature1 + 1] = g1ea2;
-          m_FeatureEulerAngles[3 * selectedfeature1 + 2] = g1ea3;
-          QuaternionMathF::Copy(q1, avgQuats[selectedfeature1]);
-          simodf->setValue(choose, (simodf->getValue(choose) + (m_Volumes[selectedfeature1] / unbiasedvol[ensem])));
-          simodf->setValue(g1odfbin, (simodf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / unbiasedvol[ensem])));
-          size = 0;
-          if(neighborlist[selectedfeature1].size() != 0) { size = neighborlist[selectedfeature1].size(); }
-          for (size_t j = 0; j < size; j++)
-          {
-            int neighbor = neighborlist[selectedfeature1][j];
-            ea1 = m_FeatureEulerAngles[3 * neighbor];
-            ea2 = m_FeatureEulerAngles[3 * neighbor + 1];
-            ea3 = m_FeatureEulerAngles[3 * neighbor + 2];
-            OrientationMath::EulertoQuat(ea1, ea2, ea3, q2);
-            float neighsurfarea = neighborsurfacearealist[selectedfeature1][j];
-            MC_LoopBody2(selectedfeature1, ensem, j, neighsurfarea, m_CrystalStructures[ensem], q1, q2);
-          }
-        }
+    if(numTrials > 0)
+    {
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+      if(doParallel == true)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, numTrials), serial, tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        serial.convert(0, numTrials);
       }
     }
-    else // SwitchOrientation
+
+    for (size_t t = 0; t < numTrials && badtrycount < (m_MaxIterations / 10); t++)
     {
-      counter = 0;
-      selectedfeature1 = int(rg.genrand_res53() * totalFeatures);
-      while ((m_SurfaceFeatures[selectedfeature1] == true || m_FeaturePhases[selectedfeature1] != static_cast<int32_t>(ensem)) && counter < totalFeatures)
+      MatchCrystallographyTrial_t& trial = trials[t];
+      iterations++;
+      badtrycount++;
+
+      bool stale = (odfStamps[trial.odfBin1] == batch);
+      if(trial.switchOrientations == false) { stale = stale || (odfStamps[trial.choose] == batch); }
+      else { stale = stale || (odfStamps[trial.odfBin2] == batch); }
+      for (size_t b = 0; b < trial.mdfBins.size() && stale == false; b++)
       {
-        if(selectedfeature1 >= totalFeatures) { selectedfeature1 = selectedfeature1 - totalFeatures; }
-        selectedfeature1++;
-        counter++;
+        stale = (mdfStamps[trial.mdfBins[b]] == batch);
       }
-      if(counter == totalFeatures)
+      if(stale == true) { serial.convert(t, t + 1); }
+
+      deltaerror = (trial.odfChange / currentodferror) + (trial.mdfChange / currentmdferror);
+      if(deltaerror <= 0) { continue; }
+
+      badtrycount = 0;
+      currentodferror = currentodferror - trial.odfChange;
+      currentmdferror = currentmdferror - trial.mdfChange;
+      size_t feature1 = trial.feature1;
+      size_t feature2 = trial.feature2;
+      float vol1 = m_Volumes[feature1] / unbiasedvol[ensem];
+      if(trial.switchOrientations == false) // SwapOutOrientation
       {
-        badtrycount = 10 * m_NumFeatures[ensem];
+        m_FeatureEulerAngles[3 * feature1] = trial.eulers[0];
+        m_FeatureEulerAngles[3 * feature1 + 1] = trial.eulers[1];
+        m_FeatureEulerAngles[3 * feature1 + 2] = trial.eulers[2];
+        QuaternionMathF::Copy(trial.quat, avgQuats[feature1]);
+        simOdfPtr[trial.choose] = simOdfPtr[trial.choose] + vol1;
+        simOdfPtr[trial.odfBin1] = simOdfPtr[trial.odfBin1] - vol1;
+        odfStamps[trial.choose] = batch;
       }
-      else
+      else // SwitchOrientation
       {
-        counter = 0;
-        selectedfeature2 = int(rg.genrand_res53() * totalFeatures);
-        while ((m_SurfaceFeatures[selectedfeature2] == true || m_FeaturePhases[selectedfeature2] != static_cast<int32_t>(ensem) || selectedfeature2 == selectedfeature1) && counter < totalFeatures)
+        float vol2 = m_Volumes[feature2] / unbiasedvol[ensem];
+        for (int k = 0; k < 3; k++)
         {
-          if(selectedfeature2 >= totalFeatures) { selectedfeature2 = selectedfeature2 - totalFeatures; }
-          selectedfeature2++;
-          counter++;
+          float temp = m_FeatureEulerAngles[3 * feature1 + k];
+          m_FeatureEulerAngles[3 * feature1 + k] = m_FeatureEulerAngles[3 * feature2 + k];
+          m_FeatureEulerAngles[3 * feature2 + k] = temp;
         }
-        if(counter == totalFeatures)
-        {
-          badtrycount = 10 * m_NumFeatures[ensem];
-        }
-        else
-        {
-          g1ea1 = m_FeatureEulerAngles[3 * selectedfeature1];
-          g1ea2 = m_FeatureEulerAngles[3 * selectedfeature1 + 1];
-          g1ea3 = m_FeatureEulerAngles[3 * selectedfeature1 + 2];
-          g2ea1 = m_FeatureEulerAngles[3 * selectedfeature2];
-          g2ea2 = m_FeatureEulerAngles[3 * selectedfeature2 + 1];
-          g2ea3 = m_FeatureEulerAngles[3 * selectedfeature2 + 2];
-          QuaternionMathF::Copy(q1, avgQuats[selectedfeature1]);
-          OrientationMath::EulertoRod(g1ea1, g1ea2, g1ea3, r1, r2, r3);
-          g1odfbin = m_OrientationOps[m_CrystalStructures[ensem]]->getOdfBin(r1, r2, r3);
-          QuaternionMathF::Copy(q1, avgQuats[selectedfeature2]);
-          OrientationMath::EulertoRod(g2ea1, g2ea2, g2ea3, r1, r2, r3);
-          g2odfbin = m_OrientationOps[m_CrystalStructures[ensem]]->getOdfBin(r1, r2, r3);
-
-          odfchange = ((actualodf->getValue(g1odfbin) - simodf->getValue(g1odfbin)) * (actualodf->getValue(g1odfbin) - simodf->getValue(g1odfbin)))
-                      - ((actualodf->getValue(g1odfbin)
-                          - (simodf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / unbiasedvol[ensem])
-                             + (m_Volumes[selectedfeature2] / unbiasedvol[ensem])))
-                         * (actualodf->getValue(g1odfbin)
-                            - (simodf->getValue(g1odfbin) - (m_Volumes[selectedfeature1] / unbiasedvol[ensem])
-                               + (m_Volumes[selectedfeature2] / unbiasedvol[ensem]))));
-          odfchange = odfchange
-                      + (((actualodf->getValue(g2odfbin) - simodf->getValue(g2odfbin)) * (actualodf->getValue(g2odfbin) - simodf->getValue(g2odfbin)))
-                         - ((actualodf->getValue(g2odfbin)
-                             - (simodf->getValue(g2odfbin) - (m_Volumes[selectedfeature2] / unbiasedvol[ensem])
-                                + (m_Volumes[selectedfeature1] / unbiasedvol[ensem])))
-                            * (actualodf->getValue(g2odfbin)
-                               - (simodf->getValue(g2odfbin) - (m_Volumes[selectedfeature2] / unbiasedvol[ensem])
-                                  + (m_Volumes[selectedfeature1] / unbiasedvol[ensem])))));
-
-          mdfchange = 0;
-          OrientationMath::EulertoQuat(g2ea1, g2ea2, g2ea3, q1);
-          size_t size = 0;
-          if(neighborlist[selectedfeature1].size() != 0) { size = neighborlist[selectedfeature1].size(); }
-          for (size_t j = 0; j < size; j++)
-          {
-            int neighbor = neighborlist[selectedfeature1][j];
-            ea1 = m_FeatureEulerAngles[3 * neighbor];
-            ea2 = m_FeatureEulerAngles[3 * neighbor + 1];
-            ea3 = m_FeatureEulerAngles[3 * neighbor + 2];
-            OrientationMath::EulertoQuat(ea1, ea2, ea3, q2);
-            float neighsurfarea = neighborsurfacearealist[selectedfeature1][j];
-            if(neighbor != static_cast<int>(selectedfeature2) )
-            {
-              MC_LoopBody1(selectedfeature1, ensem, j, neighsurfarea, m_CrystalStructures[ensem], q1, q2);
-            }
-          }
-
-          OrientationMath::EulertoQuat(g1ea1, g1ea2, g1ea3, q1);
-          size = 0;
-          if(neighborlist[selectedfeature2].size() != 0) { size = neighborlist[selectedfeature2].size(); }
-          for (size_t j = 0; j < size; j++)
-          {
-            size_t neighbor = neighborlist[selectedfeature2][j];
-            ea1 = m_FeatureEulerAngles[3 * neighbor];
-            ea2 = m_FeatureEulerAngles[3 * neighbor + 1];
-            ea3 = m_FeatureEulerAngles[3 * neighbor + 2];
-            OrientationMath::EulertoQuat(ea1, ea2, ea3, q2);
-            float neighsurfarea = neighborsurfacearealist[selectedfeature2][j];
-            if(neighbor != selectedfeature1)
-            {
-              MC_LoopBody1(selectedfeature2, ensem, j, neighsurfarea, m_CrystalStructures[ensem], q1, q2);
-            }
-          }
+        QuatF temp;
+        QuaternionMathF::Copy(avgQuats[feature1], temp);
+        QuaternionMathF::Copy(avgQuats[feature2], avgQuats[feature1]);
+        QuaternionMathF::Copy(temp, avgQuats[feature2]);
+        simOdfPtr[trial.odfBin1] = simOdfPtr[trial.odfBin1] + vol2 - vol1;
+        simOdfPtr[trial.odfBin2] = simOdfPtr[trial.odfBin2] + vol1 - vol2;
+        odfStamps[trial.odfBin2] = batch;
+      }
+      odfStamps[trial.odfBin1] = batch;
 
-          deltaerror = (odfchange / currentodferror) + (mdfchange / currentmdferror);
-          if(deltaerror > 0)
+      size_t features[2] = { feature1, feature2 };
+      int numFeatures = (trial.switchOrientations == true) ? 2 : 1;
+      for (int f = 0; f < numFeatures; f++)
+      {
+        size_t feature = features[f];
+        size_t partner = features[1 - f];
+        size_t size = neighborlist[feature].size();
+        for (size_t j = 0; j < size; j++)
+        {
+          size_t neighbor = neighborlist[feature][j];
+          if(neighbor != partner && m_FeaturePhases[neighbor] == ensem)
           {
-
-            badtrycount = 0;
-            m_FeatureEulerAngles[3 * selectedfeature1] = g2ea1;
-            m_FeatureEulerAngles[3 * selectedfeature1 + 1] = g2ea2;
-            m_FeatureEulerAngles[3 * selectedfeature1 + 2] = g2ea3;
-            m_FeatureEulerAngles[3 * selectedfeature2] = g1ea1;
-            m_FeatureEulerAngles[3 * selectedfeature2 + 1] = g1ea2;
-            m_FeatureEulerAngles[3 * selectedfeature2 + 2] = g1ea3;
-            simodf->setValue(g1odfbin, (simodf->getValue(g1odfbin) + (m_Volumes[selectedfeature2] / unbiasedvol[ensem])
-                                        - (m_Volumes[selectedfeature1] / unbiasedvol[ensem])));
-            simodf->setValue(g2odfbin, (simodf->getValue(g2odfbin) + (m_Volumes[selectedfeature1] / unbiasedvol[ensem])
-                                        - (m_Volumes[selectedfeature2] / unbiasedvol[ensem])));
-
-            OrientationMath::EulertoQuat(g2ea1, g2ea2, g2ea3, q1);
-            QuaternionMathF::Copy(avgQuats[selectedfeature1], q1);
-            size = 0;
-            if(neighborlist[selectedfeature1].size() != 0) { size = neighborlist[selectedfeature1].size(); }
-            for (size_t j = 0; j < size; j++)
-            {
-              size_t neighbor = neighborlist[selectedfeature1][j];
-              ea1 = m_FeatureEulerAngles[3 * neighbor];
-              ea2 = m_FeatureEulerAngles[3 * neighbor + 1];
-              ea3 = m_FeatureEulerAngles[3 * neighbor + 2];
-              OrientationMath::EulertoQuat(ea1, ea2, ea3, q2);
-              float neighsurfarea = neighborsurfacearealist[selectedfeature1][j];
-              if(neighbor != selectedfeature2)
-              {
-                MC_LoopBody2(selectedfeature1, ensem, j, neighsurfarea, m_CrystalStructures[ensem], q1, q2);
-              }
-            }
-
-            OrientationMath::EulertoQuat(g1ea1, g1ea2, g1ea3, q1);
-            QuaternionMathF::Copy(q1, avgQuats[selectedfeature2]);
-            size = 0;
-            if(neighborlist[selectedfeature2].size() != 0) { size = neighborlist[selectedfeature2].size(); }
-            for (size_t j = 0; j < size; j++)
-            {
-              size_t neighbor = neighborlist[selectedfeature2][j];
-              ea1 = m_FeatureEulerAngles[3 * neighbor];
-              ea2 = m_FeatureEulerAngles[3 * neighbor + 1];
-              ea3 = m_FeatureEulerAngles[3 * neighbor + 2];
-              OrientationMath::EulertoQuat(ea1, ea2, ea3, q2);
-              float neighsurfarea = neighborsurfacearealist[selectedfeature2][j];
-              if(neighbor != selectedfeature1)
-              {
-                MC_LoopBody2(selectedfeature2, ensem, j, neighsurfarea, m_CrystalStructures[ensem], q1, q2);
-              }
-            }
+            float neighsurfarea = neighborsurfacearealist[feature][j];
+            MC_LoopBody2(feature, ensem, j, neighsurfarea, sym, avgQuats[feature], avgQuats[neighbor]);
           }
         }
       }
+      for (size_t b = 0; b < trial.mdfBins.size(); b++)
+      {
+        mdfStamps[trial.mdfBins[b]] = batch;
+      }
+    }
+
+    if(noFeatures == true)
+    {
+      badtrycount = 10 * m_NumFeatures[ensem];
     }
   }
   for (size_t i = 0; i < totalPoints; i++)
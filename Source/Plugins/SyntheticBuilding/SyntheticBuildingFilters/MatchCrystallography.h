@@ -40,6 +40,7 @@
 #include <QtCore/QString>
 #include <numeric>
 #include <limits>
+#include <vector>
 
 #include <boost/shared_array.hpp>
 
@@ -48,6 +49,7 @@
 #include "DREAM3DLib/DREAM3DLib.h"
 #include "DREAM3DLib/Common/DREAM3DSetGetMacros.h"
 #include "DREAM3DLib/Common/AbstractFilter.h"
+#include "DREAM3DLib/Common/DistributionSampler.hpp"
 #include "DREAM3DLib/DataArrays/IDataArray.h"
 #include "DREAM3DLib/DataArrays/StatsDataArray.h"
 #include "DREAM3DLib/DataArrays/NeighborList.hpp"
@@ -57,6 +59,8 @@
 
 #include "SyntheticBuilding/SyntheticBuildingConstants.h"
 
+class DREAM3DCounterRandom;
+
 /**
  * @class MatchCrystallography MatchCrystallography.h DREAM3DLib/SyntheticBuilderFilters/MatchCrystallography.h
  * @brief
@@ -109,6 +113,12 @@ class MatchCrystallography : public AbstractFilter
     DREAM3D_FILTER_PARAMETER(int, MaxIterations)
     Q_PROPERTY(int MaxIterations READ getMaxIterations WRITE setMaxIterations)
 
+    DREAM3D_FILTER_PARAMETER(bool, UseFixedSeed)
+    Q_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+
+    DREAM3D_FILTER_PARAMETER(int, Seed)
+    Q_PROPERTY(int Seed READ getSeed WRITE setSeed)
+
     virtual const QString getCompiledLibraryName();
     virtual AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters);
     virtual const QString getGroupName();
@@ -153,7 +163,9 @@ class MatchCrystallography : public AbstractFilter
     void determine_boundary_areas();
     void assign_eulers(int ensem);
     int pick_euler(float random, int numbins);
-    void MC_LoopBody1(int feature, int ensem, int j, float neighsurfarea, unsigned int sym, QuatF& q1, QuatF& q2);
+    void randomize_eulers(DREAM3DCounterRandom& rg, unsigned int sym, float& ea1, float& ea2, float& ea3);
+    size_t select_feature(DREAM3DCounterRandom& rg, int ensem, size_t exclude);
+    bool claim_neighborhoods(size_t feature1, size_t feature2, size_t stamp, std::vector<size_t>& featureStamps);
     void MC_LoopBody2(int feature, int phase, int j, float neighsurfarea, unsigned int sym, QuatF& q1, QuatF& q2);
     void matchCrystallography(int ensem);
     void measure_misorientations(int ensem);
@@ -161,11 +173,11 @@ class MatchCrystallography : public AbstractFilter
   private:
 
     // Cell Data
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, CellEulerAngles)
 
     // Feature Data
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, SurfaceFeatures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, SurfaceFeatures)
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, FeaturePhases)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, Volumes)
     DEFINE_CREATED_DATAARRAY_VARIABLE(float, FeatureEulerAngles)
@@ -175,18 +187,17 @@ class MatchCrystallography : public AbstractFilter
 
     //Ensemble Data
     DEFINE_REQUIRED_DATAARRAY_VARIABLE(unsigned int, CrystalStructures)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(uint32_t, PhaseTypes)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(int32_t, NumFeatures)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(uint32_t, PhaseTypes)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(int32_t, NumFeatures)
     StatsDataArray::WeakPointer m_StatsDataArray;
 
     // All other private instance variables
-    float mdfchange;
-    float odfchange;
-
+    uint64_t m_GlobalSeed;
     QVector<float> unbiasedvol;
     QVector<float> m_TotalSurfaceArea;
 
     FloatArrayType::Pointer actualodf;
+    DistributionSampler<float> m_OdfSampler;
     FloatArrayType::Pointer simodf;
     FloatArrayType::Pointer actualmdf;
     FloatArrayType::Pointer simmdf;
@@ -40,7 +40,7 @@
 
 #ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
 #include <tbb/parallel_for.h>
-#include <tbb/blocked_range3d.h>
+#include <tbb/blocked_range.h>
 #include <tbb/partitioner.h>
 #include <tbb/task_scheduler_init.h>
 #endif
@@ -49,6 +49,7 @@
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QDir>
+#include <QtCore/QDateTime>
 
 #include "DREAM3DLib/Common/Constants.h"
 #include "DREAM3DLib/DataArrays/NeighborList.hpp"
@@ -60,13 +61,22 @@
 #include "SyntheticBuilding/ShapeOps/CylinderOps.h"
 #include "SyntheticBuilding/ShapeOps/EllipsoidOps.h"
 #include "SyntheticBuilding/ShapeOps/SuperEllipsoidOps.h"
+#include "SyntheticBuilding/ShapeOps/FeatureRasterizer.h"
 #include "DREAM3DLib/CoreFilters/DataContainerWriter.h"
 #include "DREAM3DLib/Utilities/TimeUtilities.h"
-#include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+#include "DREAM3DLib/Utilities/DREAM3DCounterRandom.h"
 
 //// Macro to determine if we are going to show the Debugging Output files
 #define PPP_SHOW_DEBUG_OUTPUTS 0
 
+namespace
+{
+  // Streams of the counter based generator. Every generated Feature draws from its own stream after these.
+  const uint64_t k_PlacementStream = 0;
+  const uint64_t k_EstimateStream = 1;
+  const uint64_t k_FirstFeatureStream = 2;
+}
+
 #define NEW_SHARED_ARRAY(var, m_msgType, size)\
   boost::shared_array<m_msgType> var##Array(new m_msgType[size]);\
   m_msgType* var = var##Array.get();
@@ -81,156 +91,186 @@ typedef int64_t DimType;
 #endif
 
 /**
- * @brief
+ * @brief The AssignVoxelsImpl class assigns the voxels of a range of tiles of a FeatureRasterizer. A voxel goes
+ * to the feature with the largest shape function value; on ties the feature placed first keeps it.
  */
-class AssignVoxelsGapsImpl
+class AssignVoxelsImpl
 {
-    DimType dims[3];
-    float Invradcur[3];
-    float res[3];
-    int32_t* m_FeatureIds;
-    float xc;
-    float yc;
-    float zc;
-    ShapeOps* m_ShapeOps;
-    float ga[3][3];
-    int curFeature;
-    Int32ArrayType::Pointer newownersPtr;
-    FloatArrayType::Pointer ellipfuncsPtr;
-
   public:
-    AssignVoxelsGapsImpl(DimType* dimensions, float* resolution, int32_t* featureIds, float* radCur,
-                         float* xx, ShapeOps* shapeOps, float gA[3][3], float* size, int cur_feature,
-                         Int32ArrayType::Pointer newowners, FloatArrayType::Pointer ellipfuncs) :
-      m_FeatureIds(featureIds),
-      m_ShapeOps(shapeOps),
-      curFeature(cur_feature)
-    {
-      dims[0] = dimensions[0];
-      dims[1] = dimensions[1];
-      dims[2] = dimensions[2];
-      Invradcur[0] = 1.0 / radCur[0];
-      Invradcur[1] = 1.0 / radCur[1];
-      Invradcur[2] = 1.0 / radCur[2];
-
-      res[0] = resolution[0];
-      res[1] = resolution[1];
-      res[2] = resolution[2];
-
-      xc = xx[0];
-      yc = xx[1];
-      zc = xx[2];
-
-      ga[0][0] = gA[0][0];
-      ga[0][1] = gA[0][1];
-      ga[0][2] = gA[0][2];
-      ga[1][0] = gA[1][0];
-      ga[1][1] = gA[1][1];
-      ga[1][2] = gA[1][2];
-      ga[2][0] = gA[2][0];
-      ga[2][1] = gA[2][1];
-      ga[2][2] = gA[2][2];
-
-      newownersPtr = newowners;
-      ellipfuncsPtr = ellipfuncs;
-
-    }
-    virtual ~AssignVoxelsGapsImpl() {}
-
-    // -----------------------------------------------------------------------------
-    //
-    // -----------------------------------------------------------------------------
-    void convert(int zStart, int zEnd, int yStart, int yEnd, int xStart, int xEnd) const
-    {
-
-      int column = 0;
-      int row = 0;
-      int plane = 0;
-      int index = 0;
-      float gaCopy[3][3];
-      float gaT[3][3];
-      float coords[3] = {0.0f, 0.0f, 0.0f};
-      float inside = 0.0f;
-      //   float dist = 0.0f;
-      //   float radcur1squared = 1.0/(Invradcur[0]*Invradcur[0]);
-      float coordsRotated[3] = {0.0f, 0.0f, 0.0f};
-      int32_t* newowners = newownersPtr->getPointer(0);
-      float* ellipfuncs = ellipfuncsPtr->getPointer(0);
-
-      //making a copy because the transpose function used later can't deal with the const nature of ga
-      for(int i = 0; i < 3; i++)
+    AssignVoxelsImpl(const FeatureRasterizer& rasterizer, int32_t* newowners, float* ellipfuncs) :
+      m_Rasterizer(rasterizer),
+      m_NewOwners(newowners),
+      m_EllipFuncs(ellipfuncs)
+    {}
+    virtual ~AssignVoxelsImpl() {}
+
+    void convert(size_t start, size_t end) const
+    {
+      for (size_t tile = start; tile < end; tile++)
       {
-        for(int j = 0; j < 3; j++)
-        {
-          gaCopy[i][j] = ga[i][j];
-        }
+        m_Rasterizer.rasterizeTile(tile, *this);
       }
+    }
 
-      DimType dim0_dim_1 = dims[0] * dims[1];
-      for (DimType iter1 = xStart; iter1 < xEnd; iter1++)
+    void assign(int64_t feature, size_t index, float inside) const
+    {
+      if ((m_NewOwners[index] > 0 && inside > m_EllipFuncs[index]) || m_NewOwners[index] == -1)
       {
-        column = iter1;
-        if (iter1 < 0) { column = iter1 + dims[0]; }
-        else if (iter1 > dims[0] - 1) { column = iter1 - dims[0]; }
+        m_NewOwners[index] = static_cast<int32_t>(feature);
+        m_EllipFuncs[index] = inside;
+      }
+    }
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const FeatureRasterizer& m_Rasterizer;
+    int32_t* m_NewOwners;
+    float* m_EllipFuncs;
+};
+
+/**
+ * @brief The PackingTrialMove_t struct holds one proposed move of a batch of feature moves: the new centroid, the shift
+ * of the feature's point lists on the packing grid, the packing grid boxes covered before and after the move and the
+ * change in the (unnormalized) filling error the move would cause.
+ */
+typedef struct
+{
+  size_t feature;
+  float centroid[3];
+  int shift[3];
+  int oldBox[6];
+  int newBox[6];
+  int64_t fillingChange;
+} PackingTrialMove_t;
+
+/**
+ * @brief The FillingErrorChangeImpl class evaluates the filling error change of a range of trial moves against the
+ * current feature owners without modifying them. It mirrors check_fillingerror, which adds (owners - 1)^2 for every
+ * packing point, so the change of a move only depends on the owner counts of the points it vacates and covers.
+ */
+class FillingErrorChangeImpl
+{
+  public:
+    FillingErrorChangeImpl(const std::vector<std::vector<int> >& columnlist, const std::vector<std::vector<int> >& rowlist,
+                           const std::vector<std::vector<int> >& planelist, const int32_t* featureOwners, const int packingPoints[3],
+                           bool periodic, PackingTrialMove_t* moves) :
+      m_ColumnList(columnlist),
+      m_RowList(rowlist),
+      m_PlaneList(planelist),
+      m_FeatureOwners(featureOwners),
+      m_Periodic(periodic),
+      m_Moves(moves)
+    {
+      m_PackingPoints[0] = packingPoints[0];
+      m_PackingPoints[1] = packingPoints[1];
+      m_PackingPoints[2] = packingPoints[2];
+    }
+    virtual ~FillingErrorChangeImpl() {}
 
-        for (DimType iter2 = yStart; iter2 < yEnd; iter2++)
+    void convert(size_t start, size_t end) const
+    {
+      std::vector<std::pair<size_t, int> > cells;
+      size_t index = 0;
+      for (size_t i = start; i < end; i++)
+      {
+        PackingTrialMove_t& move = m_Moves[i];
+        const std::vector<int>& cl = m_ColumnList[move.feature];
+        const std::vector<int>& rl = m_RowList[move.feature];
+        const std::vector<int>& pl = m_PlaneList[move.feature];
+        cells.clear();
+        for (size_t j = 0; j < cl.size(); j++)
         {
-          row = iter2;
-          if (iter2 < 0) { row = iter2 + dims[1]; }
-          else if (iter2 > dims[1] - 1) { row = iter2 - dims[1]; }
-          size_t row_dim = row * dims[0];
+          if(packingIndex(cl[j], rl[j], pl[j], index) == true) { cells.push_back(std::make_pair(index, -1)); }
+          if(packingIndex(cl[j] + move.shift[0], rl[j] + move.shift[1], pl[j] + move.shift[2], index) == true) { cells.push_back(std::make_pair(index, 1)); }
+        }
+        std::sort(cells.begin(), cells.end());
 
-          for (DimType iter3 = zStart; iter3 < zEnd; iter3++)
+        int64_t change = 0;
+        size_t j = 0;
+        while (j < cells.size())
+        {
+          index = cells[j].first;
+          int64_t owners = m_FeatureOwners[index];
+          int64_t delta = 0;
+          for (; j < cells.size() && cells[j].first == index; j++)
           {
-            plane = iter3;
-            if (iter3 < 0) { plane = iter3 + dims[2]; }
-            else if (iter3 > dims[2] - 1) { plane = iter3 - dims[2]; }
-
-            index = static_cast<int>( (plane * dim0_dim_1) + (row_dim) + column );
-
-            inside = -1;
-            coords[0] = float(iter1) * res[0];
-            coords[1] = float(iter2) * res[1];
-            coords[2] = float(iter3) * res[2];
-
-            coords[0] = coords[0] - xc;
-            coords[1] = coords[1] - yc;
-            coords[2] = coords[2] - zc;
-            MatrixMath::Transpose3x3(gaCopy, gaT);
-            MatrixMath::Multiply3x3with3x1(gaT, coords, coordsRotated);
-            float axis1comp = coordsRotated[0] * Invradcur[0];
-            float axis2comp = coordsRotated[1] * Invradcur[1];
-            float axis3comp = coordsRotated[2] * Invradcur[2];
-            inside = m_ShapeOps->inside(axis1comp, axis2comp, axis3comp);
-            //if (inside >= 0 && newowners[index] > 0)
-            if (inside >= 0 && newowners[index] > 0 && inside > ellipfuncs[index])
-            {
-              newowners[index] = curFeature;
-              ellipfuncs[index] = inside;
-              //newowners[index] = -2;
-              //ellipfuncs[index] = inside;
-            }
-            else if (inside >= 0 && newowners[index] == -1)
-            {
-              newowners[index] = curFeature;
-              ellipfuncs[index] = inside;
-            }
+            delta += cells[j].second;
           }
+          change += (owners + delta - 1) * (owners + delta - 1) - (owners - 1) * (owners - 1);
         }
+        move.fillingChange = change;
       }
     }
 
 #ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
-    void operator()(const tbb::blocked_range3d<int, int, int>& r) const
+    void operator()(const tbb::blocked_range<size_t>& r) const
     {
-      convert(r.pages().begin(), r.pages().end(), r.rows().begin(), r.rows().end(), r.cols().begin(), r.cols().end());
+      convert(r.begin(), r.end());
     }
 #endif
 
   private:
-
+    const std::vector<std::vector<int> >& m_ColumnList;
+    const std::vector<std::vector<int> >& m_RowList;
+    const std::vector<std::vector<int> >& m_PlaneList;
+    const int32_t* m_FeatureOwners;
+    int m_PackingPoints[3];
+    bool m_Periodic;
+    PackingTrialMove_t* m_Moves;
+
+    // Same wrapping and clipping as check_fillingerror
+    bool packingIndex(int col, int row, int plane, size_t& index) const
+    {
+      if(m_Periodic == true)
+      {
+        if(col < 0) { col = col + m_PackingPoints[0]; }
+        if(col > m_PackingPoints[0] - 1) { col = col - m_PackingPoints[0]; }
+        if(row < 0) { row = row + m_PackingPoints[1]; }
+        if(row > m_PackingPoints[1] - 1) { row = row - m_PackingPoints[1]; }
+        if(plane < 0) { plane = plane + m_PackingPoints[2]; }
+        if(plane > m_PackingPoints[2] - 1) { plane = plane - m_PackingPoints[2]; }
+      }
+      else if(col < 0 || col >= m_PackingPoints[0] || row < 0 || row >= m_PackingPoints[1] || plane < 0 || plane >= m_PackingPoints[2])
+      {
+        return false;
+      }
+      index = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + col;
+      return true;
+    }
 };
 
+/**
+ * @brief packingBoxesOverlap Returns true if two boxes {minCol, maxCol, minRow, maxRow, minPlane, maxPlane} on the packing
+ * grid share a packing point, taking the wrap around of periodic boundaries into account.
+ */
+static bool packingBoxesOverlap(const int a[6], const int b[6], const int packingPoints[3], bool periodic)
+{
+  for (int d = 0; d < 3; d++)
+  {
+    int a0 = a[2 * d], a1 = a[2 * d + 1];
+    int b0 = b[2 * d], b1 = b[2 * d + 1];
+    if(periodic == false)
+    {
+      if(a1 < b0 || b1 < a0) { return false; }
+      continue;
+    }
+    int length = packingPoints[d];
+    if(a1 - a0 + 1 >= length || b1 - b0 + 1 >= length) { continue; }
+    // Shift b so that it starts inside [a0, a0 + length)
+    int offset = (b0 - a0) % length;
+    if(offset < 0) { offset = offset + length; }
+    int start = a0 + offset;
+    if(start > a1 && start + (b1 - b0) < a0 + length) { return false; }
+  }
+  return true;
+}
+
 
 // -----------------------------------------------------------------------------
 //
@@ -261,6 +301,9 @@ PackPrimaryPhases::PackPrimaryPhases() :
   m_CsvOutputFile(""),
   m_PeriodicBoundaries(false),
   m_WriteGoalAttributes(false),
+  m_BatchedTrialMoves(false),
+  m_UseFixedSeed(false),
+  m_Seed(0),
   m_ErrorOutputFile(""),
   m_VtkOutputFile(""),
   m_FeatureIds(NULL),
@@ -297,7 +340,8 @@ PackPrimaryPhases::PackPrimaryPhases() :
   m_HalfPackingRes[0] = m_HalfPackingRes[1] = m_HalfPackingRes[2] = 1.0f;
   m_OneOverHalfPackingRes[0] = m_OneOverHalfPackingRes[1] = m_OneOverHalfPackingRes[2] = 1.0f;
 
-  m_Seed = QDateTime::currentMSecsSinceEpoch();
+  m_GlobalSeed = 0;
+  m_FeatureStream = k_FirstFeatureStream;
   setupFilterParameters();
 }
 
@@ -317,6 +361,11 @@ void PackPrimaryPhases::setupFilterParameters()
   parameters.push_back(FilterParameter::New("Periodic Boundaries", "PeriodicBoundaries", FilterParameterWidgetType::BooleanWidget, getPeriodicBoundaries(), false));
   QStringList linkedProps("MaskArrayPath");
   parameters.push_back(LinkedBooleanFilterParameter::New("Use Mask", "UseMask", getUseMask(), linkedProps, false));
+  parameters.push_back(FilterParameter::New("Batched Trial Moves", "BatchedTrialMoves", FilterParameterWidgetType::BooleanWidget, getBatchedTrialMoves(), false));
+  linkedProps.clear();
+  linkedProps << "Seed";
+  parameters.push_back(LinkedBooleanFilterParameter::New("Use Fixed Random Seed", "UseFixedSeed", getUseFixedSeed(), linkedProps, false));
+  parameters.push_back(FilterParameter::New("Random Seed", "Seed", FilterParameterWidgetType::IntWidget, getSeed(), false, ""));
   parameters.push_back(FilterParameter::New("Required Information", "", FilterParameterWidgetType::SeparatorWidget, "", true));
   parameters.push_back(FilterParameter::New("Mask Array", "MaskArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getMaskArrayPath(), true));
   parameters.push_back(FilterParameter::New("Statistics Array", "InputStatsArrayPath", FilterParameterWidgetType::DataArraySelectionWidget, getInputStatsArrayPath(), true));
@@ -362,6 +411,9 @@ void PackPrimaryPhases::readFilterParameters(AbstractFilterParametersReader* rea
   setNumFeaturesArrayName( reader->readString("NumFeaturesArrayName", getNumFeaturesArrayName() ) );
   setPeriodicBoundaries( reader->readValue("PeriodicBoundaries", false) );
   setWriteGoalAttributes( reader->readValue("WriteGoalAttributes", false) );
+  setBatchedTrialMoves( reader->readValue("BatchedTrialMoves", getBatchedTrialMoves()) );
+  setUseFixedSeed( reader->readValue("UseFixedSeed", getUseFixedSeed()) );
+  setSeed( reader->readValue("Seed", getSeed()) );
   setUseMask( reader->readValue("UseMask", getUseMask()) );
   setHaveFeatures( reader->readValue("HaveFeatures", getHaveFeatures()) );
   setFeatureInputFile( reader->readString( "FeatureInputFile", getFeatureInputFile() ) );
@@ -392,6 +444,9 @@ int PackPrimaryPhases::writeFilterParameters(AbstractFilterParametersWriter* wri
   DREAM3D_FILTER_WRITE_PARAMETER(UseMask)
   DREAM3D_FILTER_WRITE_PARAMETER(HaveFeatures)
   DREAM3D_FILTER_WRITE_PARAMETER(WriteGoalAttributes)
+  DREAM3D_FILTER_WRITE_PARAMETER(BatchedTrialMoves)
+  DREAM3D_FILTER_WRITE_PARAMETER(UseFixedSeed)
+  DREAM3D_FILTER_WRITE_PARAMETER(Seed)
   DREAM3D_FILTER_WRITE_PARAMETER(FeatureInputFile)
   DREAM3D_FILTER_WRITE_PARAMETER(CsvOutputFile)
   DREAM3D_FILTER_WRITE_PARAMETER(InputStatsArrayPath)
@@ -463,7 +518,7 @@ void PackPrimaryPhases::dataCheck()
   {
     m_MaskPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getMaskArrayPath(), dims);
     if( NULL != m_MaskPtr.lock().get() ) /* Validate the Weak Pointer wraps a non-NULL pointer to a DataArray<T> object */
-    { m_Mask = m_MaskPtr.lock()->getPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
+    { m_Mask = m_MaskPtr.lock()->getConstPointer(0); } /* Now assign the raw pointer to data from the DataArray<T> object */
   }
 
   dims[0] = 1;
@@ -574,7 +629,6 @@ void PackPrimaryPhases::execute()
 {
   int err = 0;
   setErrorCondition(err);
-  DREAM3D_RANDOMNG_NEW()
   dataCheck();
   if(getErrorCondition() < 0) { return; }
 
@@ -765,8 +819,10 @@ void PackPrimaryPhases::place_features(Int32ArrayType::Pointer featureOwnersPtr)
 
   int err = 0;
   setErrorCondition(err);
-  m_Seed = QDateTime::currentMSecsSinceEpoch();
-  DREAM3D_RANDOMNG_NEW_SEEDED(m_Seed);
+  m_GlobalSeed = static_cast<uint64_t>(static_cast<uint32_t>(m_Seed));
+  if (m_UseFixedSeed == false) { m_GlobalSeed = DREAM3DCounterRandom::GenerateSeed(); }
+  m_FeatureStream = k_FirstFeatureStream;
+  DREAM3DCounterRandom rg(m_GlobalSeed, k_PlacementStream);
 
   VolumeDataContainer* m = getDataContainerArray()->getDataContainerAs<VolumeDataContainer>(getOutputCellAttributeMatrixName().getDataContainerName());
 
@@ -857,9 +913,12 @@ void PackPrimaryPhases::place_features(Int32ArrayType::Pointer featureOwnersPtr)
   Int32ArrayType::Pointer exclusionOwnersPtr = Int32ArrayType::CreateArray(featureOwnersPtr->getNumberOfTuples(), dim, "PackPrimaryFeatures::exclusions_owners");
   exclusionOwnersPtr->initializeWithValue(0);
 
-  //This is the set that we are going to keep updated with the points that are not in an exclusion zone
-  std::map<size_t, size_t> availablePoints;
-  std::map<size_t, size_t> availablePointsInv;
+  //This is the set that we are going to keep updated with the points that are not in an exclusion zone.
+  //availablePointsInv packs the available points into its first availablePointsCount entries and
+  //availablePoints holds the position of each point in that packed list, so points are added and
+  //removed in constant time by swapping with the last packed entry
+  std::vector<size_t> availablePoints;
+  std::vector<size_t> availablePointsInv;
 
   // Get a pointer to the Feature Owners that was just initialized in the initialize_packinggrid() method
   int32_t* featureOwners = featureOwnersPtr->getPointer(0);
@@ -931,9 +990,8 @@ void PackPrimaryPhases::place_features(Int32ArrayType::Pointer featureOwnersPtr)
     while (curphasevol[j] < (factor * curphasetotalvol))
     {
       iter++;
-      m_Seed++;
       phase = primaryphases[j];
-      generate_feature(phase, static_cast<int>(m_Seed), &feature, m_ShapeTypes[phase]);
+      generate_feature(phase, m_FeatureStream++, &feature, m_ShapeTypes[phase]);
       currentsizedisterror = check_sizedisterror(&feature);
       change = (currentsizedisterror) - (oldsizedisterror);
       if(change > 0 || currentsizedisterror > (1.0 - (float(iter) * 0.001)) || curphasevol[j] < (0.75 * factor * curphasetotalvol))
@@ -978,9 +1036,8 @@ void PackPrimaryPhases::place_features(Int32ArrayType::Pointer featureOwnersPtr)
       while (curphasevol[j] < ((1 + factor) * curphasetotalvol))
       {
         iter++;
-        m_Seed++;
         phase = primaryphases[j];
-        generate_feature(phase, static_cast<int>(m_Seed), &feature, m_ShapeTypes[phase]);
+        generate_feature(phase, m_FeatureStream++, &feature, m_ShapeTypes[phase]);
         currentsizedisterror = check_sizedisterror(&feature);
         change = (currentsizedisterror) - (oldsizedisterror);
         if(change > 0 || currentsizedisterror > (1.0 - (iter * 0.001)) || curphasevol[j] < (0.75 * factor * curphasetotalvol))
@@ -1181,6 +1238,8 @@ void PackPrimaryPhases::place_features(Int32ArrayType::Pointer featureOwnersPtr)
 
   //determine initial set of available points
   availablePointsCount = 0;
+  availablePoints.assign(m_TotalPackingPoints, 0);
+  availablePointsInv.assign(m_TotalPackingPoints, 0);
   for(int i = 0; i < m_TotalPackingPoints; i++)
   {
     if(exclusionOwners[i] == 0)
@@ -1200,7 +1259,232 @@ void PackPrimaryPhases::place_features(Int32ArrayType::Pointer featureOwnersPtr)
   size_t key;
   float xshift, yshift, zshift;
   int lastIteration = 0;
-  for (int iteration = 0; iteration < totalAdjustments; ++iteration)
+  if(m_BatchedTrialMoves == true)
+  {
+    move_features_batched(featureOwnersPtr, exclusionOwnersPtr, availablePoints, availablePointsInv, totalAdjustments, rg);
+    if(getErrorCondition() < 0) { return; }
+  }
+  else
+  {
+    for (int iteration = 0; iteration < totalAdjustments; ++iteration)
+    {
+      currentMillis = QDateTime::currentMSecsSinceEpoch();
+      if (currentMillis - millis > 5000)
+      {
+        QString ss = QObject::tr("Swapping/Moving/Adding/Removing Features Iteration %1/%2").arg(iteration).arg(totalAdjustments);
+        timeDiff = ((float)iteration / (float)(currentMillis - startMillis));
+        estimatedTime = (float)(totalAdjustments - iteration) / timeDiff;
+
+        ss = QObject::tr(" || Est. Time Remain: %1 || Iterations/Sec: %2").arg(DREAM3D::convertMillisToHrsMinSecs(estimatedTime)).arg(timeDiff * 1000);
+        notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
+
+        millis = QDateTime::currentMSecsSinceEpoch();
+        lastIteration = iteration;
+      }
+
+
+      if (getCancel() == true)
+      {
+        QString ss = QObject::tr("Filter Cancelled.");
+        notifyErrorMessage(getHumanLabel(), ss, -1);
+        setErrorCondition(-1);
+        return;
+      }
+
+      int option = iteration % 2;
+
+      if(writeErrorFile == true && iteration % 25 == 0)
+      {
+        outFile << iteration << " " << fillingerror << "  " << availablePointsCount << " " << totalFeatures << " " << acceptedmoves << "\n";
+      }
+
+      // JUMP - this option moves one feature to a random spot in the volume
+      if(option == 0)
+      {
+        randomfeature = firstPrimaryFeature + int(rg.genrand_res53() * (totalFeatures - firstPrimaryFeature));
+        good = false;
+        count = 0;
+        while(good == false && count < static_cast<int>((totalFeatures - firstPrimaryFeature)) )
+        {
+          xc = m_Centroids[3 * randomfeature];
+          yc = m_Centroids[3 * randomfeature + 1];
+          zc = m_Centroids[3 * randomfeature + 2];
+          column = static_cast<int>( (xc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0] );
+          row = static_cast<int>( (yc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1] );
+          plane = static_cast<int>( (zc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2] );
+          featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + column;
+          if(featureOwners[featureOwnersIdx] > 1) { good = true; }
+          else { randomfeature++; }
+          if(static_cast<size_t>(randomfeature) >= totalFeatures) { randomfeature = firstPrimaryFeature; }
+          count++;
+        }
+
+        if(availablePointsCount > 0)
+        {
+          key = static_cast<size_t>(rg.genrand_res53() * (availablePointsCount - 1));
+          featureOwnersIdx = availablePointsInv[key];
+        }
+        else
+        {
+          featureOwnersIdx = static_cast<size_t>(rg.genrand_res53() * m_TotalPackingPoints);
+        }
+
+        //find the column row and plane of that point
+        column = featureOwnersIdx % m_PackingPoints[0];
+        row = int(featureOwnersIdx / m_PackingPoints[0]) % m_PackingPoints[1];
+        plane = featureOwnersIdx / (m_PackingPoints[0] * m_PackingPoints[1]);
+        xc = static_cast<float>((column * m_PackingRes[0]) + (m_PackingRes[0] * 0.5));
+        yc = static_cast<float>((row * m_PackingRes[1]) + (m_PackingRes[1] * 0.5));
+        zc = static_cast<float>((plane * m_PackingRes[2]) + (m_PackingRes[2] * 0.5));
+        oldxc = m_Centroids[3 * randomfeature];
+        oldyc = m_Centroids[3 * randomfeature + 1];
+        oldzc = m_Centroids[3 * randomfeature + 2];
+        oldfillingerror = fillingerror;
+        fillingerror = check_fillingerror(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
+        move_feature(randomfeature, xc, yc, zc);
+        fillingerror = check_fillingerror(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
+        currentneighborhooderror = check_neighborhooderror(-1000, randomfeature);
+        if(fillingerror <= oldfillingerror)
+        {
+          oldneighborhooderror = currentneighborhooderror;
+          update_availablepoints(availablePoints, availablePointsInv);
+          acceptedmoves++;
+        }
+        else if(fillingerror > oldfillingerror)
+        {
+          fillingerror = check_fillingerror(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
+          move_feature(randomfeature, oldxc, oldyc, oldzc);
+          fillingerror = check_fillingerror(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
+          pointsToRemove.clear();
+          pointsToAdd.clear();
+        }
+      }
+      // NUDGE - this option moves one feature to a spot close to its current centroid
+      if(option == 1)
+      {
+        randomfeature = firstPrimaryFeature + int(rg.genrand_res53() * (totalFeatures - firstPrimaryFeature));
+        good = false;
+        count = 0;
+        while(good == false && count < static_cast<int>((totalFeatures - firstPrimaryFeature)) )
+        {
+          xc = m_Centroids[3 * randomfeature];
+          yc = m_Centroids[3 * randomfeature + 1];
+          zc = m_Centroids[3 * randomfeature + 2];
+          column = static_cast<int>( (xc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0] );
+          row = static_cast<int>( (yc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1] );
+          plane = static_cast<int>( (zc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2] );
+          featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + column;
+          if(featureOwners[featureOwnersIdx] > 1) { good = true; }
+          else { randomfeature++; }
+          if(static_cast<size_t>(randomfeature) >= totalFeatures) { randomfeature = firstPrimaryFeature; }
+          count++;
+        }
+        oldxc = m_Centroids[3 * randomfeature];
+        oldyc = m_Centroids[3 * randomfeature + 1];
+        oldzc = m_Centroids[3 * randomfeature + 2];
+        xshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[0])) );
+        yshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[1])) );
+        zshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[2])) );
+        if((oldxc + xshift) < sizex && (oldxc + xshift) > 0) { xc = oldxc + xshift; }
+        else { xc = oldxc; }
+        if((oldyc + yshift) < sizey && (oldyc + yshift) > 0) { yc = oldyc + yshift; }
+        else { yc = oldyc; }
+        if((oldzc + zshift) < sizez && (oldzc + zshift) > 0) { zc = oldzc + zshift; }
+        else { zc = oldzc; }
+        oldfillingerror = fillingerror;
+        fillingerror = check_fillingerror(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
+        move_feature(randomfeature, xc, yc, zc);
+        fillingerror = check_fillingerror(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
+        currentneighborhooderror = check_neighborhooderror(-1000, randomfeature);
+        //      change2 = (currentneighborhooderror * currentneighborhooderror) - (oldneighborhooderror * oldneighborhooderror);
+        //      if(fillingerror <= oldfillingerror && currentneighborhooderror >= oldneighborhooderror)
+        if(fillingerror <= oldfillingerror)
+        {
+          oldneighborhooderror = currentneighborhooderror;
+          update_availablepoints(availablePoints, availablePointsInv);
+          acceptedmoves++;
+        }
+        //      else if(fillingerror > oldfillingerror || currentneighborhooderror < oldneighborhooderror)
+        else if(fillingerror > oldfillingerror)
+        {
+          fillingerror = check_fillingerror(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
+          move_feature(randomfeature, oldxc, oldyc, oldzc);
+          fillingerror = check_fillingerror(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
+          pointsToRemove.clear();
+          pointsToAdd.clear();
+        }
+      }
+    }
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Packing Features - Feature Adjustment Complete");
+
+  if(m_VtkOutputFile.isEmpty() == false)
+  {
+    err = writeVtkFile(featureOwnersPtr->getPointer(0), exclusionOwnersPtr->getPointer(0));
+    if(err < 0)
+    {
+      return;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PackPrimaryPhases::move_features_batched(Int32ArrayType::Pointer featureOwnersPtr, Int32ArrayType::Pointer exclusionOwnersPtr,
+                                              std::vector<size_t>& availablePoints, std::vector<size_t>& availablePointsInv,
+                                              int totalAdjustments, DREAM3DCounterRandom& rg)
+{
+  int32_t* featureOwners = featureOwnersPtr->getPointer(0);
+  size_t totalFeatures = m_FeaturePhasesPtr.lock()->getNumberOfTuples();
+  const size_t batchSize = 64;
+
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  // The point lists only ever get shifted, so the extent of every feature around its centroid packing point is fixed
+  std::vector<int> extents(6 * totalFeatures, 0);
+  for (size_t i = firstPrimaryFeature; i < totalFeatures; i++)
+  {
+    int center[3] =
+    {
+      static_cast<int>( (m_Centroids[3 * i] - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0] ),
+      static_cast<int>( (m_Centroids[3 * i + 1] - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1] ),
+      static_cast<int>( (m_Centroids[3 * i + 2] - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2] )
+    };
+    std::vector<int>* lists[3] = { &columnlist[i], &rowlist[i], &planelist[i] };
+    for (int d = 0; d < 3; d++)
+    {
+      std::vector<int>& list = *(lists[d]);
+      for (size_t j = 0; j < list.size(); j++)
+      {
+        if(j == 0 || list[j] - center[d] < extents[6 * i + 2 * d]) { extents[6 * i + 2 * d] = list[j] - center[d]; }
+        if(j == 0 || list[j] - center[d] > extents[6 * i + 2 * d + 1]) { extents[6 * i + 2 * d + 1] = list[j] - center[d]; }
+      }
+    }
+  }
+
+  std::vector<PackingTrialMove_t> moves;
+  moves.reserve(batchSize);
+  PackingTrialMove_t move;
+  size_t key = 0, featureOwnersIdx = 0;
+  int randomfeature = 0, count = 0, proposal = 0;
+  int column = 0, row = 0, plane = 0;
+  int oldCenter[3], newCenter[3];
+  float xc = 0.0f, yc = 0.0f, zc = 0.0f;
+  float oldxc = 0.0f, oldyc = 0.0f, oldzc = 0.0f;
+  float xshift = 0.0f, yshift = 0.0f, zshift = 0.0f;
+  bool good = false;
+
+  uint64_t millis = QDateTime::currentMSecsSinceEpoch();
+  uint64_t currentMillis = millis;
+  uint64_t startMillis = millis;
+  float timeDiff = 0.0f, estimatedTime = 0.0f;
+  int iteration = 0;
+  while (iteration < totalAdjustments)
   {
     currentMillis = QDateTime::currentMSecsSinceEpoch();
     if (currentMillis - millis > 5000)
@@ -1213,10 +1497,8 @@ void PackPrimaryPhases::place_features(Int32ArrayType::Pointer featureOwnersPtr)
       notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
 
       millis = QDateTime::currentMSecsSinceEpoch();
-      lastIteration = iteration;
     }
 
-
     if (getCancel() == true)
     {
       QString ss = QObject::tr("Filter Cancelled.");
@@ -1225,16 +1507,15 @@ void PackPrimaryPhases::place_features(Int32ArrayType::Pointer featureOwnersPtr)
       return;
     }
 
-    int option = iteration % 2;
-
-    if(writeErrorFile == true && iteration % 25 == 0)
+    // Propose a batch of JUMP and NUDGE moves serially, so that the random sequence only depends on the seed. Moves
+    // whose old or new boxes overlap a move already in the batch are dropped, which keeps the batch independent.
+    moves.clear();
+    size_t maxProposals = 2 * batchSize;
+    for (size_t attempt = 0; attempt < maxProposals && moves.size() < batchSize && iteration + static_cast<int>(moves.size()) < totalAdjustments; attempt++)
     {
-      outFile << iteration << " " << fillingerror << "  " << availablePoints.size() << "  " << availablePointsCount << " " << totalFeatures << " " << acceptedmoves << "\n";
-    }
+      int option = proposal % 2;
+      proposal++;
 
-    // JUMP - this option moves one feature to a random spot in the volume
-    if(option == 0)
-    {
       randomfeature = firstPrimaryFeature + int(rg.genrand_res53() * (totalFeatures - firstPrimaryFeature));
       good = false;
       count = 0;
@@ -1252,115 +1533,109 @@ void PackPrimaryPhases::place_features(Int32ArrayType::Pointer featureOwnersPtr)
         if(static_cast<size_t>(randomfeature) >= totalFeatures) { randomfeature = firstPrimaryFeature; }
         count++;
       }
-      m_Seed++;
-
-      if(availablePoints.size() > 0)
-      {
-        key = static_cast<size_t>(rg.genrand_res53() * (availablePointsCount - 1));
-        featureOwnersIdx = availablePointsInv[key];
-      }
-      else
-      {
-        featureOwnersIdx = static_cast<size_t>(rg.genrand_res53() * m_TotalPackingPoints);
-      }
 
-      //find the column row and plane of that point
-      column = featureOwnersIdx % m_PackingPoints[0];
-      row = int(featureOwnersIdx / m_PackingPoints[0]) % m_PackingPoints[1];
-      plane = featureOwnersIdx / (m_PackingPoints[0] * m_PackingPoints[1]);
-      xc = static_cast<float>((column * m_PackingRes[0]) + (m_PackingRes[0] * 0.5));
-      yc = static_cast<float>((row * m_PackingRes[1]) + (m_PackingRes[1] * 0.5));
-      zc = static_cast<float>((plane * m_PackingRes[2]) + (m_PackingRes[2] * 0.5));
       oldxc = m_Centroids[3 * randomfeature];
       oldyc = m_Centroids[3 * randomfeature + 1];
       oldzc = m_Centroids[3 * randomfeature + 2];
-      oldfillingerror = fillingerror;
-      fillingerror = check_fillingerror(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
-      move_feature(randomfeature, xc, yc, zc);
-      fillingerror = check_fillingerror(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-      currentneighborhooderror = check_neighborhooderror(-1000, randomfeature);
-      if(fillingerror <= oldfillingerror)
+      // JUMP - this option moves one feature to a random spot in the volume
+      if(option == 0)
       {
-        oldneighborhooderror = currentneighborhooderror;
-        update_availablepoints(availablePoints, availablePointsInv);
-        acceptedmoves++;
-      }
-      else if(fillingerror > oldfillingerror)
-      {
-        fillingerror = check_fillingerror(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
-        move_feature(randomfeature, oldxc, oldyc, oldzc);
-        fillingerror = check_fillingerror(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-        pointsToRemove.clear();
-        pointsToAdd.clear();
+        if(availablePointsCount > 0)
+        {
+          key = static_cast<size_t>(rg.genrand_res53() * (availablePointsCount - 1));
+          featureOwnersIdx = availablePointsInv[key];
+        }
+        else
+        {
+          featureOwnersIdx = static_cast<size_t>(rg.genrand_res53() * m_TotalPackingPoints);
+        }
+        column = featureOwnersIdx % m_PackingPoints[0];
+        row = int(featureOwnersIdx / m_PackingPoints[0]) % m_PackingPoints[1];
+        plane = featureOwnersIdx / (m_PackingPoints[0] * m_PackingPoints[1]);
+        xc = static_cast<float>((column * m_PackingRes[0]) + (m_PackingRes[0] * 0.5));
+        yc = static_cast<float>((row * m_PackingRes[1]) + (m_PackingRes[1] * 0.5));
+        zc = static_cast<float>((plane * m_PackingRes[2]) + (m_PackingRes[2] * 0.5));
       }
-    }
-    // NUDGE - this option moves one feature to a spot close to its current centroid
-    if(option == 1)
-    {
-      randomfeature = firstPrimaryFeature + int(rg.genrand_res53() * (totalFeatures - firstPrimaryFeature));
-      good = false;
-      count = 0;
-      while(good == false && count < static_cast<int>((totalFeatures - firstPrimaryFeature)) )
+      // NUDGE - this option moves one feature to a spot close to its current centroid
+      else
       {
-        xc = m_Centroids[3 * randomfeature];
-        yc = m_Centroids[3 * randomfeature + 1];
-        zc = m_Centroids[3 * randomfeature + 2];
-        column = static_cast<int>( (xc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0] );
-        row = static_cast<int>( (yc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1] );
-        plane = static_cast<int>( (zc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2] );
-        featureOwnersIdx = (m_PackingPoints[0] * m_PackingPoints[1] * plane) + (m_PackingPoints[0] * row) + column;
-        if(featureOwners[featureOwnersIdx] > 1) { good = true; }
-        else { randomfeature++; }
-        if(static_cast<size_t>(randomfeature) >= totalFeatures) { randomfeature = firstPrimaryFeature; }
-        count++;
+        xshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[0])) );
+        yshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[1])) );
+        zshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[2])) );
+        if((oldxc + xshift) < sizex && (oldxc + xshift) > 0) { xc = oldxc + xshift; }
+        else { xc = oldxc; }
+        if((oldyc + yshift) < sizey && (oldyc + yshift) > 0) { yc = oldyc + yshift; }
+        else { yc = oldyc; }
+        if((oldzc + zshift) < sizez && (oldzc + zshift) > 0) { zc = oldzc + zshift; }
+        else { zc = oldzc; }
       }
-      m_Seed++;
-      oldxc = m_Centroids[3 * randomfeature];
-      oldyc = m_Centroids[3 * randomfeature + 1];
-      oldzc = m_Centroids[3 * randomfeature + 2];
-      xshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[0])) );
-      yshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[1])) );
-      zshift = static_cast<float>(((2.0f * (rg.genrand_res53() - 0.5f)) * (2.0f * m_PackingRes[2])) );
-      if((oldxc + xshift) < sizex && (oldxc + xshift) > 0) { xc = oldxc + xshift; }
-      else { xc = oldxc; }
-      if((oldyc + yshift) < sizey && (oldyc + yshift) > 0) { yc = oldyc + yshift; }
-      else { yc = oldyc; }
-      if((oldzc + zshift) < sizez && (oldzc + zshift) > 0) { zc = oldzc + zshift; }
-      else { zc = oldzc; }
-      oldfillingerror = fillingerror;
-      fillingerror = check_fillingerror(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
-      move_feature(randomfeature, xc, yc, zc);
-      fillingerror = check_fillingerror(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-      currentneighborhooderror = check_neighborhooderror(-1000, randomfeature);
-      //      change2 = (currentneighborhooderror * currentneighborhooderror) - (oldneighborhooderror * oldneighborhooderror);
-      //      if(fillingerror <= oldfillingerror && currentneighborhooderror >= oldneighborhooderror)
-      if(fillingerror <= oldfillingerror)
+
+      oldCenter[0] = static_cast<int>( (oldxc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0] );
+      oldCenter[1] = static_cast<int>( (oldyc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1] );
+      oldCenter[2] = static_cast<int>( (oldzc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2] );
+      newCenter[0] = static_cast<int>( (xc - (m_HalfPackingRes[0])) * m_OneOverPackingRes[0] );
+      newCenter[1] = static_cast<int>( (yc - (m_HalfPackingRes[1])) * m_OneOverPackingRes[1] );
+      newCenter[2] = static_cast<int>( (zc - (m_HalfPackingRes[2])) * m_OneOverPackingRes[2] );
+      move.feature = randomfeature;
+      move.centroid[0] = xc;
+      move.centroid[1] = yc;
+      move.centroid[2] = zc;
+      for (int d = 0; d < 3; d++)
       {
-        oldneighborhooderror = currentneighborhooderror;
-        update_availablepoints(availablePoints, availablePointsInv);
-        acceptedmoves++;
+        move.shift[d] = newCenter[d] - oldCenter[d];
+        move.oldBox[2 * d] = oldCenter[d] + extents[6 * randomfeature + 2 * d];
+        move.oldBox[2 * d + 1] = oldCenter[d] + extents[6 * randomfeature + 2 * d + 1];
+        move.newBox[2 * d] = newCenter[d] + extents[6 * randomfeature + 2 * d];
+        move.newBox[2 * d + 1] = newCenter[d] + extents[6 * randomfeature + 2 * d + 1];
       }
-      //      else if(fillingerror > oldfillingerror || currentneighborhooderror < oldneighborhooderror)
-      else if(fillingerror > oldfillingerror)
+      move.fillingChange = 0;
+
+      good = true;
+      for (size_t i = 0; i < moves.size() && good == true; i++)
       {
-        fillingerror = check_fillingerror(-1000, static_cast<int>(randomfeature), featureOwnersPtr, exclusionOwnersPtr);
-        move_feature(randomfeature, oldxc, oldyc, oldzc);
-        fillingerror = check_fillingerror(static_cast<int>(randomfeature), -1000, featureOwnersPtr, exclusionOwnersPtr);
-        pointsToRemove.clear();
-        pointsToAdd.clear();
+        if(packingBoxesOverlap(move.oldBox, moves[i].oldBox, m_PackingPoints, m_PeriodicBoundaries) == true
+            || packingBoxesOverlap(move.oldBox, moves[i].newBox, m_PackingPoints, m_PeriodicBoundaries) == true
+            || packingBoxesOverlap(move.newBox, moves[i].oldBox, m_PackingPoints, m_PeriodicBoundaries) == true
+            || packingBoxesOverlap(move.newBox, moves[i].newBox, m_PackingPoints, m_PeriodicBoundaries) == true)
+        {
+          good = false;
+        }
       }
+      if(good == true) { moves.push_back(move); }
     }
-  }
 
-  notifyStatusMessage(getHumanLabel(), "Packing Features - Feature Adjustment Complete");
+    // Evaluate the whole batch against the current packing
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+    if (doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, moves.size()), FillingErrorChangeImpl(columnlist, rowlist, planelist, featureOwners, m_PackingPoints, m_PeriodicBoundaries, &(moves.front())), tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      FillingErrorChangeImpl serial(columnlist, rowlist, planelist, featureOwners, m_PackingPoints, m_PeriodicBoundaries, &(moves.front()));
+      serial.convert(0, moves.size());
+    }
 
-  if(m_VtkOutputFile.isEmpty() == false)
-  {
-    err = writeVtkFile(featureOwnersPtr->getPointer(0), exclusionOwnersPtr->getPointer(0));
-    if(err < 0)
+    // Commit the accepted moves in proposal order. They cover disjoint parts of the packing grid, so applying one
+    // does not change the filling error change of another.
+    bool accepted = false;
+    for (size_t i = 0; i < moves.size(); i++)
     {
-      return;
+      if(moves[i].fillingChange > 0) { continue; }
+      randomfeature = static_cast<int>(moves[i].feature);
+      fillingerror = check_fillingerror(-1000, randomfeature, featureOwnersPtr, exclusionOwnersPtr);
+      move_feature(moves[i].feature, moves[i].centroid[0], moves[i].centroid[1], moves[i].centroid[2]);
+      fillingerror = check_fillingerror(randomfeature, -1000, featureOwnersPtr, exclusionOwnersPtr);
+      update_availablepoints(availablePoints, availablePointsInv);
+      acceptedmoves++;
+      accepted = true;
     }
+    if(accepted == true)
+    {
+      oldneighborhooderror = check_neighborhooderror(-1000, -1000);
+    }
+    iteration = iteration + static_cast<int>(moves.size());
   }
 }
 
@@ -1402,9 +1677,9 @@ Int32ArrayType::Pointer PackPrimaryPhases::initialize_packinggrid()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void PackPrimaryPhases::generate_feature(int phase, int Seed, Feature* feature, unsigned int shapeclass)
+void PackPrimaryPhases::generate_feature(int phase, uint64_t stream, Feature* feature, unsigned int shapeclass)
 {
-  DREAM3D_RANDOMNG_NEW_SEEDED(Seed)
+  DREAM3DCounterRandom rg(m_GlobalSeed, stream);
 
   StatsDataArray& statsDataArray = *(m_StatsDataArray.lock().get());
 
@@ -1967,7 +2242,7 @@ float PackPrimaryPhases::check_fillingerror(int gadd, int gremove, Int32ArrayTyp
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void PackPrimaryPhases::update_availablepoints(std::map<size_t, size_t>& availablePoints, std::map<size_t, size_t>& availablePointsInv)
+void PackPrimaryPhases::update_availablepoints(std::vector<size_t>& availablePoints, std::vector<size_t>& availablePointsInv)
 {
   size_t removeSize = pointsToRemove.size();
   size_t addSize = pointsToAdd.size();
@@ -2003,8 +2278,6 @@ void PackPrimaryPhases::update_availablepoints(std::map<size_t, size_t>& availab
 // -----------------------------------------------------------------------------
 void PackPrimaryPhases::insert_feature(size_t gnum)
 {
-  DREAM3D_RANDOMNG_NEW();
-
   float inside = -1;
   int column, row, plane;
   int centercolumn, centerrow, centerplane;
@@ -2126,7 +2399,6 @@ void PackPrimaryPhases::assign_voxels()
 
   DimType column, row, plane;
   float xc, yc, zc;
-  float size[3] = {sizex, sizey, sizez};
 
   DimType xmin, xmax, ymin, ymax, zmin, zmax;
 
@@ -2143,6 +2415,9 @@ void PackPrimaryPhases::assign_voxels()
   ellipfuncsPtr->initializeWithValue(-1);
   float* ellipfuncs = ellipfuncsPtr->getPointer(0);
 
+  // The shape and bounding box of every feature are collected first; the voxels are then filled tile by tile
+  FeatureRasterizer rasterizer(udims, res);
+
   float featuresPerTime = 0;
   uint64_t millis = QDateTime::currentMSecsSinceEpoch();
   uint64_t currentMillis = millis;
@@ -2224,23 +2499,24 @@ void PackPrimaryPhases::assign_voxels()
 
     float radCur[3] = { radcur1, radcur2, radcur3 };
     float xx[3] = {xc, yc, zc };
+    int64_t bboxMin[3] = { xmin, ymin, zmin };
+    int64_t bboxMax[3] = { xmax, ymax, zmax };
     ShapeOps* shapeOps = m_ShapeOps[shapeclass];
-    //#if 0
-#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
-    if (doParallel == true)
-    {
-      tbb::parallel_for(tbb::blocked_range3d<int, int, int>(zmin, zmax + 1, ymin, ymax + 1, xmin, xmax + 1),
-                        AssignVoxelsGapsImpl(dims, res, m_FeatureIds, radCur, xx, shapeOps, ga, size, i, newownersPtr, ellipfuncsPtr), tbb::auto_partitioner());
+    rasterizer.addFeature(i, xx, radCur, ga, bboxMin, bboxMax, shapeOps, shapeOps->getShapeParameter());
+  }
 
-    }
-    else
+  rasterizer.binFeatures();
+  size_t numTiles = rasterizer.getNumberOfTiles();
+#ifdef DREAM3D_USE_PARALLEL_ALGORITHMS
+  if (doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numTiles), AssignVoxelsImpl(rasterizer, newowners, ellipfuncs), tbb::auto_partitioner());
+  }
+  else
 #endif
-    {
-      AssignVoxelsGapsImpl serial(dims, res, m_FeatureIds, radCur, xx, shapeOps, ga, size, i, newownersPtr, ellipfuncsPtr);
-      serial.convert(zmin, zmax + 1, ymin, ymax + 1, xmin, xmax + 1);
-    }
-
-
+  {
+    AssignVoxelsImpl serial(rasterizer, newowners, ellipfuncs);
+    serial.convert(0, numTiles);
   }
 
   QVector<bool> activeObjects(totalFeatures, false);
@@ -2631,7 +2907,7 @@ int PackPrimaryPhases::estimate_numfeatures(int xpoints, int ypoints, int zpoint
   // Create a Reference Variable so we can use the [] syntax
   StatsDataArray& statsDataArray = *(m_StatsDataArray.lock().get());
 
-  DREAM3D_RANDOMNG_NEW()
+  DREAM3DCounterRandom rg(m_GlobalSeed, k_EstimateStream);
 
   QVector<int> primaryPhasesLocal;
   QVector<double> primaryPhaseFractionsLocal;
@@ -53,6 +53,9 @@
 #include "SyntheticBuilding/ShapeOps/ShapeOps.h"
 #include "OrientationLib/OrientationOps/OrthoRhombicOps.h"
 #include "SyntheticBuilding/SyntheticBuildingConstants.h"
+
+class DREAM3DCounterRandom;
+
 typedef struct
 {
   float m_Volumes;
@@ -155,6 +158,15 @@ class PackPrimaryPhases : public AbstractFilter
     DREAM3D_FILTER_PARAMETER(bool, WriteGoalAttributes)
     Q_PROPERTY(bool WriteGoalAttributes READ getWriteGoalAttributes WRITE setWriteGoalAttributes)
 
+    DREAM3D_FILTER_PARAMETER(bool, BatchedTrialMoves)
+    Q_PROPERTY(bool BatchedTrialMoves READ getBatchedTrialMoves WRITE setBatchedTrialMoves)
+
+    DREAM3D_FILTER_PARAMETER(bool, UseFixedSeed)
+    Q_PROPERTY(bool UseFixedSeed READ getUseFixedSeed WRITE setUseFixedSeed)
+
+    DREAM3D_FILTER_PARAMETER(int, Seed)
+    Q_PROPERTY(int Seed READ getSeed WRITE setSeed)
+
     // THESE SHOULD GO AWAY THEY ARE FOR DEBUGGING ONLY
     DREAM3D_FILTER_PARAMETER(QString, ErrorOutputFile)
     Q_PROPERTY(QString ErrorOutputFile READ getErrorOutputFile WRITE setErrorOutputFile)
@@ -202,7 +214,7 @@ class PackPrimaryPhases : public AbstractFilter
     Int32ArrayType::Pointer initialize_packinggrid();
 
     void place_features(Int32ArrayType::Pointer featureOwnersPtr);
-    void generate_feature(int phase, int Seed, Feature* feature, unsigned int shapeclass);
+    void generate_feature(int phase, uint64_t stream, Feature* feature, unsigned int shapeclass);
     void load_features();
 
 
@@ -211,12 +223,21 @@ class PackPrimaryPhases : public AbstractFilter
 
     void move_feature(size_t featureNum, float xc, float yc, float zc);
 
+    /**
+     * @brief move_features_batched Runs the feature adjustment loop in batches of moves on features whose packing
+     * boxes do not overlap. The filling error change of every move in a batch is evaluated in parallel and the
+     * improving moves are then applied in proposal order, so the result only depends on the seed.
+     */
+    void move_features_batched(Int32ArrayType::Pointer featureOwnersPtr, Int32ArrayType::Pointer exclusionOwnersPtr,
+                               std::vector<size_t>& availablePoints, std::vector<size_t>& availablePointsInv,
+                               int totalAdjustments, DREAM3DCounterRandom& rg);
+
     float check_sizedisterror(Feature* feature);
     void determine_neighbors(size_t featureNum, int add);
     float check_neighborhooderror(int gadd, int gremove);
 
     float check_fillingerror(int gadd, int gremove, Int32ArrayType::Pointer featureOwnersPtr, Int32ArrayType::Pointer exclusionOwnersPtr);
-    void update_availablepoints(std::map<size_t, size_t>& availablePoints, std::map<size_t, size_t>& availablePointsInv);
+    void update_availablepoints(std::vector<size_t>& availablePoints, std::vector<size_t>& availablePointsInv);
     void assign_voxels();
     void assign_gaps_only();
     void cleanup_features();
@@ -236,7 +257,7 @@ class PackPrimaryPhases : public AbstractFilter
     // Cell Data - make sure these are all initialized to NULL in the constructor
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, CellPhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, Mask)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, Mask)
     int8_t*  m_BoundaryCells;
 
     // Feature Data - make sure these are all initialized to NULL in the constructor
@@ -273,7 +294,8 @@ class PackPrimaryPhases : public AbstractFilter
     std::vector<size_t> pointsToAdd;
     std::vector<size_t> pointsToRemove;
 
-    unsigned long long int m_Seed;
+    uint64_t m_GlobalSeed;
+    uint64_t m_FeatureStream; // Stream of the next Feature made by generate_feature()
 
     int firstPrimaryFeature;
 
@@ -175,7 +175,7 @@ class TesselateFarFieldGrains : public AbstractFilter
     // Cell Data - make sure these are all initialized to NULL in the constructor
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, FeatureIds)
     DEFINE_CREATED_DATAARRAY_VARIABLE(int32_t, CellPhases)
-    DEFINE_REQUIRED_DATAARRAY_VARIABLE(bool, Mask)
+    DEFINE_REQUIRED_CONST_DATAARRAY_VARIABLE(bool, Mask)
     int8_t*  m_BoundaryCells;
 
     // Feature Data - make sure these are all initialized to NULL in the constructor
@@ -0,0 +1,177 @@
+/* ============================================================================
+ * Copyright (c) 2014, Michael A. Jackson (BlueQuartz Software)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Jackson nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <vector>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Utilities/DREAM3DCounterRandom.h"
+
+#include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
+
+// -----------------------------------------------------------------------------
+// Known answers from the Random123 reference implementation of philox4x32_10
+// -----------------------------------------------------------------------------
+void TestPhiloxKnownAnswers()
+{
+  uint32_t output[4];
+  {
+    uint32_t counter[4] = { 0, 0, 0, 0 };
+    uint32_t key[2] = { 0, 0 };
+    DREAM3DCounterRandom::Philox4x32(counter, key, output);
+    DREAM3D_REQUIRE_EQUAL(output[0], 0x6627e8d5U)
+    DREAM3D_REQUIRE_EQUAL(output[1], 0xe169c58dU)
+    DREAM3D_REQUIRE_EQUAL(output[2], 0xbc57ac4cU)
+    DREAM3D_REQUIRE_EQUAL(output[3], 0x9b00dbd8U)
+  }
+  {
+    uint32_t counter[4] = { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff };
+    uint32_t key[2] = { 0xffffffff, 0xffffffff };
+    DREAM3DCounterRandom::Philox4x32(counter, key, output);
+    DREAM3D_REQUIRE_EQUAL(output[0], 0x408f276dU)
+    DREAM3D_REQUIRE_EQUAL(output[1], 0x41c83b0eU)
+    DREAM3D_REQUIRE_EQUAL(output[2], 0xa20bc7c6U)
+    DREAM3D_REQUIRE_EQUAL(output[3], 0x6d5451fdU)
+  }
+  {
+    uint32_t counter[4] = { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 };
+    uint32_t key[2] = { 0xa4093822, 0x299f31d0 };
+    DREAM3DCounterRandom::Philox4x32(counter, key, output);
+    DREAM3D_REQUIRE_EQUAL(output[0], 0xd16cfe09U)
+    DREAM3D_REQUIRE_EQUAL(output[1], 0x94fdccebU)
+    DREAM3D_REQUIRE_EQUAL(output[2], 0x5001e420U)
+    DREAM3D_REQUIRE_EQUAL(output[3], 0x24126ea1U)
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestStreamsAndPositions()
+{
+  const size_t count = 37;
+  DREAM3DCounterRandom rng(12345, 7);
+  std::vector<uint32_t> values(count, 0);
+  for (size_t i = 0; i < count; i++)
+  {
+    values[i] = rng.genrand_int32();
+  }
+  DREAM3D_REQUIRE_EQUAL(rng.getPosition(), count)
+
+  // Jumping into the middle of the stream reproduces the same values
+  for (size_t i = 0; i < count; i++)
+  {
+    DREAM3DCounterRandom jumped(12345, 7);
+    jumped.setPosition(i);
+    DREAM3D_REQUIRE_EQUAL(jumped.getPosition(), i)
+    DREAM3D_REQUIRE_EQUAL(jumped.genrand_int32(), values[i])
+  }
+
+  // A substream with the same id is the same stream; a different id or seed is not
+  DREAM3DCounterRandom same = DREAM3DCounterRandom(12345, 0).substream(7);
+  DREAM3DCounterRandom other = rng.substream(8);
+  DREAM3DCounterRandom reseeded(54321, 7);
+  size_t otherMatches = 0;
+  size_t reseededMatches = 0;
+  for (size_t i = 0; i < count; i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(same.genrand_int32(), values[i])
+    if (other.genrand_int32() == values[i]) { otherMatches++; }
+    if (reseeded.genrand_int32() == values[i]) { reseededMatches++; }
+  }
+  DREAM3D_REQUIRE(otherMatches < 2)
+  DREAM3D_REQUIRE(reseededMatches < 2)
+
+  rng.setStream(7);
+  DREAM3D_REQUIRE_EQUAL(rng.getPosition(), 0)
+  DREAM3D_REQUIRE_EQUAL(rng.genrand_int32(), values[0])
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestRealRanges()
+{
+  DREAM3DCounterRandom rng(42, 0);
+  double sum = 0.0;
+  const int count = 100000;
+  for (int i = 0; i < count; i++)
+  {
+    double value = rng.genrand_res53();
+    DREAM3D_REQUIRE(value >= 0.0 && value < 1.0)
+    sum += value;
+    value = rng.genrand_real3();
+    DREAM3D_REQUIRE(value > 0.0 && value < 1.0)
+  }
+  sum = sum / count;
+  DREAM3D_REQUIRE(sum > 0.49 && sum < 0.51)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestBetaMeans()
+{
+  // One case for each of the BB (both above 1) and BC branches
+  const double shapes[4][2] = { {2.5, 5.0}, {5.0, 2.5}, {0.5, 0.5}, {0.3, 2.0} };
+  const int count = 100000;
+  for (int j = 0; j < 4; j++)
+  {
+    DREAM3DCounterRandom rng(42, j);
+    double sum = 0.0;
+    for (int i = 0; i < count; i++)
+    {
+      double value = rng.genrand_beta(shapes[j][0], shapes[j][1]);
+      DREAM3D_REQUIRE(value >= 0.0 && value <= 1.0)
+      sum += value;
+    }
+    sum = sum / count;
+    double expected = shapes[j][0] / (shapes[j][0] + shapes[j][1]);
+    DREAM3D_REQUIRE(sum > expected - 0.01 && sum < expected + 0.01)
+  }
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  int err = EXIT_SUCCESS;
+
+  DREAM3D_REGISTER_TEST( TestPhiloxKnownAnswers() )
+  DREAM3D_REGISTER_TEST( TestStreamsAndPositions() )
+  DREAM3D_REGISTER_TEST( TestRealRanges() )
+  DREAM3D_REGISTER_TEST( TestBetaMeans() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
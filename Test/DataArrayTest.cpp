@@ -33,6 +33,7 @@
 
 #include <iostream>
 #include <vector>
+#include <math.h>
 
 #include <QtCore/QDir>
 #include <QtCore/QFile>
@@ -40,11 +41,14 @@
 #include <QtCore/QString>
 
 #include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/ThresholdFilterHelper.h"
 #include "DREAM3DLib/DataArrays/IDataArray.h"
 #include "DREAM3DLib/DataArrays/DataArray.hpp"
 #include "DREAM3DLib/DataArrays/NeighborList.hpp"
 #include "DREAM3DLib/DataArrays/ManagedArrayOfArrays.hpp"
 #include "DREAM3DLib/DataArrays/StringDataArray.hpp"
+#include "DREAM3DLib/DataArrays/BitArray.hpp"
+#include "DREAM3DLib/DataArrays/QuantizedFloatArray.hpp"
 
 
 #include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
@@ -218,6 +222,96 @@ void TestcopyTuples()
   __TestcopyTuples<double>();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template<typename T>
+void __TestBulkTuples()
+{
+  int err = 0;
+  QVector<size_t> dims(1, NUM_COMPONENTS_2);
+  typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(NUM_TUPLES_2, dims, "TestBulkTuples");
+  DREAM3D_REQUIRE_EQUAL(array->isAllocated(), true);
+  for(size_t i = 0; i < NUM_TUPLES_2; ++i)
+  {
+    array->setComponent(i, 0, static_cast<T>(i));
+    array->setComponent(i, 1, static_cast<T>(i));
+  }
+
+  // Overlapping range copy behaves like memmove
+  err = array->copyTuples(0, 2, 4);
+  DREAM3D_REQUIRE_EQUAL(0, err);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(1, 1), 1);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(2, 0), 0);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(5, 1), 3);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(6, 0), 6);
+  err = array->copyTuples(8, 4, 3);
+  DREAM3D_REQUIRE_EQUAL(-1, err);
+
+  // Indexed copies are applied in order, so the second pair sees the result of the first
+  QVector<size_t> srcIdxs;
+  QVector<size_t> destIdxs;
+  srcIdxs << 9 << 7 << 3;
+  destIdxs << 7 << 8 << 19;
+  err = array->copyTuples(srcIdxs, destIdxs);
+  DREAM3D_REQUIRE_EQUAL(-1, err);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(7, 0), 9);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(8, 1), 9);
+
+  err = array->fillTuples(0, 2, 5.0);
+  DREAM3D_REQUIRE_EQUAL(0, err);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(0, 0), 5);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(1, 1), 5);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(2, 0), 0);
+  QVector<size_t> fillIdxs;
+  fillIdxs << 3 << 9;
+  err = array->fillTuples(fillIdxs, 1.0);
+  DREAM3D_REQUIRE_EQUAL(0, err);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(3, 1), 1);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(9, 0), 1);
+
+  // Gather then scatter back to different places
+  QVector<size_t> gatherIdxs;
+  gatherIdxs << 9 << 7 << 0;
+  QVector<T> buffer(gatherIdxs.size() * NUM_COMPONENTS_2, 0);
+  err = array->gatherTuples(gatherIdxs, buffer.data());
+  DREAM3D_REQUIRE_EQUAL(0, err);
+  DREAM3D_REQUIRE_EQUAL(buffer[0], 1);
+  DREAM3D_REQUIRE_EQUAL(buffer[3], 9);
+  DREAM3D_REQUIRE_EQUAL(buffer[4], 5);
+  QVector<size_t> scatterIdxs;
+  scatterIdxs << 4 << 5 << 6;
+  err = array->scatterTuples(buffer.data(), scatterIdxs);
+  DREAM3D_REQUIRE_EQUAL(0, err);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(4, 0), 1);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(5, 1), 9);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(6, 0), 5);
+
+  // The IDataArray fallbacks give the same results for arrays that only implement copyTuple
+  IDataArray* iArray = array.get();
+  err = iArray->IDataArray::copyTuples(4, 5, 2);
+  DREAM3D_REQUIRE_EQUAL(0, err);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(5, 0), 1);
+  DREAM3D_REQUIRE_EQUAL(array->getComponent(6, 1), 9);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestBulkTuples()
+{
+  __TestBulkTuples<int8_t>();
+  __TestBulkTuples<uint8_t>();
+  __TestBulkTuples<int16_t>();
+  __TestBulkTuples<uint16_t>();
+  __TestBulkTuples<int32_t>();
+  __TestBulkTuples<uint32_t>();
+  __TestBulkTuples<int64_t>();
+  __TestBulkTuples<uint64_t>();
+  __TestBulkTuples<float>();
+  __TestBulkTuples<double>();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -382,6 +476,20 @@ void __TestEraseElements()
     int err = array->eraseTuples(eraseElements);
     DREAM3D_REQUIRE_EQUAL(err , -100)
 
+    // Indices that are out of order or repeated are rejected and nothing is erased
+    eraseElements.clear();
+    eraseElements.push_back(5);
+    eraseElements.push_back(2);
+    err = array->eraseTuples(eraseElements);
+    DREAM3D_REQUIRE_EQUAL(err , -1)
+    eraseElements.clear();
+    eraseElements.push_back(2);
+    eraseElements.push_back(2);
+    err = array->eraseTuples(eraseElements);
+    DREAM3D_REQUIRE_EQUAL(err , -1)
+    DREAM3D_REQUIRE_EQUAL(array->getNumberOfTuples(), NUM_TUPLES_2)
+    DREAM3D_REQUIRE_EQUAL(array->getComponent(5, 0), 5);
+
         eraseElements.clear();
     err = array->eraseTuples(eraseElements);
     DREAM3D_REQUIRE_EQUAL(err , 0)
@@ -909,6 +1017,54 @@ void _TestDeepCopyDataArray()
       DREAM3D_REQUIRE_EQUAL(cpy, val)
     }
   }
+
+  // The copy shares the buffer until one of the arrays is written to
+  copy = boost::dynamic_pointer_cast<DataArray<T> >(src->deepCopy());
+  DREAM3D_REQUIRE_EQUAL(copy->isSharedBuffer(), true)
+  DREAM3D_REQUIRE_EQUAL(src->isSharedBuffer(), true)
+  DREAM3D_REQUIRE(copy->getConstPointer(0) == src->getConstPointer(0))
+  // Reading values does not detach, asking for a writable pointer does
+  DREAM3D_REQUIRE_EQUAL(copy->getComponent(2, 3), src->getComponent(2, 3))
+  DREAM3D_REQUIRE_EQUAL(copy->isSharedBuffer(), true)
+  copy->getPointer(0);
+  DREAM3D_REQUIRE_EQUAL(copy->isSharedBuffer(), false)
+  copy = boost::dynamic_pointer_cast<DataArray<T> >(src->deepCopy());
+  DREAM3D_REQUIRE_EQUAL(copy->isSharedBuffer(), true)
+  copy->setComponent(2, 3, static_cast<T>(99) );
+  DREAM3D_REQUIRE_EQUAL(copy->isSharedBuffer(), false)
+  DREAM3D_REQUIRE_EQUAL(src->isSharedBuffer(), false)
+  DREAM3D_REQUIRE_EQUAL(copy->getComponent(2, 3), static_cast<T>(99) )
+  DREAM3D_REQUIRE_EQUAL(src->getComponent(2, 3), static_cast<T>(5) )
+
+  // Writing through a raw pointer of the source leaves the copy alone and the copy outlives the source
+  copy = boost::dynamic_pointer_cast<DataArray<T> >(src->deepCopy());
+  T* ptr = src->getPointer(0);
+  ptr[0] = static_cast<T>(42);
+  DREAM3D_REQUIRE_EQUAL(copy->getValue(0), static_cast<T>(0) )
+  typename DataArray<T>::Pointer copy2 = boost::dynamic_pointer_cast<DataArray<T> >(copy->deepCopy());
+  copy = DataArray<T>::NullPointer();
+  DREAM3D_REQUIRE_EQUAL(copy2->getComponent(numTuples - 1, 4), static_cast<T>(numTuples + 3) )
+  DREAM3D_REQUIRE_EQUAL(copy2->resize(numTuples * 2), 1)
+  DREAM3D_REQUIRE_EQUAL(copy2->getComponent(1, 1), static_cast<T>(2) )
+
+  // A pointer fetched for writing before the copy is made keeps writing to this array only
+  src = DataArray<T>::CreateArray(numTuples, cDims, name, true);
+  src->initializeWithValue(static_cast<T>(7));
+  ptr = src->getPointer(0);
+  copy = boost::dynamic_pointer_cast<DataArray<T> >(src->deepCopy());
+  DREAM3D_REQUIRE_EQUAL(copy->isSharedBuffer(), false)
+  DREAM3D_REQUIRE_EQUAL(src->isSharedBuffer(), false)
+  ptr[3] = static_cast<T>(11);
+  DREAM3D_REQUIRE_EQUAL(src->getValue(3), static_cast<T>(11) )
+  DREAM3D_REQUIRE_EQUAL(copy->getValue(3), static_cast<T>(7) )
+  // Once the pointers are given up the next copy shares the buffer again
+  src->invalidateWritePointers();
+  copy = boost::dynamic_pointer_cast<DataArray<T> >(src->deepCopy());
+  DREAM3D_REQUIRE_EQUAL(copy->isSharedBuffer(), true)
+  DREAM3D_REQUIRE_EQUAL(copy->getValue(3), static_cast<T>(11) )
+  // Reading through getConstPointer keeps it shared
+  DREAM3D_REQUIRE_EQUAL(src->getConstPointer(0)[3], static_cast<T>(11) )
+  DREAM3D_REQUIRE_EQUAL(src->isSharedBuffer(), true)
 }
 
 // -----------------------------------------------------------------------------
@@ -929,6 +1085,161 @@ void TestDeepCopyArray()
 
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestBitArray()
+{
+  size_t numTuples = 150;
+  BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(numTuples, "Mask");
+  size_t numTrue = 0;
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    bool value = (i % 3 == 0 || i == 64 || i == 149);
+    boolArray->setValue(i, value);
+    if (value) { numTrue++; }
+  }
+
+  // Packing and unpacking round trips
+  BitArray::Pointer bits = BitArray::FromBoolArray(boolArray.get());
+  DREAM3D_REQUIRE_EQUAL(bits->getNumberOfTuples(), numTuples)
+  DREAM3D_REQUIRE_EQUAL(bits->getNumberOfWords(), 3)
+  DREAM3D_REQUIRE_EQUAL(bits->countTrue(), numTrue)
+  // Single values are not byte addressable
+  DREAM3D_REQUIRE_NULL_POINTER(bits->getVoidPointer(0))
+  BoolArrayType::Pointer unpacked = bits->toBoolArray();
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(bits->getValue(i), boolArray->getValue(i))
+    DREAM3D_REQUIRE_EQUAL(unpacked->getValue(i), boolArray->getValue(i))
+  }
+
+  // Inverting keeps the padding bits of the last word clear
+  bits->invert();
+  DREAM3D_REQUIRE_EQUAL(bits->countTrue(), numTuples - numTrue)
+  bits->invert();
+
+  // Shifting reads value i + offset and shifts in false past either end
+  BitArray::Pointer shifted = BitArray::CreateArray(numTuples, "Shifted");
+  int64_t offsets[4] = { 1, -1, 67, -130 };
+  for(int o = 0; o < 4; o++)
+  {
+    shifted->assignShifted(bits.get(), offsets[o]);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int64_t src = static_cast<int64_t>(i) + offsets[o];
+      bool expected = (src >= 0 && src < static_cast<int64_t>(numTuples)) ? boolArray->getValue(src) : false;
+      DREAM3D_REQUIRE_EQUAL(shifted->getValue(i), expected)
+    }
+  }
+
+  // AND with a shifted copy
+  shifted->assignShifted(bits.get(), 3);
+  shifted->andWith(bits.get());
+  DREAM3D_REQUIRE_EQUAL(shifted->countTrue(), 49)
+
+  // Erasing Tuples compacts the remaining bits. The indices have to be strictly increasing.
+  QVector<size_t> eraseList;
+  eraseList << 0 << 64 << 1;
+  int err = bits->eraseTuples(eraseList);
+  DREAM3D_REQUIRE_EQUAL(err, -1)
+  DREAM3D_REQUIRE_EQUAL(bits->getNumberOfTuples(), numTuples)
+  eraseList.clear();
+  eraseList << 0 << 1 << 63 << 64 << 100;
+  err = bits->eraseTuples(eraseList);
+  DREAM3D_REQUIRE_EQUAL(err, 0)
+  DREAM3D_REQUIRE_EQUAL(bits->getNumberOfTuples(), numTuples - 5)
+  DREAM3D_REQUIRE_EQUAL(bits->getValue(0), false)
+  DREAM3D_REQUIRE_EQUAL(bits->getValue(1), true)
+  DREAM3D_REQUIRE_EQUAL(bits->getValue(61), false)
+  DREAM3D_REQUIRE_EQUAL(bits->getValue(62), true)
+  DREAM3D_REQUIRE_EQUAL(bits->getValue(144), true)
+  DREAM3D_REQUIRE_EQUAL(bits->countTrue(), numTrue - 3)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestQuantizedFloatArray()
+{
+  // Half precision encodings, including rounding to even, overflow and subnormals
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::FloatToHalf(1.0f), 0x3C00)
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::FloatToHalf(-2.0f), 0xC000)
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::FloatToHalf(0.1f), 0x2E66)
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::FloatToHalf(65504.0f), 0x7BFF)
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::FloatToHalf(65520.0f), 0x7C00)
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::FloatToHalf(1.0f / 16777216.0f), 0x0001)
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::FloatToHalf(2049.0f), 0x6800)
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::FloatToHalf(2051.0f), 0x6802)
+  for(uint32_t h = 0; h < 0x7C00; h++)
+  {
+    DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::FloatToHalf(QuantizedFloatArray::HalfToFloat(h)), h)
+  }
+
+  // Fixed point encodings
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::UnitFixedToFloat(QuantizedFloatArray::FloatToUnitFixed(1.0f)), 1.0f)
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::UnitFixedToFloat(QuantizedFloatArray::FloatToUnitFixed(-1.0f)), -1.0f)
+  DREAM3D_REQUIRE_EQUAL(QuantizedFloatArray::UnitFixedToFloat(QuantizedFloatArray::FloatToUnitFixed(0.0f)), 0.0f)
+  DREAM3D_REQUIRE_EQUAL(static_cast<int16_t>(QuantizedFloatArray::FloatToUnitFixed(0.5f)), 16384)
+  DREAM3D_REQUIRE_EQUAL(static_cast<int16_t>(QuantizedFloatArray::FloatToUnitFixed(-3.0f)), -32767)
+
+  // Whole arrays
+  QVector<size_t> cDims(1, 4);
+  FloatArrayType::Pointer quats = FloatArrayType::CreateArray(10, cDims, "Quats");
+  for(size_t i = 0; i < quats->getSize(); i++)
+  {
+    quats->setValue(i, sinf(0.3f * i));
+  }
+  QuantizedFloatArray::Pointer compact = QuantizedFloatArray::FromFloatArray(quats.get(), QuantizedFloatArray::UnitFixed16);
+  DREAM3D_REQUIRE_EQUAL(compact->getNumberOfTuples(), 10)
+  DREAM3D_REQUIRE_EQUAL(compact->getNumberOfComponents(), 4)
+  DREAM3D_REQUIRE_EQUAL(compact->getTypeSize(), 2)
+  for(size_t i = 0; i < quats->getSize(); i++)
+  {
+    DREAM3D_REQUIRE(fabs(compact->getValue(i) - quats->getValue(i)) <= 0.5f / 32767.0f + 1.0e-7f)
+  }
+
+  QVector<size_t> eraseList;
+  eraseList << 0 << 3 << 4 << 9;
+  int err = compact->eraseTuples(eraseList);
+  DREAM3D_REQUIRE_EQUAL(err, 0)
+  DREAM3D_REQUIRE_EQUAL(compact->getNumberOfTuples(), 6)
+  float tuple[4];
+  compact->getTuple(0, tuple);
+  DREAM3D_REQUIRE_EQUAL(tuple[0], QuantizedFloatArray::UnitFixedToFloat(QuantizedFloatArray::FloatToUnitFixed(quats->getValue(4))))
+  compact->getTuple(5, tuple);
+  DREAM3D_REQUIRE_EQUAL(tuple[3], QuantizedFloatArray::UnitFixedToFloat(QuantizedFloatArray::FloatToUnitFixed(quats->getValue(35))))
+
+  FloatArrayType::Pointer expanded = compact->toFloatArray();
+  DREAM3D_REQUIRE_EQUAL(expanded->getNumberOfTuples(), 6)
+  DREAM3D_REQUIRE_EQUAL(expanded->getValue(23), tuple[3])
+
+  // Thresholding a compact array matches thresholding its decoded values, without expanding it
+  FloatArrayType::Pointer ci = FloatArrayType::CreateArray(150, "Confidence Index");
+  for(size_t i = 0; i < ci->getSize(); i++)
+  {
+    ci->setValue(i, 0.5f + 0.5f * sinf(0.7f * i));
+  }
+  QuantizedFloatArray::Pointer compactCi = QuantizedFloatArray::FromFloatArray(ci.get(), QuantizedFloatArray::HalfFloat);
+  FloatArrayType::Pointer decodedCi = compactCi->toFloatArray();
+  BitArray::Pointer compactMask = BitArray::CreateArray(150, "CompactMask");
+  BitArray::Pointer floatMask = BitArray::CreateArray(150, "FloatMask");
+  BoolArrayType::Pointer boolMask = BoolArrayType::CreateArray(150, "BoolMask");
+  {
+    ThresholdFilterHelper compactFilter(DREAM3D::Comparison::Operator_GreaterThan, 0.1, compactMask.get());
+    DREAM3D_REQUIRE_EQUAL(compactFilter.execute(compactCi.get(), compactMask.get()), 1)
+    ThresholdFilterHelper floatFilter(DREAM3D::Comparison::Operator_GreaterThan, 0.1, floatMask.get());
+    DREAM3D_REQUIRE_EQUAL(floatFilter.execute(decodedCi.get(), floatMask.get()), 1)
+    ThresholdFilterHelper boolFilter(DREAM3D::Comparison::Operator_GreaterThan, 0.1, boolMask.get());
+    DREAM3D_REQUIRE_EQUAL(boolFilter.execute(compactCi.get(), boolMask.get()), 1)
+  }
+  for(size_t i = 0; i < 150; i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(compactMask->getValue(i), floatMask->getValue(i))
+    DREAM3D_REQUIRE_EQUAL(boolMask->getValue(i), floatMask->getValue(i))
+  }
+}
+
 // -----------------------------------------------------------------------------
 //  Use unit test framework
 // -----------------------------------------------------------------------------
@@ -948,7 +1259,10 @@ int main(int argc, char** argv)
       DREAM3D_REGISTER_TEST( TestDataArray() )
       DREAM3D_REGISTER_TEST( TestEraseElements() )
       DREAM3D_REGISTER_TEST( TestcopyTuples() )
+      DREAM3D_REGISTER_TEST( TestBulkTuples() )
       DREAM3D_REGISTER_TEST( TestDeepCopyArray() )
+      DREAM3D_REGISTER_TEST( TestBitArray() )
+      DREAM3D_REGISTER_TEST( TestQuantizedFloatArray() )
       DREAM3D_REGISTER_TEST( TestNeighborList() )
       DREAM3D_REGISTER_TEST( TestReorderCopy() )
 
@@ -603,6 +603,51 @@ void TestInsertDelete()
 }
 
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestRemoveInactiveObjects()
+{
+  QVector<size_t> tupleDims(1, 6);
+  AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tupleDims, "Features", DREAM3D::AttributeMatrixType::CellFeature);
+  QVector<size_t> cDims(1, 2);
+  FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(6, cDims, "Centroids");
+  Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(6, "Phases");
+  for(size_t i = 0; i < 6; i++)
+  {
+    centroids->setComponent(i, 0, static_cast<float>(i));
+    centroids->setComponent(i, 1, static_cast<float>(10 * i));
+    phases->setValue(i, static_cast<int32_t>(i));
+  }
+  attrMat->addAttributeArray(centroids->getName(), centroids);
+  attrMat->addAttributeArray(phases->getName(), phases);
+
+  Int32ArrayType::Pointer ids = Int32ArrayType::CreateArray(8, "FeatureIds");
+  int32_t idValues[8] = { 0, 1, 2, 3, 4, 5, 5, 2 };
+  for(size_t i = 0; i < 8; i++)
+  {
+    ids->setValue(i, idValues[i]);
+  }
+
+  QVector<bool> activeObjects(6, true);
+  activeObjects[2] = false;
+  activeObjects[3] = false;
+  bool good = attrMat->removeInactiveObjects(activeObjects, ids);
+  DREAM3D_REQUIRE_EQUAL(good, true)
+  DREAM3D_REQUIRE_EQUAL(attrMat->getNumTuples(), 4)
+  DREAM3D_REQUIRE_EQUAL(centroids->getNumberOfTuples(), 4)
+  DREAM3D_REQUIRE_EQUAL(phases->getValue(2), 4)
+  DREAM3D_REQUIRE_EQUAL(phases->getValue(3), 5)
+  DREAM3D_REQUIRE_EQUAL(centroids->getComponent(2, 0), 4.0f)
+  DREAM3D_REQUIRE_EQUAL(centroids->getComponent(3, 1), 50.0f)
+
+  int32_t newIdValues[8] = { 0, 1, 0, 0, 2, 3, 3, 0 };
+  for(size_t i = 0; i < 8; i++)
+  {
+    DREAM3D_REQUIRE_EQUAL(ids->getValue(i), newIdValues[i])
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -913,6 +958,7 @@ int main(int argc, char** argv)
 
       DREAM3D_REGISTER_TEST( TestDataContainerReader() )
     DREAM3D_REGISTER_TEST(TestDataArrayPath() )
+      DREAM3D_REGISTER_TEST( TestRemoveInactiveObjects() )
 
     #if REMOVE_TEST_FILES
       //DREAM3D_REGISTER_TEST( RemoveTestFiles() )
@@ -0,0 +1,116 @@
+/* ============================================================================
+ * Copyright (c) 2014, Michael A. Jackson (BlueQuartz Software)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of Michael A. Jackson nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <vector>
+
+#include "DREAM3DLib/DREAM3DLib.h"
+#include "DREAM3DLib/Common/DistributionSampler.hpp"
+#include "DREAM3DLib/Utilities/DREAM3DRandom.h"
+
+#include "DREAM3DLib/Utilities/UnitTestSupport.hpp"
+
+// -----------------------------------------------------------------------------
+// The linear scan the sampler replaces
+// -----------------------------------------------------------------------------
+int LinearPick(const std::vector<float>& densities, float random)
+{
+  int choose = 0;
+  float totaldensity = 0;
+  for (size_t j = 0; j < densities.size(); j++)
+  {
+    float density = densities[j];
+    float td1 = totaldensity;
+    totaldensity = totaldensity + density;
+    if (random < totaldensity && random >= td1) { choose = static_cast<int> (j); break; }
+  }
+  return choose;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestMatchesLinearScan()
+{
+  DREAM3D_RANDOMNG_NEW()
+  const size_t numBins = 5832;
+  std::vector<float> densities(numBins, 0.0f);
+  float total = 0.0f;
+  for (size_t j = 0; j < numBins; j++)
+  {
+    // Leave some empty bins, they must never be picked
+    if (j % 7 != 0) { densities[j] = static_cast<float>(rg.genrand_res53()); }
+    total += densities[j];
+  }
+  for (size_t j = 0; j < numBins; j++)
+  {
+    densities[j] = densities[j] / total;
+  }
+
+  DistributionSampler<float> sampler(&(densities.front()), numBins);
+  DREAM3D_REQUIRE_EQUAL(sampler.getNumberOfBins(), numBins)
+  for (int i = 0; i < 100000; i++)
+  {
+    float random = static_cast<float>(rg.genrand_res53());
+    int choose = sampler.pick(random);
+    DREAM3D_REQUIRE_EQUAL(choose, LinearPick(densities, random))
+  }
+  DREAM3D_REQUIRE_EQUAL(sampler.pick(0.0f), 1)
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestUnnormalizedDensities()
+{
+  float densities[4] = { 0.1f, 0.0f, 0.2f, 0.1f };
+  DistributionSampler<float> sampler(densities, 4);
+  DREAM3D_REQUIRE_EQUAL(sampler.pick(0.05f), 0)
+  DREAM3D_REQUIRE_EQUAL(sampler.pick(0.15f), 2)
+  DREAM3D_REQUIRE_EQUAL(sampler.pick(0.35f), 3)
+  // Past the total density the scan falls back to the first bin
+  DREAM3D_REQUIRE_EQUAL(sampler.pick(0.9f), 0)
+}
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  int err = EXIT_SUCCESS;
+
+  DREAM3D_REGISTER_TEST( TestMatchesLinearScan() )
+  DREAM3D_REGISTER_TEST( TestUnnormalizedDensities() )
+
+  PRINT_TEST_SUMMARY();
+  return err;
+}
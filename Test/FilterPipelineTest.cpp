@@ -46,6 +46,8 @@
 #include "DREAM3DLib/Common/Observer.h"
 #include "DREAM3DLib/Common/FilterPipeline.h"
 #include "DREAM3DLib/Common/FilterManager.h"
+#include "DREAM3DLib/Common/PerformanceMonitor.h"
+#include "DREAM3DLib/DataArrays/DataArray.hpp"
 #include "DREAM3DLib/Plugin/DREAM3DPluginInterface.h"
 #include "DREAM3DLib/TestFilters/GenericExample.h"
 #include "DREAM3DLib/TestFilters/ArraySelectionExample.h"
@@ -146,6 +148,63 @@ void TestPipelinePushPop()
 }
 
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TestPerformanceMonitor()
+{
+  PerformanceMonitor::Pointer monitor = PerformanceMonitor::New();
+  DREAM3D_REQUIRE_EQUAL(0, monitor->getRecords().size());
+
+  // Allocating a DataArray must show up in the byte counter
+  PerformanceMonitor::Snapshot start = PerformanceMonitor::TakeSnapshot();
+  FloatArrayType::Pointer floats = FloatArrayType::CreateArray(1000, "Floats");
+  floats->resize(2000);
+  PerformanceMonitor::Record record = PerformanceMonitor::Difference(start, PerformanceMonitor::TakeSnapshot());
+  DREAM3D_REQUIRE_EQUAL(record.BytesAllocated, static_cast<qint64>(3000 * sizeof(float)));
+  DREAM3D_REQUIRE(record.WallMillis >= 0);
+
+  record.FilterIndex = 0;
+  record.FilterClassName = "Filt0";
+  record.FilterHumanLabel = "Filter, Zero";
+  monitor->addRecord(record);
+
+  // A phase only records itself while a monitor is active
+  {
+    PerformanceMonitor::ScopedPhase phase(NULL, "Inactive");
+  }
+  DREAM3D_REQUIRE_EQUAL(1, monitor->getRecords().size());
+
+  PerformanceMonitor::SetActiveMonitor(monitor.get());
+  monitor->setCurrentFilterIndex(1);
+  {
+    PerformanceMonitor::ScopedPhase phase(NULL, "Active");
+  }
+  PerformanceMonitor::SetActiveMonitor(NULL);
+  DREAM3D_REQUIRE_EQUAL(2, monitor->getRecords().size());
+  DREAM3D_REQUIRE_EQUAL(1, monitor->getRecords().at(1).FilterIndex);
+  DREAM3D_REQUIRE(monitor->getRecords().at(1).Phase.compare("Active") == 0);
+
+  QString csv;
+  QTextStream csvOut(&csv);
+  monitor->writeCsv(csvOut);
+  csvOut.flush();
+  QStringList lines = csv.split('\n', QString::SkipEmptyParts);
+  DREAM3D_REQUIRE_EQUAL(3, lines.size());
+  DREAM3D_REQUIRE(lines[1].startsWith("0,Filt0,\"Filter, Zero\",,") == true);
+
+  QString json;
+  QTextStream jsonOut(&json);
+  monitor->writeJson(jsonOut);
+  jsonOut.flush();
+  DREAM3D_REQUIRE(json.contains("\"Phase\": \"Active\"") == true);
+
+  // Destroying the active monitor must not leave a dangling pointer behind
+  PerformanceMonitor::SetActiveMonitor(monitor.get());
+  monitor = PerformanceMonitor::NullPointer();
+  DREAM3D_REQUIRE(NULL == PerformanceMonitor::GetActiveMonitor());
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -283,6 +342,7 @@ int main(int argc, char** argv)
   DREAM3D_REGISTER_TEST( loadFilterPlugins() );
 
   DREAM3D_REGISTER_TEST( TestPipelinePushPop() );
+  DREAM3D_REGISTER_TEST( TestPerformanceMonitor() );
 
 #if REMOVE_TEST_FILES
 //  DREAM3D_REGISTER_TEST( RemoveTestFiles() );
@@ -68,6 +68,7 @@
  * writeStringAttributes - DONE
  * writeScalarAttribute - DONE
  * readPointerDataset - DONE
+ * readPointerDatasetRegion - DONE
  * readVectorDataset - DONE
  * readScalarDataset - DONE
  * readStringDataset - DONE
@@ -567,6 +568,38 @@ herr_t testReadVectorDataset(hid_t file_id)
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template<typename T>
+herr_t testReadPointerDatasetRegion(hid_t file_id)
+{
+  T value = 0x0;
+  herr_t err = 1;
+
+  QString dsetName = QH5Lite::HDFTypeForPrimitiveAsStr(value);
+  qDebug() << "Running testReadPointerDatasetRegion <" + dsetName + "> ... ";
+  dsetName = "VectorDataset<" + dsetName + ">";
+
+  // Treat the DIM0 values of the vector dataset as a grid 2 values wide and read the second column
+  hsize_t rowLength = 2;
+  hsize_t numRows = DIM0 / rowLength;
+  QVector<T> data(numRows, 0);
+  err = QH5Lite::readPointerDatasetRegion(file_id, dsetName, rowLength, 1, 1, 0, numRows, data.data());
+  DREAM3D_REQUIRE(err >= 0);
+  for (hsize_t j = 0; j < numRows; ++j)
+  {
+    DREAM3D_REQUIRE_EQUAL(data[j], static_cast<T>( (j * rowLength + 1) * 5) );
+  }
+
+  // A region wider than the rows is an error
+  err = QH5Lite::readPointerDatasetRegion(file_id, dsetName, rowLength, 1, 2, 0, 1, data.data());
+  DREAM3D_REQUIRE(err < 0);
+
+  qDebug() << " Passed" << "\n";
+  return 1;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1152,6 +1185,13 @@ void QH5LiteTest()
   DREAM3D_REQUIRE ( testReadVectorDataset<uint64_t>(file_id) >= 0);
   DREAM3D_REQUIRE ( testReadVectorDataset<float32>(file_id) >= 0);
   DREAM3D_REQUIRE ( testReadVectorDataset<float64>(file_id) >= 0);
+
+  DREAM3D_REQUIRE ( testReadPointerDatasetRegion<int8_t>(file_id) >= 0);
+  DREAM3D_REQUIRE ( testReadPointerDatasetRegion<uint16_t>(file_id) >= 0);
+  DREAM3D_REQUIRE ( testReadPointerDatasetRegion<int32_t>(file_id) >= 0);
+  DREAM3D_REQUIRE ( testReadPointerDatasetRegion<uint64_t>(file_id) >= 0);
+  DREAM3D_REQUIRE ( testReadPointerDatasetRegion<float32>(file_id) >= 0);
+  DREAM3D_REQUIRE ( testReadPointerDatasetRegion<float64>(file_id) >= 0);
 //
   DREAM3D_REQUIRE ( testReadScalarDataset<int8_t>(file_id) >= 0);
   DREAM3D_REQUIRE ( testReadScalarDataset<uint8_t>(file_id) >= 0);
@@ -111,6 +111,7 @@ int main (int argc, char  *argv[])
 {
 
   QString pipelineFile;
+  QString timingFile;
   try
   {
     // Handle program options passed on command line.
@@ -119,6 +120,9 @@ int main (int argc, char  *argv[])
     TCLAP::ValueArg<std::string> pipelineFileArg( "p", "pipeline", "Pipeline File", true, "", "Pipeline Input File (*.txt or *.ini)");
     cmd.add(pipelineFileArg);
 
+    TCLAP::ValueArg<std::string> timingFileArg( "t", "timing", "Write the time and memory used by each filter to this file", false, "", "Timing Output File (*.csv or *.json)");
+    cmd.add(timingFileArg);
+
     // Parse the argv array.
     cmd.parse(argc, argv);
     if (argc == 1)
@@ -128,6 +132,7 @@ int main (int argc, char  *argv[])
     }
     // Extract the file path passed in by the user.
     pipelineFile = QString::fromStdString(pipelineFileArg.getValue());
+    timingFile = QString::fromStdString(timingFileArg.getValue());
   }
   catch (TCLAP::ArgException &e) // catch any exceptions
   {
@@ -181,6 +186,10 @@ int main (int argc, char  *argv[])
   }
   // Now actually execute the pipeline
   pipeline->execute();
+  if (timingFile.isEmpty() == false && pipeline->getPerformanceMonitor()->writeFile(timingFile) < 0)
+  {
+    std::cout << "Could not write the timing file '" << timingFile.toStdString() << "'" << std::endl;
+  }
   err = pipeline->getErrorCondition();
   if (err < 0)
   {